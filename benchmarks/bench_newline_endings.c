@@ -0,0 +1,96 @@
+/**
+ * @file bench_newline_endings.c
+ * @brief Benchmark: newline counting throughput by line-ending style
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Measures strider_count_newlines_simd() on LF-only, CRLF-only and
+ * mixed-ending buffers for every backend supported on this CPU.
+ * The CRLF and mixed rows should be within noise of the LF row.
+ *
+ * Usage: bench_newline_endings [size_mb] [iterations]
+ */
+
+#include "strider/dispatch.h"
+#include "strider/parsers/newline.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LINE_LENGTH 80
+
+typedef enum { ENDING_LF, ENDING_CRLF, ENDING_MIXED } ending_t;
+
+static const char *const ending_names[] = {"LF", "CRLF", "mixed"};
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+/* Fill buffer with LINE_LENGTH-byte lines using the given ending style */
+static void fill_buffer(char *buffer, size_t size, ending_t ending) {
+    size_t line = 0;
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (char) ('a' + (i % 26));
+    }
+
+    for (size_t end = LINE_LENGTH - 1; end < size; end += LINE_LENGTH, line++) {
+        ending_t style = (ending == ENDING_MIXED) ? (ending_t) (line % 2) : ending;
+
+        if (style == ENDING_CRLF) {
+            buffer[end - 1] = '\r';
+        }
+        buffer[end] = '\n';
+    }
+}
+
+int main(int argc, char **argv) {
+    size_t size_mb = (argc > 1) ? (size_t) strtoul(argv[1], NULL, 10) : 64;
+    int iterations = (argc > 2) ? atoi(argv[2]) : 10;
+    size_t size = size_mb * 1024 * 1024;
+
+    char *buffer = (char *) strider_aligned_alloc(64, size);
+    if (!buffer || iterations <= 0) {
+        fprintf(stderr, "usage: %s [size_mb] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    printf("%-10s %-6s %10s %12s\n", "backend", "ending", "GB/s", "newlines");
+
+    for (int e = ENDING_LF; e <= ENDING_MIXED; e++) {
+        fill_buffer(buffer, size, (ending_t) e);
+        size_t expected = strider_count_newlines(buffer, size);
+
+        for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+            if (!strider_backend_is_supported((strider_backend_t) b)) {
+                continue;
+            }
+            strider_set_backend((strider_backend_t) b);
+
+            size_t count = strider_count_newlines_simd(buffer, size); /* warm-up */
+            double best = 0.0;
+
+            for (int i = 0; i < iterations; i++) {
+                double start = now_seconds();
+                count = strider_count_newlines_simd(buffer, size);
+                double elapsed = now_seconds() - start;
+
+                if (best == 0.0 || elapsed < best) {
+                    best = elapsed;
+                }
+            }
+
+            printf("%-10s %-6s %10.2f %12zu%s\n", strider_backend_name((strider_backend_t) b),
+                   ending_names[e], (double) size / best / 1e9, count,
+                   count == expected ? "" : "  MISMATCH");
+        }
+    }
+
+    strider_set_backend(STRIDER_BACKEND_AUTO);
+    strider_aligned_free(buffer);
+    return 0;
+}
@@ -0,0 +1,870 @@
+/**
+ * @file strider_bench.c
+ * @brief Benchmark suite: throughput of every kernel across sizes,
+ *        misalignments and match densities
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Every case runs one kernel implementation (scalar reference, the
+ * dispatched SIMD entry point on each supported backend, or libc where
+ * it has an equivalent) over a synthetic buffer. The parameters are:
+ *
+ * - size: buffer sizes from --min-size to --max-size, in steps of 4x
+ * - offset: misalignment of the buffer start from a 64-byte boundary
+ * - gap: bytes between matches (newlines, search targets or separators);
+ *   0 means no match at all
+ *
+ * Text scans also run over multilingual UTF-8 lines (scan_text_utf8),
+ * since ASCII-only input takes the validator's fast path.
+ *
+ * Each case is timed in batches sized to run for at least --min-time
+ * seconds; the fastest of --repeats batches is reported as GB/s and, on
+ * x86, TSC cycles per byte. Results of implementations of the same
+ * kernel are cross-checked and mismatches fail the run.
+ *
+ * Usage: strider_bench [--json FILE] [--filter TEXT] [--backend NAME]
+ *                      [--min-size N] [--max-size N] [--offsets LIST]
+ *                      [--gaps LIST] [--min-time SECONDS] [--repeats N]
+ *
+ * Sizes accept K, M and G suffixes (powers of 1024); lists are comma
+ * separated. --json - writes the JSON to stdout instead of the table.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* memmem */
+#endif
+
+#include "strider/config.h"
+#include "strider/dispatch.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/level.h"
+#include "strider/parsers/logs.h"
+#include "strider/parsers/memchr.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/strchr.h"
+#include "strider/parsers/strstr.h"
+#include "strider/parsers/text_scan.h"
+#include "strider/parsers/timestamp.h"
+#include "strider/parsers/tokenize.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define BENCH_HAS_TSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#    define BENCH_HAS_TSC 1
+#endif
+
+#define MAX_LIST 16
+
+/* Records per strider_parse_logs() call */
+#define LOG_BATCH 4096
+
+/* Fields per line for the tokenizer cases */
+#define MAX_FIELDS 64
+
+/* ========================================================================
+ * Options
+ * ======================================================================== */
+
+typedef struct {
+    size_t min_size;
+    size_t max_size;
+    size_t offsets[MAX_LIST];
+    size_t num_offsets;
+    size_t gaps[MAX_LIST];
+    size_t num_gaps;
+    double min_time;
+    int repeats;
+    const char *filter;
+    const char *json_path;
+    int backend; /* -1 for every supported backend */
+} options_t;
+
+/* Parse "64", "4K", "16M" or "1G" */
+static bool parse_size(const char *text, size_t *out) {
+    char *end;
+    unsigned long long value = strtoull(text, &end, 10);
+
+    if (end == text) {
+        return false;
+    }
+    switch (*end) {
+        case 'G':
+        case 'g':
+            value <<= 10;
+            /* fall through */
+        case 'M':
+        case 'm':
+            value <<= 10;
+            /* fall through */
+        case 'K':
+        case 'k':
+            value <<= 10;
+            end++;
+            break;
+        default:
+            break;
+    }
+    if (*end != '\0' || value > SIZE_MAX / 2) {
+        return false;
+    }
+    *out = (size_t) value;
+    return true;
+}
+
+static bool parse_list(const char *text, size_t *values, size_t *count) {
+    char copy[256];
+    *count = 0;
+
+    if (strlen(text) >= sizeof(copy)) {
+        return false;
+    }
+    strcpy(copy, text);
+    for (char *item = strtok(copy, ","); item; item = strtok(NULL, ",")) {
+        if (*count == MAX_LIST || !parse_size(item, &values[*count])) {
+            return false;
+        }
+        (*count)++;
+    }
+    return *count > 0;
+}
+
+static int usage(const char *program) {
+    fprintf(stderr,
+            "usage: %s [--json FILE] [--filter TEXT] [--backend NAME] [--min-size N]\n"
+            "       [--max-size N] [--offsets LIST] [--gaps LIST] [--min-time SECONDS]\n"
+            "       [--repeats N]\n",
+            program);
+    return 2;
+}
+
+static bool parse_options(int argc, char **argv, options_t *opt) {
+    static const size_t default_offsets[] = {0, 1};
+    static const size_t default_gaps[] = {0, 64, 1024};
+
+    opt->min_size = 64;
+    opt->max_size = (size_t) 16 << 20;
+    memcpy(opt->offsets, default_offsets, sizeof(default_offsets));
+    opt->num_offsets = sizeof(default_offsets) / sizeof(default_offsets[0]);
+    memcpy(opt->gaps, default_gaps, sizeof(default_gaps));
+    opt->num_gaps = sizeof(default_gaps) / sizeof(default_gaps[0]);
+    opt->min_time = 0.01;
+    opt->repeats = 3;
+    opt->filter = NULL;
+    opt->json_path = NULL;
+    opt->backend = -1;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        bool ok = value != NULL;
+
+        if (!ok) {
+            return false;
+        } else if (strcmp(arg, "--json") == 0) {
+            opt->json_path = value;
+        } else if (strcmp(arg, "--filter") == 0) {
+            opt->filter = value;
+        } else if (strcmp(arg, "--backend") == 0) {
+            strider_backend_t backend;
+            ok = strider_backend_from_name(value, &backend) == 0;
+            opt->backend = (int) backend;
+        } else if (strcmp(arg, "--min-size") == 0) {
+            ok = parse_size(value, &opt->min_size) && opt->min_size > 0;
+        } else if (strcmp(arg, "--max-size") == 0) {
+            ok = parse_size(value, &opt->max_size);
+        } else if (strcmp(arg, "--offsets") == 0) {
+            ok = parse_list(value, opt->offsets, &opt->num_offsets);
+        } else if (strcmp(arg, "--gaps") == 0) {
+            ok = parse_list(value, opt->gaps, &opt->num_gaps);
+        } else if (strcmp(arg, "--min-time") == 0) {
+            opt->min_time = atof(value);
+            ok = opt->min_time > 0.0;
+        } else if (strcmp(arg, "--repeats") == 0) {
+            opt->repeats = atoi(value);
+            ok = opt->repeats > 0;
+        } else {
+            ok = false;
+        }
+        if (!ok) {
+            return false;
+        }
+        i++;
+    }
+
+    for (size_t i = 0; i < opt->num_offsets; i++) {
+        if (opt->offsets[i] >= 64) {
+            return false;
+        }
+    }
+    return opt->min_size <= opt->max_size;
+}
+
+/* ========================================================================
+ * Inputs
+ * ======================================================================== */
+
+typedef enum {
+    FILL_TOKEN, /* Filler text with a token every gap bytes */
+    FILL_LOG,   /* Log lines of gap bytes */
+    FILL_UTF8,  /* Lines of gap bytes of 2-, 3- and 4-byte UTF-8 characters */
+} fill_t;
+
+/**
+ * @brief Input and scratch space shared by all cases
+ */
+typedef struct {
+    const char *data;
+    size_t size;
+    size_t *positions; /* Newline positions of data (line-based cases) */
+    size_t lines;
+    int64_t *timestamps;
+    uint64_t *bitmap;
+    strider_needle_t needle;
+    strider_byteset_t separators;
+    strider_tokenizer_t tokenizer;
+    strider_level_set_t levels;
+    strider_log_format_t log_format;
+    strider_log_columns_t columns;
+    strider_buffer_view_t fields[MAX_FIELDS];
+} bench_input_t;
+
+/* The token searched for by the search cases */
+#define SEARCH_TOKEN "MATCH"
+
+/* Whole characters of a multilingual sentence, padded with spaces to size bytes */
+static void fill_utf8_line(char *data, size_t size) {
+    static const char sentence[] = "caf\xc3\xa9 \xe6\x9d\xb1\xe4\xba\xac \xd0\xb7\xd0\xb0\xd0\xb4"
+                                   "\xd0\xb5\xd1\x80\xd0\xb6\xd0\xba\xd0\xb0 12 \xe2\x82\xac "
+                                   "\xf0\x9f\x98\x80 ";
+    size_t i = 0;
+    size_t next = 0;
+
+    while (i < size) {
+        const uint8_t lead = (uint8_t) sentence[next];
+        const size_t length = lead < 0x80 ? 1 : lead < 0xE0 ? 2 : lead < 0xF0 ? 3 : 4;
+
+        if (length > size - i) {
+            memset(data + i, ' ', size - i);
+            return;
+        }
+        memcpy(data + i, sentence + next, length);
+        i += length;
+        next = (next + length) % (sizeof(sentence) - 1);
+    }
+}
+
+static void fill_text(char *data, size_t size, size_t gap, fill_t fill) {
+    static const char log_line[] = "2025-12-31T23:59:59.123Z INFO worker=7 request id=42 "
+                                   "path=/api/v1/items status=200 took=12ms";
+
+    if (fill == FILL_UTF8) {
+        for (size_t start = 0; start < size; start += gap ? gap : size) {
+            const size_t room = gap == 0 || size - start < gap ? size - start : gap;
+
+            fill_utf8_line(data + start, gap ? room - 1 : room);
+            if (gap) {
+                data[start + room - 1] = '\n';
+            }
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (char) ('a' + i % 23); /* No 'x'-'z': never part of a token */
+    }
+    if (gap == 0) {
+        return;
+    }
+
+    for (size_t start = 0; start < size; start += gap) {
+        const size_t room = size - start < gap ? size - start : gap;
+
+        if (fill == FILL_TOKEN) {
+            const size_t length = strlen(SEARCH_TOKEN) < room ? strlen(SEARCH_TOKEN) : room;
+            memcpy(data + start + room - length, SEARCH_TOKEN, length);
+            data[start + room - 1] = '\n';
+        } else {
+            const size_t length = room - 1 < sizeof(log_line) - 1 ? room - 1 : sizeof(log_line) - 1;
+            memset(data + start, ' ', room);
+            memcpy(data + start, log_line, length);
+            data[start + room - 1] = '\n';
+        }
+    }
+}
+
+/* ========================================================================
+ * Kernels
+ * ======================================================================== */
+
+typedef size_t (*bench_fn)(bench_input_t *in);
+
+static size_t run_count_newlines_scalar(bench_input_t *in) {
+    return strider_count_newlines(in->data, in->size);
+}
+
+static size_t run_count_newlines_simd(bench_input_t *in) {
+    return strider_count_newlines_simd(in->data, in->size);
+}
+
+static size_t run_newline_positions_scalar(bench_input_t *in) {
+    return strider_find_newline_positions(in->data, in->size, in->positions, in->lines);
+}
+
+static size_t run_newline_positions_simd(bench_input_t *in) {
+    return strider_find_newline_positions_simd(in->data, in->size, in->positions, in->lines);
+}
+
+/* Checksum of a text scan, including where validation failed */
+static size_t text_checksum(const strider_text_stats_t *stats) {
+    const size_t error = stats->utf8_error == STRIDER_NOT_FOUND ? 0 : stats->utf8_error + 1;
+    return stats->lines + stats->max_line_length + error;
+}
+
+static size_t run_scan_text_scalar(bench_input_t *in) {
+    strider_text_stats_t stats;
+    strider_scan_text(in->data, in->size, 64 * 1024, &stats);
+    return text_checksum(&stats);
+}
+
+static size_t run_scan_text_simd(bench_input_t *in) {
+    strider_text_stats_t stats;
+    strider_scan_text_simd(in->data, in->size, 64 * 1024, &stats);
+    return text_checksum(&stats);
+}
+
+/* Search cases visit every match: they return the number of matches */
+
+static size_t run_strchr_scalar(bench_input_t *in) {
+    size_t matches = 0;
+    for (const char *p = strider_strchr(in->data, 'M'); p; p = strider_strchr(p + 1, 'M')) {
+        matches++;
+    }
+    return matches;
+}
+
+static size_t run_strchr_simd(bench_input_t *in) {
+    size_t matches = 0;
+    for (const char *p = strider_strchr_simd(in->data, 'M'); p;
+         p = strider_strchr_simd(p + 1, 'M')) {
+        matches++;
+    }
+    return matches;
+}
+
+static size_t run_strchr_libc(bench_input_t *in) {
+    size_t matches = 0;
+    for (const char *p = strchr(in->data, 'M'); p; p = strchr(p + 1, 'M')) {
+        matches++;
+    }
+    return matches;
+}
+
+typedef size_t (*view_search_fn)(strider_buffer_view_t view, int ch);
+
+static inline size_t count_byte_matches(bench_input_t *in, view_search_fn search) {
+    size_t matches = 0;
+    size_t start = 0;
+
+    for (;;) {
+        const size_t at =
+            search(strider_buffer_view_create(in->data + start, in->size - start), 'M');
+        if (at == STRIDER_NOT_FOUND) {
+            return matches;
+        }
+        matches++;
+        start += at + 1;
+    }
+}
+
+static size_t run_memchr_scalar(bench_input_t *in) {
+    return count_byte_matches(in, strider_memchr);
+}
+
+static size_t run_memchr_simd(bench_input_t *in) {
+    return count_byte_matches(in, strider_memchr_simd);
+}
+
+static size_t run_memchr_libc(bench_input_t *in) {
+    size_t matches = 0;
+    const char *end = in->data + in->size;
+    for (const char *p = memchr(in->data, 'M', in->size); p;
+         p = memchr(p + 1, 'M', (size_t) (end - p - 1))) {
+        matches++;
+    }
+    return matches;
+}
+
+static inline size_t count_needle_matches(bench_input_t *in, bool simd, bool nocase) {
+    const strider_buffer_view_t token = strider_buffer_view_from_cstr(SEARCH_TOKEN);
+    size_t matches = 0;
+    size_t start = 0;
+
+    for (;;) {
+        const strider_buffer_view_t rest =
+            strider_buffer_view_create(in->data + start, in->size - start);
+        size_t at;
+
+        if (nocase) {
+            at = simd ? strider_needle_find_nocase(rest, &in->needle)
+                      : strider_strstr_nocase(rest, token);
+        } else {
+            at = simd ? strider_needle_find(rest, &in->needle) : strider_strstr(rest, token);
+        }
+        if (at == STRIDER_NOT_FOUND) {
+            return matches;
+        }
+        matches++;
+        start += at + 1;
+    }
+}
+
+static size_t run_strstr_scalar(bench_input_t *in) {
+    return count_needle_matches(in, false, false);
+}
+
+static size_t run_strstr_simd(bench_input_t *in) {
+    return count_needle_matches(in, true, false);
+}
+
+static size_t run_strstr_nocase_scalar(bench_input_t *in) {
+    return count_needle_matches(in, false, true);
+}
+
+static size_t run_strstr_nocase_simd(bench_input_t *in) {
+    return count_needle_matches(in, true, true);
+}
+
+#if !defined(_WIN32)
+static size_t run_strstr_libc(bench_input_t *in) {
+    const size_t length = strlen(SEARCH_TOKEN);
+    const char *end = in->data + in->size;
+    size_t matches = 0;
+
+    for (const char *p = memmem(in->data, in->size, SEARCH_TOKEN, length); p;
+         p = memmem(p + 1, (size_t) (end - p - 1), SEARCH_TOKEN, length)) {
+        matches++;
+    }
+    return matches;
+}
+#endif
+
+typedef size_t (*byteset_fn)(strider_buffer_view_t view, const strider_byteset_t *set);
+
+static inline size_t count_byteset_matches(bench_input_t *in, byteset_fn find) {
+    size_t matches = 0;
+    size_t start = 0;
+
+    for (;;) {
+        const size_t at = find(strider_buffer_view_create(in->data + start, in->size - start),
+                               &in->separators);
+        if (at == STRIDER_NOT_FOUND) {
+            return matches;
+        }
+        matches++;
+        start += at + 1;
+    }
+}
+
+static size_t run_byteset_scalar(bench_input_t *in) {
+    return count_byteset_matches(in, strider_find_byteset);
+}
+
+static size_t run_byteset_simd(bench_input_t *in) {
+    return count_byteset_matches(in, strider_find_byteset_simd);
+}
+
+typedef size_t (*tokenize_fn)(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                              strider_buffer_view_t *fields, size_t max_fields);
+
+/* Line-based cases return a checksum of their output */
+
+static inline size_t tokenize_all(bench_input_t *in, tokenize_fn tokenize) {
+    size_t start = 0;
+    size_t fields = 0;
+
+    for (size_t i = 0; i <= in->lines; i++) {
+        const size_t end = i < in->lines ? in->positions[i] : in->size;
+        fields += tokenize(&in->tokenizer,
+                           strider_buffer_view_create(in->data + start, end - start), in->fields,
+                           MAX_FIELDS);
+        start = end + 1;
+    }
+    return fields;
+}
+
+static size_t run_tokenize_scalar(bench_input_t *in) {
+    return tokenize_all(in, strider_tokenize);
+}
+
+static size_t run_tokenize_simd(bench_input_t *in) {
+    return tokenize_all(in, strider_tokenize_simd);
+}
+
+static size_t run_timestamps_scalar(bench_input_t *in) {
+    return strider_parse_timestamps(in->data, in->size, in->positions, in->lines,
+                                    STRIDER_TIMESTAMP_ISO8601, 0, in->timestamps);
+}
+
+static size_t run_timestamps_simd(bench_input_t *in) {
+    return strider_parse_timestamps_simd(in->data, in->size, in->positions, in->lines,
+                                         STRIDER_TIMESTAMP_ISO8601, 0, in->timestamps);
+}
+
+static size_t run_levels_scalar(bench_input_t *in) {
+    return strider_filter_levels(in->data, in->size, in->positions, in->lines, &in->levels,
+                                 STRIDER_LEVEL_BIT(STRIDER_LEVEL_INFO), in->bitmap);
+}
+
+static size_t run_levels_simd(bench_input_t *in) {
+    return strider_filter_levels_simd(in->data, in->size, in->positions, in->lines, &in->levels,
+                                      STRIDER_LEVEL_BIT(STRIDER_LEVEL_INFO), in->bitmap);
+}
+
+static size_t run_parse_logs(bench_input_t *in) {
+    size_t records = 0;
+    size_t start = 0;
+
+    while (start < in->size) {
+        size_t consumed;
+        records += strider_parse_logs(&in->log_format, in->data + start, in->size - start,
+                                      &in->columns, LOG_BATCH, &consumed);
+        start += consumed;
+    }
+    return records;
+}
+
+/**
+ * @brief One benchmarked implementation
+ */
+typedef struct {
+    const char *kernel;
+    const char *impl; /* "scalar", "simd" (once per backend) or "libc" */
+    fill_t fill;
+    bench_fn run;
+} bench_case_t;
+
+static const bench_case_t cases[] = {
+    {"count_newlines", "scalar", FILL_TOKEN, run_count_newlines_scalar},
+    {"count_newlines", "simd", FILL_TOKEN, run_count_newlines_simd},
+    {"find_newline_positions", "scalar", FILL_TOKEN, run_newline_positions_scalar},
+    {"find_newline_positions", "simd", FILL_TOKEN, run_newline_positions_simd},
+    {"scan_text", "scalar", FILL_LOG, run_scan_text_scalar},
+    {"scan_text", "simd", FILL_LOG, run_scan_text_simd},
+    {"scan_text_utf8", "scalar", FILL_UTF8, run_scan_text_scalar},
+    {"scan_text_utf8", "simd", FILL_UTF8, run_scan_text_simd},
+    {"strchr", "scalar", FILL_TOKEN, run_strchr_scalar},
+    {"strchr", "simd", FILL_TOKEN, run_strchr_simd},
+    {"strchr", "libc", FILL_TOKEN, run_strchr_libc},
+    {"memchr", "scalar", FILL_TOKEN, run_memchr_scalar},
+    {"memchr", "simd", FILL_TOKEN, run_memchr_simd},
+    {"memchr", "libc", FILL_TOKEN, run_memchr_libc},
+    {"strstr", "scalar", FILL_TOKEN, run_strstr_scalar},
+    {"strstr", "simd", FILL_TOKEN, run_strstr_simd},
+#if !defined(_WIN32)
+    {"strstr", "libc", FILL_TOKEN, run_strstr_libc},
+#endif
+    {"strstr_nocase", "scalar", FILL_TOKEN, run_strstr_nocase_scalar},
+    {"strstr_nocase", "simd", FILL_TOKEN, run_strstr_nocase_simd},
+    {"find_byteset", "scalar", FILL_TOKEN, run_byteset_scalar},
+    {"find_byteset", "simd", FILL_TOKEN, run_byteset_simd},
+    {"tokenize", "scalar", FILL_LOG, run_tokenize_scalar},
+    {"tokenize", "simd", FILL_LOG, run_tokenize_simd},
+    {"parse_timestamps", "scalar", FILL_LOG, run_timestamps_scalar},
+    {"parse_timestamps", "simd", FILL_LOG, run_timestamps_simd},
+    {"filter_levels", "scalar", FILL_LOG, run_levels_scalar},
+    {"filter_levels", "simd", FILL_LOG, run_levels_simd},
+    {"parse_logs", "simd", FILL_LOG, run_parse_logs},
+};
+
+#define NUM_CASES (sizeof(cases) / sizeof(cases[0]))
+
+/* ========================================================================
+ * Timing
+ * ======================================================================== */
+
+typedef struct {
+    double seconds; /* Per call, best batch */
+    double cycles;  /* Per call, best batch (0 without a TSC) */
+    long iterations;
+    size_t result;
+} measurement_t;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+static inline unsigned long long read_cycles(void) {
+#if defined(BENCH_HAS_TSC)
+    return (unsigned long long) __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+static measurement_t measure(const bench_case_t *c, bench_input_t *in, const options_t *opt) {
+    measurement_t m = {0.0, 0.0, 1, 0};
+
+    /* Warm up and size the batches */
+    double start = now_seconds();
+    m.result = c->run(in);
+    double once = now_seconds() - start;
+    if (once < opt->min_time) {
+        const double n = once > 0.0 ? opt->min_time / once : 1e6;
+        m.iterations = n > 1e6 ? 1000000 : (long) n + 1;
+    }
+
+    for (int r = 0; r < opt->repeats; r++) {
+        const double t0 = now_seconds();
+        const unsigned long long c0 = read_cycles();
+        for (long i = 0; i < m.iterations; i++) {
+            m.result = c->run(in);
+        }
+        const unsigned long long c1 = read_cycles();
+        const double elapsed = (now_seconds() - t0) / (double) m.iterations;
+
+        if (r == 0 || elapsed < m.seconds) {
+            m.seconds = elapsed;
+            m.cycles = (double) (c1 - c0) / (double) m.iterations;
+        }
+    }
+    return m;
+}
+
+/* ========================================================================
+ * Output
+ * ======================================================================== */
+
+static FILE *json;
+static bool first_result = true;
+
+/* JSON string literal of text, with runs of blanks and line breaks as one space */
+static void json_string(const char *text) {
+    bool blank = false;
+
+    fputc('"', json);
+    for (; *text; text++) {
+        if ((unsigned char) *text <= ' ') {
+            blank = true;
+            continue;
+        }
+        if (blank) {
+            fputc(' ', json);
+            blank = false;
+        }
+        if (*text == '"' || *text == '\\') {
+            fputc('\\', json);
+        }
+        fputc(*text, json);
+    }
+    fputc('"', json);
+}
+
+static void json_begin(void) {
+    strider_cpu_features_t features = strider_get_cpu_features();
+    char description[256];
+
+    strider_describe_cpu_features(&features, description, sizeof(description));
+    fprintf(json, "{\n  \"version\": \"%s\",\n", STRIDER_BENCH_VERSION);
+    fprintf(json, "  \"cpu_features\": ");
+    json_string(description);
+    fprintf(json, ",\n");
+    fprintf(json, "  \"default_backend\": \"%s\",\n", strider_backend_name(strider_get_backend()));
+    fprintf(json, "  \"timestamp\": %lld,\n", (long long) time(NULL));
+    fprintf(json, "  \"results\": [");
+}
+
+static void json_result(const bench_case_t *c, const char *backend, size_t size, size_t offset,
+                        size_t gap, const measurement_t *m, bool ok) {
+    fprintf(json, "%s\n    {\"kernel\": \"%s\", \"impl\": \"%s\", ", first_result ? "" : ",",
+            c->kernel, c->impl);
+    if (backend) {
+        fprintf(json, "\"backend\": \"%s\", ", backend);
+    } else {
+        fprintf(json, "\"backend\": null, ");
+    }
+    fprintf(json,
+            "\"size\": %zu, \"offset\": %zu, \"gap\": %zu, \"iterations\": %ld, "
+            "\"seconds\": %.9g, \"gbps\": %.4f, ",
+            size, offset, gap, m->iterations, m->seconds, (double) size / m->seconds / 1e9);
+    if (m->cycles > 0.0) {
+        fprintf(json, "\"cycles_per_byte\": %.4f, ", m->cycles / (double) size);
+    } else {
+        fprintf(json, "\"cycles_per_byte\": null, ");
+    }
+    fprintf(json, "\"result\": %zu, \"ok\": %s}", m->result, ok ? "true" : "false");
+    first_result = false;
+}
+
+static void json_end(void) {
+    fprintf(json, "\n  ]\n}\n");
+}
+
+/* ========================================================================
+ * Driver
+ * ======================================================================== */
+
+static void prepare(bench_input_t *in, char *data, size_t size, size_t gap, fill_t fill,
+                    size_t capacity) {
+    fill_text(data, size, gap, fill);
+    data[size] = '\0'; /* strchr cases */
+    in->data = data;
+    in->size = size;
+    in->lines = strider_find_newline_positions(data, size, in->positions, capacity);
+}
+
+/* Most newlines any input has: one per gap bytes */
+static size_t max_lines(const options_t *opt) {
+    size_t lines = 1;
+
+    for (size_t g = 0; g < opt->num_gaps; g++) {
+        if (opt->gaps[g] > 0 && opt->max_size / opt->gaps[g] + 1 > lines) {
+            lines = opt->max_size / opt->gaps[g] + 1;
+        }
+    }
+    return lines;
+}
+
+int main(int argc, char **argv) {
+    options_t opt;
+    bench_input_t in;
+    bool table = true;
+    bool all_ok = true;
+
+    if (!parse_options(argc, argv, &opt)) {
+        return usage(argv[0]);
+    }
+
+    /* The misalignment and the strchr terminator come on top of max_size */
+    const size_t lines = max_lines(&opt);
+    char *buffer = (char *) strider_aligned_alloc(64, opt.max_size + 128);
+    memset(&in, 0, sizeof(in));
+    in.positions = (size_t *) malloc(lines * sizeof(size_t));
+    in.timestamps = (int64_t *) malloc(lines * sizeof(int64_t));
+    in.bitmap = (uint64_t *) malloc((lines / 64 + 1) * sizeof(uint64_t));
+    in.columns.offsets = (size_t *) malloc(LOG_BATCH * sizeof(size_t));
+    in.columns.timestamps = (int64_t *) malloc(LOG_BATCH * sizeof(int64_t));
+    in.columns.levels = (int8_t *) malloc(LOG_BATCH);
+    in.columns.messages =
+        (strider_buffer_view_t *) malloc(LOG_BATCH * sizeof(strider_buffer_view_t));
+    if (!buffer || !in.positions || !in.timestamps || !in.bitmap || !in.columns.offsets ||
+        !in.columns.timestamps || !in.columns.levels || !in.columns.messages) {
+        fprintf(stderr, "%s: out of memory for --max-size %zu\n", argv[0], opt.max_size);
+        return 1;
+    }
+    strider_needle_init(&in.needle, strider_buffer_view_from_cstr(SEARCH_TOKEN));
+    strider_byteset_init(&in.separators, "MHX", 3);
+    strider_tokenizer_init_format(&in.tokenizer, STRIDER_TOKENIZE_LOGFMT);
+    strider_level_set_init_default(&in.levels);
+    strider_log_format_init(&in.log_format, STRIDER_LOG_TEXT, STRIDER_TIMESTAMP_ISO8601, 0);
+
+    if (opt.json_path) {
+        json = strcmp(opt.json_path, "-") == 0 ? stdout : fopen(opt.json_path, "w");
+        if (!json) {
+            perror(opt.json_path);
+            return 1;
+        }
+        table = json != stdout;
+        json_begin();
+    }
+    if (table) {
+        printf("%-22s %-6s %-9s %10s %3s %5s %9s %8s\n", "kernel", "impl", "backend", "size",
+               "off", "gap", "GB/s", "cyc/B");
+    }
+
+    for (size_t size = opt.min_size; size <= opt.max_size; size *= 4) {
+        for (size_t o = 0; o < opt.num_offsets; o++) {
+            for (size_t g = 0; g < opt.num_gaps; g++) {
+                char *data = buffer + opt.offsets[o];
+
+                /* One reference result per kernel and input */
+                const char *reference_kernel = NULL;
+                size_t reference = 0;
+
+                for (fill_t fill = FILL_TOKEN; fill <= FILL_UTF8; fill++) {
+                    prepare(&in, data, size, opt.gaps[g], fill, lines);
+
+                    for (size_t k = 0; k < NUM_CASES; k++) {
+                        const bench_case_t *c = &cases[k];
+
+                        if (c->fill != fill || (opt.filter && !strstr(c->kernel, opt.filter))) {
+                            continue;
+                        }
+                        /* simd cases once per backend, the others once */
+                        const bool simd = strcmp(c->impl, "simd") == 0;
+                        const int first = opt.backend >= 0 ? opt.backend
+                                          : simd           ? STRIDER_BACKEND_SCALAR
+                                                           : STRIDER_BACKEND_AUTO;
+                        const int last = simd && opt.backend < 0 ? STRIDER_BACKEND_COUNT - 1
+                                                                 : first;
+
+                        for (int b = first; b <= last; b++) {
+                            const strider_backend_t backend = (strider_backend_t) b;
+
+                            if (simd && (!strider_backend_is_supported(backend) ||
+                                         strider_set_backend(backend) != 0)) {
+                                continue;
+                            }
+
+                            const measurement_t m = measure(c, &in, &opt);
+                            const char *name = simd ? strider_backend_name(backend) : NULL;
+
+                            if (!reference_kernel || strcmp(reference_kernel, c->kernel) != 0) {
+                                reference_kernel = c->kernel;
+                                reference = m.result;
+                            }
+                            const bool ok = m.result == reference;
+                            all_ok = all_ok && ok;
+
+                            if (table) {
+                                printf("%-22s %-6s %-9s %10zu %3zu %5zu %9.2f", c->kernel, c->impl,
+                                       name ? name : "-", size, opt.offsets[o], opt.gaps[g],
+                                       (double) size / m.seconds / 1e9);
+                                if (m.cycles > 0.0) {
+                                    printf(" %8.3f", m.cycles / (double) size);
+                                } else {
+                                    printf(" %8s", "-");
+                                }
+                                printf("%s\n", ok ? "" : "  MISMATCH");
+                            }
+                            if (json) {
+                                json_result(c, name, size, opt.offsets[o], opt.gaps[g], &m, ok);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        if (size > opt.max_size / 4) {
+            break;
+        }
+    }
+
+    if (json) {
+        json_end();
+        if (json != stdout) {
+            fclose(json);
+        }
+    }
+
+    strider_set_backend(STRIDER_BACKEND_AUTO);
+    strider_aligned_free(buffer);
+    free(in.positions);
+    free(in.timestamps);
+    free(in.bitmap);
+    free(in.columns.offsets);
+    free(in.columns.timestamps);
+    free(in.columns.levels);
+    free(in.columns.messages);
+    return all_ok ? 0 : 1;
+}
@@ -0,0 +1,26 @@
+# Cross-compile for 64-bit ARM Linux with the GNU toolchain
+#
+#   cmake -B build-arm64 \
+#     -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/aarch64-linux-gnu.cmake
+#   cmake --build build-arm64
+#   ctest --test-dir build-arm64 --output-on-failure
+#
+# The tests run under qemu-user (Debian/Ubuntu packages
+# gcc-aarch64-linux-gnu and qemu-user). Set STRIDER_AARCH64_SYSROOT if
+# the target libraries are not in /usr/aarch64-linux-gnu.
+
+set(CMAKE_SYSTEM_NAME Linux)
+set(CMAKE_SYSTEM_PROCESSOR aarch64)
+
+set(CMAKE_C_COMPILER aarch64-linux-gnu-gcc)
+
+if(NOT DEFINED STRIDER_AARCH64_SYSROOT)
+    set(STRIDER_AARCH64_SYSROOT /usr/aarch64-linux-gnu)
+endif()
+set(CMAKE_FIND_ROOT_PATH ${STRIDER_AARCH64_SYSROOT})
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_PACKAGE ONLY)
+
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-aarch64 -L ${STRIDER_AARCH64_SYSROOT})
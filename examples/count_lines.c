@@ -0,0 +1,84 @@
+/**
+ * @file count_lines.c
+ * @brief Example: Count lines of files without copying them
+ *
+ * Demonstrates strider_file_open() mapping a file into memory and the
+ * SIMD newline counter scanning the mapping directly (like `wc -l`,
+ * but treating \r\n and bare \r as line endings too).
+ *
+ * With -z, files are instead decompressed (gzip or zstd, detected from
+ * their contents) into cache-sized windows that feed a newline stream,
+ * so compressed logs are counted without being written out first.
+ */
+
+#include "strider/io/decompress.h"
+#include "strider/io/file.h"
+#include "strider/parsers/newline.h"
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Count the lines of a (possibly compressed) file window by window */
+static int count_decompressed(const char *path, size_t *lines) {
+    strider_decompressor_t *input = strider_decompress_open(path, NULL);
+    strider_newline_stream_t stream;
+    strider_buffer_view_t window;
+    int result;
+
+    if (!input) {
+        return -1;
+    }
+    strider_newline_stream_init(&stream);
+    while ((result = strider_decompress_next(input, &window)) > 0) {
+        strider_newline_stream_feed(&stream, (const char *) window.data, window.size);
+    }
+    *lines = strider_newline_stream_finish(&stream);
+    strider_decompress_close(input);
+    return result;
+}
+
+int main(int argc, char **argv) {
+    const int decompress = argc > 1 && strcmp(argv[1], "-z") == 0;
+    const int first = decompress ? 2 : 1;
+    size_t total = 0;
+    int status = 0;
+
+    if (argc <= first) {
+        fprintf(stderr, "usage: %s [-z] FILE...\n", argv[0]);
+        return 2;
+    }
+
+    for (int i = first; i < argc; i++) {
+        strider_file_t file;
+
+        if (decompress) {
+            size_t lines;
+            if (count_decompressed(argv[i], &lines) != 0) {
+                fprintf(stderr, "%s: %s\n", argv[i], strerror(errno));
+                status = 1;
+                continue;
+            }
+            printf("%10zu %s\n", lines, argv[i]);
+            total += lines;
+            continue;
+        }
+
+        if (strider_file_open(&file, argv[i], STRIDER_FILE_DEFAULT) != 0) {
+            fprintf(stderr, "%s: %s\n", argv[i], strerror(errno));
+            status = 1;
+            continue;
+        }
+
+        strider_buffer_view_t view = strider_file_view(&file);
+        size_t lines = strider_count_newlines_simd((const char *) view.data, view.size);
+        printf("%10zu %s%s\n", lines, argv[i], file.mapped ? "" : " (buffered)");
+        total += lines;
+
+        strider_file_close(&file);
+    }
+
+    if (argc - first > 1) {
+        printf("%10zu total\n", total);
+    }
+    return status;
+}
@@ -7,6 +7,7 @@
  */
 
 #include "strider/config.h"
+#include "strider/dispatch.h"
 #include <stdio.h>
 
 int main(void) {
@@ -37,5 +38,15 @@ int main(void) {
     printf("  - NEON (compiled in)\n");
 #endif
 
+    /* Display runtime kernel dispatch */
+    printf("\nKernel Backends:\n");
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (strider_backend_is_supported((strider_backend_t) b)) {
+            printf("  - %s\n", strider_backend_name((strider_backend_t) b));
+        }
+    }
+    printf("  Active: %s (override with STRIDER_BACKEND=<name>)\n",
+           strider_backend_name(strider_get_backend()));
+
     return 0;
 }
@@ -0,0 +1,121 @@
+/**
+ * @file strider_grep.c
+ * @brief Example: Print the lines of files that contain a literal
+ *
+ * Demonstrates the strider_grep engine: files are memory-mapped and
+ * searched in parallel chunks on a thread pool, and matching lines are
+ * printed in file order (like `grep -F`).
+ *
+ *   strider_grep [-i] [-n] [-c] [-j THREADS] [-e PATTERN]... [PATTERN] FILE...
+ *
+ * Exits with 0 if a line matched, 1 if none did, 2 on errors.
+ */
+
+#include "strider/io/grep.h"
+#include "strider/utils/thread_pool.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_PATTERNS 256
+
+typedef struct {
+    const char *name; /* File name prefix, or NULL */
+} print_context_t;
+
+static int print_line(void *context, const strider_grep_line_t *line) {
+    const print_context_t *print = (const print_context_t *) context;
+
+    if (print->name) {
+        fputs(print->name, stdout);
+        putchar(':');
+    }
+    if (line->number > 0) {
+        printf("%zu:", line->number);
+    }
+    fwrite(line->text.data, 1, line->text.size, stdout);
+    putchar('\n');
+    return 0;
+}
+
+static int usage(const char *program) {
+    fprintf(stderr, "usage: %s [-i] [-n] [-c] [-j THREADS] [-e PATTERN]... [PATTERN] FILE...\n",
+            program);
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    strider_buffer_view_t patterns[MAX_PATTERNS];
+    size_t num_patterns = 0;
+    unsigned flags = 0;
+    size_t threads = 0;
+    int count_only = 0;
+    int status = 1;
+    int i = 1;
+
+    for (; i < argc && argv[i][0] == '-' && argv[i][1] != '\0'; i++) {
+        const char *option = argv[i];
+
+        if (strcmp(option, "--") == 0) {
+            i++;
+            break;
+        } else if (strcmp(option, "-i") == 0) {
+            flags |= STRIDER_GREP_IGNORE_CASE;
+        } else if (strcmp(option, "-n") == 0) {
+            flags |= STRIDER_GREP_LINE_NUMBERS;
+        } else if (strcmp(option, "-c") == 0) {
+            count_only = 1;
+        } else if (strcmp(option, "-j") == 0 && i + 1 < argc) {
+            threads = (size_t) strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(option, "-e") == 0 && i + 1 < argc && num_patterns < MAX_PATTERNS) {
+            patterns[num_patterns++] = strider_buffer_view_from_cstr(argv[++i]);
+        } else {
+            return usage(argv[0]);
+        }
+    }
+    if (num_patterns == 0 && i < argc) {
+        patterns[num_patterns++] = strider_buffer_view_from_cstr(argv[i++]);
+    }
+    if (num_patterns == 0 || i >= argc) {
+        return usage(argv[0]);
+    }
+
+    strider_grep_t *grep = strider_grep_create(patterns, num_patterns, flags);
+    if (!grep) {
+        fprintf(stderr, "%s: invalid patterns (empty, multi-line, or -i with several)\n",
+                argv[0]);
+        return 2;
+    }
+    strider_thread_pool_t *pool = strider_thread_pool_create(threads);
+    strider_executor_t executor;
+    if (pool) {
+        executor = strider_thread_pool_executor(pool);
+    }
+
+    const int first_file = i;
+    for (; i < argc; i++) {
+        print_context_t print = {argc - first_file > 1 ? argv[i] : NULL};
+        size_t lines;
+
+        if (strider_grep_file(grep, argv[i], pool ? &executor : NULL,
+                              count_only ? NULL : print_line, &print, &lines) != 0) {
+            fprintf(stderr, "%s: %s\n", argv[i], strerror(errno));
+            status = 2;
+            continue;
+        }
+        if (count_only) {
+            if (print.name) {
+                printf("%s:", print.name);
+            }
+            printf("%zu\n", lines);
+        }
+        if (lines > 0 && status == 1) {
+            status = 0;
+        }
+    }
+
+    strider_thread_pool_destroy(pool);
+    strider_grep_destroy(grep);
+    return status;
+}
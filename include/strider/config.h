@@ -50,6 +50,11 @@ extern "C" {
 #        define STRIDER_HAS_SSE2 1
 #    endif
 
+/* SSSE3 (pshufb) */
+#    if defined(__SSSE3__) || defined(__AVX__)
+#        define STRIDER_HAS_SSSE3 1
+#    endif
+
 /* AVX2 */
 #    if defined(__AVX2__)
 #        define STRIDER_HAS_AVX2 1
@@ -104,6 +109,10 @@ typedef struct {
     bool has_avx2;
     bool has_avx512f;  /* AVX-512 Foundation */
     bool has_avx512bw; /* AVX-512 Byte and Word */
+    bool has_popcnt;
+    bool has_pclmul; /* Carry-less multiply (PCLMULQDQ) */
+    bool has_bmi1;
+    bool has_bmi2;
 
     /* ARM64 features */
     bool has_neon;
@@ -124,22 +133,43 @@ typedef struct {
  * - getauxval(AT_HWCAP) on ARM64 Linux
  * - sysctlbyname on ARM64 macOS
  *
+ * AVX and AVX-512 flags are only reported when the OS saves the
+ * corresponding register state (XGETBV), so they can be used directly
+ * to select kernels.
+ *
  * Results are cached after first call for performance.
  *
  * @return strider_cpu_features_t Structure with detected features
  *
- * @note Thread-safe after initialization
+ * @note Thread-safe
  * @note Results are consistent across calls
+ * @see strider_cpu_features() to avoid copying the structure
  */
 strider_cpu_features_t strider_get_cpu_features(void);
 
+/**
+ * @brief Get the cached CPU features without copying them
+ *
+ * Detection runs once, when the library is loaded (or on the first
+ * call, if that comes earlier), and the result is published with
+ * release/acquire ordering, so concurrent first calls are safe and
+ * later calls cost one load.
+ *
+ * @return Detected features (static storage, never NULL)
+ */
+const strider_cpu_features_t *strider_cpu_features(void);
+
 /**
  * @brief Get a human-readable description of detected features
  *
  * @param features Pointer to features structure
  * @param buffer Output buffer
  * @param buffer_size Size of output buffer
- * @return Number of characters written (excluding null terminator)
+ * @return Number of characters written (excluding null terminator, so
+ *         at most buffer_size - 1), or -1 on invalid arguments
+ *
+ * @note A description that does not fit is truncated, and the buffer is
+ *       always NUL-terminated
  */
 int strider_describe_cpu_features(const strider_cpu_features_t *features, char *buffer,
                                   size_t buffer_size);
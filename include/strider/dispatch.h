@@ -0,0 +1,94 @@
+/**
+ * @file dispatch.h
+ * @brief Runtime selection of SIMD kernel backends
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Every SIMD kernel is compiled once per supported ISA and the best
+ * variant for the running CPU is selected at load time. The selection
+ * can be pinned via the STRIDER_BACKEND environment variable or the
+ * strider_set_backend() API (e.g. to compare backends in benchmarks).
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_DISPATCH_H
+#define STRIDER_DISPATCH_H
+
+#include "strider/config.h"
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Kernel backend identifiers
+ *
+ * STRIDER_BACKEND_AUTO selects the fastest backend supported by both the
+ * build and the running CPU.
+ */
+typedef enum {
+    STRIDER_BACKEND_AUTO = 0,
+    STRIDER_BACKEND_SCALAR,   /**< Portable C reference kernels */
+    STRIDER_BACKEND_SSE2,     /**< x86_64 baseline, 128-bit */
+    STRIDER_BACKEND_AVX2,     /**< x86_64, 256-bit */
+    STRIDER_BACKEND_AVX512BW, /**< x86_64, 512-bit with byte/word ops */
+    STRIDER_BACKEND_NEON,     /**< ARM64 baseline, 128-bit */
+    STRIDER_BACKEND_COUNT
+} strider_backend_t;
+
+/**
+ * @brief Get the backend currently used by the *_simd entry points
+ *
+ * The backend is resolved when the library is loaded.
+ *
+ * @return Active backend (never STRIDER_BACKEND_AUTO)
+ */
+strider_backend_t strider_get_backend(void);
+
+/**
+ * @brief Pin the backend used by the *_simd entry points
+ *
+ * @param backend Backend to use, or STRIDER_BACKEND_AUTO to restore
+ *                automatic selection
+ * @return 0 on success, -1 if the backend is not supported
+ *
+ * @note Safe to call while other threads run kernels: each call uses
+ *       either the old or the new backend. Intended for program
+ *       start-up and benchmarks
+ */
+int strider_set_backend(strider_backend_t backend);
+
+/**
+ * @brief Check whether a backend can run in this build on this CPU
+ *
+ * @param backend Backend to check
+ * @return true if compiled in and supported by the CPU
+ */
+bool strider_backend_is_supported(strider_backend_t backend);
+
+/**
+ * @brief Get the canonical name of a backend
+ *
+ * @param backend Backend identifier
+ * @return Lowercase name ("scalar", "sse2", "avx2", ...) or "unknown"
+ */
+const char *strider_backend_name(strider_backend_t backend);
+
+/**
+ * @brief Parse a backend name as accepted by STRIDER_BACKEND
+ *
+ * @param name Backend name (case-insensitive)
+ * @param backend Output backend identifier
+ * @return 0 on success, -1 if the name is not recognized
+ */
+int strider_backend_from_name(const char *name, strider_backend_t *backend);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_DISPATCH_H */
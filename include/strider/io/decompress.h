@@ -0,0 +1,135 @@
+/**
+ * @file decompress.h
+ * @brief Streaming decompression of gzip and zstd input into scan windows
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Archived logs are mostly compressed. Rather than inflating a whole
+ * file before scanning it, a decompressor inflates it into one aligned
+ * window (256 KB by default, sized to stay in L2) at a time, and the
+ * caller scans each window while it is still hot. Memory stays bounded
+ * by the window and the read-ahead buffers of the compressed input,
+ * which is read through strider_reader.
+ *
+ * Windows are consecutive pieces of the decompressed stream, cut at
+ * arbitrary bytes, so they feed the carry-aware streaming scanners: a
+ * \r\n pair or a line split across windows is handled by the stream,
+ * and strider_newline_stream_feed_positions() reports offsets in the
+ * decompressed stream:
+ *
+ * @code
+ *   strider_decompressor_t *input = strider_decompress_open("app.log.zst", NULL);
+ *   strider_newline_stream_t stream;
+ *   strider_buffer_view_t window;
+ *
+ *   strider_newline_stream_init(&stream);
+ *   while (strider_decompress_next(input, &window) > 0) {
+ *       strider_newline_stream_feed(&stream, (const char *) window.data, window.size);
+ *   }
+ *   size_t lines = strider_newline_stream_finish(&stream);
+ *   strider_decompress_close(input);
+ * @endcode
+ *
+ * gzip needs zlib and zstd needs libzstd at build time
+ * (STRIDER_ENABLE_GZIP / STRIDER_ENABLE_ZSTD); see
+ * strider_decompress_supported().
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_IO_DECOMPRESS_H
+#define STRIDER_IO_DECOMPRESS_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default size of the decompression window */
+#define STRIDER_DECOMPRESS_WINDOW_SIZE (256 * 1024)
+
+/**
+ * @brief Compression format of the input
+ */
+typedef enum {
+    STRIDER_COMPRESSION_AUTO, /**< Detect from the magic bytes (plain if none match) */
+    STRIDER_COMPRESSION_NONE, /**< Plain input, passed through */
+    STRIDER_COMPRESSION_GZIP, /**< gzip or zlib stream, concatenated members allowed */
+    STRIDER_COMPRESSION_ZSTD, /**< Zstandard, concatenated frames allowed */
+} strider_compression_t;
+
+/**
+ * @brief Options for strider_decompress_open()
+ *
+ * A zeroed struct (or NULL) selects the defaults.
+ */
+typedef struct {
+    size_t window_size;           /**< Bytes per window (0: STRIDER_DECOMPRESS_WINDOW_SIZE) */
+    strider_compression_t format; /**< Format of the input */
+} strider_decompress_options_t;
+
+/**
+ * @brief Open decompressor (opaque)
+ */
+typedef struct strider_decompressor strider_decompressor_t;
+
+/**
+ * @brief Check whether a format was built in
+ *
+ * @return true for AUTO and NONE, and for GZIP / ZSTD when the library
+ *         was found at build time
+ */
+bool strider_decompress_supported(strider_compression_t format);
+
+/**
+ * @brief Open a file and start decompressing it
+ *
+ * With STRIDER_COMPRESSION_AUTO the format is taken from the first bytes
+ * of the input, so pipes ("-" for standard input) work too.
+ *
+ * @param path File to read ("-" for standard input)
+ * @param options Options, or NULL for the defaults
+ * @return Decompressor, or NULL on error (errno describes the failure
+ *         on POSIX systems; ENOTSUP for a format that was not built in)
+ */
+strider_decompressor_t *strider_decompress_open(const char *path,
+                                                const strider_decompress_options_t *options);
+
+/**
+ * @brief Decompress the next window
+ *
+ * Reuses the window of the previous call, so a window stays valid only
+ * until the next call. Every window but the last is window_size bytes
+ * long, and none is empty.
+ *
+ * @param input Open decompressor
+ * @param window Output view of the decompressed bytes
+ * @return 1 if a window was returned, 0 at the end of the input, -1 on
+ *         a read error or corrupt or truncated input (errno is EIO for
+ *         corrupt input)
+ */
+int strider_decompress_next(strider_decompressor_t *input, strider_buffer_view_t *window);
+
+/**
+ * @brief Format of the input (never AUTO once the input is open)
+ */
+strider_compression_t strider_decompress_format(const strider_decompressor_t *input);
+
+/**
+ * @brief Stop decompressing, free the window and close the file
+ *
+ * @param input Decompressor to close (NULL is ignored)
+ */
+void strider_decompress_close(strider_decompressor_t *input);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_IO_DECOMPRESS_H */
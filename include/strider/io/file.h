@@ -0,0 +1,98 @@
+/**
+ * @file file.h
+ * @brief Memory-mapped file input
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Maps a file read-only and exposes it as a strider_buffer_view_t, so
+ * the parsers scan the page cache directly instead of a read() copy.
+ * Access-pattern hints (madvise / posix_fadvise) are applied on a best
+ * effort basis; a hint the kernel rejects never fails the open.
+ *
+ * Files that cannot be mapped (pipes, character devices, some virtual
+ * file systems) are read into a heap buffer instead, so callers can use
+ * the same code path for "-" / /dev/stdin.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_IO_FILE_H
+#define STRIDER_IO_FILE_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Hints for strider_file_open()
+ */
+typedef enum {
+    STRIDER_FILE_SEQUENTIAL = 1 << 0, /**< MADV_SEQUENTIAL + POSIX_FADV_SEQUENTIAL */
+    STRIDER_FILE_HUGEPAGES = 1 << 1,  /**< MADV_HUGEPAGE (where the file system supports it) */
+    STRIDER_FILE_WILLNEED = 1 << 2,   /**< MADV_WILLNEED + POSIX_FADV_WILLNEED (start readahead) */
+    STRIDER_FILE_POPULATE = 1 << 3,   /**< MAP_POPULATE: fault in all pages up front */
+    STRIDER_FILE_DEFAULT = STRIDER_FILE_SEQUENTIAL | STRIDER_FILE_HUGEPAGES
+} strider_file_flags_t;
+
+/**
+ * @brief An open, mapped (or buffered) input file
+ *
+ * @note Treat fields as read-only; use strider_file_view() for the data
+ */
+typedef struct {
+    const uint8_t *data; /**< File contents (NULL for an empty file) */
+    size_t size;         /**< File size in bytes */
+    bool mapped;         /**< true: data is a mapping; false: heap buffer */
+    void *handle;        /**< Platform mapping handle (Windows only) */
+} strider_file_t;
+
+/**
+ * @brief Open and map a file read-only
+ *
+ * @param file File to initialize
+ * @param path Path to open
+ * @param flags Bitwise OR of strider_file_flags_t hints
+ * @return 0 on success, -1 on error (errno describes the failure on
+ *         POSIX systems); file is zeroed on error
+ *
+ * Example:
+ * @code
+ *   strider_file_t file;
+ *   if (strider_file_open(&file, "app.log", STRIDER_FILE_DEFAULT) == 0) {
+ *       strider_buffer_view_t view = strider_file_view(&file);
+ *       size_t lines = strider_count_newlines_simd((const char *) view.data, view.size);
+ *       strider_file_close(&file);
+ *   }
+ * @endcode
+ */
+int strider_file_open(strider_file_t *file, const char *path, unsigned flags);
+
+/**
+ * @brief Unmap (or free) and close a file
+ *
+ * @param file File to close (safe to call on a zeroed file)
+ */
+void strider_file_close(strider_file_t *file);
+
+/**
+ * @brief Get the file contents as a buffer view
+ *
+ * @param file Open file
+ * @return View valid until strider_file_close()
+ */
+static inline strider_buffer_view_t strider_file_view(const strider_file_t *file) {
+    return strider_buffer_view_create(file->data, file->size);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_IO_FILE_H */
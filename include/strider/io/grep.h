@@ -0,0 +1,149 @@
+/**
+ * @file grep.h
+ * @brief Parallel literal line search over mapped files
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * strider_grep_file() maps a file (strider_file_open()), splits it into
+ * chunks searched on an executor, and hands every line holding one of
+ * the patterns to a callback in file order.
+ *
+ * Lines are never indexed up front: the chunks search for the patterns
+ * directly (strider_needle_find_simd() for one pattern, the multi-pattern
+ * matcher for several) and only around a match look back and forward
+ * for the line ending. After a matching line the search resumes at the
+ * next line, so a line is reported once however often it matches.
+ *
+ * Chunks are searched in batches. Each chunk records at most
+ * STRIDER_GREP_CHUNK_LINES lines (as offsets into the mapping) before
+ * the batch is emitted, so memory stays bounded however many lines
+ * match; a chunk that fills up is finished on the calling thread while
+ * its lines are emitted.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_IO_GREP_H
+#define STRIDER_IO_GREP_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include "strider/utils/thread_pool.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bytes per chunk task */
+#define STRIDER_GREP_CHUNK_SIZE (256 * 1024)
+
+/** Chunks searched per executor batch */
+#define STRIDER_GREP_BATCH_CHUNKS 64
+
+/** Matching lines a chunk records before it waits for the batch to be emitted */
+#define STRIDER_GREP_CHUNK_LINES 1024
+
+/**
+ * @brief Flags for strider_grep_create()
+ */
+typedef enum {
+    STRIDER_GREP_IGNORE_CASE = 1 << 0,  /**< ASCII case-insensitive (one pattern only) */
+    STRIDER_GREP_LINE_NUMBERS = 1 << 1, /**< Report line numbers (counts all newlines) */
+} strider_grep_flags_t;
+
+/**
+ * @brief A matching line
+ */
+typedef struct {
+    strider_buffer_view_t text; /**< Line without its line ending, into the input */
+    size_t offset;              /**< Offset of the line in the input */
+    size_t number;              /**< 1-based line number, or 0 without STRIDER_GREP_LINE_NUMBERS */
+} strider_grep_line_t;
+
+/**
+ * @brief Receives matching lines, in input order, on the calling thread
+ *
+ * @param context Context passed to strider_grep_buffer()
+ * @param line Matching line
+ * @return 0 to continue, non-zero to stop the search
+ */
+typedef int (*strider_grep_output_fn)(void *context, const strider_grep_line_t *line);
+
+/**
+ * @brief Compiled search (opaque)
+ */
+typedef struct strider_grep strider_grep_t;
+
+/**
+ * @brief Compile a search for lines holding any of a set of literals
+ *
+ * Lines end at \n, \r\n or \r, as for strider_count_newlines(), so a
+ * pattern cannot contain either byte.
+ *
+ * @param patterns Literal patterns
+ * @param count Number of patterns
+ * @param flags Bitwise OR of strider_grep_flags_t
+ * @return Search (copies the patterns), or NULL on invalid arguments (no
+ *         patterns, an empty pattern, a pattern with \n or \r, more than
+ *         one pattern with STRIDER_GREP_IGNORE_CASE) or allocation failure
+ */
+strider_grep_t *strider_grep_create(const strider_buffer_view_t *patterns, size_t count,
+                                    unsigned flags);
+
+/**
+ * @brief Free a search
+ *
+ * @param grep Search to free (NULL is ignored)
+ */
+void strider_grep_destroy(strider_grep_t *grep);
+
+/**
+ * @brief Report the lines of a buffer that hold a pattern
+ *
+ * Example:
+ * @code
+ *   strider_buffer_view_t pattern = strider_buffer_view_from_cstr("timeout");
+ *   strider_grep_t *grep = strider_grep_create(&pattern, 1, STRIDER_GREP_LINE_NUMBERS);
+ *   strider_thread_pool_t *pool = strider_thread_pool_create(0);
+ *   strider_executor_t executor = strider_thread_pool_executor(pool);
+ *   size_t lines;
+ *
+ *   strider_grep_file(grep, "app.log", &executor, print_line, stdout, &lines);
+ * @endcode
+ *
+ * @param grep Compiled search
+ * @param input Buffer to search
+ * @param executor Executor for the chunks, or NULL to run on the calling
+ *                 thread
+ * @param output Called for every matching line, or NULL to only count
+ * @param context Passed to output
+ * @param lines Output: number of matching lines reported (may be NULL)
+ * @return 0 on success (also when output stopped the search), -1 on
+ *         invalid arguments or allocation failure
+ */
+int strider_grep_buffer(const strider_grep_t *grep, strider_buffer_view_t input,
+                        const strider_executor_t *executor, strider_grep_output_fn output,
+                        void *context, size_t *lines);
+
+/**
+ * @brief Report the lines of a file that hold a pattern
+ *
+ * Maps the file with STRIDER_FILE_DEFAULT and calls strider_grep_buffer().
+ * Line views passed to output are valid only during the call.
+ *
+ * @return 0 on success, -1 if the file cannot be opened (errno describes
+ *         the failure on POSIX systems) or on the errors of
+ *         strider_grep_buffer()
+ */
+int strider_grep_file(const strider_grep_t *grep, const char *path,
+                      const strider_executor_t *executor, strider_grep_output_fn output,
+                      void *context, size_t *lines);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_IO_GREP_H */
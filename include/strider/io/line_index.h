@@ -0,0 +1,142 @@
+/**
+ * @file line_index.h
+ * @brief Persistent, memory-mappable line index sidecar files
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * A line index stores the newline positions of a source file (as found
+ * by strider_find_newline_positions_simd()) so that line N can be
+ * located without rescanning the source.
+ *
+ * File format (version 1, all integers little-endian):
+ *
+ * @code
+ *   [0, 4096)          Header
+ *                        magic "STRLIDX\n", version, block_lines,
+ *                        source_size, source_mtime_ns, source_hash,
+ *                        line_count, skip_capacity, data_size, flags
+ *   [4096, data_start) Skip table: skip_capacity entries of
+ *                        { u64 first_position, u64 data_offset }
+ *   [data_start, ...)  Blocks: for every block of block_lines positions,
+ *                        the gaps to the following positions minus one,
+ *                        LEB128 varint encoded
+ * @endcode
+ *
+ * data_start is 4096 + 16 * skip_capacity, with the skip table reserved
+ * up front (a sparse hole on most file systems) at twice the size first
+ * needed. Appending to the source only rewrites the partial last block,
+ * new skip entries and the header. A full rebuild happens when the skip
+ * table is full or the source was rewritten. Looking up a position reads
+ * one skip entry and decodes at most block_lines - 1 varints.
+ *
+ * source_hash is a 64-bit FNV-1a over the first 64 KiB and the last
+ * 4 KiB of the indexed range. It detects a rewritten or rotated source
+ * without rereading gigabytes.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_IO_LINE_INDEX_H
+#define STRIDER_IO_LINE_INDEX_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Positions per encoded block (bounds the decode work per lookup) */
+#define STRIDER_LINE_INDEX_BLOCK_LINES 128
+
+/**
+ * @brief Opened line index (opaque)
+ */
+typedef struct strider_line_index strider_line_index_t;
+
+/**
+ * @brief Build a line index for a source file from scratch
+ *
+ * Writes to "<index_path>.tmp" and renames it over index_path, so
+ * readers never see a partial index.
+ *
+ * @param index_path Index file to create or replace
+ * @param source_path Source file to index
+ * @return 0 on success, -1 on error
+ */
+int strider_line_index_build(const char *index_path, const char *source_path);
+
+/**
+ * @brief Bring a line index up to date with its source
+ *
+ * If the source only grew since the index was written, and its indexed
+ * prefix still hashes the same, only the new bytes are scanned and the
+ * index is extended in place. Otherwise (no index, version mismatch,
+ * truncated or rewritten source, skip table full) it is rebuilt.
+ *
+ * @param index_path Index file
+ * @param source_path Source file
+ * @return 0 on success, -1 on error
+ */
+int strider_line_index_update(const char *index_path, const char *source_path);
+
+/**
+ * @brief Map an index for lookups
+ *
+ * @param index_path Index file
+ * @return Index, or NULL if the file is missing or not a valid index
+ *
+ * @note Does not check the index against its source; call
+ *       strider_line_index_update() first if the source may have changed
+ */
+strider_line_index_t *strider_line_index_open(const char *index_path);
+
+/**
+ * @brief Unmap and free an index
+ *
+ * @param index Index to close (NULL is ignored)
+ */
+void strider_line_index_close(strider_line_index_t *index);
+
+/**
+ * @brief Number of newlines recorded in the index
+ */
+size_t strider_line_index_count(const strider_line_index_t *index);
+
+/**
+ * @brief Number of source bytes covered by the index
+ */
+size_t strider_line_index_source_size(const strider_line_index_t *index);
+
+/**
+ * @brief Position of the n-th newline (0-based)
+ *
+ * @return Byte offset in the source (\r of a \r\n pair), or
+ *         STRIDER_NOT_FOUND if n >= strider_line_index_count()
+ */
+size_t strider_line_index_position(const strider_line_index_t *index, size_t n);
+
+/**
+ * @brief Get line n (0-based) of the source, without its line ending
+ *
+ * Line n runs from the end of newline n - 1 to newline n. The text after
+ * the last newline, if any, is line strider_line_index_count().
+ *
+ * @param index Index of source
+ * @param source Source contents (e.g. strider_file_view())
+ * @param n Line number
+ * @param line Output view into source
+ * @return 0 on success, -1 if there is no line n
+ */
+int strider_line_index_line(const strider_line_index_t *index, strider_buffer_view_t source,
+                            size_t n, strider_buffer_view_t *line);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_IO_LINE_INDEX_H */
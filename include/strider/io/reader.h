@@ -0,0 +1,120 @@
+/**
+ * @file reader.h
+ * @brief Asynchronous read-ahead input for files that should not be mapped
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Mapping a file on a network file system turns every page fault into a
+ * synchronous round trip, and pipes cannot be mapped at all. A reader
+ * instead keeps a ring of aligned buffers (three by default) in flight:
+ * while the caller scans one buffer, the others are being filled, so
+ * I/O and the SIMD scan overlap and the device queue never runs dry.
+ *
+ * Buffers are filled by io_uring on Linux (seekable files only), and by
+ * a background thread doing pread() (read() for pipes) everywhere else.
+ * Chunks come back in file order and feed the streaming scanners:
+ *
+ * @code
+ *   strider_reader_t *reader = strider_reader_open("app.log", NULL);
+ *   strider_newline_stream_t stream;
+ *   strider_buffer_view_t chunk;
+ *
+ *   strider_newline_stream_init(&stream);
+ *   while (strider_reader_next(reader, &chunk) > 0) {
+ *       strider_newline_stream_feed(&stream, (const char *) chunk.data, chunk.size);
+ *   }
+ *   size_t lines = strider_newline_stream_finish(&stream);
+ *   strider_reader_close(reader);
+ * @endcode
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_IO_READER_H
+#define STRIDER_IO_READER_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Default size of each buffer */
+#define STRIDER_READER_BUFFER_SIZE (1024 * 1024)
+
+/** Default number of buffers (triple buffering) */
+#define STRIDER_READER_BUFFERS 3
+
+/**
+ * @brief How buffers are filled
+ */
+typedef enum {
+    STRIDER_READER_AUTO,     /**< io_uring where supported, otherwise the thread */
+    STRIDER_READER_IO_URING, /**< io_uring (Linux, seekable files); open fails otherwise */
+    STRIDER_READER_THREAD,   /**< Background read thread */
+} strider_reader_backend_t;
+
+/**
+ * @brief Options for strider_reader_open()
+ *
+ * A zeroed struct (or NULL) selects the defaults.
+ */
+typedef struct {
+    size_t buffer_size;               /**< Bytes per buffer (0: STRIDER_READER_BUFFER_SIZE) */
+    size_t buffers;                   /**< Buffers in the ring, at least 2 (0: default) */
+    strider_reader_backend_t backend; /**< Backend to use */
+} strider_reader_options_t;
+
+/**
+ * @brief Open reader (opaque)
+ */
+typedef struct strider_reader strider_reader_t;
+
+/**
+ * @brief Open a file and start reading ahead
+ *
+ * @param path File to read ("-" for standard input)
+ * @param options Options, or NULL for the defaults
+ * @return Reader, or NULL on error (errno describes the failure on POSIX
+ *         systems)
+ */
+strider_reader_t *strider_reader_open(const char *path, const strider_reader_options_t *options);
+
+/**
+ * @brief Get the next chunk of the file
+ *
+ * Hands the buffer of the previous chunk back to the ring, so a chunk
+ * stays valid only until the next call. Every chunk but the last is
+ * buffer_size bytes long.
+ *
+ * @param reader Open reader
+ * @param chunk Output view of the chunk
+ * @return 1 if a chunk was returned, 0 at the end of the file, -1 on a
+ *         read error (errno is set on POSIX systems); after an error
+ *         every later call returns -1 too
+ */
+int strider_reader_next(strider_reader_t *reader, strider_buffer_view_t *chunk);
+
+/**
+ * @brief Backend filling the buffers of a reader
+ *
+ * @return STRIDER_READER_IO_URING or STRIDER_READER_THREAD
+ */
+strider_reader_backend_t strider_reader_backend(const strider_reader_t *reader);
+
+/**
+ * @brief Stop reading, free the buffers and close the file
+ *
+ * @param reader Reader to close (NULL is ignored)
+ */
+void strider_reader_close(strider_reader_t *reader);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_IO_READER_H */
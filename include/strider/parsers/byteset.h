@@ -0,0 +1,124 @@
+/**
+ * @file byteset.h
+ * @brief Multi-byte set search (find the first of N delimiters)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * A strider_byteset_t is compiled once from a list of bytes and then
+ * classifies a whole vector per step, instead of rescanning the buffer
+ * once per delimiter. SIMD kernels use the low/high nibble lookup
+ * technique: each byte is matched by two 16-entry table lookups
+ * (pshufb / vqtbl1q_u8) and an AND.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_BYTESET_H
+#define STRIDER_PARSERS_BYTESET_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Precompiled set of bytes
+ *
+ * Bytes sharing a high nibble form a bucket keyed by their set of low
+ * nibbles; every bucket owns one bit of the nibble tables. Up to 8
+ * buckets fit in one table pair, so any set needs at most 2 passes.
+ *
+ * @note Build with strider_byteset_init(); treat fields as read-only
+ */
+typedef struct {
+    uint8_t lo_nibble[2][16]; /**< Bucket bits by low nibble, per pass */
+    uint8_t hi_nibble[2][16]; /**< Bucket bit by high nibble, per pass */
+    uint8_t members[16];      /**< First 16 distinct members (compare fallback) */
+    uint32_t bitmap[8];       /**< Membership bitmap for scalar paths */
+    uint16_t count;           /**< Number of distinct members */
+    uint8_t passes;           /**< Table pairs in use (0 for an empty set) */
+} strider_byteset_t;
+
+/**
+ * @brief Compile a byte set
+ *
+ * @param set Set to initialize
+ * @param bytes Member bytes (duplicates are ignored; may be NULL if count is 0)
+ * @param count Number of bytes
+ * @return 0 on success, -1 on invalid arguments
+ *
+ * Example:
+ * @code
+ *   strider_byteset_t delims;
+ *   strider_byteset_init(&delims, " \t=\",]", 6);
+ * @endcode
+ */
+int strider_byteset_init(strider_byteset_t *set, const char *bytes, size_t count);
+
+/**
+ * @brief Check whether a byte is a member of the set
+ */
+static inline bool strider_byteset_contains(const strider_byteset_t *set, uint8_t byte) {
+    return (set->bitmap[byte >> 5] >> (byte & 31)) & 1u;
+}
+
+/**
+ * @brief Find first byte that is in the set (scalar reference)
+ *
+ * @param view Buffer to search
+ * @param set Compiled byte set
+ * @return Offset of first member byte, or STRIDER_NOT_FOUND
+ *
+ * @note This is the reference implementation for testing SIMD variants
+ */
+size_t strider_find_byteset(strider_buffer_view_t view, const strider_byteset_t *set);
+
+/**
+ * @brief Find first byte that is in the set (SIMD-accelerated)
+ *
+ * @param view Buffer to search
+ * @param set Compiled byte set
+ * @return Offset of first member byte, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_find_byteset()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_find_byteset_simd(strider_buffer_view_t view, const strider_byteset_t *set);
+
+/**
+ * @brief Find first byte that is NOT in the set (scalar reference)
+ *
+ * Skips a run of member bytes, e.g. leading whitespace.
+ *
+ * @param view Buffer to search
+ * @param set Compiled byte set
+ * @return Offset of first non-member byte, or STRIDER_NOT_FOUND if every
+ *         byte is a member
+ */
+size_t strider_skip_byteset(strider_buffer_view_t view, const strider_byteset_t *set);
+
+/**
+ * @brief Find first byte that is NOT in the set (SIMD-accelerated)
+ *
+ * @param view Buffer to search
+ * @param set Compiled byte set
+ * @return Offset of first non-member byte, or STRIDER_NOT_FOUND if every
+ *         byte is a member
+ *
+ * @note Guaranteed to return same result as strider_skip_byteset()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_skip_byteset_simd(strider_buffer_view_t view, const strider_byteset_t *set);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_BYTESET_H */
@@ -0,0 +1,179 @@
+/**
+ * @file level.h
+ * @brief Log level filtering
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Finds the level token of every line and emits a bitmap of the lines
+ * whose level is in a requested set, so later stages only touch the
+ * lines that survive.
+ *
+ * The level of a line is the first word in its first `window` bytes
+ * that is one of the names in a strider_level_set_t. A word is a
+ * maximal run of ASCII letters, so "[ERROR]", "(warn)" and "level=INFO"
+ * all match while "INFORMATION" and "ERRORS" do not. Words cut off by
+ * the end of the window are matched as they are.
+ *
+ * SIMD kernels classify the whole window in one 64-byte block and use
+ * bitmask tricks to find word starts, then compare each candidate word
+ * (up to 8 bytes, one little-endian uint64_t) against every name of the
+ * set at once.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_LEVEL_H
+#define STRIDER_PARSERS_LEVEL_H
+
+#include "strider/config.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Most names a level set can hold */
+#define STRIDER_LEVEL_MAX_NAMES 16
+
+/** Longest level name in bytes */
+#define STRIDER_LEVEL_MAX_NAME_LENGTH 8
+
+/** Largest (and default) search window from the start of a line */
+#define STRIDER_LEVEL_MAX_WINDOW 64
+
+/**
+ * @brief Level ids used by strider_level_set_init_default()
+ *
+ * Ids index bits of a level mask (see STRIDER_LEVEL_BIT()); user-defined
+ * levels can use any id up to 31.
+ */
+typedef enum {
+    STRIDER_LEVEL_TRACE,
+    STRIDER_LEVEL_DEBUG,
+    STRIDER_LEVEL_INFO,
+    STRIDER_LEVEL_WARN,
+    STRIDER_LEVEL_ERROR,
+    STRIDER_LEVEL_FATAL,
+    STRIDER_LEVEL_CUSTOM, /**< First id not used by the defaults */
+} strider_level_t;
+
+/** Mask bit of a level id */
+#define STRIDER_LEVEL_BIT(level) (UINT32_C(1) << (level))
+
+/**
+ * @brief Compiled set of level names
+ *
+ * @note Build with strider_level_set_init() and strider_level_set_add();
+ *       treat fields as read-only
+ */
+typedef struct {
+    uint64_t keys[STRIDER_LEVEL_MAX_NAMES]; /**< Names, zero padded (lowercase if ignore_case);
+                                                 unused entries never match */
+    uint8_t ids[STRIDER_LEVEL_MAX_NAMES];   /**< Level id of each name */
+    uint16_t lengths;                       /**< Bit n set if some name has n bytes */
+    uint8_t count;                          /**< Number of names */
+    uint8_t window;                         /**< Bytes searched from the line start */
+    bool ignore_case;                       /**< Match names case-insensitively */
+} strider_level_set_t;
+
+/**
+ * @brief Initialize an empty level set
+ *
+ * @param set Set to initialize
+ * @param window Bytes searched from the start of each line (1 to
+ *               STRIDER_LEVEL_MAX_WINDOW)
+ * @param ignore_case Whether "error" matches the name "ERROR"
+ * @return 0 on success, -1 on invalid arguments
+ */
+int strider_level_set_init(strider_level_set_t *set, size_t window, bool ignore_case);
+
+/**
+ * @brief Initialize a set with the common level names
+ *
+ * TRACE, DEBUG, INFO, WARN, WARNING (as STRIDER_LEVEL_WARN), ERROR,
+ * FATAL and CRITICAL (as STRIDER_LEVEL_FATAL), case-insensitive, with a
+ * STRIDER_LEVEL_MAX_WINDOW byte window. More names can be added.
+ *
+ * @return 0 on success, -1 on invalid arguments
+ */
+int strider_level_set_init_default(strider_level_set_t *set);
+
+/**
+ * @brief Add a level name
+ *
+ * @param set Level set
+ * @param name NUL-terminated name: 1 to STRIDER_LEVEL_MAX_NAME_LENGTH ASCII letters
+ * @param level Level id (0-31); several names may share an id
+ * @return 0 on success, -1 if the name is invalid or already present, the
+ *         id is out of range or the set is full
+ */
+int strider_level_set_add(strider_level_set_t *set, const char *name, unsigned level);
+
+/**
+ * @brief Find the level of one line (scalar reference)
+ *
+ * @param set Level names
+ * @param line Start of the line
+ * @param size Length of the line
+ * @return Level id, or -1 if no name occurs in the window
+ */
+int strider_find_level(const strider_level_set_t *set, const char *line, size_t size);
+
+/**
+ * @brief Find the level of one line (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_find_level()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+int strider_find_level_simd(const strider_level_set_t *set, const char *line, size_t size);
+
+/**
+ * @brief Select the lines whose level is in a mask (scalar reference)
+ *
+ * Line i runs from the end of newline i - 1 (the start of data for
+ * i = 0) to positions[i], as returned by strider_find_newline_positions().
+ *
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param positions Newline positions in data
+ * @param count Number of positions
+ * @param set Level names
+ * @param levels Mask of wanted level ids (STRIDER_LEVEL_BIT() values)
+ * @param bitmap Output: (count + 63) / 64 words, bit i % 64 of word
+ *               i / 64 set if line i is selected (unused bits are zero)
+ * @return Number of selected lines
+ */
+size_t strider_filter_levels(const char *data, size_t size, const size_t *positions,
+                             size_t count, const strider_level_set_t *set, uint32_t levels,
+                             uint64_t *bitmap);
+
+/**
+ * @brief Select the lines whose level is in a mask (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_filter_levels()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_filter_levels_simd(const char *data, size_t size, const size_t *positions,
+                                  size_t count, const strider_level_set_t *set, uint32_t levels,
+                                  uint64_t *bitmap);
+
+/**
+ * @brief Turn a selection bitmap into a list of line numbers
+ *
+ * @param bitmap Bitmap from strider_filter_levels()
+ * @param count Number of lines it covers
+ * @param selection Output: selected line numbers in ascending order
+ *                  (room for as many as strider_filter_levels() returned)
+ * @return Number of line numbers written
+ */
+size_t strider_selection_from_bitmap(const uint64_t *bitmap, size_t count, size_t *selection);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_LEVEL_H */
@@ -0,0 +1,149 @@
+/**
+ * @file logs.h
+ * @brief Batch log record parsing into columns
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Splits a buffer into lines and extracts the timestamp, level and
+ * message of every line into structure-of-arrays columns, ready for
+ * columnar writers or vectorized aggregation. Messages are views into
+ * the input; nothing is copied.
+ *
+ * Layouts:
+ * - Text: "<stamp> <level> <message>", the stamp optionally in brackets
+ *   and the level optionally in brackets, parentheses or angle brackets
+ *   and followed by ':', '-' or '|' ("[2025-12-31 23:59:59] [ERROR]: x",
+ *   "2025-12-31T23:59:59Z WARN - x"). When the word after the stamp is
+ *   not a level, the level is searched in the level window as in
+ *   strider_find_level() and the message is everything after the stamp
+ *   ("Dec 31 23:59:59 host sshd[42]: error: x").
+ * - Logfmt: ts=... level=... msg=...
+ * - JSON lines: flat objects, {"ts": ..., "level": ..., "msg": ...}
+ *
+ * Structured layouts look up the keys ts, time, timestamp and
+ * \@timestamp; level, lvl and severity; msg and message. Quotes around
+ * values are removed; escapes inside them are kept as they are.
+ *
+ * All per-byte work (newlines, stamps, levels and fields) is done by the
+ * dispatched SIMD kernels.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_LOGS_H
+#define STRIDER_PARSERS_LOGS_H
+
+#include "strider/config.h"
+#include "strider/parsers/level.h"
+#include "strider/parsers/timestamp.h"
+#include "strider/parsers/tokenize.h"
+#include "strider/utils/arena.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Fields of a structured record that are looked at; later ones are ignored */
+#define STRIDER_LOG_MAX_FIELDS 32
+
+/** Level column value for records without a level */
+#define STRIDER_LOG_NO_LEVEL (-1)
+
+/**
+ * @brief Record layouts
+ */
+typedef enum {
+    STRIDER_LOG_TEXT,   /**< 2025-12-31T23:59:59Z ERROR message */
+    STRIDER_LOG_LOGFMT, /**< ts=2025-12-31T23:59:59Z level=error msg="message" */
+    STRIDER_LOG_JSON,   /**< {"ts":"2025-12-31T23:59:59Z","level":"error","msg":"message"} */
+} strider_log_layout_t;
+
+/**
+ * @brief Compiled record format
+ *
+ * @note Build with strider_log_format_init(); levels may then be
+ *       extended with strider_level_set_add()
+ */
+typedef struct {
+    strider_log_layout_t layout;                 /**< Record layout */
+    strider_timestamp_format_t timestamp_format; /**< Layout of the stamps */
+    int year;                                    /**< Year of syslog stamps */
+    strider_level_set_t levels;                  /**< Level names */
+    strider_tokenizer_t tokenizer;               /**< Field splitting (structured layouts) */
+} strider_log_format_t;
+
+/**
+ * @brief Output columns, one entry per record
+ *
+ * Any column may be NULL; it is then neither written nor computed.
+ */
+typedef struct {
+    size_t *offsets;                 /**< Offset of the line in data */
+    int64_t *timestamps;             /**< Nanoseconds since the epoch, or
+                                          STRIDER_TIMESTAMP_INVALID */
+    int8_t *levels;                  /**< Level id, or STRIDER_LOG_NO_LEVEL */
+    strider_buffer_view_t *messages; /**< Message text (empty if none) */
+} strider_log_columns_t;
+
+/**
+ * @brief Initialize a record format
+ *
+ * Levels start as strider_level_set_init_default().
+ *
+ * @param format Format to initialize
+ * @param layout Record layout
+ * @param timestamp_format Layout of the stamps
+ * @param year Year of syslog stamps (ignored by other stamp layouts)
+ * @return 0 on success, -1 on invalid arguments
+ */
+int strider_log_format_init(strider_log_format_t *format, strider_log_layout_t layout,
+                            strider_timestamp_format_t timestamp_format, int year);
+
+/**
+ * @brief Parse the records of a buffer into columns
+ *
+ * Every line is one record, also empty ones and the text after the last
+ * newline. Line endings (\n or \r\n) are not part of messages.
+ *
+ * @param format Record format
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param columns Output columns, each with room for max_records entries
+ * @param max_records Most records to parse
+ * @param consumed Output (optional): bytes of data covered by the parsed
+ *                 records, including their line endings; parse the rest
+ *                 with another call at data + *consumed
+ * @return Number of records parsed
+ */
+size_t strider_parse_logs(const strider_log_format_t *format, const char *data, size_t size,
+                          const strider_log_columns_t *columns, size_t max_records,
+                          size_t *consumed);
+
+/**
+ * @brief Parse all records of a buffer into columns allocated from an arena
+ *
+ * Counts the lines first and allocates every column for exactly that
+ * many records, so a loop that parses a batch and resets the arena does
+ * not call malloc once the arena has grown to the batch size.
+ *
+ * @param format Record format
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param arena Arena for the columns, or NULL for strider_thread_arena()
+ * @param columns Output: all four columns, valid until the arena is reset
+ * @return Number of records parsed, or STRIDER_NOT_FOUND if the
+ *         allocation failed
+ */
+size_t strider_parse_logs_arena(const strider_log_format_t *format, const char *data, size_t size,
+                                strider_arena_t *arena, strider_log_columns_t *columns);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_LOGS_H */
@@ -0,0 +1,164 @@
+/**
+ * @file memchr.h
+ * @brief Length-bounded byte search (memchr/memrchr-like functionality)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Searches a strider_buffer_view_t for a byte without relying on a NUL
+ * terminator, so it works on mmapped and binary data with embedded
+ * NULs. Never reads outside [view.data, view.data + view.size).
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_MEMCHR_H
+#define STRIDER_PARSERS_MEMCHR_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Find first occurrence of byte in buffer (scalar reference)
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note This is the reference implementation for testing SIMD variants
+ */
+size_t strider_memchr(strider_buffer_view_t view, int ch);
+
+/**
+ * @brief Find first occurrence of byte in buffer (SIMD-accelerated)
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_memchr()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_memchr_simd(strider_buffer_view_t view, int ch);
+
+/**
+ * @brief Find last occurrence of byte in buffer (scalar reference)
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of last occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Useful for tail-follow: find the last complete line in a buffer
+ */
+size_t strider_memrchr(strider_buffer_view_t view, int ch);
+
+/**
+ * @brief Find last occurrence of byte in buffer (SIMD-accelerated)
+ *
+ * Scans backward from the end of the buffer one block at a time.
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of last occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_memrchr()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_memrchr_simd(strider_buffer_view_t view, int ch);
+
+/* ========================================================================
+ * Case-Insensitive Search
+ * ======================================================================== */
+
+/**
+ * @brief Find first byte equal to ch ignoring ASCII case (scalar reference)
+ *
+ * Only A-Z and a-z are folded; other bytes (including UTF-8) must match
+ * exactly.
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ */
+size_t strider_memchr_nocase(strider_buffer_view_t view, int ch);
+
+/**
+ * @brief Find first byte equal to ch ignoring ASCII case (SIMD-accelerated)
+ *
+ * Folds the buffer in registers (range check for A-Z, then OR 0x20), so
+ * the input needs no lower-cased copy.
+ *
+ * @param view Buffer to search
+ * @param ch Byte to find (converted to unsigned char)
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_memchr_nocase()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_memchr_nocase_simd(strider_buffer_view_t view, int ch);
+
+/* ========================================================================
+ * Batch Search
+ * ======================================================================== */
+
+/**
+ * @brief Search many buffers for one byte (scalar reference)
+ *
+ * @param views Buffers to search
+ * @param count Number of buffers
+ * @param ch Byte to find (converted to unsigned char)
+ * @param results Output: strider_memchr(views[i], ch) for every buffer
+ * @return Number of buffers containing ch
+ */
+size_t strider_memchr_batch(const strider_buffer_view_t *views, size_t count, int ch,
+                            size_t *results);
+
+/**
+ * @brief Search many buffers for one byte (SIMD-accelerated)
+ *
+ * Same results as strider_memchr_simd() per buffer, without its per-call
+ * cost: dispatch and the broadcast needle are set up once, and the
+ * buffers a few positions ahead are prefetched while one is searched.
+ *
+ * @note Guaranteed to return same result as strider_memchr_batch()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_memchr_batch_simd(const strider_buffer_view_t *views, size_t count, int ch,
+                                 size_t *results);
+
+/**
+ * @brief Search many spans of one buffer for one byte (scalar reference)
+ *
+ * Spans are offset/length pairs, e.g. the fields produced by
+ * strider_tokenize_lines().
+ *
+ * @param base Buffer the span offsets are relative to
+ * @param spans Spans to search
+ * @param count Number of spans
+ * @param ch Byte to find (converted to unsigned char)
+ * @param results Output: offset of ch within each span, or STRIDER_NOT_FOUND
+ * @return Number of spans containing ch
+ */
+size_t strider_memchr_spans(const char *base, const strider_field_span_t *spans, size_t count,
+                            int ch, size_t *results);
+
+/**
+ * @brief Search many spans of one buffer for one byte (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_memchr_spans()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_memchr_spans_simd(const char *base, const strider_field_span_t *spans,
+                                 size_t count, int ch, size_t *results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_MEMCHR_H */
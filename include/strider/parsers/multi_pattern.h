@@ -0,0 +1,125 @@
+/**
+ * @file multi_pattern.h
+ * @brief Multi-literal matching (find any of many keywords in one pass)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * A strider_multi_pattern_t is compiled once from a set of literal
+ * patterns and reports every occurrence of every pattern in a single
+ * scan, so the cost does not grow linearly with the number of keywords.
+ *
+ * Two engines are built:
+ * - Teddy: a SIMD prefilter for small sets (up to
+ *   STRIDER_TEDDY_MAX_PATTERNS). Patterns are split into 8 buckets and
+ *   nibble lookup tables over the first 1-3 pattern bytes flag candidate
+ *   offsets per bucket, which are then verified with memcmp.
+ * - Aho-Corasick: a DFA with byte-class compression and breadth-first
+ *   state numbering (hot shallow states share cache lines), used for
+ *   larger sets and on backends without a byte shuffle.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_MULTI_PATTERN_H
+#define STRIDER_PARSERS_MULTI_PATTERN_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Largest pattern set searched with the Teddy prefilter */
+#define STRIDER_TEDDY_MAX_PATTERNS 64
+
+/**
+ * @brief One pattern occurrence
+ */
+typedef struct {
+    uint32_t pattern_id; /**< Index of the pattern passed to create() */
+    size_t offset;       /**< Offset of the first matched byte */
+} strider_match_t;
+
+/**
+ * @brief Compiled multi-pattern matcher (opaque)
+ */
+typedef struct strider_multi_pattern strider_multi_pattern_t;
+
+/**
+ * @brief Compile a set of literal patterns
+ *
+ * @param patterns Pattern bytes; pattern i is reported as pattern_id i
+ * @param count Number of patterns
+ * @return Matcher (copies the patterns), or NULL on invalid arguments
+ *         (no patterns, an empty pattern) or allocation failure
+ *
+ * Example:
+ * @code
+ *   strider_buffer_view_t keywords[] = {
+ *       strider_buffer_view_from_cstr("timeout"),
+ *       strider_buffer_view_from_cstr("OOM"),
+ *   };
+ *   strider_multi_pattern_t *mp = strider_multi_pattern_create(keywords, 2);
+ * @endcode
+ */
+strider_multi_pattern_t *strider_multi_pattern_create(const strider_buffer_view_t *patterns,
+                                                      size_t count);
+
+/**
+ * @brief Free a matcher
+ *
+ * @param mp Matcher to free (NULL is ignored)
+ */
+void strider_multi_pattern_destroy(strider_multi_pattern_t *mp);
+
+/**
+ * @brief Number of patterns in a matcher
+ */
+size_t strider_multi_pattern_count(const strider_multi_pattern_t *mp);
+
+/**
+ * @brief Find all pattern occurrences (scalar reference)
+ *
+ * Matches are reported ordered by offset, then by pattern_id.
+ * Overlapping occurrences are all reported.
+ *
+ * @param mp Compiled matcher
+ * @param haystack Buffer to search
+ * @param matches Output array
+ * @param max_matches Capacity of matches
+ * @return Number of matches stored; if equal to max_matches, more
+ *         matches may exist past the last one stored
+ *
+ * @note This is the reference implementation for testing SIMD variants
+ */
+size_t strider_multi_pattern_find(const strider_multi_pattern_t *mp,
+                                  strider_buffer_view_t haystack, strider_match_t *matches,
+                                  size_t max_matches);
+
+/**
+ * @brief Find all pattern occurrences (SIMD-accelerated)
+ *
+ * @param mp Compiled matcher
+ * @param haystack Buffer to search
+ * @param matches Output array
+ * @param max_matches Capacity of matches
+ * @return Number of matches stored (same contents and order as
+ *         strider_multi_pattern_find())
+ *
+ * @note Guaranteed to return same result as strider_multi_pattern_find()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_multi_pattern_find_simd(const strider_multi_pattern_t *mp,
+                                       strider_buffer_view_t haystack, strider_match_t *matches,
+                                       size_t max_matches);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_MULTI_PATTERN_H */
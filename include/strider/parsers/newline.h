@@ -16,8 +16,12 @@
 #define STRIDER_PARSERS_NEWLINE_H
 
 #include "strider/config.h"
+#include "strider/utils/arena.h"
+#include "strider/utils/thread_pool.h"
 #include "strider/utils/memory.h"
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,7 +54,7 @@ size_t strider_count_newlines(const char *data, size_t size);
  *
  * @note Optimized for large buffers (>1KB)
  * @note Handles unaligned buffers
- * @note Automatically uses best SIMD implementation for platform
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
  */
 size_t strider_count_newlines_simd(const char *data, size_t size);
 
@@ -73,6 +77,252 @@ size_t strider_count_newlines_simd(const char *data, size_t size);
 size_t strider_find_newline_positions(const char *data, size_t size, size_t *positions,
                                       size_t max_positions);
 
+/**
+ * @brief Find positions of all newlines in buffer (SIMD-accelerated)
+ *
+ * Builds a bitmask of newline bytes per 64-byte block and converts it
+ * to offsets with count-trailing-zeros / clear-lowest-bit loops.
+ * Guaranteed to return the same count and positions as
+ * strider_find_newline_positions(), including \r\n pairs split across
+ * vector boundaries.
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param positions Output array to store newline positions
+ * @param max_positions Maximum number of positions to store
+ * @return Number of newlines found (may be > max_positions)
+ *
+ * @note Never writes past positions[max_positions - 1]
+ * @note Entries after the returned count (but below max_positions) may
+ *       be overwritten with unspecified values
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_find_newline_positions_simd(const char *data, size_t size, size_t *positions,
+                                           size_t max_positions);
+
+/**
+ * @brief Find positions of all newlines into arena memory (SIMD-accelerated)
+ *
+ * Counts the newlines first, so the output is sized exactly and no
+ * maximum has to be guessed.
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param arena Arena for the output, or NULL for strider_thread_arena()
+ * @param count Output: number of newlines found
+ * @return Positions, valid until the arena is reset, or NULL if the
+ *         allocation failed
+ */
+size_t *strider_find_newline_positions_arena(const char *data, size_t size,
+                                             strider_arena_t *arena, size_t *count);
+
+/* ========================================================================
+ * Compact Position Output
+ * ======================================================================== */
+
+/**
+ * @brief Find newline positions as 32-bit offsets (scalar reference)
+ *
+ * Stores base + offset of each newline, in half the space of
+ * strider_find_newline_positions(). Intended for chunks of a larger
+ * input, with base being the chunk's offset in a window of up to 4 GiB.
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param base Value added to every offset
+ * @param positions Output array for base + newline offset
+ * @param max_positions Maximum number of positions to store
+ * @return Number of newlines found (may be > max_positions), or
+ *         STRIDER_NOT_FOUND if base + size exceeds 2^32 (nothing is stored)
+ */
+size_t strider_find_newline_positions32(const char *data, size_t size, uint32_t base,
+                                        uint32_t *positions, size_t max_positions);
+
+/**
+ * @brief Find newline positions as 32-bit offsets (SIMD-accelerated)
+ *
+ * Same results as strider_find_newline_positions32(), with the
+ * strider_find_newline_positions_simd() output rules.
+ *
+ * @note Entries after the returned count (but below max_positions) may
+ *       be overwritten with unspecified values
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_find_newline_positions32_simd(const char *data, size_t size, uint32_t base,
+                                             uint32_t *positions, size_t max_positions);
+
+/**
+ * @brief Find newline positions and pack them as varint gaps (scalar reference)
+ *
+ * Writes, for each newline, the LEB128 varint of its distance from the
+ * previous newline minus one (the first is its offset from data). Log
+ * lines under 129 bytes take one byte each, and the output is never
+ * longer than the input.
+ *
+ * Stops before the first newline whose varint does not fit; resume by
+ * scanning data + *consumed (its gaps start from zero again).
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param out Output buffer
+ * @param capacity Size of out in bytes (size bytes always suffice)
+ * @param out_size Bytes written to out (may be NULL)
+ * @param consumed Bytes of data covered by the output: size, or the
+ *                 offset of the first newline left out (may be NULL)
+ * @return Number of newlines packed
+ */
+size_t strider_pack_newline_positions(const char *data, size_t size, uint8_t *out,
+                                      size_t capacity, size_t *out_size, size_t *consumed);
+
+/**
+ * @brief Find newline positions and pack them as varint gaps (SIMD-accelerated)
+ *
+ * Same output as strider_pack_newline_positions(); gaps are encoded
+ * straight from the 64-byte block masks without an intermediate
+ * position array.
+ *
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_pack_newline_positions_simd(const char *data, size_t size, uint8_t *out,
+                                           size_t capacity, size_t *out_size, size_t *consumed);
+
+/**
+ * @brief Expand packed newline gaps into positions
+ *
+ * @param packed Output of strider_pack_newline_positions()
+ * @param packed_size Size of packed in bytes
+ * @param base Value added to every position (e.g. the scanned chunk's offset)
+ * @param positions Output array
+ * @param max_positions Maximum number of positions to store
+ * @return Number of positions stored (stops early at a truncated varint)
+ */
+size_t strider_unpack_newline_positions(const uint8_t *packed, size_t packed_size, size_t base,
+                                        size_t *positions, size_t max_positions);
+
+/* ========================================================================
+ * Parallel Interface
+ * ======================================================================== */
+
+/** Bytes per task of the parallel scanners (about one L2 cache) */
+#define STRIDER_PARALLEL_SEGMENT_SIZE (256 * 1024)
+
+/**
+ * @brief Count newlines using several threads
+ *
+ * Splits the buffer into STRIDER_PARALLEL_SEGMENT_SIZE segments counted
+ * independently; a segment starting with the \n of a \r\n pair that
+ * straddles the seam skips it.
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param executor Executor for the segments (e.g.
+ *                 strider_thread_pool_executor()), or NULL to run on the
+ *                 calling thread
+ * @return Number of newlines found (same as strider_count_newlines())
+ */
+size_t strider_count_newlines_parallel(const char *data, size_t size,
+                                       const strider_executor_t *executor);
+
+/**
+ * @brief Find newline positions using several threads
+ *
+ * Counts every segment first, turns the counts into output offsets with
+ * a prefix sum, then lets every segment write its positions straight
+ * into its slice of the output array.
+ *
+ * @param data Buffer to scan
+ * @param size Size of buffer in bytes
+ * @param positions Output array to store newline positions
+ * @param max_positions Maximum number of positions to store
+ * @param executor Executor for the segments, or NULL to run on the
+ *                 calling thread
+ * @return Number of newlines found (may be > max_positions)
+ *
+ * @note Stores the same positions as strider_find_newline_positions()
+ * @note Never writes past positions[max_positions - 1]
+ */
+size_t strider_find_newline_positions_parallel(const char *data, size_t size, size_t *positions,
+                                               size_t max_positions,
+                                               const strider_executor_t *executor);
+
+/* ========================================================================
+ * Streaming Interface
+ * ======================================================================== */
+
+/**
+ * @brief Resumable newline scanner state
+ *
+ * Carries what one buffer needs from the previous one: whether it ended
+ * in \r (so a leading \n completes a \r\n pair that was already
+ * counted) and the global offset of the next byte. Feeding a stream in
+ * chunks gives the same counts and positions as one call over the
+ * concatenated data.
+ *
+ * Example:
+ * @code
+ *   strider_newline_stream_t stream;
+ *   strider_newline_stream_init(&stream);
+ *   while ((n = read(fd, buf, sizeof(buf))) > 0) {
+ *       strider_newline_stream_feed(&stream, buf, (size_t) n);
+ *   }
+ *   size_t total = strider_newline_stream_finish(&stream);
+ * @endcode
+ */
+typedef struct {
+    size_t offset;   /**< Bytes consumed so far (global offset of next byte) */
+    size_t newlines; /**< Newlines found so far */
+    bool pending_cr; /**< Last byte consumed was \r */
+} strider_newline_stream_t;
+
+/**
+ * @brief Reset a stream to the start of input
+ */
+void strider_newline_stream_init(strider_newline_stream_t *stream);
+
+/**
+ * @brief Count newlines in the next chunk of a stream
+ *
+ * @param stream Stream state
+ * @param data Next chunk
+ * @param size Size of chunk in bytes (may be 0)
+ * @return Number of newlines found in this chunk
+ *
+ * @note A \r\n pair split across chunks is counted once, in the chunk
+ *       holding the \r
+ * @note Uses the SIMD kernels (see strider_count_newlines_simd())
+ */
+size_t strider_newline_stream_feed(strider_newline_stream_t *stream, const char *data,
+                                   size_t size);
+
+/**
+ * @brief Find newline positions in the next chunk of a stream
+ *
+ * Same as strider_newline_stream_feed() but also stores the global
+ * offset (from the start of the stream) of each newline.
+ *
+ * @param stream Stream state
+ * @param data Next chunk
+ * @param size Size of chunk in bytes (may be 0)
+ * @param positions Output array for global newline positions
+ * @param max_positions Maximum number of positions to store
+ * @return Number of newlines found in this chunk (may be > max_positions)
+ *
+ * @note Positions follow strider_find_newline_positions_simd() rules:
+ *       \r\n pairs point to the \r, entries past the returned count may
+ *       be overwritten
+ */
+size_t strider_newline_stream_feed_positions(strider_newline_stream_t *stream, const char *data,
+                                             size_t size, size_t *positions,
+                                             size_t max_positions);
+
+/**
+ * @brief End a stream
+ *
+ * @param stream Stream state (reset, ready for new input)
+ * @return Total newlines found over the whole stream
+ */
+size_t strider_newline_stream_finish(strider_newline_stream_t *stream);
+
 #ifdef __cplusplus
 }
 #endif
@@ -41,7 +41,8 @@ const char *strider_strchr(const char *str, int ch);
  * @brief Find first occurrence of character in string (SIMD-accelerated)
  *
  * Uses SIMD instructions (SSE2/AVX2/NEON) to search for character in parallel.
- * Handles unaligned buffers with prefix/suffix scalar fallback.
+ * Reads whole aligned vectors, which may extend past the terminator but
+ * never into another page.
  *
  * @param str Null-terminated string to search
  * @param ch Character to find (converted to unsigned char)
@@ -49,10 +50,35 @@ const char *strider_strchr(const char *str, int ch);
  *
  * @note Guaranteed to return same result as strider_strchr()
  * @note Performance improves with longer strings (>16 bytes)
- * @note Automatically uses best SIMD implementation for platform
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
  */
 const char *strider_strchr_simd(const char *str, int ch);
 
+/**
+ * @brief Search many strings for one character (scalar reference)
+ *
+ * @param strs Null-terminated strings to search
+ * @param count Number of strings
+ * @param ch Character to find (converted to unsigned char)
+ * @param results Output: strider_strchr(strs[i], ch) for every string
+ * @return Number of strings containing ch
+ */
+size_t strider_strchr_batch(const char *const *strs, size_t count, int ch, const char **results);
+
+/**
+ * @brief Search many strings for one character (SIMD-accelerated)
+ *
+ * Same results as strider_strchr_simd() per string, without its per-call
+ * cost: dispatch and the vector constants are set up once, and the
+ * strings a few positions ahead are prefetched while one is searched.
+ * Meant for many short strings such as header values.
+ *
+ * @note Guaranteed to return same result as strider_strchr_batch()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_strchr_batch_simd(const char *const *strs, size_t count, int ch,
+                                 const char **results);
+
 #ifdef __cplusplus
 }
 #endif
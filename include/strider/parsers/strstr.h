@@ -0,0 +1,145 @@
+/**
+ * @file strstr.h
+ * @brief Length-bounded substring search (strstr/memmem-like functionality)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * The SIMD search uses the "generic SIMD" first/last-byte filter: the
+ * needle's first and last bytes are broadcast and compared against the
+ * haystack at offsets 0 and needle_size - 1, so only positions where
+ * both match are verified with a byte compare. A precompiled
+ * strider_needle_t lets repeated searches for the same token (e.g. one
+ * per log line) skip the setup. The _nocase variants ignore ASCII case
+ * by folding haystack vectors in registers before the compares.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_STRSTR_H
+#define STRIDER_PARSERS_STRSTR_H
+
+#include "strider/config.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Precompiled substring needle
+ *
+ * @note Borrows the needle bytes: they must outlive the handle
+ * @note Build with strider_needle_init(); treat fields as read-only
+ */
+typedef struct {
+    const uint8_t *data; /**< Needle bytes (not owned) */
+    size_t size;         /**< Needle length */
+    uint8_t first;       /**< data[0], broadcast by the filter */
+    uint8_t last;        /**< data[size - 1], broadcast by the filter */
+} strider_needle_t;
+
+/**
+ * @brief Compile a needle for repeated searches
+ *
+ * @param needle Handle to initialize
+ * @param view Needle bytes (may be empty)
+ * @return 0 on success, -1 on invalid arguments
+ *
+ * Example:
+ * @code
+ *   strider_needle_t error;
+ *   strider_needle_init(&error, strider_buffer_view_from_cstr("ERROR"));
+ *   size_t pos = strider_needle_find(line, &error);
+ * @endcode
+ */
+int strider_needle_init(strider_needle_t *needle, strider_buffer_view_t view);
+
+/**
+ * @brief Find first occurrence of needle in haystack (scalar reference)
+ *
+ * @param haystack Buffer to search
+ * @param needle Bytes to find
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND. An empty
+ *         needle matches at offset 0.
+ *
+ * @note This is the reference implementation for testing SIMD variants
+ */
+size_t strider_strstr(strider_buffer_view_t haystack, strider_buffer_view_t needle);
+
+/**
+ * @brief Find first occurrence of needle in haystack (SIMD-accelerated)
+ *
+ * Convenience wrapper that compiles the needle and calls
+ * strider_needle_find().
+ *
+ * @param haystack Buffer to search
+ * @param needle Bytes to find
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_strstr()
+ */
+size_t strider_strstr_simd(strider_buffer_view_t haystack, strider_buffer_view_t needle);
+
+/**
+ * @brief Find first occurrence of a precompiled needle (SIMD-accelerated)
+ *
+ * @param haystack Buffer to search
+ * @param needle Needle compiled with strider_needle_init()
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_strstr()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_needle_find(strider_buffer_view_t haystack, const strider_needle_t *needle);
+
+/* ========================================================================
+ * Case-Insensitive Search
+ * ======================================================================== */
+
+/**
+ * @brief Find first occurrence ignoring ASCII case (scalar reference)
+ *
+ * Only A-Z and a-z are folded; other bytes (including UTF-8) must match
+ * exactly.
+ *
+ * @param haystack Buffer to search
+ * @param needle Bytes to find
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND. An empty
+ *         needle matches at offset 0.
+ */
+size_t strider_strstr_nocase(strider_buffer_view_t haystack, strider_buffer_view_t needle);
+
+/**
+ * @brief Find first occurrence ignoring ASCII case (SIMD-accelerated)
+ *
+ * Convenience wrapper that compiles the needle and calls
+ * strider_needle_find_nocase().
+ *
+ * @note Guaranteed to return same result as strider_strstr_nocase()
+ */
+size_t strider_strstr_nocase_simd(strider_buffer_view_t haystack, strider_buffer_view_t needle);
+
+/**
+ * @brief Find first occurrence of a precompiled needle ignoring ASCII case
+ *
+ * The same needle handle serves case-sensitive and case-insensitive
+ * searches; the needle may be given in any case.
+ *
+ * @param haystack Buffer to search
+ * @param needle Needle compiled with strider_needle_init()
+ * @return Offset of first occurrence, or STRIDER_NOT_FOUND
+ *
+ * @note Guaranteed to return same result as strider_strstr_nocase()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_needle_find_nocase(strider_buffer_view_t haystack, const strider_needle_t *needle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_STRSTR_H */
@@ -0,0 +1,124 @@
+/**
+ * @file timestamp.h
+ * @brief Timestamp extraction for common log formats
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Parses the timestamp at the start of a log line into nanoseconds since
+ * the Unix epoch (UTC). SIMD kernels check the fixed digit/separator
+ * layout of a stamp with one vector compare against a template and turn
+ * the digits into numbers with a byte multiply-add (pmaddubsw /
+ * vmull_u8), leaving only the calendar arithmetic to scalar code.
+ *
+ * Supported formats:
+ * - ISO 8601 / RFC 3339: "2025-12-31T23:59:59", 'T', 't' or ' ' between
+ *   date and time, then an optional fraction ('.' or ',' and 1-9 digits;
+ *   further digits are consumed and ignored) and an optional zone ("Z",
+ *   "+hh:mm", "+hhmm" or "+hh"). Stamps without a zone are taken as UTC.
+ * - Syslog (RFC 3164): "Dec 31 23:59:59" or "Jan  1 00:00:00", with an
+ *   optional fraction. The year is supplied by the caller.
+ * - Epoch: decimal seconds with an optional fraction, "1767225599.123".
+ *
+ * Dates are validated (month lengths, leap years). Seconds may be 60 to
+ * allow leap seconds; the result then equals the next minute.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_TIMESTAMP_H
+#define STRIDER_PARSERS_TIMESTAMP_H
+
+#include "strider/config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Batch output for lines that do not start with a valid timestamp */
+#define STRIDER_TIMESTAMP_INVALID INT64_MIN
+
+/**
+ * @brief Timestamp layouts
+ */
+typedef enum {
+    STRIDER_TIMESTAMP_ISO8601, /**< 2025-12-31T23:59:59.123Z */
+    STRIDER_TIMESTAMP_SYSLOG,  /**< Dec 31 23:59:59 */
+    STRIDER_TIMESTAMP_EPOCH,   /**< 1767225599.123 */
+} strider_timestamp_format_t;
+
+/**
+ * @brief Parse the timestamp at the start of data (scalar reference)
+ *
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param format Expected layout
+ * @param year Year of syslog stamps (ignored by other formats)
+ * @param ns Output: nanoseconds since 1970-01-01T00:00:00Z
+ * @return Length of the stamp in bytes, or 0 if data does not start with
+ *         a valid timestamp (ns is then left unchanged)
+ *
+ * @note Results outside the int64 nanosecond range
+ *       (1677-09-21T00:12:43.145224192Z to 2262-04-11T23:47:16.854775807Z)
+ *       are rejected
+ * @note This is the reference implementation for testing SIMD variants
+ */
+size_t strider_parse_timestamp(const char *data, size_t size, strider_timestamp_format_t format,
+                               int year, int64_t *ns);
+
+/**
+ * @brief Parse the timestamp at the start of data (SIMD-accelerated)
+ *
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param format Expected layout
+ * @param year Year of syslog stamps (ignored by other formats)
+ * @param ns Output: nanoseconds since 1970-01-01T00:00:00Z
+ * @return Length of the stamp in bytes, or 0 if there is none
+ *
+ * @note Guaranteed to return same result as strider_parse_timestamp()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_parse_timestamp_simd(const char *data, size_t size,
+                                    strider_timestamp_format_t format, int year, int64_t *ns);
+
+/**
+ * @brief Parse the timestamp of every line (scalar reference)
+ *
+ * Line i runs from the end of newline i - 1 (the start of data for
+ * i = 0) to positions[i], as returned by strider_find_newline_positions().
+ * Text after the last newline is not a line here; parse it with
+ * strider_parse_timestamp() if needed.
+ *
+ * @param data Input text
+ * @param size Size of input in bytes
+ * @param positions Newline positions in data
+ * @param count Number of positions
+ * @param format Expected layout
+ * @param year Year of syslog stamps (ignored by other formats)
+ * @param timestamps Output: count values, STRIDER_TIMESTAMP_INVALID for
+ *                   lines without a valid timestamp
+ * @return Number of lines with a valid timestamp
+ */
+size_t strider_parse_timestamps(const char *data, size_t size, const size_t *positions,
+                                size_t count, strider_timestamp_format_t format, int year,
+                                int64_t *timestamps);
+
+/**
+ * @brief Parse the timestamp of every line (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_parse_timestamps()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_parse_timestamps_simd(const char *data, size_t size, const size_t *positions,
+                                     size_t count, strider_timestamp_format_t format, int year,
+                                     int64_t *timestamps);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_TIMESTAMP_H */
@@ -0,0 +1,182 @@
+/**
+ * @file tokenize.h
+ * @brief Field tokenization (space, CSV, logfmt and JSON-lines records)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Splits lines into fields at separator bytes, honoring quotes and
+ * escapes, without copying: fields point into the input.
+ *
+ * Rules, applied left to right:
+ * - An escape character makes the next byte literal (also another
+ *   escape, a quote or a separator), inside or outside quotes
+ * - An unescaped quote character toggles quoting; separators inside
+ *   quotes are literal. Quotes stay part of the field, so
+ *   msg="a b" is one field (see strider_field_unquote())
+ * - With merge_separators, runs of separators act as one and leading or
+ *   trailing separators produce no fields ("a  b " -> "a", "b").
+ *   Otherwise every separator ends a field ("a,,b" -> "a", "", "b").
+ *   An empty line has no fields either way.
+ *
+ * SIMD kernels follow the two stages of simdjson: stage 1 builds 64-bit
+ * masks of quotes, escapes and separators per 64-byte block and removes
+ * quoted separators with a prefix XOR (a carry-less multiply where the
+ * CPU has one); stage 2 turns the remaining separator bits into field
+ * spans.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_PARSERS_TOKENIZE_H
+#define STRIDER_PARSERS_TOKENIZE_H
+
+#include "strider/config.h"
+#include "strider/parsers/byteset.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Compiled tokenizer settings
+ *
+ * @note Build with strider_tokenizer_init() or
+ *       strider_tokenizer_init_format(); treat fields as read-only
+ */
+typedef struct {
+    strider_byteset_t separators; /**< Bytes that end a field */
+    uint8_t quote;                /**< Quote character (if has_quote) */
+    uint8_t escape;               /**< Escape character (if has_escape) */
+    bool has_quote;               /**< Whether quotes are recognized */
+    bool has_escape;              /**< Whether escapes are recognized */
+    bool merge_separators;        /**< Runs of separators act as one */
+} strider_tokenizer_t;
+
+/**
+ * @brief Common record layouts for strider_tokenizer_init_format()
+ */
+typedef enum {
+    STRIDER_TOKENIZE_WHITESPACE, /**< Space/tab separated, "quoted" and \-escaped */
+    STRIDER_TOKENIZE_CSV,        /**< Comma separated, "quoted" ("" inside quotes) */
+    STRIDER_TOKENIZE_LOGFMT,     /**< key=value pairs: fields are "key" and "value" */
+    STRIDER_TOKENIZE_JSON,       /**< Flat JSON objects: fields are keys and values */
+} strider_tokenize_format_t;
+
+/* Fields of a line in a batch are strider_field_span_t (utils/memory.h) */
+
+/**
+ * @brief Initialize a tokenizer
+ *
+ * @param tok Tokenizer to initialize
+ * @param separators Separator bytes
+ * @param count Number of separator bytes (at least 1)
+ * @param quote Quote character, or -1 for none
+ * @param escape Escape character, or -1 for none
+ * @param merge_separators Whether runs of separators act as one
+ * @return 0 on success, -1 on invalid arguments (including a quote or
+ *         escape character that is also a separator, or quote == escape)
+ *
+ * Example:
+ * @code
+ *   strider_tokenizer_t tok;
+ *   strider_tokenizer_init(&tok, "|", 1, -1, -1, false);
+ * @endcode
+ */
+int strider_tokenizer_init(strider_tokenizer_t *tok, const char *separators, size_t count,
+                           int quote, int escape, bool merge_separators);
+
+/**
+ * @brief Initialize a tokenizer for a common record layout
+ *
+ * LOGFMT splits at spaces and '=' (merged) so keys and values alternate
+ * for well-formed input ("a=1 b=2" -> "a", "1", "b", "2"). JSON splits at
+ * whitespace and {}[],: outside strings, giving keys and values of flat
+ * objects with their quotes ("{"a":1}" -> "\"a\"", "1").
+ *
+ * @return 0 on success, -1 on invalid arguments
+ */
+int strider_tokenizer_init_format(strider_tokenizer_t *tok, strider_tokenize_format_t format);
+
+/**
+ * @brief Split one line into fields (scalar reference)
+ *
+ * @param tok Tokenizer settings
+ * @param line Line without its newline
+ * @param fields Output: views into line
+ * @param max_fields Capacity of fields; if a line has more fields the
+ *                   last one written extends to the end of the line
+ * @return Number of fields written
+ */
+size_t strider_tokenize(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                        strider_buffer_view_t *fields, size_t max_fields);
+
+/**
+ * @brief Split one line into fields (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_tokenize()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_tokenize_simd(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                             strider_buffer_view_t *fields, size_t max_fields);
+
+/**
+ * @brief Split many lines into one flat array of field spans (scalar reference)
+ *
+ * Line i runs from the end of newline i - 1 (the start of data for
+ * i = 0) to positions[i], as returned by strider_find_newline_positions().
+ * The fields of line i are spans[field_index[i]] to
+ * spans[field_index[i + 1] - 1].
+ *
+ * Stops before the first line whose fields do not all fit; size + count
+ * spans are always enough.
+ *
+ * @param tok Tokenizer settings
+ * @param data Input text (lines shorter than 4 GiB)
+ * @param size Size of input in bytes
+ * @param positions Newline positions in data
+ * @param count Number of positions
+ * @param spans Output: field spans
+ * @param max_spans Capacity of spans
+ * @param field_index Output: count + 1 entries, of which the first
+ *                    (return value + 1) are written
+ * @return Number of lines tokenized
+ */
+size_t strider_tokenize_lines(const strider_tokenizer_t *tok, const char *data, size_t size,
+                              const size_t *positions, size_t count, strider_field_span_t *spans,
+                              size_t max_spans, size_t *field_index);
+
+/**
+ * @brief Split many lines into one flat array of field spans (SIMD-accelerated)
+ *
+ * @note Guaranteed to return same result as strider_tokenize_lines()
+ * @note Dispatches at runtime to the best backend for the CPU (see strider/dispatch.h)
+ */
+size_t strider_tokenize_lines_simd(const strider_tokenizer_t *tok, const char *data, size_t size,
+                                   const size_t *positions, size_t count,
+                                   strider_field_span_t *spans, size_t max_spans,
+                                   size_t *field_index);
+
+/**
+ * @brief Remove the quotes around a field
+ *
+ * Only a field that starts and ends with the quote character changes;
+ * escapes and doubled quotes inside are left alone (no copy is made).
+ *
+ * @param tok Tokenizer the field came from
+ * @param field Field view
+ * @return View without the surrounding quotes
+ */
+strider_buffer_view_t strider_field_unquote(const strider_tokenizer_t *tok,
+                                            strider_buffer_view_t field);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_PARSERS_TOKENIZE_H */
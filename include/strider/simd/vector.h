@@ -28,6 +28,9 @@
 /* Platform-specific intrinsics headers */
 #if defined(STRIDER_ARCH_X86_64)
 #    include <emmintrin.h> /* SSE2 */
+#    ifdef STRIDER_HAS_SSSE3
+#        include <tmmintrin.h> /* SSSE3 */
+#    endif
 #    ifdef STRIDER_HAS_AVX2
 #        include <immintrin.h> /* AVX2, AVX-512 */
 #    endif
@@ -190,6 +193,22 @@ static inline strider_vec128_t strider_vec128_set1(uint8_t value) {
     return result;
 }
 
+/**
+ * @brief Broadcast a 64-bit value (its bytes in memory order) to both halves
+ */
+static inline strider_vec128_t strider_vec128_set1_u64(uint64_t value) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_set1_epi64x((long long) value);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vreinterpretq_u8_u64(vdupq_n_u64(value));
+#else
+    memcpy(result.data, &value, 8);
+    memcpy(result.data + 8, &value, 8);
+#endif
+    return result;
+}
+
 /**
  * @brief Create zero vector
  *
@@ -228,6 +247,19 @@ static inline strider_vec256_t strider_vec256_load_aligned(const void *ptr) {
     return result;
 }
 
+static inline strider_vec256_t strider_vec256_load_unaligned(const void *ptr) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_loadu_si256((const __m256i *) ptr);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vld1q_u8((const uint8_t *) ptr);
+    result.data[1] = vld1q_u8((const uint8_t *) ptr + 16);
+#    else
+    memcpy(result.data, ptr, 32);
+#    endif
+    return result;
+}
+
 static inline void strider_vec256_store_aligned(void *ptr, strider_vec256_t vec) {
 #    if defined(STRIDER_HAS_AVX2)
     _mm256_store_si256((__m256i *) ptr, vec.data);
@@ -239,6 +271,17 @@ static inline void strider_vec256_store_aligned(void *ptr, strider_vec256_t vec)
 #    endif
 }
 
+static inline void strider_vec256_store_unaligned(void *ptr, strider_vec256_t vec) {
+#    if defined(STRIDER_HAS_AVX2)
+    _mm256_storeu_si256((__m256i *) ptr, vec.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    vst1q_u8((uint8_t *) ptr, vec.data[0]);
+    vst1q_u8((uint8_t *) ptr + 16, vec.data[1]);
+#    else
+    memcpy(ptr, vec.data, 32);
+#    endif
+}
+
 static inline strider_vec256_t strider_vec256_set1(uint8_t value) {
     strider_vec256_t result;
 #    if defined(STRIDER_HAS_AVX2)
@@ -254,6 +297,21 @@ static inline strider_vec256_t strider_vec256_set1(uint8_t value) {
     return result;
 }
 
+static inline strider_vec256_t strider_vec256_set1_u64(uint64_t value) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_set1_epi64x((long long) value);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vreinterpretq_u8_u64(vdupq_n_u64(value));
+    result.data[1] = result.data[0];
+#    else
+    for (int i = 0; i < 32; i += 8) {
+        memcpy(result.data + i, &value, 8);
+    }
+#    endif
+    return result;
+}
+
 static inline strider_vec256_t strider_vec256_zero(void) {
     strider_vec256_t result;
 #    if defined(STRIDER_HAS_AVX2)
@@ -298,6 +356,30 @@ static inline strider_vec128_t strider_vec128_cmpeq(strider_vec128_t a, strider_
     return result;
 }
 
+/**
+ * @brief Element-wise signed greater-than comparison
+ *
+ * @param a First vector
+ * @param b Second vector
+ * @return Vector with 0xFF where (int8_t) a > (int8_t) b, 0x00 elsewhere
+ *
+ * @note Bytes compare as signed; see strider_vec128_in_range() for an
+ *       unsigned range check built on it
+ */
+static inline strider_vec128_t strider_vec128_cmpgt_i8(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_cmpgt_epi8(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vcgtq_s8(vreinterpretq_s8_u8(a.data), vreinterpretq_s8_u8(b.data));
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = ((int8_t) a.data[i] > (int8_t) b.data[i]) ? 0xFF : 0x00;
+    }
+#endif
+    return result;
+}
+
 /**
  * @brief Extract sign bit mask from vector bytes
  *
@@ -305,45 +387,19 @@ static inline strider_vec128_t strider_vec128_cmpeq(strider_vec128_t a, strider_
  * @return 16-bit mask where bit i = sign bit of byte i
  *
  * @note Used with cmpeq to find matching bytes
- * @note On ARM, extracts MSB of each byte to build mask
+ * @note On ARM this takes several instructions; NEON kernels should
+ *       prefer strider_vec128_nibble_mask() or strider_vec128_movemask64()
  */
 static inline uint32_t strider_vec128_movemask(strider_vec128_t vec) {
 #if defined(STRIDER_ARCH_X86_64)
     return (uint32_t) _mm_movemask_epi8(vec.data);
 #elif defined(STRIDER_ARCH_ARM64)
-    /* ARM NEON: Extract MSB from each byte and pack into mask
-     * Strategy: Narrow and shift to pack 16 MSBs into 16 bits */
-
-    /* Shift each byte right by 7 to get MSB in bit 0 */
-    uint8x16_t shifted = vshrq_n_u8(vec.data, 7);
-
-    /* Now each byte is either 0x00 or 0x01 */
-    /* Pack pairs of bytes into nibbles using shifts */
-    uint8x16_t mask_0 = shifted;
-    uint8x16_t mask_1 = vshlq_n_u8(shifted, 1);
-    uint8x16_t mask_2 = vshlq_n_u8(shifted, 2);
-    uint8x16_t mask_3 = vshlq_n_u8(shifted, 3);
-    uint8x16_t mask_4 = vshlq_n_u8(shifted, 4);
-    uint8x16_t mask_5 = vshlq_n_u8(shifted, 5);
-    uint8x16_t mask_6 = vshlq_n_u8(shifted, 6);
-    uint8x16_t mask_7 = vshlq_n_u8(shifted, 7);
-
-    /* Combine adjacent pairs */
-    uint8x16_t pair0 = vorrq_u8(mask_0, mask_1);
-    uint8x16_t pair1 = vorrq_u8(mask_2, mask_3);
-    uint8x16_t pair2 = vorrq_u8(mask_4, mask_5);
-    uint8x16_t pair3 = vorrq_u8(mask_6, mask_7);
-
-    /* Extract bytes and build mask manually */
-    uint8_t bytes[16];
-    vst1q_u8(bytes, shifted);
+    /* Move each sign bit to bit (i % 8) of its byte, then add up the
+     * bytes of each half (no stores, no scalar loop) */
+    static const int8_t shifts[16] = {0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7};
+    uint8x16_t bits = vshlq_u8(vshrq_n_u8(vec.data, 7), vld1q_s8(shifts));
 
-    uint32_t mask = 0;
-    for (int i = 0; i < 16; i++) {
-        mask |= (bytes[i] & 1) << i;
-    }
-
-    return mask;
+    return (uint32_t) vaddv_u8(vget_low_u8(bits)) | ((uint32_t) vaddv_u8(vget_high_u8(bits)) << 8);
 #else
     /* Scalar fallback */
     uint32_t mask = 0;
@@ -356,6 +412,70 @@ static inline uint32_t strider_vec128_movemask(strider_vec128_t vec) {
 #endif
 }
 
+/**
+ * @brief Compress a compare result to 4 bits per byte
+ *
+ * @param vec Vector whose bytes are 0x00 or 0xFF (a cmpeq result)
+ * @return 64-bit mask where bits 4i..4i+3 are set for byte i
+ *
+ * The first match is at strider_ctz64(mask) / 4 and the number of
+ * matches is strider_popcount64(mask) / 4.
+ *
+ * @note On ARM this is a single shift-right-narrow, much cheaper than an
+ *       exact movemask; other targets expand strider_vec128_movemask()
+ */
+static inline uint64_t strider_vec128_nibble_mask(strider_vec128_t vec) {
+#if defined(STRIDER_ARCH_ARM64)
+    uint8x8_t narrowed = vshrn_n_u16(vreinterpretq_u16_u8(vec.data), 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+#else
+    uint32_t bits = strider_vec128_movemask(vec);
+    uint64_t mask = 0;
+    for (int i = 0; i < 16; i++) {
+        if (bits & (1U << i)) {
+            mask |= (uint64_t) 0xF << (4 * i);
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief Extract sign bit mask from four consecutive vectors
+ *
+ * @return 64-bit mask where bit 16k + i = sign bit of byte i of vector k
+ *
+ * @note On ARM the four vectors are reduced together with pairwise adds,
+ *       which is cheaper than four strider_vec128_movemask() calls
+ */
+static inline uint64_t strider_vec128_movemask64(strider_vec128_t v0, strider_vec128_t v1,
+                                                 strider_vec128_t v2, strider_vec128_t v3) {
+#if defined(STRIDER_ARCH_ARM64)
+    static const uint8_t weights[16] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+                                        0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+    const uint8x16_t weight = vld1q_u8(weights);
+
+    /* Spread each sign bit over its byte, then keep one weight bit */
+    uint8x16_t t0 = vandq_u8(vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(v0.data), 7)),
+                             weight);
+    uint8x16_t t1 = vandq_u8(vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(v1.data), 7)),
+                             weight);
+    uint8x16_t t2 = vandq_u8(vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(v2.data), 7)),
+                             weight);
+    uint8x16_t t3 = vandq_u8(vreinterpretq_u8_s8(vshrq_n_s8(vreinterpretq_s8_u8(v3.data), 7)),
+                             weight);
+
+    /* Three rounds of pairwise adds fold 8 weighted bytes into one */
+    uint8x16_t sum = vpaddq_u8(vpaddq_u8(t0, t1), vpaddq_u8(t2, t3));
+    sum = vpaddq_u8(sum, sum);
+    return vgetq_lane_u64(vreinterpretq_u64_u8(sum), 0);
+#else
+    return (uint64_t) strider_vec128_movemask(v0) | ((uint64_t) strider_vec128_movemask(v1) << 16) |
+           ((uint64_t) strider_vec128_movemask(v2) << 32) |
+           ((uint64_t) strider_vec128_movemask(v3) << 48);
+#endif
+}
+
 /* ========================================================================
  * Comparison Operations (256-bit)
  * ======================================================================== */
@@ -377,6 +497,22 @@ static inline strider_vec256_t strider_vec256_cmpeq(strider_vec256_t a, strider_
     return result;
 }
 
+/* Signed greater-than (see strider_vec128_cmpgt_i8) */
+static inline strider_vec256_t strider_vec256_cmpgt_i8(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_cmpgt_epi8(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vcgtq_s8(vreinterpretq_s8_u8(a.data[0]), vreinterpretq_s8_u8(b.data[0]));
+    result.data[1] = vcgtq_s8(vreinterpretq_s8_u8(a.data[1]), vreinterpretq_s8_u8(b.data[1]));
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = ((int8_t) a.data[i] > (int8_t) b.data[i]) ? 0xFF : 0x00;
+    }
+#    endif
+    return result;
+}
+
 static inline uint32_t strider_vec256_movemask(strider_vec256_t vec) {
 #    if defined(STRIDER_HAS_AVX2)
     return (uint32_t) _mm256_movemask_epi8(vec.data);
@@ -401,6 +537,679 @@ static inline uint32_t strider_vec256_movemask(strider_vec256_t vec) {
 
 #endif /* STRIDER_HAS_AVX2 */
 
+/* ========================================================================
+ * Bitwise and Arithmetic Operations (128-bit)
+ * ======================================================================== */
+
+/**
+ * @brief Bitwise OR
+ */
+static inline strider_vec128_t strider_vec128_or(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_or_si128(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vorrq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] | b.data[i];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Bitwise AND
+ */
+static inline strider_vec128_t strider_vec128_and(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_and_si128(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vandq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] & b.data[i];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Bitwise AND-NOT
+ *
+ * @return a & ~b
+ *
+ * @note Operand order differs from _mm_andnot_si128 (which is ~a & b)
+ */
+static inline strider_vec128_t strider_vec128_andnot(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_andnot_si128(b.data, a.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vbicq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] & (uint8_t) ~b.data[i];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Bitwise XOR
+ */
+static inline strider_vec128_t strider_vec128_xor(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_xor_si128(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = veorq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] ^ b.data[i];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Byte-wise wrapping subtraction
+ *
+ * @return a - b per byte (mod 256)
+ *
+ * @note Subtracting a cmpeq result (0xFF = -1) adds 1 per matching byte
+ */
+static inline strider_vec128_t strider_vec128_sub_u8(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_sub_epi8(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vsubq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = (uint8_t) (a.data[i] - b.data[i]);
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Byte-wise saturating subtraction
+ *
+ * @return max(a - b, 0) per unsigned byte
+ *
+ * @note Non-zero exactly where a > b, so it doubles as an unsigned
+ *       compare against a per-byte threshold
+ */
+static inline strider_vec128_t strider_vec128_subs_u8(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_subs_epu8(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vqsubq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] > b.data[i] ? (uint8_t) (a.data[i] - b.data[i]) : 0;
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Byte-wise unsigned minimum
+ */
+static inline strider_vec128_t strider_vec128_min_u8(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_min_epu8(a.data, b.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vminq_u8(a.data, b.data);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = a.data[i] < b.data[i] ? a.data[i] : b.data[i];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Multiply bytes and add adjacent products into 16-bit lanes
+ *
+ * @param a Unsigned bytes
+ * @param b Weights, each in the range 0-127
+ * @return 8 little-endian uint16 lanes, lane i = a[2i] * b[2i] + a[2i+1] * b[2i+1]
+ *
+ * Turns digit bytes into two-digit values in one step (weights 10, 1).
+ *
+ * @note Maps to pmaddubsw (SSSE3) or vmull_u8 + vpaddq_u16 (NEON);
+ *       emulated with two 16-bit multiplies on SSE2-only builds. Lane
+ *       sums must stay below 32768 for every backend to agree.
+ */
+static inline strider_vec128_t strider_vec128_maddubs(strider_vec128_t a, strider_vec128_t b) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64) && defined(STRIDER_HAS_SSSE3)
+    result.data = _mm_maddubs_epi16(a.data, b.data);
+#elif defined(STRIDER_ARCH_X86_64)
+    const __m128i low = _mm_set1_epi16(0x00FF);
+    __m128i even = _mm_mullo_epi16(_mm_and_si128(a.data, low), _mm_and_si128(b.data, low));
+    __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a.data, 8), _mm_srli_epi16(b.data, 8));
+    result.data = _mm_add_epi16(even, odd);
+#elif defined(STRIDER_ARCH_ARM64)
+    uint16x8_t lo = vmull_u8(vget_low_u8(a.data), vget_low_u8(b.data));
+    uint16x8_t hi = vmull_high_u8(a.data, b.data);
+    result.data = vreinterpretq_u8_u16(vpaddq_u16(lo, hi));
+#else
+    for (int i = 0; i < 16; i += 2) {
+        unsigned sum = a.data[i] * b.data[i] + a.data[i + 1] * b.data[i + 1];
+        result.data[i] = (uint8_t) sum;
+        result.data[i + 1] = (uint8_t) (sum >> 8);
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Horizontal sum of all 16 unsigned bytes
+ *
+ * @return Sum (0-4080)
+ *
+ * @note Uses psadbw on x86 and vaddlvq on ARM64
+ */
+static inline uint64_t strider_vec128_sum_u8(strider_vec128_t vec) {
+#if defined(STRIDER_ARCH_X86_64)
+    __m128i sums = _mm_sad_epu8(vec.data, _mm_setzero_si128());
+    return (uint64_t) _mm_cvtsi128_si32(sums) + (uint64_t) _mm_extract_epi16(sums, 4);
+#elif defined(STRIDER_ARCH_ARM64)
+    return vaddlvq_u8(vec.data);
+#else
+    uint64_t sum = 0;
+    for (int i = 0; i < 16; i++) {
+        sum += vec.data[i];
+    }
+    return sum;
+#endif
+}
+
+/**
+ * @brief Unsigned range check
+ *
+ * @param vec Input vector
+ * @param lo Smallest byte in the range
+ * @param hi Largest byte in the range
+ * @return Vector with 0xFF where lo <= byte <= hi, 0x00 elsewhere (all
+ *         0x00 if hi < lo)
+ *
+ * Subtracting lo + 0x80 moves the range to the bottom of the signed
+ * byte range, so one signed compare checks both bounds: two
+ * instructions per vector on every target.
+ *
+ * Example (ASCII upper case to lower case):
+ * @code
+ *   strider_vec128_t upper = strider_vec128_in_range(v, 'A', 'Z');
+ *   v = strider_vec128_or(v, strider_vec128_and(upper, strider_vec128_set1(0x20)));
+ * @endcode
+ */
+static inline strider_vec128_t strider_vec128_in_range(strider_vec128_t vec, uint8_t lo,
+                                                       uint8_t hi) {
+    if (hi < lo) {
+        return strider_vec128_zero();
+    }
+    if (hi - lo == 0xFF) {
+        return strider_vec128_set1(0xFF);
+    }
+    const strider_vec128_t offsets =
+        strider_vec128_sub_u8(vec, strider_vec128_set1((uint8_t) (lo + 0x80)));
+    const strider_vec128_t limit = strider_vec128_set1((uint8_t) (hi - lo + 1 + 0x80));
+
+    return strider_vec128_cmpgt_i8(limit, offsets);
+}
+
+/* ========================================================================
+ * Shuffle / Table Lookup Operations (128-bit)
+ * ======================================================================== */
+
+/**
+ * @brief 16-entry byte table lookup
+ *
+ * @param table Lookup table (16 bytes)
+ * @param indices Per-byte indices, each in the range 0-15
+ * @return Vector where byte i = table[indices[i]]
+ *
+ * @note Maps to pshufb (SSSE3) or vqtbl1q_u8 (NEON); emulated on SSE2-only
+ *       builds. Indices >= 16 have ISA-specific results.
+ */
+static inline strider_vec128_t strider_vec128_shuffle(strider_vec128_t table,
+                                                      strider_vec128_t indices) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64) && defined(STRIDER_HAS_SSSE3)
+    result.data = _mm_shuffle_epi8(table.data, indices.data);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vqtbl1q_u8(table.data, indices.data);
+#elif defined(STRIDER_ARCH_X86_64)
+    uint8_t t[16], idx[16], out[16];
+    _mm_storeu_si128((__m128i *) t, table.data);
+    _mm_storeu_si128((__m128i *) idx, indices.data);
+    for (int i = 0; i < 16; i++) {
+        out[i] = t[idx[i] & 0x0F];
+    }
+    result.data = _mm_loadu_si128((const __m128i *) out);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = table.data[indices.data[i] & 0x0F];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Look back n bytes across two consecutive vectors
+ *
+ * @param prev Vector preceding cur in memory
+ * @param cur Current vector
+ * @param n Distance, 1 to 3
+ * @return Byte i is the byte n positions before cur[i], i.e.
+ *         prev[16 + i - n] for i < n and cur[i - n] otherwise
+ *
+ * Lets a kernel compare each byte with its predecessors without
+ * reloading memory at an offset.
+ *
+ * @note Maps to palignr (SSSE3), two byte shifts (SSE2) or vext (NEON)
+ */
+static inline strider_vec128_t strider_vec128_prev(strider_vec128_t prev, strider_vec128_t cur,
+                                                   int n) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64) && defined(STRIDER_HAS_SSSE3)
+    /* The shift must be an immediate */
+    switch (n) {
+    case 1:
+        result.data = _mm_alignr_epi8(cur.data, prev.data, 15);
+        break;
+    case 2:
+        result.data = _mm_alignr_epi8(cur.data, prev.data, 14);
+        break;
+    default:
+        result.data = _mm_alignr_epi8(cur.data, prev.data, 13);
+        break;
+    }
+#elif defined(STRIDER_ARCH_X86_64)
+    switch (n) {
+    case 1:
+        result.data = _mm_or_si128(_mm_slli_si128(cur.data, 1), _mm_srli_si128(prev.data, 15));
+        break;
+    case 2:
+        result.data = _mm_or_si128(_mm_slli_si128(cur.data, 2), _mm_srli_si128(prev.data, 14));
+        break;
+    default:
+        result.data = _mm_or_si128(_mm_slli_si128(cur.data, 3), _mm_srli_si128(prev.data, 13));
+        break;
+    }
+#elif defined(STRIDER_ARCH_ARM64)
+    switch (n) {
+    case 1:
+        result.data = vextq_u8(prev.data, cur.data, 15);
+        break;
+    case 2:
+        result.data = vextq_u8(prev.data, cur.data, 14);
+        break;
+    default:
+        result.data = vextq_u8(prev.data, cur.data, 13);
+        break;
+    }
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = i < n ? prev.data[16 + i - n] : cur.data[i - n];
+    }
+#endif
+    return result;
+}
+
+/**
+ * @brief Extract the high nibble of every byte
+ *
+ * @return Vector where byte i = vec[i] >> 4 (0-15)
+ */
+static inline strider_vec128_t strider_vec128_high_nibble(strider_vec128_t vec) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_and_si128(_mm_srli_epi16(vec.data, 4), _mm_set1_epi8(0x0F));
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vshrq_n_u8(vec.data, 4);
+#else
+    for (int i = 0; i < 16; i++) {
+        result.data[i] = vec.data[i] >> 4;
+    }
+#endif
+    return result;
+}
+
+/* ========================================================================
+ * Bitwise and Arithmetic Operations (256-bit)
+ * ======================================================================== */
+
+#if defined(STRIDER_HAS_AVX2) || !defined(STRIDER_ARCH_X86_64)
+
+static inline strider_vec256_t strider_vec256_or(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_or_si256(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vorrq_u8(a.data[0], b.data[0]);
+    result.data[1] = vorrq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] | b.data[i];
+    }
+#    endif
+    return result;
+}
+
+static inline strider_vec256_t strider_vec256_and(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_and_si256(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vandq_u8(a.data[0], b.data[0]);
+    result.data[1] = vandq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] & b.data[i];
+    }
+#    endif
+    return result;
+}
+
+/* a & ~b (see strider_vec128_andnot) */
+static inline strider_vec256_t strider_vec256_andnot(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_andnot_si256(b.data, a.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vbicq_u8(a.data[0], b.data[0]);
+    result.data[1] = vbicq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] & (uint8_t) ~b.data[i];
+    }
+#    endif
+    return result;
+}
+
+static inline strider_vec256_t strider_vec256_xor(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_xor_si256(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = veorq_u8(a.data[0], b.data[0]);
+    result.data[1] = veorq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] ^ b.data[i];
+    }
+#    endif
+    return result;
+}
+
+static inline strider_vec256_t strider_vec256_sub_u8(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_sub_epi8(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vsubq_u8(a.data[0], b.data[0]);
+    result.data[1] = vsubq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = (uint8_t) (a.data[i] - b.data[i]);
+    }
+#    endif
+    return result;
+}
+
+/* Saturating subtraction (see strider_vec128_subs_u8) */
+static inline strider_vec256_t strider_vec256_subs_u8(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_subs_epu8(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vqsubq_u8(a.data[0], b.data[0]);
+    result.data[1] = vqsubq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] > b.data[i] ? (uint8_t) (a.data[i] - b.data[i]) : 0;
+    }
+#    endif
+    return result;
+}
+
+static inline strider_vec256_t strider_vec256_min_u8(strider_vec256_t a, strider_vec256_t b) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_min_epu8(a.data, b.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vminq_u8(a.data[0], b.data[0]);
+    result.data[1] = vminq_u8(a.data[1], b.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = a.data[i] < b.data[i] ? a.data[i] : b.data[i];
+    }
+#    endif
+    return result;
+}
+
+/* Unsigned range check, lo <= byte <= hi (see strider_vec128_in_range) */
+static inline strider_vec256_t strider_vec256_in_range(strider_vec256_t vec, uint8_t lo,
+                                                       uint8_t hi) {
+    if (hi < lo) {
+        return strider_vec256_zero();
+    }
+    if (hi - lo == 0xFF) {
+        return strider_vec256_set1(0xFF);
+    }
+    const strider_vec256_t offsets =
+        strider_vec256_sub_u8(vec, strider_vec256_set1((uint8_t) (lo + 0x80)));
+    const strider_vec256_t limit = strider_vec256_set1((uint8_t) (hi - lo + 1 + 0x80));
+
+    return strider_vec256_cmpgt_i8(limit, offsets);
+}
+
+/* Horizontal sum of all 32 unsigned bytes (0-8160) */
+static inline uint64_t strider_vec256_sum_u8(strider_vec256_t vec) {
+#    if defined(STRIDER_HAS_AVX2)
+    __m256i sums = _mm256_sad_epu8(vec.data, _mm256_setzero_si256());
+    __m128i pair = _mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+    return (uint64_t) _mm_cvtsi128_si32(pair) + (uint64_t) _mm_extract_epi16(pair, 4);
+#    elif defined(STRIDER_ARCH_ARM64)
+    return (uint64_t) vaddlvq_u8(vec.data[0]) + vaddlvq_u8(vec.data[1]);
+#    else
+    uint64_t sum = 0;
+    for (int i = 0; i < 32; i++) {
+        sum += vec.data[i];
+    }
+    return sum;
+#    endif
+}
+
+/* ========================================================================
+ * Shuffle / Table Lookup Operations (256-bit)
+ * ======================================================================== */
+
+/* Copy a 128-bit vector into both halves of a 256-bit vector */
+static inline strider_vec256_t strider_vec256_broadcast128(strider_vec128_t vec) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_broadcastsi128_si256(vec.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vec.data;
+    result.data[1] = vec.data;
+#    else
+    memcpy(result.data, vec.data, 16);
+    memcpy(result.data + 16, vec.data, 16);
+#    endif
+    return result;
+}
+
+/* Per-128-bit-half table lookup (vpshufb semantics): byte i of each half
+ * is table[indices[i]] within that half. Broadcast a 16-byte table with
+ * strider_vec256_broadcast128() for a plain 16-entry lookup. */
+static inline strider_vec256_t strider_vec256_shuffle(strider_vec256_t table,
+                                                      strider_vec256_t indices) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_shuffle_epi8(table.data, indices.data);
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vqtbl1q_u8(table.data[0], indices.data[0]);
+    result.data[1] = vqtbl1q_u8(table.data[1], indices.data[1]);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = table.data[(i & 16) | (indices.data[i] & 0x0F)];
+    }
+#    endif
+    return result;
+}
+
+/* Look back n (1-3) bytes across two consecutive vectors (see strider_vec128_prev) */
+static inline strider_vec256_t strider_vec256_prev(strider_vec256_t prev, strider_vec256_t cur,
+                                                   int n) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    /* High half of prev and low half of cur, so alignr can shift across the halves */
+    const __m256i carry = _mm256_permute2x128_si256(prev.data, cur.data, 0x21);
+    switch (n) {
+    case 1:
+        result.data = _mm256_alignr_epi8(cur.data, carry, 15);
+        break;
+    case 2:
+        result.data = _mm256_alignr_epi8(cur.data, carry, 14);
+        break;
+    default:
+        result.data = _mm256_alignr_epi8(cur.data, carry, 13);
+        break;
+    }
+#    elif defined(STRIDER_ARCH_ARM64)
+    switch (n) {
+    case 1:
+        result.data[0] = vextq_u8(prev.data[1], cur.data[0], 15);
+        result.data[1] = vextq_u8(cur.data[0], cur.data[1], 15);
+        break;
+    case 2:
+        result.data[0] = vextq_u8(prev.data[1], cur.data[0], 14);
+        result.data[1] = vextq_u8(cur.data[0], cur.data[1], 14);
+        break;
+    default:
+        result.data[0] = vextq_u8(prev.data[1], cur.data[0], 13);
+        result.data[1] = vextq_u8(cur.data[0], cur.data[1], 13);
+        break;
+    }
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = i < n ? prev.data[32 + i - n] : cur.data[i - n];
+    }
+#    endif
+    return result;
+}
+
+static inline strider_vec256_t strider_vec256_high_nibble(strider_vec256_t vec) {
+    strider_vec256_t result;
+#    if defined(STRIDER_HAS_AVX2)
+    result.data = _mm256_and_si256(_mm256_srli_epi16(vec.data, 4), _mm256_set1_epi8(0x0F));
+#    elif defined(STRIDER_ARCH_ARM64)
+    result.data[0] = vshrq_n_u8(vec.data[0], 4);
+    result.data[1] = vshrq_n_u8(vec.data[1], 4);
+#    else
+    for (int i = 0; i < 32; i++) {
+        result.data[i] = vec.data[i] >> 4;
+    }
+#    endif
+    return result;
+}
+
+#endif /* STRIDER_HAS_AVX2 */
+
+/* ========================================================================
+ * 512-bit Vector Type and Mask Compares (AVX-512BW)
+ * ======================================================================== */
+
+/**
+ * @brief Mask with the low n bits set
+ *
+ * @param n Number of bits (0-64)
+ * @return Lane mask for the first n bytes of a 64-byte block
+ */
+static inline uint64_t strider_mask64_low(size_t n) {
+    return n >= 64 ? ~(uint64_t) 0 : (((uint64_t) 1 << n) - 1);
+}
+
+#if defined(STRIDER_HAS_AVX512BW)
+/**
+ * @brief 512-bit SIMD vector (64 bytes)
+ *
+ * Only defined in AVX-512BW builds (there is no emulation). Compares
+ * write a 64-bit lane mask (a k register) instead of a byte vector, so
+ * kernels get one bit per byte without a movemask step.
+ */
+typedef struct {
+    __m512i data;
+} strider_vec512_t;
+
+/**
+ * @brief Load 64 bytes from 64-byte aligned memory
+ */
+static inline strider_vec512_t strider_vec512_load_aligned(const void *ptr) {
+    strider_vec512_t result;
+    result.data = _mm512_load_si512(ptr);
+    return result;
+}
+
+/**
+ * @brief Load 64 bytes from unaligned memory
+ */
+static inline strider_vec512_t strider_vec512_load_unaligned(const void *ptr) {
+    strider_vec512_t result;
+    result.data = _mm512_loadu_si512(ptr);
+    return result;
+}
+
+/**
+ * @brief Load the bytes selected by mask, zeroing the others
+ *
+ * Bytes outside mask are not accessed and can not fault, so a buffer's
+ * head or tail is read in one instruction without over-reading it.
+ *
+ * @param ptr Start of the 64-byte block
+ * @param mask Bit i set: load ptr[i]
+ */
+static inline strider_vec512_t strider_vec512_load_masked(const void *ptr, uint64_t mask) {
+    strider_vec512_t result;
+    result.data = _mm512_maskz_loadu_epi8((__mmask64) mask, ptr);
+    return result;
+}
+
+static inline void strider_vec512_store_unaligned(void *ptr, strider_vec512_t vec) {
+    _mm512_storeu_si512(ptr, vec.data);
+}
+
+static inline strider_vec512_t strider_vec512_set1(uint8_t value) {
+    strider_vec512_t result;
+    result.data = _mm512_set1_epi8((char) value);
+    return result;
+}
+
+static inline strider_vec512_t strider_vec512_zero(void) {
+    strider_vec512_t result;
+    result.data = _mm512_setzero_si512();
+    return result;
+}
+
+/**
+ * @brief Compare bytes for equality into a lane mask
+ *
+ * @return Bit i set iff a[i] == b[i]
+ */
+static inline uint64_t strider_vec512_cmpeq_mask(strider_vec512_t a, strider_vec512_t b) {
+    return (uint64_t) _mm512_cmpeq_epi8_mask(a.data, b.data);
+}
+#endif /* STRIDER_HAS_AVX512BW */
+
 /* ========================================================================
  * Bit Manipulation Utilities
  * ======================================================================== */
@@ -432,6 +1241,78 @@ static inline int strider_ctz32(uint32_t x) {
 #endif
 }
 
+/**
+ * @brief Count trailing zeros of a 64-bit mask
+ *
+ * @param x Input value
+ * @return Number of trailing zero bits (0-63), or 64 if x is 0
+ */
+static inline int strider_ctz64(uint64_t x) {
+    if (x == 0)
+        return 64;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, x);
+    return (int) index;
+#else
+    uint32_t lo = (uint32_t) x;
+    return lo ? strider_ctz32(lo) : 32 + strider_ctz32((uint32_t) (x >> 32));
+#endif
+}
+
+/**
+ * @brief Count leading zeros (find position of last set bit)
+ *
+ * @param x Input value
+ * @return Number of leading zero bits (0-31), or 32 if x is 0
+ *
+ * @note 31 - strider_clz32(mask) is the offset of the last match
+ */
+static inline int strider_clz32(uint32_t x) {
+    if (x == 0)
+        return 32;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clz(x);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse(&index, x);
+    return 31 - (int) index;
+#else
+    int n = 0;
+    while ((x & 0x80000000U) == 0) {
+        x <<= 1;
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * @brief Count leading zeros of a 64-bit mask
+ *
+ * @param x Input value
+ * @return Number of leading zero bits (0-63), or 64 if x is 0
+ */
+static inline int strider_clz64(uint64_t x) {
+    if (x == 0)
+        return 64;
+
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_clzll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, x);
+    return 63 - (int) index;
+#else
+    uint32_t hi = (uint32_t) (x >> 32);
+    return hi ? strider_clz32(hi) : 32 + strider_clz32((uint32_t) x);
+#endif
+}
+
 /**
  * @brief Count number of set bits (population count)
  *
@@ -456,6 +1337,22 @@ static inline int strider_popcount32(uint32_t x) {
 #endif
 }
 
+/**
+ * @brief Count number of set bits in a 64-bit mask
+ *
+ * @param x Input value
+ * @return Number of 1 bits in x
+ */
+static inline int strider_popcount64(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(x);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    return (int) __popcnt64(x);
+#else
+    return strider_popcount32((uint32_t) x) + strider_popcount32((uint32_t) (x >> 32));
+#endif
+}
+
 /* ========================================================================
  * Utility Functions
  * ======================================================================== */
@@ -0,0 +1,123 @@
+/**
+ * @file stats.h
+ * @brief Per-kernel call and byte statistics
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Builds configured with -DSTRIDER_ENABLE_STATS=ON count, for each
+ * instrumented kernel, the calls made and the bytes it examined, split
+ * into bytes handled by the vector loops and bytes handled by scalar
+ * prefix, tail or fallback code. A kernel whose scalar share is not
+ * close to zero on large inputs is taking a slow path.
+ *
+ * Counters are kept per thread, so recording needs no locking, and are
+ * summed over all threads (including ones that have exited) when
+ * strider_get_stats() is called. In builds without the option the API
+ * is still present, the kernels carry no instrumentation and all
+ * counters stay zero.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_STATS_H
+#define STRIDER_STATS_H
+
+#include "strider/config.h"
+#include "strider/dispatch.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Instrumented kernels
+ *
+ * A kernel that hands a whole search to another one is counted under
+ * the kernel doing the work: a one-byte substring search counts as
+ * MEMCHR, not STRSTR.
+ */
+typedef enum {
+    STRIDER_STATS_COUNT_NEWLINES,         /**< Newline counting */
+    STRIDER_STATS_FIND_NEWLINE_POSITIONS, /**< Newline offsets, 64- and 32-bit */
+    STRIDER_STATS_PACK_NEWLINE_POSITIONS, /**< Varint-packed newline offsets */
+    STRIDER_STATS_STRCHR,                 /**< NUL-terminated byte search */
+    STRIDER_STATS_MEMCHR,                 /**< Bounded byte search, both directions */
+    STRIDER_STATS_BYTESET,                /**< Byte set find and skip */
+    STRIDER_STATS_STRSTR,                 /**< Substring search, both case modes */
+    STRIDER_STATS_MULTI_PATTERN,          /**< Multi-literal search (Teddy and DFA) */
+    STRIDER_STATS_KERNEL_COUNT
+} strider_stats_kernel_t;
+
+/**
+ * @brief Counters of one kernel
+ *
+ * bytes = simd_bytes + scalar_bytes. Searches count the bytes up to
+ * the end of the block the match was found in.
+ */
+typedef struct {
+    uint64_t calls;        /**< Number of calls */
+    uint64_t bytes;        /**< Bytes examined */
+    uint64_t simd_bytes;   /**< Bytes examined by vector code */
+    uint64_t scalar_bytes; /**< Bytes examined by scalar code */
+} strider_kernel_stats_t;
+
+/**
+ * @brief Statistics snapshot
+ */
+typedef struct {
+    bool enabled;              /**< Built with STRIDER_ENABLE_STATS */
+    strider_backend_t backend; /**< Backend the *_simd entry points use */
+    strider_kernel_stats_t kernels[STRIDER_STATS_KERNEL_COUNT];
+} strider_stats_t;
+
+/**
+ * @brief Sum the counters of all threads
+ *
+ * @param stats Output snapshot; counts since the last
+ *              strider_reset_stats()
+ *
+ * @note Thread-safe; calls running concurrently may or may not be
+ *       included
+ */
+void strider_get_stats(strider_stats_t *stats);
+
+/**
+ * @brief Start counting from zero
+ *
+ * @note Thread-safe
+ */
+void strider_reset_stats(void);
+
+/**
+ * @brief Name of an instrumented kernel ("count_newlines", ...)
+ *
+ * @return Static string, or NULL for an invalid kernel
+ */
+const char *strider_stats_kernel_name(strider_stats_kernel_t kernel);
+
+/**
+ * @brief Get a human-readable description of a statistics snapshot
+ *
+ * One line for the backend and one per kernel that was called.
+ *
+ * @param stats Snapshot from strider_get_stats()
+ * @param buffer Output buffer
+ * @param buffer_size Size of output buffer
+ * @return Number of characters written (excluding null terminator, so
+ *         at most buffer_size - 1), or -1 on invalid arguments
+ *
+ * @note A description that does not fit is truncated, and the buffer is
+ *       always NUL-terminated
+ */
+int strider_describe_stats(const strider_stats_t *stats, char *buffer, size_t buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_STATS_H */
@@ -20,6 +20,7 @@
 #include "strider/config.h"
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -104,6 +105,22 @@ typedef struct {
     size_t size;         /**< Size of buffer in bytes */
 } strider_buffer_view_t;
 
+/**
+ * @brief Span of bytes relative to a base, e.g. a field of a line
+ *
+ * Used for the fields stored by strider_tokenize_lines() and the spans
+ * searched by strider_memchr_spans().
+ */
+typedef struct {
+    uint32_t start;  /**< Offset from the base (start of the line) */
+    uint32_t length; /**< Length in bytes */
+} strider_field_span_t;
+
+/**
+ * @brief Offset returned by buffer searches when there is no match
+ */
+#define STRIDER_NOT_FOUND ((size_t) -1)
+
 /**
  * @brief Create a buffer view from memory
  *
@@ -174,6 +191,23 @@ static inline bool strider_buffer_view_equals(strider_buffer_view_t a, strider_b
     return memcmp(a.data, b.data, a.size) == 0;
 }
 
+/* ========================================================================
+ * Prefetch
+ * ======================================================================== */
+
+/**
+ * @brief Hint that the cache line at ptr will be read soon
+ *
+ * @note Never faults, also for NULL or unmapped addresses
+ */
+static inline void strider_prefetch(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(ptr, 0, 3);
+#else
+    (void) ptr;
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,90 @@
+/**
+ * @file thread_pool.h
+ * @brief Task executor interface and a small built-in thread pool
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Parallel entry points (e.g. strider_count_newlines_parallel()) hand
+ * their work to a strider_executor_t as a batch of independent tasks.
+ * The built-in pool implements it, and callers that already own a
+ * scheduler can plug that in instead.
+ *
+ * @author Strider Development Team
+ * @date 2025-12-31
+ */
+
+#ifndef STRIDER_UTILS_THREAD_POOL_H
+#define STRIDER_UTILS_THREAD_POOL_H
+
+#include "strider/config.h"
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One task of a batch
+ *
+ * @param arg Batch argument
+ * @param index Task index in [0, count)
+ */
+typedef void (*strider_task_fn)(void *arg, size_t index);
+
+/**
+ * @brief Executes a batch of independent tasks
+ *
+ * run() must call task(arg, i) exactly once for every i in [0, count),
+ * in any order and on any threads, and return only after all calls
+ * have returned.
+ */
+typedef struct {
+    void (*run)(void *context, strider_task_fn task, void *arg, size_t count);
+    void *context; /**< Passed to run() */
+} strider_executor_t;
+
+/**
+ * @brief Built-in thread pool (opaque)
+ */
+typedef struct strider_thread_pool strider_thread_pool_t;
+
+/**
+ * @brief Start a thread pool
+ *
+ * @param threads Worker threads to start, or 0 for one per online CPU.
+ *                The thread calling run() also executes tasks.
+ * @return Pool, or NULL on failure
+ */
+strider_thread_pool_t *strider_thread_pool_create(size_t threads);
+
+/**
+ * @brief Stop the workers and free the pool
+ *
+ * @param pool Pool to destroy (NULL is ignored); must not be running a batch
+ */
+void strider_thread_pool_destroy(strider_thread_pool_t *pool);
+
+/**
+ * @brief Number of worker threads in the pool
+ */
+size_t strider_thread_pool_size(const strider_thread_pool_t *pool);
+
+/**
+ * @brief Get an executor that runs batches on the pool
+ *
+ * @note Batches submitted concurrently from several threads run one
+ *       after another
+ */
+strider_executor_t strider_thread_pool_executor(strider_thread_pool_t *pool);
+
+/**
+ * @brief Number of online CPUs (at least 1)
+ */
+size_t strider_hardware_concurrency(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STRIDER_UTILS_THREAD_POOL_H */
@@ -11,6 +11,8 @@
  */
 
 #include "strider/config.h"
+#include "internal/format.h"
+#include "internal/once.h"
 #include <stdio.h>
 #include <string.h>
 
@@ -50,11 +52,24 @@ static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t *eax, uint32_t *ebx,
 #    endif
 }
 
+/* Read XCR0 to check which register state the OS saves on context switch */
+static uint64_t xgetbv0(void) {
+#    if defined(_MSC_VER)
+    return _xgetbv(0);
+#    else
+    uint32_t eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return ((uint64_t) edx << 32) | eax;
+#    endif
+}
+
 static void detect_x86_features(strider_cpu_features_t *features) {
     uint32_t eax, ebx, ecx, edx;
+    uint32_t max_leaf;
 
     /* Get vendor string */
     cpuid(0, 0, &eax, &ebx, &ecx, &edx);
+    max_leaf = eax;
     memcpy(features->vendor + 0, &ebx, 4);
     memcpy(features->vendor + 4, &edx, 4);
     memcpy(features->vendor + 8, &ecx, 4);
@@ -71,13 +86,29 @@ static void detect_x86_features(strider_cpu_features_t *features) {
     features->has_ssse3 = (ecx & (1 << 9)) != 0;
     features->has_sse4_1 = (ecx & (1 << 19)) != 0;
     features->has_sse4_2 = (ecx & (1 << 20)) != 0;
+    features->has_pclmul = (ecx & (1 << 1)) != 0;
+    features->has_popcnt = (ecx & (1 << 23)) != 0;
     features->has_avx = (ecx & (1 << 28)) != 0;
 
+    /* AVX state must be enabled by the OS (OSXSAVE + XCR0) */
+    bool os_ymm = false;
+    bool os_zmm = false;
+    if ((ecx & (1 << 27)) != 0) {
+        uint64_t xcr0 = xgetbv0();
+        os_ymm = (xcr0 & 0x6) == 0x6;   /* XMM | YMM */
+        os_zmm = (xcr0 & 0xE6) == 0xE6; /* XMM | YMM | opmask | ZMM */
+    }
+    features->has_avx = features->has_avx && os_ymm;
+
     /* Detect AVX2 and AVX-512 from CPUID leaf 7 */
-    cpuid(7, 0, &eax, &ebx, &ecx, &edx);
-    features->has_avx2 = (ebx & (1 << 5)) != 0;
-    features->has_avx512f = (ebx & (1 << 16)) != 0;
-    features->has_avx512bw = (ebx & (1 << 30)) != 0;
+    if (max_leaf >= 7) {
+        cpuid(7, 0, &eax, &ebx, &ecx, &edx);
+        features->has_bmi1 = (ebx & (1 << 3)) != 0;
+        features->has_avx2 = os_ymm && (ebx & (1 << 5)) != 0;
+        features->has_bmi2 = (ebx & (1 << 8)) != 0;
+        features->has_avx512f = os_zmm && (ebx & (1 << 16)) != 0;
+        features->has_avx512bw = os_zmm && (ebx & (1u << 30)) != 0;
+    }
 }
 
 #endif /* STRIDER_ARCH_X86_64 */
@@ -131,15 +162,10 @@ static void detect_arm_features(strider_cpu_features_t *features) {
  * Public API
  * ======================================================================== */
 
-strider_cpu_features_t strider_get_cpu_features(void) {
-    /* Cache features after first detection */
-    static strider_cpu_features_t cached_features = {0};
-    static bool initialized = false;
-
-    if (initialized) {
-        return cached_features;
-    }
+static strider_cpu_features_t cached_features;
+static strider_once_t features_once = STRIDER_ONCE_INIT;
 
+static void detect_features(void) {
     /* Initialize all fields to false/zero */
     memset(&cached_features, 0, sizeof(cached_features));
 
@@ -151,9 +177,20 @@ strider_cpu_features_t strider_get_cpu_features(void) {
     cached_features.arch_arm64 = true;
     detect_arm_features(&cached_features);
 #endif
+}
+
+/* Detect before main(), so no thread ever races the detection */
+STRIDER_CONSTRUCTOR(init_cpu_features) {
+    strider_call_once(&features_once, detect_features);
+}
+
+const strider_cpu_features_t *strider_cpu_features(void) {
+    strider_call_once(&features_once, detect_features);
+    return &cached_features;
+}
 
-    initialized = true;
-    return cached_features;
+strider_cpu_features_t strider_get_cpu_features(void) {
+    return *strider_cpu_features();
 }
 
 int strider_describe_cpu_features(const strider_cpu_features_t *features, char *buffer,
@@ -165,44 +202,51 @@ int strider_describe_cpu_features(const strider_cpu_features_t *features, char *
     int written = 0;
 
     /* Architecture */
-    written += snprintf(buffer + written, buffer_size - written, "Architecture: %s\n",
-                        features->arch_x86_64 ? "x86_64" : "ARM64");
+    written = strider_appendf(buffer, buffer_size, written, "Architecture: %s\n",
+                              features->arch_x86_64 ? "x86_64" : "ARM64");
 
     /* Vendor */
     if (features->vendor[0]) {
-        written +=
-            snprintf(buffer + written, buffer_size - written, "Vendor: %s\n", features->vendor);
+        written = strider_appendf(buffer, buffer_size, written, "Vendor: %s\n", features->vendor);
     }
 
     /* SIMD features */
-    written += snprintf(buffer + written, buffer_size - written, "SIMD Features:\n");
+    written = strider_appendf(buffer, buffer_size, written, "SIMD Features:\n");
 
 #if defined(STRIDER_ARCH_X86_64)
     if (features->has_sse2)
-        written += snprintf(buffer + written, buffer_size - written, "  - SSE2\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SSE2\n");
     if (features->has_sse3)
-        written += snprintf(buffer + written, buffer_size - written, "  - SSE3\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SSE3\n");
     if (features->has_ssse3)
-        written += snprintf(buffer + written, buffer_size - written, "  - SSSE3\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SSSE3\n");
     if (features->has_sse4_1)
-        written += snprintf(buffer + written, buffer_size - written, "  - SSE4.1\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SSE4.1\n");
     if (features->has_sse4_2)
-        written += snprintf(buffer + written, buffer_size - written, "  - SSE4.2\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SSE4.2\n");
+    if (features->has_popcnt)
+        written = strider_appendf(buffer, buffer_size, written, "  - POPCNT\n");
+    if (features->has_pclmul)
+        written = strider_appendf(buffer, buffer_size, written, "  - PCLMUL\n");
     if (features->has_avx)
-        written += snprintf(buffer + written, buffer_size - written, "  - AVX\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - AVX\n");
     if (features->has_avx2)
-        written += snprintf(buffer + written, buffer_size - written, "  - AVX2\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - AVX2\n");
+    if (features->has_bmi1)
+        written = strider_appendf(buffer, buffer_size, written, "  - BMI1\n");
+    if (features->has_bmi2)
+        written = strider_appendf(buffer, buffer_size, written, "  - BMI2\n");
     if (features->has_avx512f)
-        written += snprintf(buffer + written, buffer_size - written, "  - AVX-512F\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - AVX-512F\n");
     if (features->has_avx512bw)
-        written += snprintf(buffer + written, buffer_size - written, "  - AVX-512BW\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - AVX-512BW\n");
 #elif defined(STRIDER_ARCH_ARM64)
     if (features->has_neon)
-        written += snprintf(buffer + written, buffer_size - written, "  - NEON\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - NEON\n");
     if (features->has_sve)
-        written += snprintf(buffer + written, buffer_size - written, "  - SVE\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SVE\n");
     if (features->has_sve2)
-        written += snprintf(buffer + written, buffer_size - written, "  - SVE2\n");
+        written = strider_appendf(buffer, buffer_size, written, "  - SVE2\n");
 #endif
 
     return written;
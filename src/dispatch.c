@@ -0,0 +1,405 @@
+/**
+ * @file dispatch.c
+ * @brief Runtime kernel backend selection
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Picks the kernel table for the best backend supported by the build
+ * (STRIDER_BUILD_KERNELS_* definitions) and by the running CPU
+ * (strider_cpu_features()). STRIDER_BACKEND=<name> in the
+ * environment pins a backend at start-up.
+ *
+ * The choice is made when the library is loaded and published as an
+ * atomic pointer: kernel calls load it with acquire ordering, and
+ * strider_set_backend() swaps it with a release store, so threads see
+ * either the old or the new table, both complete.
+ */
+
+#include "internal/dispatch.h"
+#include "internal/multi_pattern.h"
+#include "internal/stats.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/level.h"
+#include "strider/parsers/memchr.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/strchr.h"
+#include "strider/parsers/strstr.h"
+#include "strider/parsers/text_scan.h"
+#include "strider/parsers/timestamp.h"
+#include "strider/parsers/tokenize.h"
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ========================================================================
+ * Kernel Tables
+ * ======================================================================== */
+
+/* Bytes a forward search of size bytes examined to return position */
+static inline size_t searched(size_t size, size_t position) {
+    return position == STRIDER_NOT_FOUND ? size : position + 1;
+}
+
+/* Count a substring search like the SIMD kernels: one-byte needles as memchr */
+static inline void record_needle_find(size_t size, size_t needle_size, size_t position) {
+    if (needle_size == 1) {
+        STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, 0, searched(size, position));
+    } else if (needle_size == 0 || needle_size > size) {
+        STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, 0, 0);
+    } else {
+        /* A match ends needle_size - 1 bytes after its start */
+        STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, 0,
+                             searched(size - needle_size + 1, position) + needle_size - 1);
+    }
+}
+
+/* Scalar kernels whose reference API takes different arguments */
+static size_t scalar_needle_find(strider_buffer_view_t haystack, const strider_needle_t *needle) {
+    const size_t position =
+        strider_strstr(haystack, strider_buffer_view_create(needle->data, needle->size));
+
+    record_needle_find(haystack.size, needle->size, position);
+    return position;
+}
+
+static size_t scalar_needle_find_nocase(strider_buffer_view_t haystack,
+                                        const strider_needle_t *needle) {
+    const size_t position =
+        strider_strstr_nocase(haystack, strider_buffer_view_create(needle->data, needle->size));
+
+    record_needle_find(haystack.size, needle->size, position);
+    return position;
+}
+
+static void scalar_scan_text(const char *data, size_t size, size_t long_line_limit,
+                             strider_text_stats_t *stats) {
+    strider_scan_text(data, size, long_line_limit, stats);
+}
+
+#if defined(STRIDER_ENABLE_STATS)
+
+/* Instrumented kernels of the scalar backend: everything is scalar */
+static size_t scalar_count_newlines(const char *data, size_t size) {
+    STRIDER_STATS_RECORD(STRIDER_STATS_COUNT_NEWLINES, 0, size);
+    return strider_count_newlines(data, size);
+}
+
+static size_t scalar_find_newline_positions(const char *data, size_t size, size_t *positions,
+                                            size_t max_positions) {
+    STRIDER_STATS_RECORD(STRIDER_STATS_FIND_NEWLINE_POSITIONS, 0, size);
+    return strider_find_newline_positions(data, size, positions, max_positions);
+}
+
+static size_t scalar_find_newline_positions32(const char *data, size_t size, uint32_t base,
+                                              uint32_t *positions, size_t max_positions) {
+    STRIDER_STATS_RECORD(STRIDER_STATS_FIND_NEWLINE_POSITIONS, 0, size);
+    return strider_find_newline_positions32(data, size, base, positions, max_positions);
+}
+
+static size_t scalar_pack_newline_positions(const char *data, size_t size, uint8_t *out,
+                                            size_t capacity, size_t *out_size,
+                                            size_t *consumed) {
+    size_t examined;
+    const size_t count =
+        strider_pack_newline_positions(data, size, out, capacity, out_size, &examined);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_PACK_NEWLINE_POSITIONS, 0, examined);
+    if (consumed) {
+        *consumed = examined;
+    }
+    return count;
+}
+
+static const char *scalar_strchr(const char *str, int ch) {
+    const char *found = strider_strchr(str, ch);
+    const char *end = found ? found : str + strlen(str);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_STRCHR, 0, (size_t) (end - str) + 1);
+    return found;
+}
+
+static size_t scalar_memchr(strider_buffer_view_t view, int ch) {
+    const size_t position = strider_memchr(view, ch);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, 0, searched(view.size, position));
+    return position;
+}
+
+static size_t scalar_memchr_nocase(strider_buffer_view_t view, int ch) {
+    const size_t position = strider_memchr_nocase(view, ch);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, 0, searched(view.size, position));
+    return position;
+}
+
+static size_t scalar_strchr_batch(const char *const *strs, size_t count, int ch,
+                                  const char **results) {
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = scalar_strchr(strs[i], ch);
+        found += results[i] != NULL;
+    }
+    return found;
+}
+
+static size_t scalar_memchr_batch(const strider_buffer_view_t *views, size_t count, int ch,
+                                  size_t *results) {
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = scalar_memchr(views[i], ch);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+static size_t scalar_memchr_spans(const char *base, const strider_field_span_t *spans,
+                                  size_t count, int ch, size_t *results) {
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = scalar_memchr(
+            strider_buffer_view_create(base + spans[i].start, spans[i].length), ch);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+static size_t scalar_memrchr(strider_buffer_view_t view, int ch) {
+    const size_t position = strider_memrchr(view, ch);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, 0,
+                         position == STRIDER_NOT_FOUND ? view.size : view.size - position);
+    return position;
+}
+
+static size_t scalar_find_byteset(strider_buffer_view_t view, const strider_byteset_t *set) {
+    const size_t position = strider_find_byteset(view, set);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, 0, searched(view.size, position));
+    return position;
+}
+
+static size_t scalar_skip_byteset(strider_buffer_view_t view, const strider_byteset_t *set) {
+    const size_t position = strider_skip_byteset(view, set);
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, 0, searched(view.size, position));
+    return position;
+}
+
+#    define SCALAR_KERNEL(name) scalar_##name
+#else
+#    define SCALAR_KERNEL(name) strider_##name
+#endif
+
+static const strider_kernel_table_t scalar_kernels = {
+    .backend = STRIDER_BACKEND_SCALAR,
+    .count_newlines = SCALAR_KERNEL(count_newlines),
+    .find_newline_positions = SCALAR_KERNEL(find_newline_positions),
+    .find_newline_positions32 = SCALAR_KERNEL(find_newline_positions32),
+    .pack_newline_positions = SCALAR_KERNEL(pack_newline_positions),
+    .strchr = SCALAR_KERNEL(strchr),
+    .strchr_batch = SCALAR_KERNEL(strchr_batch),
+    .memchr = SCALAR_KERNEL(memchr),
+    .memchr_nocase = SCALAR_KERNEL(memchr_nocase),
+    .memchr_batch = SCALAR_KERNEL(memchr_batch),
+    .memchr_spans = SCALAR_KERNEL(memchr_spans),
+    .memrchr = SCALAR_KERNEL(memrchr),
+    .find_byteset = SCALAR_KERNEL(find_byteset),
+    .skip_byteset = SCALAR_KERNEL(skip_byteset),
+    .needle_find = scalar_needle_find,
+    .needle_find_nocase = scalar_needle_find_nocase,
+    .multi_pattern_find = strider_multi_pattern_find_dfa,
+    .parse_timestamp = strider_parse_timestamp,
+    .parse_timestamps = strider_parse_timestamps,
+    .find_level = strider_find_level,
+    .filter_levels = strider_filter_levels,
+    .tokenize = strider_tokenize,
+    .tokenize_lines = strider_tokenize_lines,
+    .scan_text = scalar_scan_text,
+};
+
+#if defined(STRIDER_BUILD_KERNELS_SSE2)
+static const strider_kernel_table_t sse2_kernels = STRIDER_KERNEL_TABLE(sse2, STRIDER_BACKEND_SSE2);
+#endif
+
+#if defined(STRIDER_BUILD_KERNELS_AVX2)
+static const strider_kernel_table_t avx2_kernels = STRIDER_KERNEL_TABLE(avx2, STRIDER_BACKEND_AVX2);
+#endif
+
+#if defined(STRIDER_BUILD_KERNELS_AVX512BW)
+static const strider_kernel_table_t avx512bw_kernels =
+    STRIDER_KERNEL_TABLE(avx512bw, STRIDER_BACKEND_AVX512BW);
+#endif
+
+#if defined(STRIDER_BUILD_KERNELS_NEON)
+static const strider_kernel_table_t neon_kernels = STRIDER_KERNEL_TABLE(neon, STRIDER_BACKEND_NEON);
+#endif
+
+/**
+ * @brief Get the kernel table compiled for a backend
+ *
+ * @return Table, or NULL if the backend was not built
+ */
+static const strider_kernel_table_t *kernels_for(strider_backend_t backend) {
+    switch (backend) {
+        case STRIDER_BACKEND_SCALAR:
+            return &scalar_kernels;
+#if defined(STRIDER_BUILD_KERNELS_SSE2)
+        case STRIDER_BACKEND_SSE2:
+            return &sse2_kernels;
+#endif
+#if defined(STRIDER_BUILD_KERNELS_AVX2)
+        case STRIDER_BACKEND_AVX2:
+            return &avx2_kernels;
+#endif
+#if defined(STRIDER_BUILD_KERNELS_AVX512BW)
+        case STRIDER_BACKEND_AVX512BW:
+            return &avx512bw_kernels;
+#endif
+#if defined(STRIDER_BUILD_KERNELS_NEON)
+        case STRIDER_BACKEND_NEON:
+            return &neon_kernels;
+#endif
+        default:
+            return NULL;
+    }
+}
+
+/* ========================================================================
+ * Backend Selection
+ * ======================================================================== */
+
+static const char *const backend_names[STRIDER_BACKEND_COUNT] = {
+    "auto", "scalar", "sse2", "avx2", "avx512bw", "neon",
+};
+
+/* Preference order for automatic selection (best first) */
+static const strider_backend_t backend_preference[] = {
+    STRIDER_BACKEND_AVX512BW,
+    STRIDER_BACKEND_AVX2,
+    STRIDER_BACKEND_SSE2,
+    STRIDER_BACKEND_NEON,
+    STRIDER_BACKEND_SCALAR,
+};
+
+static bool cpu_supports(strider_backend_t backend) {
+    const strider_cpu_features_t *features = strider_cpu_features();
+
+    switch (backend) {
+        case STRIDER_BACKEND_SCALAR:
+            return true;
+        case STRIDER_BACKEND_SSE2:
+            return features->has_sse2;
+        case STRIDER_BACKEND_AVX2:
+            return features->has_avx2 && features->has_popcnt && features->has_bmi1 &&
+                   features->has_bmi2 && features->has_pclmul;
+        case STRIDER_BACKEND_AVX512BW:
+            return features->has_avx512f && features->has_avx512bw && features->has_avx2 &&
+                   features->has_popcnt && features->has_bmi1 && features->has_bmi2 &&
+                   features->has_pclmul;
+        case STRIDER_BACKEND_NEON:
+            return features->has_neon;
+        default:
+            return false;
+    }
+}
+
+static strider_backend_t best_backend(void) {
+    size_t count = sizeof(backend_preference) / sizeof(backend_preference[0]);
+
+    for (size_t i = 0; i < count; i++) {
+        if (strider_backend_is_supported(backend_preference[i])) {
+            return backend_preference[i];
+        }
+    }
+    return STRIDER_BACKEND_SCALAR;
+}
+
+/* Backend requested via STRIDER_BACKEND, or AUTO if unset/unsupported */
+static strider_backend_t env_backend(void) {
+    const char *name = getenv("STRIDER_BACKEND");
+    strider_backend_t backend;
+
+    if (name == NULL || strider_backend_from_name(name, &backend) != 0) {
+        return STRIDER_BACKEND_AUTO;
+    }
+    if (!strider_backend_is_supported(backend)) {
+        return STRIDER_BACKEND_AUTO;
+    }
+    return backend;
+}
+
+strider_atomic_ptr_t strider_active_kernels = NULL;
+
+const strider_kernel_table_t *strider_resolve_kernels(void) {
+    strider_backend_t backend = env_backend();
+
+    if (backend == STRIDER_BACKEND_AUTO) {
+        backend = best_backend();
+    }
+    /* Racing resolvers compute the same table; a pinned one wins */
+    return (const strider_kernel_table_t *) strider_atomic_publish_ptr(&strider_active_kernels,
+                                                                      kernels_for(backend));
+}
+
+/* Resolve before main(), so the first kernel call takes the fast path */
+STRIDER_CONSTRUCTOR(init_kernels) {
+    strider_get_kernels();
+}
+
+/* ========================================================================
+ * Public API
+ * ======================================================================== */
+
+strider_backend_t strider_get_backend(void) {
+    return strider_get_kernels()->backend;
+}
+
+int strider_set_backend(strider_backend_t backend) {
+    if (backend == STRIDER_BACKEND_AUTO) {
+        strider_atomic_store_ptr(&strider_active_kernels, kernels_for(best_backend()));
+        return 0;
+    }
+    if (!strider_backend_is_supported(backend)) {
+        return -1;
+    }
+    strider_atomic_store_ptr(&strider_active_kernels, kernels_for(backend));
+    return 0;
+}
+
+bool strider_backend_is_supported(strider_backend_t backend) {
+    if (backend <= STRIDER_BACKEND_AUTO || backend >= STRIDER_BACKEND_COUNT) {
+        return false;
+    }
+    return kernels_for(backend) != NULL && cpu_supports(backend);
+}
+
+const char *strider_backend_name(strider_backend_t backend) {
+    if (backend < STRIDER_BACKEND_AUTO || backend >= STRIDER_BACKEND_COUNT) {
+        return "unknown";
+    }
+    return backend_names[backend];
+}
+
+int strider_backend_from_name(const char *name, strider_backend_t *backend) {
+    if (!name || !backend) {
+        return -1;
+    }
+
+    for (int i = 0; i < STRIDER_BACKEND_COUNT; i++) {
+        const char *candidate = backend_names[i];
+        size_t j = 0;
+
+        while (name[j] != '\0' && tolower((unsigned char) name[j]) == candidate[j]) {
+            j++;
+        }
+        if (name[j] == '\0' && candidate[j] == '\0') {
+            *backend = (strider_backend_t) i;
+            return 0;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,40 @@
+/**
+ * @file ascii.h
+ * @brief ASCII case folding for scalar code (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Only A-Z and a-z are folded; every other byte, including UTF-8 and
+ * Latin-1 letters, compares as itself. Kernels fold whole vectors with
+ * strider_vecn_ascii_tolower() (internal/block64.h), which gives the
+ * same result per byte.
+ */
+
+#ifndef STRIDER_INTERNAL_ASCII_H
+#define STRIDER_INTERNAL_ASCII_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief ASCII A-Z to a-z, other bytes unchanged
+ */
+static inline uint8_t strider_ascii_tolower(uint8_t c) {
+    return (uint8_t) (c - 'A') <= 'Z' - 'A' ? (uint8_t) (c | 0x20) : c;
+}
+
+/**
+ * @brief Compare size bytes ignoring ASCII case
+ */
+static inline bool strider_ascii_equal_nocase(const uint8_t *a, const uint8_t *b, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        if (strider_ascii_tolower(a[i]) != strider_ascii_tolower(b[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+#endif /* STRIDER_INTERNAL_ASCII_H */
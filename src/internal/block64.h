@@ -0,0 +1,309 @@
+/**
+ * @file block64.h
+ * @brief 64-byte block helpers for kernel translation units
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Kernels that turn byte matches into bitmasks work on 64-byte blocks
+ * so one uint64_t mask covers a block on every ISA. A block is the
+ * widest vector type available in the translation unit (vec256 with
+ * AVX2, vec128 otherwise) repeated to fill 64 bytes.
+ */
+
+#ifndef STRIDER_INTERNAL_BLOCK64_H
+#define STRIDER_INTERNAL_BLOCK64_H
+
+#include "strider/simd/vector.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#if defined(__PCLMUL__)
+#    include <wmmintrin.h> /* PCLMULQDQ */
+#endif
+
+#if defined(STRIDER_HAS_AVX2)
+#    define STRIDER_VECN_SIZE 32
+typedef strider_vec256_t strider_vecn_t;
+#else
+#    define STRIDER_VECN_SIZE 16
+typedef strider_vec128_t strider_vecn_t;
+#endif
+
+#define STRIDER_BLOCK64_VECTORS (64 / STRIDER_VECN_SIZE)
+
+/* Bits of a strider_vecn_eq_mask() result that correspond to lanes */
+#define STRIDER_VECN_LANE_MASK ((uint32_t) ((1ULL << STRIDER_VECN_SIZE) - 1))
+
+/* strider_vecn_lookup16() is a native byte shuffle (SSSE3 and later, NEON)
+ * rather than the scalar emulation used on SSE2-only builds */
+#if defined(STRIDER_HAS_SSSE3) || defined(STRIDER_ARCH_ARM64)
+#    define STRIDER_VECN_HAS_SHUFFLE 1
+#endif
+
+/**
+ * @brief 64 bytes held in native-width vectors
+ */
+typedef struct {
+    strider_vecn_t v[STRIDER_BLOCK64_VECTORS];
+} strider_block64_t;
+
+/* ========================================================================
+ * Native-Width Vector Operations
+ * ======================================================================== */
+
+static inline strider_vecn_t strider_vecn_set1(uint8_t value) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_set1(value);
+#else
+    return strider_vec128_set1(value);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_load_unaligned(const void *ptr) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_load_unaligned(ptr);
+#else
+    return strider_vec128_load_unaligned(ptr);
+#endif
+}
+
+static inline void strider_vecn_store_unaligned(void *ptr, strider_vecn_t vec) {
+#if defined(STRIDER_HAS_AVX2)
+    strider_vec256_store_unaligned(ptr, vec);
+#else
+    strider_vec128_store_unaligned(ptr, vec);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_zero(void) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_zero();
+#else
+    return strider_vec128_zero();
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_and(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_and(a, b);
+#else
+    return strider_vec128_and(a, b);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_or(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_or(a, b);
+#else
+    return strider_vec128_or(a, b);
+#endif
+}
+
+/* 16-entry lookup of every byte; indices must be 0-15 */
+static inline strider_vecn_t strider_vecn_lookup16(strider_vecn_t table, strider_vecn_t indices) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_shuffle(table, indices);
+#else
+    return strider_vec128_shuffle(table, indices);
+#endif
+}
+
+/* Load a 16-byte lookup table for strider_vecn_lookup16() */
+static inline strider_vecn_t strider_vecn_load_table16(const uint8_t *table) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_broadcast128(strider_vec128_load_unaligned(table));
+#else
+    return strider_vec128_load_unaligned(table);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_high_nibble(strider_vecn_t vec) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_high_nibble(vec);
+#else
+    return strider_vec128_high_nibble(vec);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_sub_u8(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_sub_u8(a, b);
+#else
+    return strider_vec128_sub_u8(a, b);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_xor(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_xor(a, b);
+#else
+    return strider_vec128_xor(a, b);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_subs_u8(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_subs_u8(a, b);
+#else
+    return strider_vec128_subs_u8(a, b);
+#endif
+}
+
+/* Byte i is the byte n (1-3) positions before cur[i], reaching into prev */
+static inline strider_vecn_t strider_vecn_prev(strider_vecn_t prev, strider_vecn_t cur, int n) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_prev(prev, cur, n);
+#else
+    return strider_vec128_prev(prev, cur, n);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_min_u8(strider_vecn_t a, strider_vecn_t b) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_min_u8(a, b);
+#else
+    return strider_vec128_min_u8(a, b);
+#endif
+}
+
+static inline strider_vecn_t strider_vecn_set1_u64(uint64_t value) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_set1_u64(value);
+#else
+    return strider_vec128_set1_u64(value);
+#endif
+}
+
+/* 0xFF for bytes in [lo, hi], 0x00 elsewhere */
+static inline strider_vecn_t strider_vecn_in_range(strider_vecn_t vec, uint8_t lo, uint8_t hi) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_in_range(vec, lo, hi);
+#else
+    return strider_vec128_in_range(vec, lo, hi);
+#endif
+}
+
+/* ASCII A-Z to a-z, other bytes unchanged: OR 0x20 into the upper case letters */
+static inline strider_vecn_t strider_vecn_ascii_tolower(strider_vecn_t vec) {
+    const strider_vecn_t upper = strider_vecn_in_range(vec, 'A', 'Z');
+    return strider_vecn_or(vec, strider_vecn_and(upper, strider_vecn_set1(0x20)));
+}
+
+/* Sign bit of every byte (bit i = byte i) */
+static inline uint32_t strider_vecn_movemask(strider_vecn_t vec) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_movemask(vec);
+#else
+    return strider_vec128_movemask(vec);
+#endif
+}
+
+/* Bitmask of bytes in vec equal to needle (bit i = byte i) */
+static inline uint32_t strider_vecn_eq_mask(strider_vecn_t vec, strider_vecn_t needle) {
+#if defined(STRIDER_HAS_AVX2)
+    return strider_vec256_movemask(strider_vec256_cmpeq(vec, needle));
+#else
+    return strider_vec128_movemask(strider_vec128_cmpeq(vec, needle));
+#endif
+}
+
+/* True if every byte of vec is zero */
+static inline bool strider_vecn_is_zero(strider_vecn_t vec) {
+    return strider_vecn_eq_mask(vec, strider_vecn_zero()) == STRIDER_VECN_LANE_MASK;
+}
+
+/* ========================================================================
+ * Block Operations
+ * ======================================================================== */
+
+/**
+ * @brief Load 64 bytes (any alignment)
+ */
+static inline strider_block64_t strider_block64_load(const uint8_t *ptr) {
+    strider_block64_t block;
+    for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+        block.v[i] = strider_vecn_load_unaligned(ptr + i * STRIDER_VECN_SIZE);
+    }
+    return block;
+}
+
+/**
+ * @brief Fold the ASCII letters of a block to lower case
+ */
+static inline strider_block64_t strider_block64_ascii_tolower(strider_block64_t block) {
+    for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+        block.v[i] = strider_vecn_ascii_tolower(block.v[i]);
+    }
+    return block;
+}
+
+/**
+ * @brief Bitmask of bytes in block equal to needle (bit i = byte i)
+ */
+static inline uint64_t strider_block64_eq(strider_block64_t block, strider_vecn_t needle) {
+#if defined(STRIDER_HAS_AVX2)
+    return (uint64_t) strider_vecn_eq_mask(block.v[0], needle) |
+           ((uint64_t) strider_vecn_eq_mask(block.v[1], needle) << 32);
+#else
+    /* One combined reduction (cheap on NEON) instead of four movemasks */
+    return strider_vec128_movemask64(
+        strider_vec128_cmpeq(block.v[0], needle), strider_vec128_cmpeq(block.v[1], needle),
+        strider_vec128_cmpeq(block.v[2], needle), strider_vec128_cmpeq(block.v[3], needle));
+#endif
+}
+
+/* ========================================================================
+ * Quote and Escape Masks
+ * ======================================================================== */
+
+/**
+ * @brief Prefix XOR: bit i of the result is the XOR of bits 0 to i
+ *
+ * Turns a mask of quote characters into a mask of the bytes inside
+ * quotes (opening quote included, closing quote excluded). One
+ * carry-less multiply by all ones where available, six shift/XOR steps
+ * otherwise.
+ */
+static inline uint64_t strider_prefix_xor64(uint64_t bits) {
+#if defined(__PCLMUL__)
+    const __m128i product =
+        _mm_clmulepi64_si128(_mm_set_epi64x(0, (long long) bits), _mm_set1_epi8(-1), 0);
+    return (uint64_t) _mm_cvtsi128_si64(product);
+#elif defined(STRIDER_ARCH_ARM64) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+    return vgetq_lane_u64(vreinterpretq_u64_p128(vmull_p64(bits, ~UINT64_C(0))), 0);
+#else
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+#endif
+}
+
+/**
+ * @brief Bytes escaped by the escape characters of a block
+ *
+ * An escape character escapes the next byte unless it is escaped
+ * itself, so only runs of odd length escape what follows them. Runs
+ * starting on even and odd bits are told apart with one addition
+ * (simdjson, "Parsing Gigabytes of JSON per Second").
+ *
+ * @param escapes Escape characters in the block
+ * @param carry In/out: 1 if the first byte of the block is escaped
+ * @return Mask of escaped bytes
+ */
+static inline uint64_t strider_escaped_mask64(uint64_t escapes, uint64_t *carry) {
+    const uint64_t even = UINT64_C(0x5555555555555555);
+
+    escapes &= ~*carry;
+    const uint64_t follows = (escapes << 1) | *carry;
+    const uint64_t odd_starts = escapes & ~even & ~follows;
+    const uint64_t sequences = odd_starts + escapes;
+    *carry = sequences < odd_starts;
+    return (even ^ (sequences << 1)) & follows;
+}
+
+#endif /* STRIDER_INTERNAL_BLOCK64_H */
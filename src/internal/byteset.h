@@ -0,0 +1,101 @@
+/**
+ * @file byteset.h
+ * @brief Byte set classification for kernel translation units
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * With a byte shuffle (SSSE3 and later, NEON) a byte b is a member iff
+ * lo_nibble[b & 0xF] & hi_nibble[b >> 4] is non-zero, i.e. two table
+ * lookups per vector regardless of the set size. The SSE2 baseline has
+ * no pshufb, so it ORs one compare per member instead (up to 16
+ * members); larger sets must use the bitmap.
+ *
+ * Shared by the byte set search (byteset_simd.c) and the tokenizer
+ * (tokenize_simd.c).
+ */
+
+#ifndef STRIDER_INTERNAL_BYTESET_H
+#define STRIDER_INTERNAL_BYTESET_H
+
+#include "internal/block64.h"
+#include "strider/parsers/byteset.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ========================================================================
+ * Vector Classification
+ * ======================================================================== */
+
+/**
+ * @brief Set expanded into registers for one scan
+ */
+typedef struct {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    strider_vecn_t lo[2];
+    strider_vecn_t hi[2];
+    int passes;
+#else
+    strider_vecn_t members[16];
+    int count;
+#endif
+} strider_byteset_matcher_t;
+
+/* Returns false if the set cannot be matched with vectors on this ISA */
+static inline bool strider_byteset_matcher_init(strider_byteset_matcher_t *m,
+                                                const strider_byteset_t *set) {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    for (int p = 0; p < 2; p++) {
+        m->lo[p] = strider_vecn_load_table16(set->lo_nibble[p]);
+        m->hi[p] = strider_vecn_load_table16(set->hi_nibble[p]);
+    }
+    m->passes = set->passes;
+    return true;
+#else
+    if (set->count > sizeof(set->members)) {
+        return false;
+    }
+    for (int i = 0; i < set->count; i++) {
+        m->members[i] = strider_vecn_set1(set->members[i]);
+    }
+    m->count = set->count;
+    return true;
+#endif
+}
+
+/* Bitmask of member bytes in one native vector (bit i = byte i) */
+static inline uint32_t strider_byteset_match_vector(strider_vecn_t v,
+                                                    const strider_byteset_matcher_t *m) {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    const strider_vecn_t lo = strider_vecn_and(v, strider_vecn_set1(0x0F));
+    const strider_vecn_t hi = strider_vecn_high_nibble(v);
+    strider_vecn_t hits =
+        strider_vecn_and(strider_vecn_lookup16(m->lo[0], lo), strider_vecn_lookup16(m->hi[0], hi));
+
+    if (m->passes > 1) {
+        hits = strider_vecn_or(hits, strider_vecn_and(strider_vecn_lookup16(m->lo[1], lo),
+                                                      strider_vecn_lookup16(m->hi[1], hi)));
+    }
+    return ~strider_vecn_eq_mask(hits, strider_vecn_zero()) & STRIDER_VECN_LANE_MASK;
+#else
+    uint32_t mask = 0;
+
+    for (int i = 0; i < m->count; i++) {
+        mask |= strider_vecn_eq_mask(v, m->members[i]);
+    }
+    return mask;
+#endif
+}
+
+static inline uint64_t strider_byteset_match_block(const uint8_t *ptr,
+                                                   const strider_byteset_matcher_t *m) {
+    strider_block64_t block = strider_block64_load(ptr);
+    uint64_t mask = 0;
+
+    for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+        mask |= (uint64_t) strider_byteset_match_vector(block.v[i], m) << (i * STRIDER_VECN_SIZE);
+    }
+    return mask;
+}
+
+#endif /* STRIDER_INTERNAL_BYTESET_H */
@@ -0,0 +1,182 @@
+/**
+ * @file dispatch.h
+ * @brief Internal kernel table used by the runtime dispatcher
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Kernel translation units are compiled once per ISA with
+ * STRIDER_KERNEL_ISA set to the variant name (sse2, avx2, ...).
+ * STRIDER_KERNEL(name) gives each variant a unique symbol, e.g.
+ * STRIDER_KERNEL(count_newlines) -> strider_count_newlines_avx2.
+ */
+
+#ifndef STRIDER_INTERNAL_DISPATCH_H
+#define STRIDER_INTERNAL_DISPATCH_H
+
+#include "internal/once.h"
+#include "strider/dispatch.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/level.h"
+#include "strider/parsers/multi_pattern.h"
+#include "strider/parsers/strstr.h"
+#include "strider/parsers/text_scan.h"
+#include "strider/parsers/timestamp.h"
+#include "strider/parsers/tokenize.h"
+#include "strider/utils/memory.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define STRIDER_KERNEL_CONCAT_(a, b) a##_##b
+#define STRIDER_KERNEL_CONCAT(a, b) STRIDER_KERNEL_CONCAT_(a, b)
+#define STRIDER_KERNEL(name) STRIDER_KERNEL_CONCAT(strider_##name, STRIDER_KERNEL_ISA)
+
+/**
+ * @brief Function pointers for one backend
+ */
+typedef struct {
+    strider_backend_t backend;
+    size_t (*count_newlines)(const char *data, size_t size);
+    size_t (*find_newline_positions)(const char *data, size_t size, size_t *positions,
+                                     size_t max_positions);
+    size_t (*find_newline_positions32)(const char *data, size_t size, uint32_t base,
+                                       uint32_t *positions, size_t max_positions);
+    size_t (*pack_newline_positions)(const char *data, size_t size, uint8_t *out, size_t capacity,
+                                     size_t *out_size, size_t *consumed);
+    const char *(*strchr)(const char *str, int ch);
+    size_t (*strchr_batch)(const char *const *strs, size_t count, int ch, const char **results);
+    size_t (*memchr)(strider_buffer_view_t view, int ch);
+    size_t (*memchr_nocase)(strider_buffer_view_t view, int ch);
+    size_t (*memchr_batch)(const strider_buffer_view_t *views, size_t count, int ch,
+                           size_t *results);
+    size_t (*memchr_spans)(const char *base, const strider_field_span_t *spans, size_t count,
+                           int ch, size_t *results);
+    size_t (*memrchr)(strider_buffer_view_t view, int ch);
+    size_t (*find_byteset)(strider_buffer_view_t view, const strider_byteset_t *set);
+    size_t (*skip_byteset)(strider_buffer_view_t view, const strider_byteset_t *set);
+    size_t (*needle_find)(strider_buffer_view_t haystack, const strider_needle_t *needle);
+    size_t (*needle_find_nocase)(strider_buffer_view_t haystack, const strider_needle_t *needle);
+    size_t (*multi_pattern_find)(const strider_multi_pattern_t *mp, strider_buffer_view_t haystack,
+                                 strider_match_t *matches, size_t max_matches);
+    size_t (*parse_timestamp)(const char *data, size_t size, strider_timestamp_format_t format,
+                              int year, int64_t *ns);
+    size_t (*parse_timestamps)(const char *data, size_t size, const size_t *positions,
+                               size_t count, strider_timestamp_format_t format, int year,
+                               int64_t *timestamps);
+    int (*find_level)(const strider_level_set_t *set, const char *line, size_t size);
+    size_t (*filter_levels)(const char *data, size_t size, const size_t *positions, size_t count,
+                            const strider_level_set_t *set, uint32_t levels, uint64_t *bitmap);
+    size_t (*tokenize)(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                       strider_buffer_view_t *fields, size_t max_fields);
+    size_t (*tokenize_lines)(const strider_tokenizer_t *tok, const char *data, size_t size,
+                             const size_t *positions, size_t count, strider_field_span_t *spans,
+                             size_t max_spans, size_t *field_index);
+    void (*scan_text)(const char *data, size_t size, size_t long_line_limit,
+                      strider_text_stats_t *stats);
+} strider_kernel_table_t;
+
+/** Declare the kernels provided by one ISA variant */
+#define STRIDER_DECLARE_KERNELS(isa)                                                               \
+    size_t strider_count_newlines_##isa(const char *data, size_t size);                            \
+    size_t strider_find_newline_positions_##isa(const char *data, size_t size, size_t *positions,  \
+                                                size_t max_positions);                             \
+    size_t strider_find_newline_positions32_##isa(const char *data, size_t size, uint32_t base,    \
+                                                  uint32_t *positions, size_t max_positions);      \
+    size_t strider_pack_newline_positions_##isa(const char *data, size_t size, uint8_t *out,       \
+                                                size_t capacity, size_t *out_size,                 \
+                                                size_t *consumed);                                 \
+    const char *strider_strchr_##isa(const char *str, int ch);                                     \
+    size_t strider_strchr_batch_##isa(const char *const *strs, size_t count, int ch,               \
+                                      const char **results);                                       \
+    size_t strider_memchr_##isa(strider_buffer_view_t view, int ch);                               \
+    size_t strider_memchr_nocase_##isa(strider_buffer_view_t view, int ch);                        \
+    size_t strider_memchr_batch_##isa(const strider_buffer_view_t *views, size_t count, int ch,    \
+                                      size_t *results);                                            \
+    size_t strider_memchr_spans_##isa(const char *base, const strider_field_span_t *spans,         \
+                                      size_t count, int ch, size_t *results);                      \
+    size_t strider_memrchr_##isa(strider_buffer_view_t view, int ch);                              \
+    size_t strider_find_byteset_##isa(strider_buffer_view_t view, const strider_byteset_t *set);   \
+    size_t strider_skip_byteset_##isa(strider_buffer_view_t view, const strider_byteset_t *set);   \
+    size_t strider_needle_find_##isa(strider_buffer_view_t haystack,                               \
+                                     const strider_needle_t *needle);                              \
+    size_t strider_needle_find_nocase_##isa(strider_buffer_view_t haystack,                        \
+                                            const strider_needle_t *needle);                       \
+    size_t strider_multi_pattern_find_##isa(const strider_multi_pattern_t *mp,                     \
+                                            strider_buffer_view_t haystack,                        \
+                                            strider_match_t *matches, size_t max_matches);         \
+    size_t strider_parse_timestamp_##isa(const char *data, size_t size,                            \
+                                         strider_timestamp_format_t format, int year,              \
+                                         int64_t *ns);                                             \
+    size_t strider_parse_timestamps_##isa(const char *data, size_t size, const size_t *positions,  \
+                                          size_t count, strider_timestamp_format_t format,         \
+                                          int year, int64_t *timestamps);                          \
+    int strider_find_level_##isa(const strider_level_set_t *set, const char *line, size_t size);   \
+    size_t strider_filter_levels_##isa(const char *data, size_t size, const size_t *positions,     \
+                                       size_t count, const strider_level_set_t *set,               \
+                                       uint32_t levels, uint64_t *bitmap);                         \
+    size_t strider_tokenize_##isa(const strider_tokenizer_t *tok, strider_buffer_view_t line,      \
+                                  strider_buffer_view_t *fields, size_t max_fields);               \
+    size_t strider_tokenize_lines_##isa(const strider_tokenizer_t *tok, const char *data,          \
+                                        size_t size, const size_t *positions, size_t count,        \
+                                        strider_field_span_t *spans, size_t max_spans,             \
+                                        size_t *field_index);                                      \
+    void strider_scan_text_##isa(const char *data, size_t size, size_t long_line_limit,            \
+                                 strider_text_stats_t *stats);
+
+/** Initializer for a kernel table built from one ISA variant */
+#define STRIDER_KERNEL_TABLE(isa, id)                                                              \
+    {                                                                                              \
+        .backend = (id),                                                                           \
+        .count_newlines = strider_count_newlines_##isa,                                            \
+        .find_newline_positions = strider_find_newline_positions_##isa,                            \
+        .find_newline_positions32 = strider_find_newline_positions32_##isa,                        \
+        .pack_newline_positions = strider_pack_newline_positions_##isa,                            \
+        .strchr = strider_strchr_##isa,                                                            \
+        .strchr_batch = strider_strchr_batch_##isa,                                                \
+        .memchr = strider_memchr_##isa,                                                            \
+        .memchr_nocase = strider_memchr_nocase_##isa,                                              \
+        .memchr_batch = strider_memchr_batch_##isa,                                                \
+        .memchr_spans = strider_memchr_spans_##isa,                                                \
+        .memrchr = strider_memrchr_##isa,                                                          \
+        .find_byteset = strider_find_byteset_##isa,                                                \
+        .skip_byteset = strider_skip_byteset_##isa,                                                \
+        .needle_find = strider_needle_find_##isa,                                                  \
+        .needle_find_nocase = strider_needle_find_nocase_##isa,                                    \
+        .multi_pattern_find = strider_multi_pattern_find_##isa,                                    \
+        .parse_timestamp = strider_parse_timestamp_##isa,                                          \
+        .parse_timestamps = strider_parse_timestamps_##isa,                                        \
+        .find_level = strider_find_level_##isa,                                                    \
+        .filter_levels = strider_filter_levels_##isa,                                              \
+        .tokenize = strider_tokenize_##isa,                                                        \
+        .tokenize_lines = strider_tokenize_lines_##isa,                                            \
+        .scan_text = strider_scan_text_##isa,                                                      \
+    }
+
+STRIDER_DECLARE_KERNELS(sse2)
+STRIDER_DECLARE_KERNELS(avx2)
+STRIDER_DECLARE_KERNELS(avx512bw)
+STRIDER_DECLARE_KERNELS(neon)
+
+/** Active kernel table, NULL until resolved (use strider_get_kernels()) */
+extern strider_atomic_ptr_t strider_active_kernels;
+
+/**
+ * @brief Resolve the backend and publish its table (slow path)
+ */
+const strider_kernel_table_t *strider_resolve_kernels(void);
+
+/**
+ * @brief Get the kernel table for the active backend
+ *
+ * The table is resolved when the library is loaded, so this is one
+ * acquire load (a plain load on x86 and ARM64) and a branch that is
+ * always taken the same way; calls made before that (from other
+ * constructors) resolve it here.
+ */
+static inline const strider_kernel_table_t *strider_get_kernels(void) {
+    const strider_kernel_table_t *kernels =
+        (const strider_kernel_table_t *) strider_atomic_load_ptr(&strider_active_kernels);
+    return kernels ? kernels : strider_resolve_kernels();
+}
+
+#endif /* STRIDER_INTERNAL_DISPATCH_H */
@@ -0,0 +1,47 @@
+/**
+ * @file format.h
+ * @brief Appending formatted text to a fixed buffer (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * The describe functions build their text with repeated appends and
+ * return the number of characters in the buffer. Text that does not fit
+ * is cut off, and the count never exceeds buffer_size - 1, so it can be
+ * used as an offset into the buffer.
+ */
+
+#ifndef STRIDER_INTERNAL_FORMAT_H
+#define STRIDER_INTERNAL_FORMAT_H
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+
+/**
+ * @brief snprintf() at buffer + written
+ *
+ * @param buffer Output buffer (NUL-terminated on return)
+ * @param buffer_size Size of buffer, at least 1
+ * @param written Characters already in buffer (< buffer_size), or a
+ *                negative error from an earlier append
+ * @return Characters now in buffer; negative on an encoding error
+ */
+static inline int strider_appendf(char *buffer, size_t buffer_size, int written,
+                                  const char *format, ...) {
+    const size_t room = written >= 0 ? buffer_size - (size_t) written : 0;
+    va_list args;
+
+    if (room == 0) {
+        return written; /* An earlier error */
+    }
+    va_start(args, format);
+    const int added = vsnprintf(buffer + written, room, format, args);
+    va_end(args);
+    if (added < 0) {
+        return added;
+    }
+    return (size_t) added < room ? written + added : (int) (buffer_size - 1);
+}
+
+#endif /* STRIDER_INTERNAL_FORMAT_H */
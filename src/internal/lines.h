@@ -0,0 +1,29 @@
+/**
+ * @file lines.h
+ * @brief Walking lines given their newline positions
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Shared by the per-line parsers (timestamps, levels) that take the
+ * positions from strider_find_newline_positions().
+ */
+
+#ifndef STRIDER_INTERNAL_LINES_H
+#define STRIDER_INTERNAL_LINES_H
+
+#include <stddef.h>
+
+/**
+ * @brief Start of the line after the newline at position
+ *
+ * Positions mark the \r of a \r\n pair (see strider_find_newline_positions()).
+ */
+static inline size_t strider_next_line_start(const char *data, size_t size, size_t position) {
+    if (data[position] == '\r' && position + 1 < size && data[position + 1] == '\n') {
+        return position + 2;
+    }
+    return position + 1;
+}
+
+#endif /* STRIDER_INTERNAL_LINES_H */
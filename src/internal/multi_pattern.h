@@ -0,0 +1,96 @@
+/**
+ * @file multi_pattern.h
+ * @brief Internal layout of the compiled multi-pattern matcher
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Shared by src/parsers/multi_pattern.c (construction, reference and
+ * Aho-Corasick scan) and the Teddy kernels in multi_pattern_simd.c.
+ */
+
+#ifndef STRIDER_INTERNAL_MULTI_PATTERN_H
+#define STRIDER_INTERNAL_MULTI_PATTERN_H
+
+#include "strider/parsers/multi_pattern.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#define STRIDER_TEDDY_BUCKETS 8
+#define STRIDER_TEDDY_MAX_WIDTH 3
+
+/* Flag in a DFA transition: the target state reports matches */
+#define STRIDER_DFA_OUTPUT_FLAG 0x80000000u
+
+struct strider_multi_pattern {
+    /* Patterns, concatenated */
+    size_t count;
+    uint8_t *storage;
+    size_t *offsets;
+    size_t *lengths;
+    size_t max_length;
+
+    /* Teddy prefilter: bucket bits by nibble, for the first teddy_width bytes */
+    bool use_teddy;
+    size_t teddy_width;
+    uint8_t teddy_lo[STRIDER_TEDDY_MAX_WIDTH][16];
+    uint8_t teddy_hi[STRIDER_TEDDY_MAX_WIDTH][16];
+    uint32_t bucket_start[STRIDER_TEDDY_BUCKETS + 1]; /* CSR into bucket_ids */
+    uint32_t *bucket_ids;                             /* Ascending within a bucket */
+
+    /* Aho-Corasick DFA over byte classes. Transitions hold the target
+     * state premultiplied by num_classes, plus STRIDER_DFA_OUTPUT_FLAG. */
+    uint16_t byte_class[256];
+    size_t num_classes;
+    size_t num_states;
+    uint32_t *transitions;
+    uint32_t *output_start; /* CSR into output_ids, num_states + 1 entries */
+    uint32_t *output_ids;   /* Ascending within a state */
+};
+
+static inline const uint8_t *strider_mp_pattern(const strider_multi_pattern_t *mp, uint32_t id) {
+    return mp->storage + mp->offsets[id];
+}
+
+/**
+ * @brief Keep the max_matches smallest (offset, pattern_id) matches
+ *
+ * Inserts into the sorted output array; once it is full, a new match
+ * either displaces the current largest entry or is dropped. Engines
+ * find matches nearly in order, so the insertion point is at or near
+ * the end.
+ */
+static inline void strider_match_list_add(strider_match_t *matches, size_t *count,
+                                          size_t max_matches, size_t offset, uint32_t id) {
+    size_t n = *count;
+
+    if (n == max_matches) {
+        const strider_match_t *last = &matches[n - 1];
+        if (offset > last->offset || (offset == last->offset && id >= last->pattern_id)) {
+            return;
+        }
+        n--; /* Drop the largest entry */
+    }
+
+    while (n > 0 && (matches[n - 1].offset > offset ||
+                     (matches[n - 1].offset == offset && matches[n - 1].pattern_id > id))) {
+        matches[n] = matches[n - 1];
+        n--;
+    }
+    matches[n].pattern_id = id;
+    matches[n].offset = offset;
+
+    if (*count < max_matches) {
+        (*count)++;
+    }
+}
+
+/**
+ * @brief Scan with the Aho-Corasick DFA (portable fallback)
+ */
+size_t strider_multi_pattern_find_dfa(const strider_multi_pattern_t *mp,
+                                      strider_buffer_view_t haystack, strider_match_t *matches,
+                                      size_t max_matches);
+
+#endif /* STRIDER_INTERNAL_MULTI_PATTERN_H */
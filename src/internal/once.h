@@ -0,0 +1,156 @@
+/**
+ * @file once.h
+ * @brief One-time initialization and published pointers (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Library state that is computed once (CPU features, the kernel table)
+ * is published with a release store and read with an acquire load, so
+ * once it is set, reading it costs one plain load on x86 and ARM64 and
+ * never takes a lock. C11 atomics are used where the compiler has them;
+ * MSVC without /experimental:c11atomics falls back to the Interlocked
+ * functions (full barriers, still lock-free).
+ *
+ * STRIDER_CONSTRUCTOR runs a function at load time, before main() and
+ * before any thread the program starts, so the fast paths are normally
+ * warm before the first call; the once / compare-and-swap paths only
+ * cover calls made from other constructors.
+ */
+
+#ifndef STRIDER_INTERNAL_ONCE_H
+#define STRIDER_INTERNAL_ONCE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#if !defined(__STDC_NO_ATOMICS__)
+#    include <stdatomic.h>
+#elif !defined(_WIN32)
+#    error "strider needs C11 atomics"
+#endif
+
+#if defined(_WIN32)
+#    include <windows.h>
+#    define STRIDER_YIELD() SwitchToThread()
+#else
+#    include <sched.h>
+#    define STRIDER_YIELD() sched_yield()
+#endif
+
+/* ========================================================================
+ * Published Pointers
+ * ======================================================================== */
+
+#if !defined(__STDC_NO_ATOMICS__)
+
+typedef _Atomic(const void *) strider_atomic_ptr_t;
+
+/** @brief Read a published pointer (acquire) */
+static inline const void *strider_atomic_load_ptr(strider_atomic_ptr_t *ptr) {
+    return atomic_load_explicit(ptr, memory_order_acquire);
+}
+
+/** @brief Publish a pointer (release) */
+static inline void strider_atomic_store_ptr(strider_atomic_ptr_t *ptr, const void *value) {
+    atomic_store_explicit(ptr, value, memory_order_release);
+}
+
+/**
+ * @brief Publish a pointer unless one already is
+ *
+ * @return The pointer published now (value, or the one that won)
+ */
+static inline const void *strider_atomic_publish_ptr(strider_atomic_ptr_t *ptr,
+                                                     const void *value) {
+    const void *expected = NULL;
+    if (atomic_compare_exchange_strong_explicit(ptr, &expected, value, memory_order_acq_rel,
+                                                memory_order_acquire)) {
+        return value;
+    }
+    return expected;
+}
+
+#else
+
+typedef const void *volatile strider_atomic_ptr_t;
+
+static inline const void *strider_atomic_load_ptr(strider_atomic_ptr_t *ptr) {
+    return InterlockedCompareExchangePointer((PVOID volatile *) ptr, NULL, NULL);
+}
+
+static inline void strider_atomic_store_ptr(strider_atomic_ptr_t *ptr, const void *value) {
+    InterlockedExchangePointer((PVOID volatile *) ptr, (PVOID) value);
+}
+
+static inline const void *strider_atomic_publish_ptr(strider_atomic_ptr_t *ptr,
+                                                     const void *value) {
+    const void *previous =
+        InterlockedCompareExchangePointer((PVOID volatile *) ptr, (PVOID) value, NULL);
+    return previous ? previous : value;
+}
+
+#endif
+
+/* ========================================================================
+ * One-Time Initialization
+ * ======================================================================== */
+
+/**
+ * @brief Once flag
+ *
+ * The state is a pointer, so the published-pointer helpers serve here
+ * too: NULL before, a private marker while init runs, and the flag's
+ * own address once it is done.
+ */
+typedef struct {
+    strider_atomic_ptr_t state;
+} strider_once_t;
+
+#define STRIDER_ONCE_INIT {NULL}
+
+/**
+ * @brief Run init exactly once; every caller returns after it finished
+ *
+ * Callers that lose the race to run init yield until it is done
+ * (init must not call back into the same once flag).
+ */
+static inline void strider_call_once(strider_once_t *once, void (*init)(void)) {
+    static const char running = 0;
+    const void *done = (const void *) once;
+
+    if (strider_atomic_load_ptr(&once->state) == done) {
+        return;
+    }
+    if (strider_atomic_publish_ptr(&once->state, &running) == &running) {
+        init();
+        strider_atomic_store_ptr(&once->state, done);
+        return;
+    }
+    while (strider_atomic_load_ptr(&once->state) != done) {
+        STRIDER_YIELD();
+    }
+}
+
+/* ========================================================================
+ * Load-Time Initialization
+ * ======================================================================== */
+
+/**
+ * @brief Define a function run when the library is loaded
+ *
+ * @code
+ *   STRIDER_CONSTRUCTOR(warm_up) { ... }
+ * @endcode
+ */
+#if defined(_MSC_VER) && !defined(__clang__)
+#    pragma section(".CRT$XCU", read)
+#    define STRIDER_CONSTRUCTOR(name)                                                              \
+        static void name(void);                                                                    \
+        __declspec(allocate(".CRT$XCU")) void (*const name##_entry)(void) = name;                 \
+        __pragma(comment(linker, "/include:" #name "_entry")) static void name(void)
+#else
+#    define STRIDER_CONSTRUCTOR(name) __attribute__((constructor)) static void name(void)
+#endif
+
+#endif /* STRIDER_INTERNAL_ONCE_H */
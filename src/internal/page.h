@@ -0,0 +1,88 @@
+/**
+ * @file page.h
+ * @brief Page-safe loads past the end of an input (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Memory protection works on whole pages, so a load that stays inside a
+ * page holding at least one byte of the input cannot fault, even where
+ * it reads bytes outside the input. Kernels use this to handle short
+ * inputs and NUL-terminated strings with full vectors; the bytes outside
+ * the input are masked off. AddressSanitizer tracks bytes, not pages, so
+ * these loads go through the strider_vec*_load_in_page() helpers, which
+ * use the intrinsics directly and are exempted from instrumentation.
+ */
+
+#ifndef STRIDER_INTERNAL_PAGE_H
+#define STRIDER_INTERNAL_PAGE_H
+
+#include "strider/simd/vector.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Smallest page size of the supported targets */
+#define STRIDER_PAGE_SIZE 4096
+
+#if defined(__has_feature)
+#    if __has_feature(address_sanitizer)
+#        define STRIDER_ASAN 1
+#    endif
+#endif
+#if defined(__SANITIZE_ADDRESS__)
+#    define STRIDER_ASAN 1
+#endif
+
+/** Exempts functions that read past an input within its pages */
+#if defined(STRIDER_ASAN)
+#    define STRIDER_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#else
+#    define STRIDER_NO_SANITIZE_ADDRESS
+#endif
+
+/**
+ * @brief Check that size bytes from ptr lie in the page of ptr
+ */
+static inline bool strider_load_in_page(const void *ptr, size_t size) {
+    return ((uintptr_t) ptr & (STRIDER_PAGE_SIZE - 1)) <= STRIDER_PAGE_SIZE - size;
+}
+
+/* ========================================================================
+ * Loads
+ * ======================================================================== */
+
+/* Unaligned loads that may read bytes outside the input in its pages */
+
+STRIDER_NO_SANITIZE_ADDRESS
+static inline strider_vec128_t strider_vec128_load_in_page(const void *ptr) {
+    strider_vec128_t result;
+#if defined(STRIDER_ARCH_X86_64)
+    result.data = _mm_loadu_si128((const __m128i *) ptr);
+#elif defined(STRIDER_ARCH_ARM64)
+    result.data = vld1q_u8((const uint8_t *) ptr);
+#else
+    result = strider_vec128_load_unaligned(ptr);
+#endif
+    return result;
+}
+
+#if defined(STRIDER_HAS_AVX2)
+STRIDER_NO_SANITIZE_ADDRESS
+static inline strider_vec256_t strider_vec256_load_in_page(const void *ptr) {
+    strider_vec256_t result;
+    result.data = _mm256_loadu_si256((const __m256i *) ptr);
+    return result;
+}
+#endif
+
+#if defined(STRIDER_HAS_AVX512BW)
+STRIDER_NO_SANITIZE_ADDRESS
+static inline strider_vec512_t strider_vec512_load_in_page(const void *ptr) {
+    strider_vec512_t result;
+    result.data = _mm512_loadu_si512(ptr);
+    return result;
+}
+#endif
+
+#endif /* STRIDER_INTERNAL_PAGE_H */
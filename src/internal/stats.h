@@ -0,0 +1,37 @@
+/**
+ * @file stats.h
+ * @brief Kernel instrumentation hooks (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Kernels call STRIDER_STATS_RECORD() once per call with the bytes they
+ * examined in vector and in scalar code. Without STRIDER_ENABLE_STATS
+ * the macro only evaluates its (side-effect free) arguments, so the
+ * bookkeeping variables compile away.
+ */
+
+#ifndef STRIDER_INTERNAL_STATS_H
+#define STRIDER_INTERNAL_STATS_H
+
+#include "strider/stats.h"
+#include <stddef.h>
+
+#if defined(STRIDER_ENABLE_STATS)
+
+/**
+ * @brief Add one call to the calling thread's counters
+ */
+void strider_stats_record(strider_stats_kernel_t kernel, size_t simd_bytes, size_t scalar_bytes);
+
+#    define STRIDER_STATS_RECORD(kernel, simd_bytes, scalar_bytes)                                 \
+        strider_stats_record((kernel), (simd_bytes), (scalar_bytes))
+
+#else
+
+#    define STRIDER_STATS_RECORD(kernel, simd_bytes, scalar_bytes)                                 \
+        ((void) (kernel), (void) (simd_bytes), (void) (scalar_bytes))
+
+#endif
+
+#endif /* STRIDER_INTERNAL_STATS_H */
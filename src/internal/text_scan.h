@@ -0,0 +1,42 @@
+/**
+ * @file text_scan.h
+ * @brief Line statistics bookkeeping shared by the text scanners (internal)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#ifndef STRIDER_INTERNAL_TEXT_SCAN_H
+#define STRIDER_INTERNAL_TEXT_SCAN_H
+
+#include "strider/parsers/text_scan.h"
+#include <string.h>
+
+/**
+ * @brief Empty statistics
+ */
+static inline void strider_text_stats_init(strider_text_stats_t *stats) {
+    memset(stats, 0, sizeof(*stats));
+    stats->first_long_line = STRIDER_NOT_FOUND;
+    stats->utf8_error = STRIDER_NOT_FOUND;
+}
+
+/**
+ * @brief Account for the line of length bytes starting at start
+ */
+static inline void strider_text_stats_add_line(strider_text_stats_t *stats, size_t start,
+                                               size_t length, size_t long_line_limit) {
+    stats->lines++;
+    stats->line_lengths[strider_line_length_bucket(length)]++;
+    if (length > stats->max_line_length) {
+        stats->max_line_length = length;
+    }
+    if (length > long_line_limit) {
+        if (stats->long_lines == 0) {
+            stats->first_long_line = start;
+        }
+        stats->long_lines++;
+    }
+}
+
+#endif /* STRIDER_INTERNAL_TEXT_SCAN_H */
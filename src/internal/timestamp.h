@@ -0,0 +1,254 @@
+/**
+ * @file timestamp.h
+ * @brief Calendar arithmetic and stamp suffix parsing
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Shared by the scalar reference (src/parsers/timestamp.c) and the
+ * kernels in timestamp_simd.c, which only differ in how they validate
+ * and convert the fixed-width part of a stamp. Everything after it
+ * (fraction, zone) and the final conversion go through the helpers
+ * below so that all backends agree bit for bit.
+ */
+
+#ifndef STRIDER_INTERNAL_TIMESTAMP_H
+#define STRIDER_INTERNAL_TIMESTAMP_H
+
+#include "strider/parsers/timestamp.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/** Fixed part of an ISO 8601 stamp: "2025-12-31T23:59:59" */
+#define STRIDER_ISO8601_FIXED_LENGTH 19
+
+/** Fixed part of a syslog stamp: "Dec 31 23:59:59" */
+#define STRIDER_SYSLOG_FIXED_LENGTH 15
+
+/** Whole seconds and nanoseconds of INT64_MAX ns (2262-04-11T23:47:16.854775807Z) */
+#define STRIDER_TIMESTAMP_MAX_SECONDS (INT64_MAX / 1000000000)
+#define STRIDER_TIMESTAMP_MAX_NANOS (INT64_MAX % 1000000000)
+
+/**
+ * @brief Calendar fields of a stamp (validated by strider_timestamp_assemble())
+ */
+typedef struct {
+    int64_t year;
+    unsigned month;
+    unsigned day;
+    unsigned hour;
+    unsigned minute;
+    unsigned second;
+} strider_civil_time_t;
+
+static inline bool strider_is_digit(uint8_t c) {
+    return (uint8_t) (c - '0') <= 9;
+}
+
+/**
+ * @brief Days from 1970-01-01 to a proleptic Gregorian date
+ *
+ * Works in 400-year eras starting on March 1st, so leap days fall at the
+ * end of each year (H. Hinnant, "chrono-Compatible Low-Level Date
+ * Algorithms").
+ */
+static inline int64_t strider_days_from_civil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned year_of_era = (unsigned) (year - era * 400);
+    const unsigned day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const unsigned day_of_era =
+        year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + (int64_t) day_of_era - 719468;
+}
+
+static inline unsigned strider_days_in_month(int64_t year, unsigned month) {
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool leap = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+    return month == 2 && leap ? 29 : days[month - 1];
+}
+
+/**
+ * @brief Month number (1-12) of a syslog month name, 0 if p is not one
+ *
+ * @param p 3 readable bytes
+ */
+static inline unsigned strider_syslog_month(const uint8_t *p) {
+    static const char names[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    for (unsigned i = 0; i < 12; i++) {
+        if (p[0] == names[3 * i] && p[1] == names[3 * i + 1] && p[2] == names[3 * i + 2]) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Parse an optional fraction of a second (".123" or ",123")
+ *
+ * Uses up to 9 digits; any further digits are consumed and ignored.
+ *
+ * @return Pointer past the fraction (p itself if there is none)
+ */
+static inline const uint8_t *strider_timestamp_fraction(const uint8_t *p, const uint8_t *end,
+                                                        int64_t *nanos) {
+    *nanos = 0;
+    if (end - p < 2 || (p[0] != '.' && p[0] != ',') || !strider_is_digit(p[1])) {
+        return p;
+    }
+
+    static const int32_t scale[10] = {1000000000, 100000000, 10000000, 1000000, 100000,
+                                      10000,      1000,      100,      10,      1};
+    const uint8_t *digits = ++p;
+    int32_t value = 0;
+
+    for (; p < end && strider_is_digit(*p); p++) {
+        if (p - digits < 9) {
+            value = value * 10 + (*p - '0');
+        }
+    }
+    *nanos = (int64_t) value * scale[p - digits < 9 ? p - digits : 9];
+    return p;
+}
+
+/**
+ * @brief Parse an optional zone ("Z", "+hh:mm", "+hhmm" or "+hh")
+ *
+ * A sign not followed by two digits is not part of the stamp.
+ *
+ * @param offset Output: seconds east of UTC (0 if there is no zone)
+ * @return Pointer past the zone (p itself if there is none), or NULL if
+ *         the zone hour or minute is out of range
+ */
+static inline const uint8_t *strider_timestamp_zone(const uint8_t *p, const uint8_t *end,
+                                                    int64_t *offset) {
+    *offset = 0;
+    if (p < end && (*p == 'Z' || *p == 'z')) {
+        return p + 1;
+    }
+    if (end - p < 3 || (p[0] != '+' && p[0] != '-') || !strider_is_digit(p[1]) ||
+        !strider_is_digit(p[2])) {
+        return p;
+    }
+
+    const int64_t sign = p[0] == '-' ? -1 : 1;
+    const unsigned hours = (unsigned) (p[1] - '0') * 10 + (unsigned) (p[2] - '0');
+    unsigned minutes = 0;
+    p += 3;
+
+    /* ":mm" or "mm" */
+    const uint8_t *m = (p < end && *p == ':') ? p + 1 : p;
+    if (end - m >= 2 && strider_is_digit(m[0]) && strider_is_digit(m[1])) {
+        minutes = (unsigned) (m[0] - '0') * 10 + (unsigned) (m[1] - '0');
+        p = m + 2;
+    }
+
+    if (hours > 23 || minutes > 59) {
+        return NULL;
+    }
+    *offset = sign * (int64_t) (hours * 3600 + minutes * 60);
+    return p;
+}
+
+/**
+ * @brief seconds * 10^9 + nanos, if it fits int64
+ *
+ * @param nanos Fraction of the second, 0 to 999999999
+ * @return true on success (*ns written)
+ */
+static inline bool strider_timestamp_to_ns(int64_t seconds, int64_t nanos, int64_t *ns) {
+    /* INT64_MIN ns is -(MAX_SECONDS + 1) s plus 10^9 - (MAX_NANOS + 1) ns */
+    if (seconds > STRIDER_TIMESTAMP_MAX_SECONDS ||
+        (seconds == STRIDER_TIMESTAMP_MAX_SECONDS && nanos > STRIDER_TIMESTAMP_MAX_NANOS) ||
+        seconds < -STRIDER_TIMESTAMP_MAX_SECONDS - 1 ||
+        (seconds == -STRIDER_TIMESTAMP_MAX_SECONDS - 1 &&
+         nanos < 1000000000 - STRIDER_TIMESTAMP_MAX_NANOS - 1)) {
+        return false;
+    }
+
+    /* Borrow a second below zero, so the product itself cannot overflow */
+    *ns = seconds < 0 ? (seconds + 1) * 1000000000 + (nanos - 1000000000)
+                      : seconds * 1000000000 + nanos;
+    return true;
+}
+
+/**
+ * @brief Validate calendar fields and convert to epoch nanoseconds
+ *
+ * @return true on success (*ns written), false if a field is out of
+ *         range or the result does not fit
+ */
+static inline bool strider_timestamp_assemble(const strider_civil_time_t *t, int64_t nanos,
+                                              int64_t offset, int64_t *ns) {
+    if (t->month < 1 || t->month > 12 || t->day < 1 ||
+        t->day > strider_days_in_month(t->year, t->month) || t->hour > 23 || t->minute > 59 ||
+        t->second > 60) {
+        return false;
+    }
+
+    /* Bound the year before multiplying so nothing below can overflow */
+    if (t->year < -400000 || t->year > 400000) {
+        return false;
+    }
+    const int64_t seconds = strider_days_from_civil(t->year, t->month, t->day) * 86400 +
+                            t->hour * 3600 + t->minute * 60 + t->second - offset;
+    return strider_timestamp_to_ns(seconds, nanos, ns);
+}
+
+/**
+ * @brief Parse what follows the fixed part of a stamp and convert it
+ *
+ * @param start Start of the stamp
+ * @param p End of the fixed part
+ * @param end End of input
+ * @param t Fields of the fixed part
+ * @param allow_zone Whether a zone may follow (ISO 8601 only)
+ * @return Stamp length, or 0 if it is invalid
+ */
+static inline size_t strider_timestamp_finish(const uint8_t *start, const uint8_t *p,
+                                              const uint8_t *end, const strider_civil_time_t *t,
+                                              bool allow_zone, int64_t *ns) {
+    int64_t nanos;
+    int64_t offset = 0;
+
+    p = strider_timestamp_fraction(p, end, &nanos);
+    if (allow_zone) {
+        p = strider_timestamp_zone(p, end, &offset);
+        if (!p) {
+            return 0;
+        }
+    }
+    if (!strider_timestamp_assemble(t, nanos, offset, ns)) {
+        return 0;
+    }
+    return (size_t) (p - start);
+}
+
+/**
+ * @brief Parse epoch seconds ("1767225599" or "1767225599.123")
+ *
+ * Short and variable-length, so every backend uses this scalar parser.
+ *
+ * @return Stamp length, or 0 if it is invalid
+ */
+static inline size_t strider_timestamp_parse_epoch(const uint8_t *start, size_t size,
+                                                   int64_t *ns) {
+    const uint8_t *end = start + size;
+    const uint8_t *p = start;
+    int64_t seconds = 0;
+    int64_t nanos;
+
+    /* At most 10 digits; the range check below rejects the rest */
+    while (p < end && strider_is_digit(*p) && p - start <= 10) {
+        seconds = seconds * 10 + (*p++ - '0');
+    }
+    if (p == start || p - start > 10) {
+        return 0;
+    }
+
+    p = strider_timestamp_fraction(p, end, &nanos);
+    return strider_timestamp_to_ns(seconds, nanos, ns) ? (size_t) (p - start) : 0;
+}
+
+#endif /* STRIDER_INTERNAL_TIMESTAMP_H */
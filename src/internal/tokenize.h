@@ -0,0 +1,55 @@
+/**
+ * @file tokenize.h
+ * @brief Field output shared by the tokenizer implementations
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * The scalar reference (src/parsers/tokenize.c) and the kernels in
+ * tokenize_simd.c find field boundaries differently but write them
+ * through this writer, so single-line calls (views) and batches (spans)
+ * share one implementation per backend.
+ */
+
+#ifndef STRIDER_INTERNAL_TOKENIZE_H
+#define STRIDER_INTERNAL_TOKENIZE_H
+
+#include "strider/parsers/tokenize.h"
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Destination for the fields of one line
+ *
+ * Exactly one of spans and views is set.
+ */
+typedef struct {
+    strider_field_span_t *spans;  /**< Batch output */
+    strider_buffer_view_t *views; /**< Single-line output */
+    const uint8_t *line;          /**< Start of the line (for views) */
+    size_t capacity;              /**< Fields that fit */
+    size_t count;                 /**< Fields written */
+} strider_field_writer_t;
+
+static inline void strider_field_emit(strider_field_writer_t *w, size_t start, size_t length) {
+    if (w->views) {
+        w->views[w->count] = strider_buffer_view_create(w->line + start, length);
+    } else {
+        w->spans[w->count].start = (uint32_t) start;
+        w->spans[w->count].length = (uint32_t) length;
+    }
+    w->count++;
+}
+
+/* Extend the last field written to the end of the line (size bytes) */
+static inline void strider_field_extend(strider_field_writer_t *w, size_t size) {
+    if (w->views) {
+        strider_buffer_view_t *last = &w->views[w->count - 1];
+        last->size = size - (size_t) (last->data - w->line);
+    } else {
+        strider_field_span_t *last = &w->spans[w->count - 1];
+        last->length = (uint32_t) (size - last->start);
+    }
+}
+
+#endif /* STRIDER_INTERNAL_TOKENIZE_H */
@@ -0,0 +1,70 @@
+/**
+ * @file varint.h
+ * @brief LEB128 varint helpers
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Shared by the packed newline position output (newline.c and the
+ * newline kernels) and the line index sidecar (src/io/line_index.c).
+ * Values are stored 7 bits per byte, low group first, with the high bit
+ * set on every byte but the last.
+ */
+
+#ifndef STRIDER_INTERNAL_VARINT_H
+#define STRIDER_INTERNAL_VARINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/** Longest encoding of a 64-bit value */
+#define STRIDER_VARINT_MAX_BYTES 10
+
+/**
+ * @brief Encoded size of value in bytes
+ */
+static inline size_t strider_varint_length(uint64_t value) {
+    size_t n = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        n++;
+    }
+    return n;
+}
+
+/**
+ * @brief Encode value at p (needs strider_varint_length(value) bytes)
+ *
+ * @return Bytes written
+ */
+static inline size_t strider_varint_encode(uint8_t *p, uint64_t value) {
+    size_t n = 0;
+    while (value >= 0x80) {
+        p[n++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    p[n++] = (uint8_t) value;
+    return n;
+}
+
+/**
+ * @brief Decode one value from [p, end)
+ *
+ * @return Pointer past the value, or NULL if it is truncated or longer
+ *         than STRIDER_VARINT_MAX_BYTES
+ */
+static inline const uint8_t *strider_varint_decode(const uint8_t *p, const uint8_t *end,
+                                                   uint64_t *value) {
+    uint64_t result = 0;
+    for (unsigned shift = 0; shift < 64 && p < end; shift += 7) {
+        const uint8_t byte = *p++;
+        result |= (uint64_t) (byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return p;
+        }
+    }
+    return NULL;
+}
+
+#endif /* STRIDER_INTERNAL_VARINT_H */
@@ -0,0 +1,375 @@
+/**
+ * @file decompress.c
+ * @brief Streaming gzip and zstd decompression implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * The compressed input comes from a strider_reader (so reading ahead
+ * overlaps inflating), and is decompressed into a single window which
+ * is filled completely before it is returned: every window but the
+ * last is window_size bytes. Plain input is passed through as the
+ * reader's chunks, which are window_size bytes too.
+ *
+ * Both formats allow members / frames to be concatenated (as `cat
+ * a.gz b.gz` or `zstd` on several files produce). Input that ends
+ * inside a member or frame is reported as truncated. Zero bytes from
+ * the end of a gzip member up to the end of the input (block padding
+ * of tar and tape writers) end the stream cleanly, as with gzip -d.
+ */
+
+#include "strider/io/decompress.h"
+#include "strider/io/reader.h"
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(STRIDER_HAVE_ZLIB)
+#    include <zlib.h>
+#endif
+
+#if defined(STRIDER_HAVE_ZSTD)
+#    include <zstd.h>
+#endif
+
+/* Window alignment (cache line, like the rest of the scan buffers) */
+#define WINDOW_ALIGNMENT 64
+
+struct strider_decompressor {
+    strider_reader_t *reader;
+    strider_compression_t format;
+    size_t window_size;
+    uint8_t *window;
+
+    strider_buffer_view_t in; /* Compressed bytes not consumed yet */
+    bool eof;                 /* The reader has no more chunks */
+    bool frame_open;          /* Inside a gzip member or zstd frame */
+
+#if defined(STRIDER_HAVE_ZLIB)
+    z_stream zlib;
+    bool zlib_ready;
+    bool member_done; /* At least one gzip member has ended */
+#endif
+#if defined(STRIDER_HAVE_ZSTD)
+    ZSTD_DStream *zstd;
+#endif
+};
+
+/* Make input available unless the reader is done */
+static int fill_input(strider_decompressor_t *input) {
+    while (input->in.size == 0 && !input->eof) {
+        const int result = strider_reader_next(input->reader, &input->in);
+        if (result < 0) {
+            return -1;
+        }
+        if (result == 0) {
+            input->in = strider_buffer_view_create(NULL, 0);
+            input->eof = true;
+        }
+    }
+    return 0;
+}
+
+static void consume_input(strider_decompressor_t *input, size_t size) {
+    input->in.data = (const uint8_t *) input->in.data + size;
+    input->in.size -= size;
+}
+
+/* ========================================================================
+ * gzip (zlib)
+ * ======================================================================== */
+
+#if defined(STRIDER_HAVE_ZLIB)
+
+static int gzip_init(strider_decompressor_t *input) {
+    memset(&input->zlib, 0, sizeof(input->zlib));
+    /* 15 + 32: largest window, detect gzip or zlib headers */
+    if (inflateInit2(&input->zlib, 15 + 32) != Z_OK) {
+        errno = ENOMEM;
+        return -1;
+    }
+    input->zlib_ready = true;
+    return 0;
+}
+
+/* Inflate into the window; returns 1 on progress, 0 if none was possible, -1 */
+static int gzip_step(strider_decompressor_t *input, size_t *produced) {
+    z_stream *zs = &input->zlib;
+    const size_t in_size = input->in.size < UINT_MAX ? input->in.size : UINT_MAX;
+    const size_t space = input->window_size - *produced;
+    const size_t out_size = space < UINT_MAX ? space : UINT_MAX;
+
+    zs->next_in = (Bytef *) input->in.data;
+    zs->avail_in = (uInt) in_size;
+    zs->next_out = input->window + *produced;
+    zs->avail_out = (uInt) out_size;
+
+    const int status = inflate(zs, Z_NO_FLUSH);
+    const size_t consumed = in_size - zs->avail_in;
+    const size_t inflated = out_size - zs->avail_out;
+
+    consume_input(input, consumed);
+    *produced += inflated;
+
+    if (status == Z_STREAM_END) {
+        /* End of a member; another one may follow */
+        inflateReset(zs);
+        input->frame_open = false;
+        input->member_done = true;
+    } else if (status == Z_OK || status == Z_BUF_ERROR) {
+        /* Z_BUF_ERROR only means no progress was possible */
+        if (consumed > 0) {
+            input->frame_open = true;
+        }
+    } else {
+        errno = status == Z_MEM_ERROR ? ENOMEM : EIO;
+        return -1;
+    }
+    return consumed + inflated > 0;
+}
+
+/* Skip zero padding between a member and the end of the input; -1 if more data follows it */
+static int gzip_skip_padding(strider_decompressor_t *input) {
+    bool skipped = false;
+
+    if (!input->member_done || input->frame_open) {
+        return 0;
+    }
+    while (input->in.size > 0 && *(const uint8_t *) input->in.data == 0) {
+        const uint8_t *bytes = (const uint8_t *) input->in.data;
+        size_t zeros = 1;
+
+        while (zeros < input->in.size && bytes[zeros] == 0) {
+            zeros++;
+        }
+        consume_input(input, zeros);
+        skipped = true;
+        if (fill_input(input) != 0) {
+            return -1;
+        }
+    }
+    if (skipped && input->in.size > 0) {
+        errno = EIO; /* Not padding: garbage after the last member */
+        return -1;
+    }
+    return 0;
+}
+
+#endif
+
+/* ========================================================================
+ * zstd
+ * ======================================================================== */
+
+#if defined(STRIDER_HAVE_ZSTD)
+
+static int zstd_init(strider_decompressor_t *input) {
+    input->zstd = ZSTD_createDStream();
+    if (!input->zstd || ZSTD_isError(ZSTD_initDStream(input->zstd))) {
+        errno = ENOMEM;
+        return -1;
+    }
+    return 0;
+}
+
+/* Decompress into the window; returns 1 on progress, 0 if none, -1 */
+static int zstd_step(strider_decompressor_t *input, size_t *produced) {
+    ZSTD_inBuffer in = {input->in.data, input->in.size, 0};
+    ZSTD_outBuffer out = {input->window + *produced, input->window_size - *produced, 0};
+
+    /* Returns 0 exactly when a frame is complete and fully flushed */
+    const size_t hint = ZSTD_decompressStream(input->zstd, &out, &in);
+    if (ZSTD_isError(hint)) {
+        errno = EIO;
+        return -1;
+    }
+
+    consume_input(input, in.pos);
+    *produced += out.pos;
+    input->frame_open = hint != 0;
+    return in.pos + out.pos > 0;
+}
+
+#endif
+
+/* ========================================================================
+ * Public API
+ * ======================================================================== */
+
+bool strider_decompress_supported(strider_compression_t format) {
+    switch (format) {
+    case STRIDER_COMPRESSION_AUTO:
+    case STRIDER_COMPRESSION_NONE:
+        return true;
+    case STRIDER_COMPRESSION_GZIP:
+#if defined(STRIDER_HAVE_ZLIB)
+        return true;
+#else
+        return false;
+#endif
+    case STRIDER_COMPRESSION_ZSTD:
+#if defined(STRIDER_HAVE_ZSTD)
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+/* Format from the magic bytes at the start of the input */
+static strider_compression_t detect_format(strider_buffer_view_t head) {
+    const uint8_t *bytes = (const uint8_t *) head.data;
+
+    if (head.size >= 2 && bytes[0] == 0x1f && bytes[1] == 0x8b) {
+        return STRIDER_COMPRESSION_GZIP;
+    }
+    if (head.size >= 4 && bytes[0] == 0x28 && bytes[1] == 0xb5 && bytes[2] == 0x2f &&
+        bytes[3] == 0xfd) {
+        return STRIDER_COMPRESSION_ZSTD;
+    }
+    return STRIDER_COMPRESSION_NONE;
+}
+
+strider_decompressor_t *strider_decompress_open(const char *path,
+                                                const strider_decompress_options_t *options) {
+    const strider_decompress_options_t defaults = {0, STRIDER_COMPRESSION_AUTO};
+    strider_decompressor_t *input;
+    int status = 0;
+
+    if (!options) {
+        options = &defaults;
+    }
+    if (!path || (int) options->format < STRIDER_COMPRESSION_AUTO ||
+        options->format > STRIDER_COMPRESSION_ZSTD) {
+        errno = EINVAL;
+        return NULL;
+    }
+    if (!strider_decompress_supported(options->format)) {
+        errno = ENOTSUP;
+        return NULL;
+    }
+
+    input = (strider_decompressor_t *) calloc(1, sizeof(*input));
+    if (!input) {
+        return NULL;
+    }
+    input->window_size =
+        options->window_size ? options->window_size : STRIDER_DECOMPRESS_WINDOW_SIZE;
+    input->format = options->format;
+
+    /* Compressed chunks of window_size; plain chunks are the windows */
+    const strider_reader_options_t reader_options = {input->window_size, 0, STRIDER_READER_AUTO};
+    input->reader = strider_reader_open(path, &reader_options);
+    if (!input->reader) {
+        free(input);
+        return NULL;
+    }
+
+    if (input->format == STRIDER_COMPRESSION_AUTO) {
+        status = fill_input(input);
+        input->format = detect_format(input->in);
+        if (status == 0 && !strider_decompress_supported(input->format)) {
+            errno = ENOTSUP;
+            status = -1;
+        }
+    }
+    if (status == 0 && input->format != STRIDER_COMPRESSION_NONE) {
+        input->window = (uint8_t *) strider_aligned_alloc(WINDOW_ALIGNMENT, input->window_size);
+        status = input->window ? 0 : -1;
+    }
+#if defined(STRIDER_HAVE_ZLIB)
+    if (status == 0 && input->format == STRIDER_COMPRESSION_GZIP) {
+        status = gzip_init(input);
+    }
+#endif
+#if defined(STRIDER_HAVE_ZSTD)
+    if (status == 0 && input->format == STRIDER_COMPRESSION_ZSTD) {
+        status = zstd_init(input);
+    }
+#endif
+
+    if (status != 0) {
+        const int error = errno;
+        strider_decompress_close(input);
+        errno = error;
+        return NULL;
+    }
+    return input;
+}
+
+int strider_decompress_next(strider_decompressor_t *input, strider_buffer_view_t *window) {
+    size_t produced = 0;
+
+    if (!input || !window) {
+        return -1;
+    }
+
+    if (input->format == STRIDER_COMPRESSION_NONE) {
+        if (fill_input(input) != 0) {
+            return -1;
+        }
+        *window = input->in;
+        input->in = strider_buffer_view_create(NULL, 0);
+        return window->size > 0;
+    }
+
+    while (produced < input->window_size) {
+        int progress = -1;
+
+        if (fill_input(input) != 0) {
+            return -1;
+        }
+#if defined(STRIDER_HAVE_ZLIB)
+        if (input->format == STRIDER_COMPRESSION_GZIP && gzip_skip_padding(input) != 0) {
+            return -1;
+        }
+#endif
+        if (input->in.size == 0 && input->eof && !input->frame_open) {
+            break;
+        }
+#if defined(STRIDER_HAVE_ZLIB)
+        if (input->format == STRIDER_COMPRESSION_GZIP) {
+            progress = gzip_step(input, &produced);
+        }
+#endif
+#if defined(STRIDER_HAVE_ZSTD)
+        if (input->format == STRIDER_COMPRESSION_ZSTD) {
+            progress = zstd_step(input, &produced);
+        }
+#endif
+        if (progress < 0) {
+            return -1;
+        }
+        if (progress == 0 && input->in.size == 0 && input->eof) {
+            errno = EIO; /* Truncated: the input ended inside a member or frame */
+            return -1;
+        }
+    }
+
+    *window = strider_buffer_view_create(input->window, produced);
+    return produced > 0;
+}
+
+strider_compression_t strider_decompress_format(const strider_decompressor_t *input) {
+    return input->format;
+}
+
+void strider_decompress_close(strider_decompressor_t *input) {
+    if (!input) {
+        return;
+    }
+#if defined(STRIDER_HAVE_ZLIB)
+    if (input->zlib_ready) {
+        inflateEnd(&input->zlib);
+    }
+#endif
+#if defined(STRIDER_HAVE_ZSTD)
+    ZSTD_freeDStream(input->zstd);
+#endif
+    strider_reader_close(input->reader);
+    strider_aligned_free(input->window);
+    free(input);
+}
@@ -0,0 +1,260 @@
+/**
+ * @file file.c
+ * @brief Memory-mapped file input implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * POSIX: open + fstat + mmap(PROT_READ, MAP_PRIVATE), hints via
+ * posix_fadvise/madvise. Windows: CreateFileMapping + MapViewOfFile
+ * (hints are ignored). Non-mappable inputs fall back to read().
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* MAP_POPULATE, MADV_HUGEPAGE */
+#endif
+
+#include "strider/io/file.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <errno.h>
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#if defined(_WIN32)
+
+/* ========================================================================
+ * Windows Implementation
+ * ======================================================================== */
+
+int strider_file_open(strider_file_t *file, const char *path, unsigned flags) {
+    HANDLE handle;
+    LARGE_INTEGER size;
+
+    (void) flags;
+    if (!file || !path) {
+        return -1;
+    }
+    memset(file, 0, sizeof(*file));
+
+    handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+                         FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return -1;
+    }
+    if (!GetFileSizeEx(handle, &size) || (uint64_t) size.QuadPart > SIZE_MAX) {
+        CloseHandle(handle);
+        return -1;
+    }
+    if (size.QuadPart == 0) {
+        CloseHandle(handle);
+        file->mapped = true;
+        return 0;
+    }
+
+    HANDLE mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(handle); /* The mapping keeps the file open */
+    if (mapping == NULL) {
+        return -1;
+    }
+
+    file->data = (const uint8_t *) MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (file->data == NULL) {
+        CloseHandle(mapping);
+        return -1;
+    }
+    file->size = (size_t) size.QuadPart;
+    file->mapped = true;
+    file->handle = mapping;
+
+    return 0;
+}
+
+void strider_file_close(strider_file_t *file) {
+    if (!file) {
+        return;
+    }
+    if (file->mapped) {
+        if (file->data) {
+            UnmapViewOfFile(file->data);
+        }
+        if (file->handle) {
+            CloseHandle((HANDLE) file->handle);
+        }
+    } else {
+        free((void *) file->data);
+    }
+    memset(file, 0, sizeof(*file));
+}
+
+#else
+
+/* ========================================================================
+ * POSIX Implementation
+ * ======================================================================== */
+
+/* Read a non-mappable input (pipe, tty, ...) to EOF into a heap buffer */
+static int read_all(strider_file_t *file, int fd) {
+    size_t capacity = 64 * 1024;
+    size_t size = 0;
+    uint8_t *buffer = (uint8_t *) malloc(capacity);
+
+    if (!buffer) {
+        return -1;
+    }
+
+    for (;;) {
+        if (size == capacity) {
+            uint8_t *grown = (capacity <= SIZE_MAX / 2) ? realloc(buffer, capacity * 2) : NULL;
+            if (!grown) {
+                free(buffer);
+                errno = ENOMEM;
+                return -1;
+            }
+            buffer = grown;
+            capacity *= 2;
+        }
+
+        ssize_t n = read(fd, buffer + size, capacity - size);
+        if (n == 0) {
+            break;
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            free(buffer);
+            return -1;
+        }
+        size += (size_t) n;
+    }
+
+    file->data = buffer;
+    file->size = size;
+    file->mapped = false;
+    return 0;
+}
+
+/* Best-effort access-pattern hints; failures are ignored */
+static void apply_hints(int fd, void *map, size_t size, unsigned flags) {
+#    if defined(POSIX_FADV_SEQUENTIAL)
+    if (flags & STRIDER_FILE_SEQUENTIAL) {
+        (void) posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+    if (flags & STRIDER_FILE_WILLNEED) {
+        (void) posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    }
+#    else
+    (void) fd;
+#    endif
+
+#    if defined(MADV_SEQUENTIAL)
+    if (flags & STRIDER_FILE_SEQUENTIAL) {
+        (void) madvise(map, size, MADV_SEQUENTIAL);
+    }
+#    endif
+#    if defined(MADV_WILLNEED)
+    if (flags & STRIDER_FILE_WILLNEED) {
+        (void) madvise(map, size, MADV_WILLNEED);
+    }
+#    endif
+#    if defined(MADV_HUGEPAGE)
+    if (flags & STRIDER_FILE_HUGEPAGES) {
+        (void) madvise(map, size, MADV_HUGEPAGE);
+    }
+#    endif
+    (void) map;
+    (void) size;
+    (void) flags;
+}
+
+int strider_file_open(strider_file_t *file, const char *path, unsigned flags) {
+    struct stat st;
+    int map_flags = MAP_PRIVATE;
+    void *map;
+    int fd;
+    int saved_errno;
+
+    if (!file || !path) {
+        errno = EINVAL;
+        return -1;
+    }
+    memset(file, 0, sizeof(*file));
+
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &st) != 0) {
+        goto fail;
+    }
+
+    if (!S_ISREG(st.st_mode)) {
+        if (read_all(file, fd) != 0) {
+            goto fail;
+        }
+        close(fd);
+        return 0;
+    }
+
+    if ((uintmax_t) st.st_size > SIZE_MAX) {
+        errno = EFBIG;
+        goto fail;
+    }
+    if (st.st_size == 0) {
+        /* mmap rejects empty lengths; an empty view needs no mapping */
+        file->mapped = true;
+        close(fd);
+        return 0;
+    }
+
+#    if defined(MAP_POPULATE)
+    if (flags & STRIDER_FILE_POPULATE) {
+        map_flags |= MAP_POPULATE;
+    }
+#    endif
+
+    map = mmap(NULL, (size_t) st.st_size, PROT_READ, map_flags, fd, 0);
+    if (map == MAP_FAILED) {
+        goto fail;
+    }
+    apply_hints(fd, map, (size_t) st.st_size, flags);
+
+    /* The mapping stays valid after the descriptor is closed */
+    close(fd);
+    file->data = (const uint8_t *) map;
+    file->size = (size_t) st.st_size;
+    file->mapped = true;
+    return 0;
+
+fail:
+    saved_errno = errno;
+    close(fd);
+    memset(file, 0, sizeof(*file));
+    errno = saved_errno;
+    return -1;
+}
+
+void strider_file_close(strider_file_t *file) {
+    if (!file) {
+        return;
+    }
+    if (file->mapped) {
+        if (file->data) {
+            munmap((void *) file->data, file->size);
+        }
+    } else {
+        free((void *) file->data);
+    }
+    memset(file, 0, sizeof(*file));
+}
+
+#endif
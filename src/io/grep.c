@@ -0,0 +1,325 @@
+/**
+ * @file grep.c
+ * @brief Parallel literal line search implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * A chunk owns the lines that start in it: its first line starts after
+ * the line ending at or after the byte before the chunk, and its last
+ * line is the one holding the chunk's last byte, which may run on into
+ * the next chunks. Those boundaries are found by each chunk on its own,
+ * so chunks need no coordination, and the line-ending lookups only ever
+ * cover the line around a match or a chunk boundary.
+ *
+ * Line numbers (when asked for) are the newlines counted from the chunk's
+ * first line to each matching line, plus the newline totals of all
+ * chunks before it, which are known by the time the chunk is emitted.
+ */
+
+#include "internal/lines.h"
+#include "strider/io/file.h"
+#include "strider/io/grep.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/memchr.h"
+#include "strider/parsers/multi_pattern.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/strstr.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+struct strider_grep {
+    unsigned flags;
+    strider_multi_pattern_t *patterns; /* Two or more patterns */
+    strider_needle_t needle;           /* A single pattern */
+    uint8_t *needle_data;
+    strider_byteset_t line_ends; /* \n and \r */
+};
+
+typedef struct {
+    size_t offset;   /* Line start */
+    size_t length;   /* Without the line ending */
+    size_t newlines; /* Newlines from the chunk's first line to the line */
+} grep_record_t;
+
+typedef struct {
+    size_t stop;     /* Line ending of the chunk's last line (or input size) */
+    size_t next;     /* Start of the next line to search */
+    size_t end;      /* Start of the next chunk's first line */
+    size_t counted;  /* Newlines are counted up to here */
+    size_t newlines; /* Newlines in [first line, counted) */
+    size_t count;    /* Records stored */
+    bool done;       /* Searched up to stop */
+    grep_record_t *records;
+} grep_chunk_t;
+
+typedef struct {
+    const strider_grep_t *grep;
+    const char *data;
+    size_t size;
+    size_t first_chunk; /* Input chunk of chunks[0] */
+    grep_chunk_t *chunks;
+} grep_job_t;
+
+/* ========================================================================
+ * Searching
+ * ======================================================================== */
+
+/* First \n or \r at or after from, or size */
+static size_t find_line_end(const grep_job_t *job, size_t from) {
+    const size_t at = strider_find_byteset_simd(
+        strider_buffer_view_create(job->data + from, job->size - from), &job->grep->line_ends);
+    return at == STRIDER_NOT_FOUND ? job->size : from + at;
+}
+
+/* Start of the line after the one ending at end (size: none) */
+static size_t line_after(const grep_job_t *job, size_t end) {
+    return end >= job->size ? job->size : strider_next_line_start(job->data, job->size, end);
+}
+
+/* Start of the line holding pos, which is in the line starting at or after floor */
+static size_t find_line_start(const grep_job_t *job, size_t floor, size_t pos) {
+    size_t at = strider_memrchr_simd(
+        strider_buffer_view_create(job->data + floor, pos - floor), '\n');
+    if (at != STRIDER_NOT_FOUND) {
+        floor += at + 1;
+    }
+    at = strider_memrchr_simd(strider_buffer_view_create(job->data + floor, pos - floor), '\r');
+    return at == STRIDER_NOT_FOUND ? floor : floor + at + 1;
+}
+
+/* Offset of the first match in [from, stop), or STRIDER_NOT_FOUND */
+static size_t find_match(const grep_job_t *job, size_t from, size_t stop) {
+    const strider_grep_t *grep = job->grep;
+    const strider_buffer_view_t haystack =
+        strider_buffer_view_create(job->data + from, stop - from);
+    size_t at;
+
+    if (grep->patterns) {
+        strider_match_t match;
+        at = strider_multi_pattern_find_simd(grep->patterns, haystack, &match, 1) == 1
+                 ? match.offset
+                 : STRIDER_NOT_FOUND;
+    } else if (grep->flags & STRIDER_GREP_IGNORE_CASE) {
+        at = strider_needle_find_nocase(haystack, &grep->needle);
+    } else {
+        at = strider_needle_find(haystack, &grep->needle);
+    }
+    return at == STRIDER_NOT_FOUND ? STRIDER_NOT_FOUND : from + at;
+}
+
+static void count_newlines_to(const grep_job_t *job, grep_chunk_t *chunk, size_t pos) {
+    if (job->grep->flags & STRIDER_GREP_LINE_NUMBERS) {
+        chunk->newlines += strider_count_newlines_simd(job->data + chunk->counted,
+                                                       pos - chunk->counted);
+        chunk->counted = pos;
+    }
+}
+
+/* Record matching lines until the chunk is done or its records are full */
+static void chunk_search(const grep_job_t *job, grep_chunk_t *chunk) {
+    while (!chunk->done && chunk->count < STRIDER_GREP_CHUNK_LINES) {
+        const size_t match = chunk->next < chunk->stop
+                                 ? find_match(job, chunk->next, chunk->stop)
+                                 : STRIDER_NOT_FOUND;
+
+        if (match == STRIDER_NOT_FOUND) {
+            count_newlines_to(job, chunk, chunk->end);
+            chunk->done = true;
+            break;
+        }
+
+        /* Patterns hold no line ending, so the line is within [next, stop] */
+        const size_t start = find_line_start(job, chunk->next, match);
+        const size_t end = find_line_end(job, match);
+        grep_record_t *record = &chunk->records[chunk->count++];
+
+        count_newlines_to(job, chunk, start);
+        record->offset = start;
+        record->length = end - start;
+        record->newlines = chunk->newlines;
+        chunk->next = line_after(job, end);
+    }
+}
+
+static void chunk_init(const grep_job_t *job, grep_chunk_t *chunk, size_t index) {
+    const size_t begin = index * STRIDER_GREP_CHUNK_SIZE;
+    const size_t last = (job->size - begin <= STRIDER_GREP_CHUNK_SIZE
+                             ? job->size
+                             : begin + STRIDER_GREP_CHUNK_SIZE) - 1;
+    const size_t first = begin == 0 ? 0 : line_after(job, find_line_end(job, begin - 1));
+
+    chunk->stop = find_line_end(job, last);
+    chunk->end = line_after(job, chunk->stop);
+    chunk->next = first;
+    chunk->counted = first;
+    chunk->newlines = 0;
+    chunk->count = 0;
+    chunk->done = first > chunk->stop; /* Inside a line started before */
+    if (chunk->done) {
+        chunk->end = first;
+    }
+}
+
+static void search_task(void *arg, size_t index) {
+    grep_job_t *job = (grep_job_t *) arg;
+    grep_chunk_t *chunk = &job->chunks[index];
+
+    chunk_init(job, chunk, job->first_chunk + index);
+    chunk_search(job, chunk);
+}
+
+/* ========================================================================
+ * Public API
+ * ======================================================================== */
+
+strider_grep_t *strider_grep_create(const strider_buffer_view_t *patterns, size_t count,
+                                    unsigned flags) {
+    strider_grep_t *grep;
+
+    if (!patterns || count == 0 || ((flags & STRIDER_GREP_IGNORE_CASE) && count > 1)) {
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!patterns[i].data || patterns[i].size == 0 ||
+            memchr(patterns[i].data, '\n', patterns[i].size) ||
+            memchr(patterns[i].data, '\r', patterns[i].size)) {
+            return NULL;
+        }
+    }
+
+    grep = (strider_grep_t *) calloc(1, sizeof(*grep));
+    if (!grep) {
+        return NULL;
+    }
+    grep->flags = flags;
+    strider_byteset_init(&grep->line_ends, "\n\r", 2);
+
+    if (count > 1) {
+        grep->patterns = strider_multi_pattern_create(patterns, count);
+        if (!grep->patterns) {
+            strider_grep_destroy(grep);
+            return NULL;
+        }
+        return grep;
+    }
+
+    grep->needle_data = (uint8_t *) malloc(patterns[0].size);
+    if (!grep->needle_data) {
+        strider_grep_destroy(grep);
+        return NULL;
+    }
+    memcpy(grep->needle_data, patterns[0].data, patterns[0].size);
+    strider_needle_init(&grep->needle,
+                        strider_buffer_view_create(grep->needle_data, patterns[0].size));
+    return grep;
+}
+
+void strider_grep_destroy(strider_grep_t *grep) {
+    if (!grep) {
+        return;
+    }
+    strider_multi_pattern_destroy(grep->patterns);
+    free(grep->needle_data);
+    free(grep);
+}
+
+int strider_grep_buffer(const strider_grep_t *grep, strider_buffer_view_t input,
+                        const strider_executor_t *executor, strider_grep_output_fn output,
+                        void *context, size_t *lines) {
+    const size_t num_chunks = (input.size + STRIDER_GREP_CHUNK_SIZE - 1) / STRIDER_GREP_CHUNK_SIZE;
+    grep_job_t job = {grep, (const char *) input.data, input.size, 0, NULL};
+    grep_record_t *records;
+    size_t newlines = 0; /* Before the chunk being emitted */
+    size_t reported = 0;
+    bool stopped = false;
+
+    if (lines) {
+        *lines = 0;
+    }
+    if (!grep || (!input.data && input.size > 0)) {
+        return -1;
+    }
+    if (num_chunks == 0) {
+        return 0;
+    }
+
+    job.chunks = (grep_chunk_t *) calloc(STRIDER_GREP_BATCH_CHUNKS, sizeof(grep_chunk_t));
+    records = (grep_record_t *) malloc(sizeof(grep_record_t) * STRIDER_GREP_BATCH_CHUNKS *
+                                       STRIDER_GREP_CHUNK_LINES);
+    if (!job.chunks || !records) {
+        free(job.chunks);
+        free(records);
+        return -1;
+    }
+    for (size_t i = 0; i < STRIDER_GREP_BATCH_CHUNKS; i++) {
+        job.chunks[i].records = records + i * STRIDER_GREP_CHUNK_LINES;
+    }
+
+    for (size_t first = 0; first < num_chunks && !stopped; first += STRIDER_GREP_BATCH_CHUNKS) {
+        const size_t batch = num_chunks - first < STRIDER_GREP_BATCH_CHUNKS
+                                 ? num_chunks - first
+                                 : STRIDER_GREP_BATCH_CHUNKS;
+
+        job.first_chunk = first;
+        if (executor && batch > 1) {
+            executor->run(executor->context, search_task, &job, batch);
+        } else {
+            for (size_t i = 0; i < batch; i++) {
+                search_task(&job, i);
+            }
+        }
+
+        /* Emit in order; a chunk that filled its records resumes here */
+        for (size_t i = 0; i < batch && !stopped; i++) {
+            grep_chunk_t *chunk = &job.chunks[i];
+
+            for (;;) {
+                for (size_t r = 0; r < chunk->count && !stopped; r++) {
+                    const grep_record_t *record = &chunk->records[r];
+                    strider_grep_line_t line;
+
+                    line.text = strider_buffer_view_create(job.data + record->offset,
+                                                           record->length);
+                    line.offset = record->offset;
+                    line.number = (grep->flags & STRIDER_GREP_LINE_NUMBERS)
+                                      ? newlines + record->newlines + 1
+                                      : 0;
+                    stopped = output && output(context, &line) != 0;
+                    reported++;
+                }
+                if (stopped || chunk->done) {
+                    break;
+                }
+                chunk->count = 0;
+                chunk_search(&job, chunk);
+            }
+            newlines += chunk->newlines;
+        }
+    }
+
+    free(records);
+    free(job.chunks);
+    if (lines) {
+        *lines = reported;
+    }
+    return 0;
+}
+
+int strider_grep_file(const strider_grep_t *grep, const char *path,
+                      const strider_executor_t *executor, strider_grep_output_fn output,
+                      void *context, size_t *lines) {
+    strider_file_t file;
+    int result;
+
+    if (lines) {
+        *lines = 0;
+    }
+    if (!grep || !path || strider_file_open(&file, path, STRIDER_FILE_DEFAULT) != 0) {
+        return -1;
+    }
+    result = strider_grep_buffer(grep, strider_file_view(&file), executor, output, context, lines);
+    strider_file_close(&file);
+    return result;
+}
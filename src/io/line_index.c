@@ -0,0 +1,613 @@
+/**
+ * @file line_index.c
+ * @brief Line index sidecar implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Writing goes through stdio; reading maps the index with
+ * strider_file_open(). Newlines are collected with the resumable stream
+ * API, so an append that starts with the \n of a \r\n pair split by the
+ * previous update is handled like a single scan.
+ *
+ * An in-place update rewrites the partial last block at its old data
+ * offset and only then the header. The new encoding starts with the old
+ * one's varints, so a crash before the header write leaves the previous
+ * index intact.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* fseeko, struct stat st_mtim */
+#endif
+
+#include "internal/varint.h"
+#include "strider/io/file.h"
+#include "strider/io/line_index.h"
+#include "strider/parsers/newline.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#if defined(_WIN32)
+#    define index_fseek _fseeki64
+#else
+#    define index_fseek fseeko
+#endif
+
+#define INDEX_MAGIC "STRLIDX\n"
+#define INDEX_VERSION 1
+#define INDEX_HEADER_SIZE 4096
+#define INDEX_SKIP_ENTRY_SIZE 16
+#define INDEX_MIN_SKIP_CAPACITY 64
+#define INDEX_FLAG_PENDING_CR 0x1u
+
+/* Source ranges hashed to fingerprint the indexed prefix */
+#define INDEX_HASH_HEAD (64 * 1024)
+#define INDEX_HASH_TAIL (4 * 1024)
+
+/* Bytes scanned per newline stream call (and positions buffer size) */
+#define INDEX_SCAN_CHUNK (64 * 1024)
+
+/* Worst-case encoded block: a maximum-length varint per gap */
+#define INDEX_MAX_BLOCK_BYTES (STRIDER_LINE_INDEX_BLOCK_LINES * STRIDER_VARINT_MAX_BYTES)
+
+/* Internal status: the skip table has no room for another block */
+#define INDEX_FULL 1
+
+typedef struct {
+    uint32_t block_lines;
+    uint64_t source_size;
+    int64_t source_mtime_ns;
+    uint64_t source_hash;
+    uint64_t line_count;
+    uint64_t skip_capacity;
+    uint64_t data_size;
+    uint32_t flags;
+} index_header_t;
+
+struct strider_line_index {
+    strider_file_t file;
+    const uint8_t *skip;
+    const uint8_t *data;
+    size_t data_size;
+    size_t line_count;
+    size_t source_size;
+    size_t block_lines;
+};
+
+/* ========================================================================
+ * Encoding Helpers
+ * ======================================================================== */
+
+static void store_le32(uint8_t *p, uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+        p[i] = (uint8_t) (value >> (8 * i));
+    }
+}
+
+static void store_le64(uint8_t *p, uint64_t value) {
+    for (int i = 0; i < 8; i++) {
+        p[i] = (uint8_t) (value >> (8 * i));
+    }
+}
+
+static uint32_t load_le32(const uint8_t *p) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) {
+        value |= (uint32_t) p[i] << (8 * i);
+    }
+    return value;
+}
+
+static uint64_t load_le64(const uint8_t *p) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) {
+        value |= (uint64_t) p[i] << (8 * i);
+    }
+    return value;
+}
+
+/* ========================================================================
+ * Header and Source Metadata
+ * ======================================================================== */
+
+static void header_encode(const index_header_t *header, uint8_t *out) {
+    memset(out, 0, INDEX_HEADER_SIZE);
+    memcpy(out, INDEX_MAGIC, 8);
+    store_le32(out + 8, INDEX_VERSION);
+    store_le32(out + 12, header->block_lines);
+    store_le64(out + 16, header->source_size);
+    store_le64(out + 24, (uint64_t) header->source_mtime_ns);
+    store_le64(out + 32, header->source_hash);
+    store_le64(out + 40, header->line_count);
+    store_le64(out + 48, header->skip_capacity);
+    store_le64(out + 56, header->data_size);
+    store_le32(out + 64, header->flags);
+}
+
+/* Parse and sanity-check a header; file_size bounds the sections */
+static int header_decode(const uint8_t *in, uint64_t file_size, index_header_t *header) {
+    if (file_size < INDEX_HEADER_SIZE || memcmp(in, INDEX_MAGIC, 8) != 0 ||
+        load_le32(in + 8) != INDEX_VERSION) {
+        return -1;
+    }
+
+    header->block_lines = load_le32(in + 12);
+    header->source_size = load_le64(in + 16);
+    header->source_mtime_ns = (int64_t) load_le64(in + 24);
+    header->source_hash = load_le64(in + 32);
+    header->line_count = load_le64(in + 40);
+    header->skip_capacity = load_le64(in + 48);
+    header->data_size = load_le64(in + 56);
+    header->flags = load_le32(in + 64);
+
+    /* The tail of the skip table and an empty data region may be unwritten */
+    if (header->block_lines == 0 || header->skip_capacity > UINT32_MAX ||
+        header->line_count > header->source_size) {
+        return -1;
+    }
+    const uint64_t data_start = INDEX_HEADER_SIZE + header->skip_capacity * INDEX_SKIP_ENTRY_SIZE;
+    const uint64_t blocks =
+        header->line_count / header->block_lines + (header->line_count % header->block_lines != 0);
+    if (blocks > header->skip_capacity ||
+        INDEX_HEADER_SIZE + blocks * INDEX_SKIP_ENTRY_SIZE > file_size ||
+        (header->data_size > 0 &&
+         (file_size < data_start || header->data_size > file_size - data_start))) {
+        return -1;
+    }
+    return 0;
+}
+
+static uint64_t fnv1a(uint64_t hash, const uint8_t *data, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001B3ULL;
+    }
+    return hash;
+}
+
+/* Fingerprint of source[0, size): its head and tail samples */
+static uint64_t source_hash(const uint8_t *data, size_t size) {
+    const size_t head = size < INDEX_HASH_HEAD ? size : INDEX_HASH_HEAD;
+    const size_t tail = size - head < INDEX_HASH_TAIL ? size - head : INDEX_HASH_TAIL;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    uint8_t length[8];
+
+    store_le64(length, size);
+    hash = fnv1a(hash, length, sizeof(length));
+    hash = fnv1a(hash, data, head);
+    return fnv1a(hash, data + size - tail, tail);
+}
+
+static int source_mtime(const char *path, int64_t *mtime_ns) {
+#if defined(_WIN32)
+    struct __stat64 st;
+    if (_stat64(path, &st) != 0) {
+        return -1;
+    }
+    *mtime_ns = (int64_t) st.st_mtime * 1000000000;
+#else
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+#    if defined(__APPLE__)
+    *mtime_ns = (int64_t) st.st_mtimespec.tv_sec * 1000000000 + st.st_mtimespec.tv_nsec;
+#    else
+    *mtime_ns = (int64_t) st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+#    endif
+#endif
+    return 0;
+}
+
+/* ========================================================================
+ * Writer
+ * ======================================================================== */
+
+typedef struct {
+    FILE *fp;
+    index_header_t header; /* line_count / data_size cover flushed blocks only */
+    uint64_t blocks;       /* Skip entries written */
+    size_t pending[STRIDER_LINE_INDEX_BLOCK_LINES];
+    size_t num_pending;
+} index_writer_t;
+
+static int write_at(FILE *fp, uint64_t offset, const void *data, size_t size) {
+    if (index_fseek(fp, (int64_t) offset, SEEK_SET) != 0) {
+        return -1;
+    }
+    return fwrite(data, 1, size, fp) == size ? 0 : -1;
+}
+
+static int writer_flush_block(index_writer_t *w) {
+    uint8_t block[INDEX_MAX_BLOCK_BYTES];
+    uint8_t entry[INDEX_SKIP_ENTRY_SIZE];
+    size_t length = 0;
+
+    if (w->num_pending == 0) {
+        return 0;
+    }
+    if (w->blocks == w->header.skip_capacity) {
+        return INDEX_FULL;
+    }
+
+    for (size_t i = 1; i < w->num_pending; i++) {
+        length += strider_varint_encode(block + length, w->pending[i] - w->pending[i - 1] - 1);
+    }
+    store_le64(entry, w->pending[0]);
+    store_le64(entry + 8, w->header.data_size);
+
+    const uint64_t data_start =
+        INDEX_HEADER_SIZE + w->header.skip_capacity * INDEX_SKIP_ENTRY_SIZE;
+    if ((length > 0 && write_at(w->fp, data_start + w->header.data_size, block, length) != 0) ||
+        write_at(w->fp, INDEX_HEADER_SIZE + w->blocks * INDEX_SKIP_ENTRY_SIZE, entry,
+                 sizeof(entry)) != 0) {
+        return -1;
+    }
+
+    w->header.data_size += length;
+    w->header.line_count += w->num_pending;
+    w->blocks++;
+    w->num_pending = 0;
+    return 0;
+}
+
+static int writer_add(index_writer_t *w, size_t position) {
+    w->pending[w->num_pending++] = position;
+    return w->num_pending == STRIDER_LINE_INDEX_BLOCK_LINES ? writer_flush_block(w) : 0;
+}
+
+/* Feed data (the source from stream->offset on) through the writer */
+static int writer_scan(index_writer_t *w, strider_newline_stream_t *stream, const uint8_t *data,
+                       size_t size) {
+    size_t *positions = (size_t *) malloc(INDEX_SCAN_CHUNK * sizeof(size_t));
+    int status = 0;
+
+    if (!positions) {
+        return -1;
+    }
+    for (size_t done = 0; done < size && status == 0;) {
+        const size_t chunk = size - done < INDEX_SCAN_CHUNK ? size - done : INDEX_SCAN_CHUNK;
+        const size_t found = strider_newline_stream_feed_positions(
+            stream, (const char *) data + done, chunk, positions, INDEX_SCAN_CHUNK);
+
+        for (size_t i = 0; i < found && status == 0; i++) {
+            status = writer_add(w, positions[i]);
+        }
+        done += chunk;
+    }
+    free(positions);
+    return status;
+}
+
+/* Flush the partial block and commit the header for source[0, size) */
+static int writer_finish(index_writer_t *w, const uint8_t *source, size_t size,
+                         int64_t mtime_ns) {
+    uint8_t header[INDEX_HEADER_SIZE];
+    int status = writer_flush_block(w);
+
+    if (status != 0) {
+        return status;
+    }
+    w->header.source_size = size;
+    w->header.source_mtime_ns = mtime_ns;
+    w->header.source_hash = source_hash(source, size);
+    w->header.flags = (size > 0 && source[size - 1] == '\r') ? INDEX_FLAG_PENDING_CR : 0;
+
+    header_encode(&w->header, header);
+    if (write_at(w->fp, 0, header, sizeof(header)) != 0 || fflush(w->fp) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Reopen the partial last block so new positions extend it */
+static int writer_resume(index_writer_t *w) {
+    const uint64_t data_start =
+        INDEX_HEADER_SIZE + w->header.skip_capacity * INDEX_SKIP_ENTRY_SIZE;
+    const size_t partial = (size_t) (w->header.line_count % w->header.block_lines);
+    uint8_t entry[INDEX_SKIP_ENTRY_SIZE];
+    uint8_t block[INDEX_MAX_BLOCK_BYTES];
+
+    w->blocks = w->header.line_count / w->header.block_lines + (partial != 0);
+    if (partial == 0) {
+        return 0;
+    }
+
+    w->blocks--;
+    if (index_fseek(w->fp, (int64_t) (INDEX_HEADER_SIZE + w->blocks * INDEX_SKIP_ENTRY_SIZE),
+                    SEEK_SET) != 0 ||
+        fread(entry, 1, sizeof(entry), w->fp) != sizeof(entry)) {
+        return -1;
+    }
+
+    const uint64_t offset = load_le64(entry + 8);
+    if (offset > w->header.data_size) {
+        return -1;
+    }
+    const size_t length = (size_t) (w->header.data_size - offset) < sizeof(block)
+                              ? (size_t) (w->header.data_size - offset)
+                              : sizeof(block);
+    if (index_fseek(w->fp, (int64_t) (data_start + offset), SEEK_SET) != 0 ||
+        fread(block, 1, length, w->fp) != length) {
+        return -1;
+    }
+
+    const uint8_t *p = block;
+    w->pending[0] = (size_t) load_le64(entry);
+    for (size_t i = 1; i < partial; i++) {
+        uint64_t gap;
+        if (!(p = strider_varint_decode(p, block + length, &gap))) {
+            return -1;
+        }
+        w->pending[i] = w->pending[i - 1] + (size_t) gap + 1;
+    }
+    w->num_pending = partial;
+    w->header.line_count -= partial;
+    w->header.data_size = offset;
+    return 0;
+}
+
+/* ========================================================================
+ * Build and Update
+ * ======================================================================== */
+
+int strider_line_index_build(const char *index_path, const char *source_path) {
+    strider_file_t source;
+    strider_newline_stream_t stream;
+    index_writer_t writer;
+    int64_t mtime_ns;
+    char *tmp_path;
+    int status;
+
+    if (!index_path || !source_path) {
+        return -1;
+    }
+    /* Stat before mapping: a concurrent append then looks newer, not older */
+    if (source_mtime(source_path, &mtime_ns) != 0 ||
+        strider_file_open(&source, source_path, STRIDER_FILE_DEFAULT) != 0) {
+        return -1;
+    }
+
+    const size_t path_length = strlen(index_path);
+    tmp_path = (char *) malloc(path_length + sizeof(".tmp"));
+    if (!tmp_path) {
+        strider_file_close(&source);
+        return -1;
+    }
+    memcpy(tmp_path, index_path, path_length);
+    memcpy(tmp_path + path_length, ".tmp", sizeof(".tmp"));
+
+    /* Size the skip table from a count pass, with room to grow 2x */
+    const size_t lines = strider_count_newlines_simd((const char *) source.data, source.size);
+    const uint64_t blocks = lines / STRIDER_LINE_INDEX_BLOCK_LINES +
+                            (lines % STRIDER_LINE_INDEX_BLOCK_LINES != 0);
+
+    memset(&writer, 0, sizeof(writer));
+    writer.header.block_lines = STRIDER_LINE_INDEX_BLOCK_LINES;
+    writer.header.skip_capacity =
+        2 * blocks > INDEX_MIN_SKIP_CAPACITY ? 2 * blocks : INDEX_MIN_SKIP_CAPACITY;
+    writer.fp = fopen(tmp_path, "wb");
+
+    status = -1;
+    if (writer.fp) {
+        strider_newline_stream_init(&stream);
+        status = writer_scan(&writer, &stream, source.data, source.size);
+        if (status == 0) {
+            status = writer_finish(&writer, source.data, source.size, mtime_ns);
+        }
+        if (fclose(writer.fp) != 0) {
+            status = -1;
+        }
+    }
+    strider_file_close(&source);
+
+    if (status == 0) {
+#if defined(_WIN32)
+        (void) remove(index_path); /* rename() does not replace on Windows */
+#endif
+        status = rename(tmp_path, index_path) == 0 ? 0 : -1;
+    }
+    if (status != 0) {
+        (void) remove(tmp_path);
+        status = -1;
+    }
+    free(tmp_path);
+    return status;
+}
+
+/* Try to extend an existing index in place; nonzero means rebuild */
+static int line_index_append(FILE *fp, const index_header_t *header, const char *source_path) {
+    strider_file_t source;
+    strider_newline_stream_t stream;
+    index_writer_t writer;
+    int64_t mtime_ns;
+    int status;
+
+    if (header->block_lines != STRIDER_LINE_INDEX_BLOCK_LINES ||
+        source_mtime(source_path, &mtime_ns) != 0 ||
+        strider_file_open(&source, source_path, STRIDER_FILE_DEFAULT) != 0) {
+        return -1;
+    }
+    if (source.size < header->source_size ||
+        source_hash(source.data, (size_t) header->source_size) != header->source_hash) {
+        strider_file_close(&source);
+        return -1;
+    }
+    if (source.size == header->source_size && mtime_ns == header->source_mtime_ns) {
+        strider_file_close(&source);
+        return 0;
+    }
+
+    memset(&writer, 0, sizeof(writer));
+    writer.fp = fp;
+    writer.header = *header;
+    status = writer_resume(&writer);
+
+    if (status == 0) {
+        strider_newline_stream_init(&stream);
+        stream.offset = (size_t) header->source_size;
+        stream.pending_cr = (header->flags & INDEX_FLAG_PENDING_CR) != 0;
+        status = writer_scan(&writer, &stream, source.data + header->source_size,
+                             source.size - (size_t) header->source_size);
+    }
+    if (status == 0) {
+        status = writer_finish(&writer, source.data, source.size, mtime_ns);
+    }
+
+    strider_file_close(&source);
+    return status;
+}
+
+int strider_line_index_update(const char *index_path, const char *source_path) {
+    uint8_t raw[INDEX_HEADER_SIZE];
+    index_header_t header;
+    int status = -1;
+    FILE *fp;
+
+    if (!index_path || !source_path) {
+        return -1;
+    }
+
+    fp = fopen(index_path, "r+b");
+    if (fp) {
+        if (fread(raw, 1, sizeof(raw), fp) == sizeof(raw) &&
+            index_fseek(fp, 0, SEEK_END) == 0) {
+#if defined(_WIN32)
+            const int64_t file_size = _ftelli64(fp);
+#else
+            const int64_t file_size = (int64_t) ftello(fp);
+#endif
+            if (file_size > 0 && header_decode(raw, (uint64_t) file_size, &header) == 0) {
+                status = line_index_append(fp, &header, source_path);
+            }
+        }
+        if (fclose(fp) != 0) {
+            status = -1;
+        }
+    }
+
+    return status == 0 ? 0 : strider_line_index_build(index_path, source_path);
+}
+
+/* ========================================================================
+ * Reader
+ * ======================================================================== */
+
+strider_line_index_t *strider_line_index_open(const char *index_path) {
+    strider_line_index_t *index;
+    index_header_t header;
+
+    if (!index_path) {
+        return NULL;
+    }
+    index = (strider_line_index_t *) calloc(1, sizeof(*index));
+    if (!index) {
+        return NULL;
+    }
+    if (strider_file_open(&index->file, index_path, 0) != 0) {
+        free(index);
+        return NULL;
+    }
+    if (index->file.size < INDEX_HEADER_SIZE ||
+        header_decode(index->file.data, index->file.size, &header) != 0) {
+        strider_line_index_close(index);
+        return NULL;
+    }
+
+    index->skip = index->file.data + INDEX_HEADER_SIZE;
+    index->data = header.data_size > 0
+                      ? index->skip + header.skip_capacity * INDEX_SKIP_ENTRY_SIZE
+                      : NULL;
+    index->data_size = (size_t) header.data_size;
+    index->line_count = (size_t) header.line_count;
+    index->source_size = (size_t) header.source_size;
+    index->block_lines = header.block_lines;
+    return index;
+}
+
+void strider_line_index_close(strider_line_index_t *index) {
+    if (!index) {
+        return;
+    }
+    strider_file_close(&index->file);
+    free(index);
+}
+
+size_t strider_line_index_count(const strider_line_index_t *index) {
+    return index ? index->line_count : 0;
+}
+
+size_t strider_line_index_source_size(const strider_line_index_t *index) {
+    return index ? index->source_size : 0;
+}
+
+size_t strider_line_index_position(const strider_line_index_t *index, size_t n) {
+    if (!index || n >= index->line_count) {
+        return STRIDER_NOT_FOUND;
+    }
+
+    const uint8_t *entry = index->skip + (n / index->block_lines) * INDEX_SKIP_ENTRY_SIZE;
+    const uint64_t offset = load_le64(entry + 8);
+    size_t position = (size_t) load_le64(entry);
+    size_t gaps = n % index->block_lines;
+
+    if (gaps == 0) {
+        return position;
+    }
+    if (offset >= index->data_size) {
+        return STRIDER_NOT_FOUND;
+    }
+    const uint8_t *p = index->data + offset;
+    const uint8_t *end = index->data + index->data_size;
+    for (; gaps > 0; gaps--) {
+        uint64_t gap;
+        if (!(p = strider_varint_decode(p, end, &gap))) {
+            return STRIDER_NOT_FOUND;
+        }
+        position += (size_t) gap + 1;
+    }
+    return position;
+}
+
+/* Offset just past the newline at position */
+static size_t line_start_after(strider_buffer_view_t source, size_t position) {
+    const bool crlf = source.data[position] == '\r' && position + 1 < source.size &&
+                      source.data[position + 1] == '\n';
+    return position + (crlf ? 2 : 1);
+}
+
+int strider_line_index_line(const strider_line_index_t *index, strider_buffer_view_t source,
+                            size_t n, strider_buffer_view_t *line) {
+    size_t start = 0;
+    size_t end;
+
+    if (!index || !line || n > index->line_count || source.size < index->source_size) {
+        return -1;
+    }
+
+    if (n > 0) {
+        const size_t previous = strider_line_index_position(index, n - 1);
+        if (previous == STRIDER_NOT_FOUND || previous >= source.size) {
+            return -1;
+        }
+        start = line_start_after(source, previous);
+    }
+    if (n < index->line_count) {
+        end = strider_line_index_position(index, n);
+        if (end == STRIDER_NOT_FOUND || end < start) {
+            return -1;
+        }
+    } else {
+        /* Unterminated text after the last indexed newline */
+        end = index->source_size;
+        if (start >= end) {
+            return -1;
+        }
+    }
+
+    *line = strider_buffer_view_create(source.data + start, end - start);
+    return 0;
+}
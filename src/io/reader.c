@@ -0,0 +1,738 @@
+/**
+ * @file reader.c
+ * @brief Asynchronous read-ahead input implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Chunk k of the file always lives in buffer k % buffers, so the ring
+ * needs no free list: handing chunk k back lets the buffer be refilled
+ * with chunk k + buffers.
+ *
+ * io_uring: the ring is driven with the raw system calls (no liburing).
+ * All buffers are submitted up front as IORING_OP_READV at their file
+ * offsets, and a buffer handed back is resubmitted at once. Completions
+ * may arrive in any order; a short read of a buffer is continued until
+ * the buffer is full or a read returns 0, so only the last chunk is
+ * short.
+ *
+ * Thread: a background thread fills the buffers in order with pread()
+ * (read() for pipes and terminals) and waits while all of them are
+ * full; the consumer waits while none is.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* pread */
+#endif
+
+#include "strider/io/reader.h"
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+typedef SRWLOCK reader_mutex_t;
+typedef CONDITION_VARIABLE reader_cond_t;
+typedef HANDLE reader_thread_t;
+typedef HANDLE reader_file_t;
+#    define reader_mutex_init(m) InitializeSRWLock(m)
+#    define reader_mutex_destroy(m) ((void) (m))
+#    define reader_mutex_lock(m) AcquireSRWLockExclusive(m)
+#    define reader_mutex_unlock(m) ReleaseSRWLockExclusive(m)
+#    define reader_cond_init(c) InitializeConditionVariable(c)
+#    define reader_cond_destroy(c) ((void) (c))
+#    define reader_cond_wait(c, m) SleepConditionVariableSRW((c), (m), INFINITE, 0)
+#    define reader_cond_signal(c) WakeConditionVariable(c)
+#else
+#    include <fcntl.h>
+#    include <pthread.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+typedef pthread_mutex_t reader_mutex_t;
+typedef pthread_cond_t reader_cond_t;
+typedef pthread_t reader_thread_t;
+typedef int reader_file_t;
+#    define reader_mutex_init(m) pthread_mutex_init((m), NULL)
+#    define reader_mutex_destroy(m) pthread_mutex_destroy(m)
+#    define reader_mutex_lock(m) pthread_mutex_lock(m)
+#    define reader_mutex_unlock(m) pthread_mutex_unlock(m)
+#    define reader_cond_init(c) pthread_cond_init((c), NULL)
+#    define reader_cond_destroy(c) pthread_cond_destroy(c)
+#    define reader_cond_wait(c, m) pthread_cond_wait((c), (m))
+#    define reader_cond_signal(c) pthread_cond_signal(c)
+#endif
+
+#if defined(STRIDER_HAVE_IO_URING)
+#    include <linux/io_uring.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <sys/uio.h>
+#endif
+
+/* Buffers start on page boundaries (as O_DIRECT and DMA would want) */
+#define READER_ALIGNMENT 4096
+
+#if defined(STRIDER_HAVE_IO_URING)
+
+/* ========================================================================
+ * io_uring Ring
+ * ======================================================================== */
+
+typedef struct {
+    int fd;
+    unsigned *sq_tail;
+    unsigned *sq_mask;
+    unsigned *sq_array;
+    unsigned *cq_head;
+    unsigned *cq_tail;
+    unsigned *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ring;
+    void *cq_ring; /* Same as sq_ring with IORING_FEAT_SINGLE_MMAP */
+    size_t sq_ring_size;
+    size_t cq_ring_size;
+    size_t sqes_size;
+} uring_t;
+
+/* State of one buffer under io_uring */
+typedef struct {
+    struct iovec iov; /* Remainder of the buffer being read */
+    uint64_t offset;  /* File offset of the buffer */
+    size_t filled;    /* Bytes read so far */
+    bool pending;     /* A read is in flight */
+    bool done;        /* Full, or a read returned 0 */
+    int error;
+} uring_slot_t;
+
+static void uring_destroy(uring_t *ring) {
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqes_size);
+    }
+    if (ring->cq_ring && ring->cq_ring != ring->sq_ring) {
+        munmap(ring->cq_ring, ring->cq_ring_size);
+    }
+    if (ring->sq_ring) {
+        munmap(ring->sq_ring, ring->sq_ring_size);
+    }
+    if (ring->fd >= 0) {
+        close(ring->fd);
+    }
+    memset(ring, 0, sizeof(*ring));
+    ring->fd = -1;
+}
+
+/* 0 on success, otherwise an errno value */
+static int uring_init(uring_t *ring, unsigned entries) {
+    struct io_uring_params params;
+    int error;
+
+    memset(ring, 0, sizeof(*ring));
+    memset(&params, 0, sizeof(params));
+    ring->fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (ring->fd < 0) {
+        return errno;
+    }
+
+    ring->sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    ring->cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (ring->cq_ring_size > ring->sq_ring_size) {
+            ring->sq_ring_size = ring->cq_ring_size;
+        }
+        ring->cq_ring_size = ring->sq_ring_size;
+    }
+
+    ring->sq_ring = mmap(NULL, ring->sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (ring->sq_ring == MAP_FAILED) {
+        ring->sq_ring = NULL;
+        goto fail;
+    }
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        ring->cq_ring = ring->sq_ring;
+    } else {
+        ring->cq_ring = mmap(NULL, ring->cq_ring_size, PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_CQ_RING);
+        if (ring->cq_ring == MAP_FAILED) {
+            ring->cq_ring = NULL;
+            goto fail;
+        }
+    }
+    ring->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = (struct io_uring_sqe *) mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE,
+                                              MAP_SHARED | MAP_POPULATE, ring->fd,
+                                              IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = NULL;
+        goto fail;
+    }
+
+    uint8_t *sq = (uint8_t *) ring->sq_ring;
+    uint8_t *cq = (uint8_t *) ring->cq_ring;
+    ring->sq_tail = (unsigned *) (sq + params.sq_off.tail);
+    ring->sq_mask = (unsigned *) (sq + params.sq_off.ring_mask);
+    ring->sq_array = (unsigned *) (sq + params.sq_off.array);
+    ring->cq_head = (unsigned *) (cq + params.cq_off.head);
+    ring->cq_tail = (unsigned *) (cq + params.cq_off.tail);
+    ring->cq_mask = (unsigned *) (cq + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe *) (cq + params.cq_off.cqes);
+    return 0;
+
+fail:
+    error = errno;
+    uring_destroy(ring);
+    return error;
+}
+
+static int uring_enter(uring_t *ring, unsigned submit, unsigned wait) {
+    const unsigned flags = wait > 0 ? IORING_ENTER_GETEVENTS : 0;
+    int result;
+
+    do {
+        result = (int) syscall(__NR_io_uring_enter, ring->fd, submit, wait, flags, NULL, 0);
+    } while (result < 0 && errno == EINTR);
+    return result < 0 ? errno : 0;
+}
+
+/* Queue and submit a read of the rest of a buffer; 0 or an errno value */
+static int uring_submit_read(uring_t *ring, int fd, uring_slot_t *slot, uint64_t user_data) {
+    const unsigned tail = *ring->sq_tail;
+    const unsigned index = tail & *ring->sq_mask;
+    struct io_uring_sqe *sqe = &ring->sqes[index];
+
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READV;
+    sqe->fd = fd;
+    sqe->addr = (uint64_t) (uintptr_t) &slot->iov;
+    sqe->len = 1;
+    sqe->off = slot->offset + slot->filled;
+    sqe->user_data = user_data;
+    ring->sq_array[index] = index;
+    __atomic_store_n(ring->sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+    /* A failed enter consumed nothing: take the entry back */
+    const int error = uring_enter(ring, 1, 0);
+    if (error != 0) {
+        __atomic_store_n(ring->sq_tail, tail, __ATOMIC_RELEASE);
+    }
+    slot->pending = error == 0;
+    return error;
+}
+
+#endif /* STRIDER_HAVE_IO_URING */
+
+/* ========================================================================
+ * Reader
+ * ======================================================================== */
+
+struct strider_reader {
+    strider_reader_backend_t backend;
+    reader_file_t file;
+    bool owns_file;
+    bool seekable;
+    size_t buffer_size;
+    size_t num_buffers;
+    uint8_t *memory; /* num_buffers buffers, READER_ALIGNMENT apart */
+    size_t stride;
+    size_t consumed; /* Chunks handed back (not counting the one out) */
+    bool holding;    /* Chunk number consumed is out with the caller */
+    bool eof;        /* The chunk out (or an earlier one) was the last */
+    bool stopping;   /* Closing: no new reads */
+
+    /* Thread backend, guarded by lock */
+    reader_mutex_t lock;
+    reader_cond_t ready; /* A buffer was filled, or the thread finished */
+    reader_cond_t space; /* A buffer was handed back, or stop */
+    reader_thread_t thread;
+    bool thread_started;
+    size_t produced; /* Chunks filled */
+    size_t *lengths;
+    bool finished; /* No more chunks will be produced */
+    bool stop;
+    int error;
+
+#if defined(STRIDER_HAVE_IO_URING)
+    uring_t ring;
+    uring_slot_t *slots;
+    uint64_t next_offset; /* File offset of the next buffer to submit */
+    int failed;           /* First error; every later call fails with it */
+#endif
+};
+
+static uint8_t *buffer_at(const strider_reader_t *reader, size_t index) {
+    return reader->memory + index * reader->stride;
+}
+
+/* ========================================================================
+ * Thread Backend
+ * ======================================================================== */
+
+#if defined(_WIN32)
+
+/* Fill up to size bytes; 0 or a GetLastError() value */
+static int read_fully(strider_reader_t *reader, uint8_t *buffer, size_t size, uint64_t offset,
+                      size_t *length) {
+    *length = 0;
+    while (*length < size) {
+        const DWORD request =
+            size - *length > 0x40000000 ? 0x40000000 : (DWORD) (size - *length);
+        OVERLAPPED overlapped;
+        OVERLAPPED *position = NULL;
+        DWORD got = 0;
+
+        if (reader->seekable) {
+            const uint64_t at = offset + *length;
+            memset(&overlapped, 0, sizeof(overlapped));
+            overlapped.Offset = (DWORD) at;
+            overlapped.OffsetHigh = (DWORD) (at >> 32);
+            position = &overlapped;
+        }
+        if (!ReadFile(reader->file, buffer + *length, request, &got, position)) {
+            const DWORD error = GetLastError();
+            return error == ERROR_HANDLE_EOF || error == ERROR_BROKEN_PIPE ? 0 : (int) error;
+        }
+        if (got == 0) {
+            return 0;
+        }
+        *length += got;
+    }
+    return 0;
+}
+
+#else
+
+/* Fill up to size bytes; 0 or an errno value */
+static int read_fully(strider_reader_t *reader, uint8_t *buffer, size_t size, uint64_t offset,
+                      size_t *length) {
+    *length = 0;
+    while (*length < size) {
+        const ssize_t got =
+            reader->seekable
+                ? pread(reader->file, buffer + *length, size - *length, (off_t) (offset + *length))
+                : read(reader->file, buffer + *length, size - *length);
+        if (got < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return errno;
+        }
+        if (got == 0) {
+            return 0;
+        }
+        *length += (size_t) got;
+    }
+    return 0;
+}
+
+#endif
+
+static void read_ahead(strider_reader_t *reader) {
+    uint64_t offset = 0;
+
+    reader_mutex_lock(&reader->lock);
+    for (size_t chunk = 0;; chunk++) {
+        const size_t index = chunk % reader->num_buffers;
+        size_t length;
+        int error;
+
+        while (!reader->stop && chunk - reader->consumed >= reader->num_buffers) {
+            reader_cond_wait(&reader->space, &reader->lock);
+        }
+        if (reader->stop) {
+            break;
+        }
+        reader_mutex_unlock(&reader->lock);
+        error = read_fully(reader, buffer_at(reader, index), reader->buffer_size, offset, &length);
+        offset += length;
+        reader_mutex_lock(&reader->lock);
+
+        if (error != 0) {
+            reader->error = error;
+            reader->finished = true;
+        } else {
+            reader->lengths[index] = length;
+            reader->produced = chunk + 1;
+            reader->finished = length < reader->buffer_size;
+        }
+        reader_cond_signal(&reader->ready);
+        if (reader->finished) {
+            break;
+        }
+    }
+    reader_mutex_unlock(&reader->lock);
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI read_thread_main(LPVOID param) {
+    read_ahead((strider_reader_t *) param);
+    return 0;
+}
+#else
+static void *read_thread_main(void *param) {
+    read_ahead((strider_reader_t *) param);
+    return NULL;
+}
+#endif
+
+static int thread_start(strider_reader_t *reader) {
+    reader_mutex_init(&reader->lock);
+    reader_cond_init(&reader->ready);
+    reader_cond_init(&reader->space);
+    reader->lengths = (size_t *) calloc(reader->num_buffers, sizeof(size_t));
+    if (!reader->lengths) {
+        return -1;
+    }
+#if defined(_WIN32)
+    reader->thread = CreateThread(NULL, 0, read_thread_main, reader, 0, NULL);
+    reader->thread_started = reader->thread != NULL;
+#else
+    reader->thread_started = pthread_create(&reader->thread, NULL, read_thread_main, reader) == 0;
+#endif
+    return reader->thread_started ? 0 : -1;
+}
+
+static int thread_next(strider_reader_t *reader, strider_buffer_view_t *chunk) {
+    int error;
+
+    reader_mutex_lock(&reader->lock);
+    if (reader->holding) {
+        reader->consumed++;
+        reader->holding = false;
+        reader_cond_signal(&reader->space);
+    }
+    while (reader->consumed == reader->produced && !reader->finished) {
+        reader_cond_wait(&reader->ready, &reader->lock);
+    }
+    if (reader->consumed < reader->produced) {
+        const size_t index = reader->consumed % reader->num_buffers;
+
+        if (reader->lengths[index] > 0) {
+            *chunk = strider_buffer_view_create(buffer_at(reader, index), reader->lengths[index]);
+            reader->holding = true;
+            reader_mutex_unlock(&reader->lock);
+            return 1;
+        }
+    }
+    error = reader->error;
+    reader_mutex_unlock(&reader->lock);
+
+    if (error != 0) {
+        errno = error;
+        return -1;
+    }
+    return 0;
+}
+
+static void thread_stop(strider_reader_t *reader) {
+    if (reader->thread_started) {
+        reader_mutex_lock(&reader->lock);
+        reader->stop = true;
+        reader_cond_signal(&reader->space);
+        reader_mutex_unlock(&reader->lock);
+#if defined(_WIN32)
+        WaitForSingleObject(reader->thread, INFINITE);
+        CloseHandle(reader->thread);
+#else
+        pthread_join(reader->thread, NULL);
+#endif
+    }
+    reader_cond_destroy(&reader->ready);
+    reader_cond_destroy(&reader->space);
+    reader_mutex_destroy(&reader->lock);
+    free(reader->lengths);
+}
+
+/* ========================================================================
+ * io_uring Backend
+ * ======================================================================== */
+
+#if defined(STRIDER_HAVE_IO_URING)
+
+/* Queue the read of the next chunk into a buffer; 0 or an errno value */
+static int uring_fill(strider_reader_t *reader, size_t index) {
+    uring_slot_t *slot = &reader->slots[index];
+
+    slot->offset = reader->next_offset;
+    slot->filled = 0;
+    slot->done = false;
+    slot->error = 0;
+    slot->iov.iov_base = buffer_at(reader, index);
+    slot->iov.iov_len = reader->buffer_size;
+    reader->next_offset += reader->buffer_size;
+    return uring_submit_read(&reader->ring, reader->file, slot, index);
+}
+
+/* Handle the completions present, waiting for one if there are none */
+static int uring_reap(strider_reader_t *reader, bool wait) {
+    uring_t *ring = &reader->ring;
+    unsigned head = *ring->cq_head;
+    const unsigned tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+
+    if (head == tail) {
+        return wait ? uring_enter(ring, 0, 1) : 0;
+    }
+    for (; head != tail; head++) {
+        const struct io_uring_cqe *cqe = &ring->cqes[head & *ring->cq_mask];
+        uring_slot_t *slot = &reader->slots[cqe->user_data];
+        const int result = cqe->res;
+
+        slot->pending = false;
+        if (reader->stopping) {
+            slot->done = true;
+        } else if (result == -EINTR || result == -EAGAIN) {
+            slot->error = uring_submit_read(ring, reader->file, slot, cqe->user_data);
+            slot->done = slot->error != 0;
+        } else if (result < 0) {
+            slot->error = -result;
+            slot->done = true;
+        } else if (result == 0 || slot->filled + (size_t) result == reader->buffer_size) {
+            slot->filled += (size_t) result;
+            slot->done = true;
+        } else {
+            /* Short read: continue with the rest of the buffer */
+            slot->filled += (size_t) result;
+            slot->iov.iov_base = buffer_at(reader, cqe->user_data) + slot->filled;
+            slot->iov.iov_len = reader->buffer_size - slot->filled;
+            slot->error = uring_submit_read(ring, reader->file, slot, cqe->user_data);
+            slot->done = slot->error != 0;
+        }
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+    return 0;
+}
+
+static int uring_start(strider_reader_t *reader) {
+    int error = uring_init(&reader->ring, (unsigned) reader->num_buffers);
+
+    if (error != 0) {
+        errno = error;
+        return -1;
+    }
+    reader->slots = (uring_slot_t *) calloc(reader->num_buffers, sizeof(uring_slot_t));
+    if (!reader->slots) {
+        return -1;
+    }
+    for (size_t i = 0; i < reader->num_buffers; i++) {
+        error = uring_fill(reader, i);
+        if (error != 0) {
+            errno = error;
+            return -1;
+        }
+    }
+    return 0;
+}
+
+/* Make an error sticky: the ring may be left with a slot never refilled */
+static int uring_fail(strider_reader_t *reader, int error) {
+    reader->failed = error;
+    errno = error;
+    return -1;
+}
+
+static int uring_next(strider_reader_t *reader, strider_buffer_view_t *chunk) {
+    size_t index = reader->consumed % reader->num_buffers;
+    int error;
+
+    if (reader->failed != 0) {
+        errno = reader->failed;
+        return -1;
+    }
+    if (reader->holding) {
+        reader->holding = false;
+        reader->consumed++;
+        if (!reader->eof) {
+            error = uring_fill(reader, index);
+            if (error != 0) {
+                reader->slots[index].error = error;
+                reader->slots[index].done = true;
+                return uring_fail(reader, error);
+            }
+        }
+        index = reader->consumed % reader->num_buffers;
+    }
+    if (reader->eof) {
+        return 0;
+    }
+
+    uring_slot_t *slot = &reader->slots[index];
+    while (!slot->done) {
+        error = uring_reap(reader, true);
+        if (error != 0) {
+            return uring_fail(reader, error);
+        }
+    }
+    if (slot->error != 0) {
+        return uring_fail(reader, slot->error);
+    }
+    reader->eof = slot->filled < reader->buffer_size;
+    if (slot->filled == 0) {
+        return 0;
+    }
+    *chunk = strider_buffer_view_create(buffer_at(reader, index), slot->filled);
+    reader->holding = true;
+    return 1;
+}
+
+/* Wait out the reads in flight, which still write into the buffers */
+static void uring_stop(strider_reader_t *reader) {
+    reader->stopping = true;
+    for (size_t i = 0; reader->slots && i < reader->num_buffers; i++) {
+        while (reader->slots[i].pending && uring_reap(reader, true) == 0) {
+        }
+    }
+    uring_destroy(&reader->ring);
+    free(reader->slots);
+    reader->slots = NULL;
+}
+
+#endif /* STRIDER_HAVE_IO_URING */
+
+/* ========================================================================
+ * Public API
+ * ======================================================================== */
+
+static int open_file(strider_reader_t *reader, const char *path) {
+#if defined(_WIN32)
+    if (strcmp(path, "-") == 0) {
+        reader->file = GetStdHandle(STD_INPUT_HANDLE);
+    } else {
+        reader->file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
+                                   OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        reader->owns_file = true;
+    }
+    if (reader->file == INVALID_HANDLE_VALUE || reader->file == NULL) {
+        reader->owns_file = false;
+        return -1;
+    }
+    reader->seekable = GetFileType(reader->file) == FILE_TYPE_DISK;
+#else
+    struct stat st;
+
+    if (strcmp(path, "-") == 0) {
+        reader->file = STDIN_FILENO;
+    } else {
+        reader->file = open(path, O_RDONLY | O_CLOEXEC);
+        reader->owns_file = reader->file >= 0;
+    }
+    if (reader->file < 0 || fstat(reader->file, &st) != 0) {
+        return -1;
+    }
+    reader->seekable = S_ISREG(st.st_mode) || S_ISBLK(st.st_mode);
+#    if defined(POSIX_FADV_SEQUENTIAL)
+    if (reader->seekable) {
+        posix_fadvise(reader->file, 0, 0, POSIX_FADV_SEQUENTIAL);
+    }
+#    endif
+#endif
+    return 0;
+}
+
+static void close_file(strider_reader_t *reader) {
+    if (!reader->owns_file) {
+        return;
+    }
+#if defined(_WIN32)
+    CloseHandle(reader->file);
+#else
+    close(reader->file);
+#endif
+}
+
+strider_reader_t *strider_reader_open(const char *path, const strider_reader_options_t *options) {
+    const strider_reader_options_t defaults = {0, 0, STRIDER_READER_AUTO};
+    strider_reader_t *reader;
+    int started = -1;
+
+    if (!options) {
+        options = &defaults;
+    }
+    if (!path || options->buffers == 1 || (int) options->backend < STRIDER_READER_AUTO ||
+        options->backend > STRIDER_READER_THREAD) {
+        errno = EINVAL;
+        return NULL;
+    }
+
+    reader = (strider_reader_t *) calloc(1, sizeof(*reader));
+    if (!reader) {
+        return NULL;
+    }
+    reader->buffer_size = options->buffer_size ? options->buffer_size : STRIDER_READER_BUFFER_SIZE;
+    reader->num_buffers = options->buffers ? options->buffers : STRIDER_READER_BUFFERS;
+    reader->stride = (reader->buffer_size + READER_ALIGNMENT - 1) / READER_ALIGNMENT *
+                     READER_ALIGNMENT;
+    reader->memory =
+        (uint8_t *) strider_aligned_alloc(READER_ALIGNMENT, reader->stride * reader->num_buffers);
+    if (!reader->memory || open_file(reader, path) != 0) {
+        close_file(reader);
+        strider_aligned_free(reader->memory);
+        free(reader);
+        return NULL;
+    }
+
+    /* backend stays AUTO until a backend has something to stop */
+#if defined(STRIDER_HAVE_IO_URING)
+    if (options->backend != STRIDER_READER_THREAD && reader->seekable) {
+        started = uring_start(reader);
+        if (started == 0) {
+            reader->backend = STRIDER_READER_IO_URING;
+        } else {
+            const int error = errno;
+            uring_stop(reader);
+            errno = error;
+        }
+    }
+#else
+    errno = ENOTSUP;
+#endif
+    if (started != 0 && options->backend == STRIDER_READER_IO_URING && !reader->seekable) {
+        errno = ESPIPE;
+    } else if (started != 0 && options->backend != STRIDER_READER_IO_URING) {
+        reader->backend = STRIDER_READER_THREAD;
+        started = thread_start(reader);
+    }
+
+    if (started != 0) {
+        const int error = errno;
+        strider_reader_close(reader);
+        errno = error;
+        return NULL;
+    }
+    return reader;
+}
+
+int strider_reader_next(strider_reader_t *reader, strider_buffer_view_t *chunk) {
+    if (!reader || !chunk) {
+        return -1;
+    }
+#if defined(STRIDER_HAVE_IO_URING)
+    if (reader->backend == STRIDER_READER_IO_URING) {
+        return uring_next(reader, chunk);
+    }
+#endif
+    return thread_next(reader, chunk);
+}
+
+strider_reader_backend_t strider_reader_backend(const strider_reader_t *reader) {
+    return reader->backend;
+}
+
+void strider_reader_close(strider_reader_t *reader) {
+    if (!reader) {
+        return;
+    }
+    if (reader->backend == STRIDER_READER_THREAD) {
+        thread_stop(reader);
+    }
+#if defined(STRIDER_HAVE_IO_URING)
+    if (reader->backend == STRIDER_READER_IO_URING) {
+        uring_stop(reader);
+    }
+#endif
+    close_file(reader);
+    strider_aligned_free(reader->memory);
+    free(reader);
+}
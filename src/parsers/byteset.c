@@ -0,0 +1,103 @@
+/**
+ * @file byteset.c
+ * @brief Implementation of multi-byte set search
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/dispatch.h"
+#include "strider/parsers/byteset.h"
+#include <string.h>
+
+/* ========================================================================
+ * Set Construction
+ * ======================================================================== */
+
+int strider_byteset_init(strider_byteset_t *set, const char *bytes, size_t count) {
+    uint16_t low_sets[16] = {0}; /* Low nibbles present, per high nibble */
+    uint16_t buckets[16];        /* Distinct low-nibble sets */
+    size_t num_buckets = 0;
+
+    if (!set || (!bytes && count > 0)) {
+        return -1;
+    }
+    memset(set, 0, sizeof(*set));
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t byte = (uint8_t) bytes[i];
+
+        if (strider_byteset_contains(set, byte)) {
+            continue;
+        }
+        set->bitmap[byte >> 5] |= 1u << (byte & 31);
+        if (set->count < sizeof(set->members)) {
+            set->members[set->count] = byte;
+        }
+        set->count++;
+        low_sets[byte >> 4] |= (uint16_t) (1u << (byte & 0x0F));
+    }
+
+    /* High nibbles with identical low-nibble sets share a bucket */
+    for (int hi = 0; hi < 16; hi++) {
+        size_t b = 0;
+
+        if (low_sets[hi] == 0) {
+            continue;
+        }
+        while (b < num_buckets && buckets[b] != low_sets[hi]) {
+            b++;
+        }
+        if (b == num_buckets) {
+            buckets[num_buckets++] = low_sets[hi];
+        }
+        set->hi_nibble[b / 8][hi] = (uint8_t) (1u << (b % 8));
+    }
+
+    for (size_t b = 0; b < num_buckets; b++) {
+        for (int lo = 0; lo < 16; lo++) {
+            if (buckets[b] & (1u << lo)) {
+                set->lo_nibble[b / 8][lo] |= (uint8_t) (1u << (b % 8));
+            }
+        }
+    }
+    set->passes = (uint8_t) ((num_buckets + 7) / 8);
+
+    return 0;
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+size_t strider_find_byteset(strider_buffer_view_t view, const strider_byteset_t *set) {
+    for (size_t i = 0; i < view.size; i++) {
+        if (strider_byteset_contains(set, view.data[i])) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+size_t strider_skip_byteset(strider_buffer_view_t view, const strider_byteset_t *set) {
+    for (size_t i = 0; i < view.size; i++) {
+        if (!strider_byteset_contains(set, view.data[i])) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see byteset_simd.c)
+ * ======================================================================== */
+
+size_t strider_find_byteset_simd(strider_buffer_view_t view, const strider_byteset_t *set) {
+    return strider_get_kernels()->find_byteset(view, set);
+}
+
+size_t strider_skip_byteset_simd(strider_buffer_view_t view, const strider_byteset_t *set) {
+    return strider_get_kernels()->skip_byteset(view, set);
+}
@@ -0,0 +1,82 @@
+/**
+ * @file byteset_simd.c
+ * @brief SIMD multi-byte set search kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * Vectors are classified with the nibble lookup (or, on SSE2, per-member
+ * compares) in internal/byteset.h; sets too large for the SSE2 path fall
+ * back to the bitmap.
+ */
+
+#include "internal/byteset.h"
+#include "internal/dispatch.h"
+#include "internal/stats.h"
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "byteset_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * Search
+ * ======================================================================== */
+
+/**
+ * @brief Offset of the first byte whose membership differs from skip
+ *
+ * skip = false finds the first member, skip = true the first non-member.
+ */
+static size_t search(strider_buffer_view_t view, const strider_byteset_t *set, bool skip) {
+    const uint8_t *ptr = view.data;
+    const size_t size = view.size;
+    strider_byteset_matcher_t matcher;
+    size_t i = 0;
+
+    if (strider_byteset_matcher_init(&matcher, set)) {
+        const uint64_t flip = skip ? ~(uint64_t) 0 : 0;
+
+        /* 64 bytes per iteration */
+        for (; i + 64 <= size; i += 64) {
+            uint64_t mask = strider_byteset_match_block(ptr + i, &matcher) ^ flip;
+            if (mask != 0) {
+                STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, i + 64, 0);
+                return i + (size_t) strider_ctz64(mask);
+            }
+        }
+
+        /* Remaining whole vectors */
+        for (; i + STRIDER_VECN_SIZE <= size; i += STRIDER_VECN_SIZE) {
+            strider_vecn_t v = strider_vecn_load_unaligned(ptr + i);
+            uint32_t mask = strider_byteset_match_vector(v, &matcher) ^ (uint32_t) flip;
+            mask &= STRIDER_VECN_LANE_MASK;
+            if (mask != 0) {
+                STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, i + STRIDER_VECN_SIZE, 0);
+                return i + (size_t) strider_ctz32(mask);
+            }
+        }
+    }
+
+    /* Handle remaining bytes (or all of them, for large sets) with scalar */
+    const size_t vector_bytes = i;
+    for (; i < size; i++) {
+        if (strider_byteset_contains(set, ptr[i]) != skip) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, vector_bytes, i + 1 - vector_bytes);
+            return i;
+        }
+    }
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_BYTESET, vector_bytes, size - vector_bytes);
+    return STRIDER_NOT_FOUND;
+}
+
+size_t STRIDER_KERNEL(find_byteset)(strider_buffer_view_t view, const strider_byteset_t *set) {
+    return search(view, set, false);
+}
+
+size_t STRIDER_KERNEL(skip_byteset)(strider_buffer_view_t view, const strider_byteset_t *set) {
+    return search(view, set, true);
+}
@@ -0,0 +1,203 @@
+/**
+ * @file level.c
+ * @brief Implementation of log level filtering
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "strider/parsers/level.h"
+#include "strider/simd/vector.h"
+#include <string.h>
+
+/* ========================================================================
+ * Level Sets
+ * ======================================================================== */
+
+static inline bool is_letter(uint8_t c) {
+    return (uint8_t) ((c | 0x20) - 'a') <= 'z' - 'a';
+}
+
+/* Length of the name stored in a key (names never contain a zero byte) */
+static size_t key_length(uint64_t key) {
+    const uint8_t *name = (const uint8_t *) &key;
+    size_t length = 0;
+    while (length < STRIDER_LEVEL_MAX_NAME_LENGTH && name[length]) {
+        length++;
+    }
+    return length;
+}
+
+int strider_level_set_init(strider_level_set_t *set, size_t window, bool ignore_case) {
+    if (!set || window == 0 || window > STRIDER_LEVEL_MAX_WINDOW) {
+        return -1;
+    }
+
+    /* All-ones keys never equal a word, which holds letters and zeros only */
+    memset(set->keys, 0xFF, sizeof(set->keys));
+    memset(set->ids, 0, sizeof(set->ids));
+    set->lengths = 0;
+    set->count = 0;
+    set->window = (uint8_t) window;
+    set->ignore_case = ignore_case;
+    return 0;
+}
+
+int strider_level_set_init_default(strider_level_set_t *set) {
+    static const struct {
+        const char *name;
+        strider_level_t level;
+    } defaults[] = {
+        {"TRACE", STRIDER_LEVEL_TRACE},
+        {"DEBUG", STRIDER_LEVEL_DEBUG},
+        {"INFO", STRIDER_LEVEL_INFO},
+        {"WARN", STRIDER_LEVEL_WARN},
+        {"WARNING", STRIDER_LEVEL_WARN},
+        {"ERROR", STRIDER_LEVEL_ERROR},
+        {"FATAL", STRIDER_LEVEL_FATAL},
+        {"CRITICAL", STRIDER_LEVEL_FATAL},
+    };
+
+    if (strider_level_set_init(set, STRIDER_LEVEL_MAX_WINDOW, true) != 0) {
+        return -1;
+    }
+    for (size_t i = 0; i < sizeof(defaults) / sizeof(defaults[0]); i++) {
+        if (strider_level_set_add(set, defaults[i].name, defaults[i].level) != 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int strider_level_set_add(strider_level_set_t *set, const char *name, unsigned level) {
+    uint8_t bytes[8] = {0};
+    size_t length = 0;
+    uint64_t key;
+
+    if (!set || !name || level > 31 || set->count >= STRIDER_LEVEL_MAX_NAMES) {
+        return -1;
+    }
+    for (; name[length]; length++) {
+        const uint8_t c = (uint8_t) name[length];
+        if (length == STRIDER_LEVEL_MAX_NAME_LENGTH || !is_letter(c)) {
+            return -1;
+        }
+        bytes[length] = set->ignore_case ? (uint8_t) (c | 0x20) : c;
+    }
+    if (length == 0) {
+        return -1;
+    }
+
+    memcpy(&key, bytes, sizeof(key));
+    for (size_t k = 0; k < set->count; k++) {
+        if (set->keys[k] == key) {
+            return -1;
+        }
+    }
+
+    set->keys[set->count] = key;
+    set->ids[set->count] = (uint8_t) level;
+    set->lengths |= (uint16_t) (1u << length);
+    set->count++;
+    return 0;
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+/* Whether the word of the given length at p spells the name in key */
+static bool word_equals(const strider_level_set_t *set, const uint8_t *p, size_t length,
+                        uint64_t key) {
+    const uint8_t *name = (const uint8_t *) &key;
+
+    if (key_length(key) != length) {
+        return false;
+    }
+    for (size_t i = 0; i < length; i++) {
+        const uint8_t c = set->ignore_case ? (uint8_t) (p[i] | 0x20) : p[i];
+        if (c != name[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int strider_find_level(const strider_level_set_t *set, const char *line, size_t size) {
+    const uint8_t *p = (const uint8_t *) line;
+    const size_t window = size < set->window ? size : set->window;
+    size_t i = 0;
+
+    while (i < window) {
+        if (!is_letter(p[i])) {
+            i++;
+            continue;
+        }
+
+        const size_t start = i;
+        while (i < window && is_letter(p[i])) {
+            i++;
+        }
+        if (i - start > STRIDER_LEVEL_MAX_NAME_LENGTH) {
+            continue;
+        }
+        for (size_t k = 0; k < set->count; k++) {
+            if (word_equals(set, p + start, i - start, set->keys[k])) {
+                return set->ids[k];
+            }
+        }
+    }
+    return -1;
+}
+
+size_t strider_filter_levels(const char *data, size_t size, const size_t *positions,
+                             size_t count, const strider_level_set_t *set, uint32_t levels,
+                             uint64_t *bitmap) {
+    size_t start = 0;
+    size_t selected = 0;
+
+    memset(bitmap, 0, ((count + 63) / 64) * sizeof(uint64_t));
+    for (size_t i = 0; i < count; i++) {
+        const int level = strider_find_level(set, data + start, positions[i] - start);
+
+        if (level >= 0 && (levels >> level) & 1) {
+            bitmap[i / 64] |= UINT64_C(1) << (i % 64);
+            selected++;
+        }
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+
+    return selected;
+}
+
+size_t strider_selection_from_bitmap(const uint64_t *bitmap, size_t count, size_t *selection) {
+    size_t written = 0;
+
+    for (size_t w = 0; w < (count + 63) / 64; w++) {
+        uint64_t bits = bitmap[w];
+        if (w == count / 64) {
+            bits &= strider_mask64_low(count % 64);
+        }
+        while (bits) {
+            selection[written++] = w * 64 + (size_t) strider_ctz64(bits);
+            bits &= bits - 1;
+        }
+    }
+    return written;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see level_simd.c)
+ * ======================================================================== */
+
+int strider_find_level_simd(const strider_level_set_t *set, const char *line, size_t size) {
+    return strider_get_kernels()->find_level(set, line, size);
+}
+
+size_t strider_filter_levels_simd(const char *data, size_t size, const size_t *positions,
+                                  size_t count, const strider_level_set_t *set, uint32_t levels,
+                                  uint64_t *bitmap) {
+    return strider_get_kernels()->filter_levels(data, size, positions, count, set, levels, bitmap);
+}
@@ -0,0 +1,165 @@
+/**
+ * @file level_simd.c
+ * @brief SIMD log level filtering kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * Per line, the whole search window is one 64-byte block:
+ *
+ *   1. letters = ((v | 0x20) - 'a') <= 25, as a 64-bit mask
+ *   2. Word starts are letters & ~(letters << 1); the length of the word
+ *      at s is the number of trailing ones of letters >> s
+ *   3. Words with a length no name has are skipped; the others are
+ *      loaded as one uint64_t, zero padded (and case folded) and compared
+ *      with every name of the set, STRIDER_VECN_SIZE / 8 names per compare
+ */
+
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "strider/parsers/level.h"
+#include <string.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "level_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* The block load plus an 8-byte word load at its last byte */
+#define LEVEL_READ_SIZE (STRIDER_LEVEL_MAX_WINDOW + 8)
+
+/* Names per vector compare */
+#define KEYS_PER_VECTOR (STRIDER_VECN_SIZE / 8)
+
+/* Bit 0 of every 8-bit group of a name compare mask */
+#if STRIDER_VECN_SIZE == 32
+#    define KEY_LANE_BITS 0x01010101u
+#else
+#    define KEY_LANE_BITS 0x0101u
+#endif
+
+/* ========================================================================
+ * Helpers
+ * ======================================================================== */
+
+/* Bit i set if byte i of the 64 at ptr is an ASCII letter */
+static inline uint64_t letter_mask(const uint8_t *ptr) {
+    const strider_vecn_t fold = strider_vecn_set1(0x20);
+    const strider_vecn_t first = strider_vecn_set1('a');
+    const strider_vecn_t last = strider_vecn_set1('z' - 'a');
+    strider_block64_t block = strider_block64_load(ptr);
+    strider_vecn_t offsets[STRIDER_BLOCK64_VECTORS];
+
+    for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+        offsets[i] = strider_vecn_sub_u8(strider_vecn_or(block.v[i], fold), first);
+    }
+#if defined(STRIDER_HAS_AVX2)
+    return (uint64_t) strider_vecn_eq_mask(strider_vecn_min_u8(offsets[0], last), offsets[0]) |
+           ((uint64_t) strider_vecn_eq_mask(strider_vecn_min_u8(offsets[1], last), offsets[1])
+            << 32);
+#else
+    return strider_vec128_movemask64(
+        strider_vec128_cmpeq(strider_vec128_min_u8(offsets[0], last), offsets[0]),
+        strider_vec128_cmpeq(strider_vec128_min_u8(offsets[1], last), offsets[1]),
+        strider_vec128_cmpeq(strider_vec128_min_u8(offsets[2], last), offsets[2]),
+        strider_vec128_cmpeq(strider_vec128_min_u8(offsets[3], last), offsets[3]));
+#endif
+}
+
+/* Index of the name equal to word, or -1 */
+static inline int match_name(const strider_level_set_t *set, uint64_t word) {
+    const strider_vecn_t needle = strider_vecn_set1_u64(word);
+
+    /* keys has room for whole vectors; unused names never match */
+    for (size_t k = 0; k < set->count; k += KEYS_PER_VECTOR) {
+        uint32_t eq = strider_vecn_eq_mask(strider_vecn_load_unaligned(set->keys + k), needle);
+
+        /* Bit 8j survives if all 8 bytes of name k + j are equal */
+        eq &= eq >> 4;
+        eq &= eq >> 2;
+        eq &= eq >> 1;
+        eq &= KEY_LANE_BITS;
+        if (eq) {
+            return (int) (k + (size_t) strider_ctz32(eq) / 8);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @param readable Bytes readable at line (>= size); lines closer than
+ *                 LEVEL_READ_SIZE to the end of the buffer are copied
+ */
+static inline int line_level(const strider_level_set_t *set, const uint8_t *line, size_t size,
+                             size_t readable) {
+    const size_t window = size < set->window ? size : set->window;
+    const uint64_t fold = set->ignore_case ? UINT64_C(0x2020202020202020) : 0;
+    uint8_t copy[LEVEL_READ_SIZE];
+
+    if (readable < LEVEL_READ_SIZE) {
+        memset(copy, 0, sizeof(copy));
+        memcpy(copy, line, window);
+        line = copy;
+    }
+
+    const uint64_t letters = letter_mask(line) & strider_mask64_low(window);
+    uint64_t starts = letters & ~(letters << 1);
+
+    while (starts) {
+        const int s = strider_ctz64(starts);
+        const unsigned length = (unsigned) strider_ctz64(~(letters >> s));
+        uint64_t word;
+
+        starts &= starts - 1;
+        if (length > STRIDER_LEVEL_MAX_NAME_LENGTH || !((set->lengths >> length) & 1)) {
+            continue;
+        }
+
+        memcpy(&word, line + s, sizeof(word));
+        word = (word | fold) & (~UINT64_C(0) >> (64 - 8 * length));
+        const int k = match_name(set, word);
+        if (k >= 0) {
+            return set->ids[k];
+        }
+    }
+    return -1;
+}
+
+/* ========================================================================
+ * Kernels
+ * ======================================================================== */
+
+int STRIDER_KERNEL(find_level)(const strider_level_set_t *set, const char *line, size_t size) {
+    return line_level(set, (const uint8_t *) line, size, size);
+}
+
+size_t STRIDER_KERNEL(filter_levels)(const char *data, size_t size, const size_t *positions,
+                                     size_t count, const strider_level_set_t *set,
+                                     uint32_t levels, uint64_t *bitmap) {
+    const uint8_t *base = (const uint8_t *) data;
+    size_t start = 0;
+    size_t selected = 0;
+    uint64_t bits = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const int level = line_level(set, base + start, positions[i] - start, size - start);
+
+        if (level >= 0 && (levels >> level) & 1) {
+            bits |= UINT64_C(1) << (i % 64);
+            selected++;
+        }
+        if (i % 64 == 63) {
+            bitmap[i / 64] = bits;
+            bits = 0;
+        }
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+    if (count % 64) {
+        bitmap[count / 64] = bits;
+    }
+
+    return selected;
+}
@@ -0,0 +1,302 @@
+/**
+ * @file logs.c
+ * @brief Implementation of batch log record parsing
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Lines are found a window at a time with the newline kernel, then each
+ * record is parsed with the single-line kernels (timestamp, level,
+ * tokenizer) of the same backend, looked up once per call.
+ */
+
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "strider/parsers/logs.h"
+#include <string.h>
+
+/* Newline positions found per window */
+#define LINE_BATCH 1024
+
+/* Bytes scanned for newlines per window (grown for longer lines) */
+#define LINE_WINDOW (LINE_BATCH * 32)
+
+/**
+ * @brief One parsed record, before it is scattered to the columns
+ */
+typedef struct {
+    int64_t timestamp;
+    int level;
+    strider_buffer_view_t message;
+} log_record_t;
+
+/* ========================================================================
+ * Format Settings
+ * ======================================================================== */
+
+int strider_log_format_init(strider_log_format_t *format, strider_log_layout_t layout,
+                            strider_timestamp_format_t timestamp_format, int year) {
+    strider_tokenize_format_t fields;
+
+    if (!format) {
+        return -1;
+    }
+    switch (layout) {
+        case STRIDER_LOG_TEXT:
+        case STRIDER_LOG_LOGFMT:
+            fields = STRIDER_TOKENIZE_LOGFMT;
+            break;
+        case STRIDER_LOG_JSON:
+            fields = STRIDER_TOKENIZE_JSON;
+            break;
+        default:
+            return -1;
+    }
+    switch (timestamp_format) {
+        case STRIDER_TIMESTAMP_ISO8601:
+        case STRIDER_TIMESTAMP_SYSLOG:
+        case STRIDER_TIMESTAMP_EPOCH:
+            break;
+        default:
+            return -1;
+    }
+
+    format->layout = layout;
+    format->timestamp_format = timestamp_format;
+    format->year = year;
+    if (strider_level_set_init_default(&format->levels) != 0 ||
+        strider_tokenizer_init_format(&format->tokenizer, fields) != 0) {
+        return -1;
+    }
+    return 0;
+}
+
+/* ========================================================================
+ * Text Records
+ * ======================================================================== */
+
+static inline bool is_blank(uint8_t c) {
+    return c == ' ' || c == '\t';
+}
+
+static inline bool is_letter(uint8_t c) {
+    return (uint8_t) ((c | 0x20) - 'a') <= 'z' - 'a';
+}
+
+static inline size_t skip_blanks(const uint8_t *p, size_t i, size_t size) {
+    while (i < size && is_blank(p[i])) {
+        i++;
+    }
+    return i;
+}
+
+/* After a level word: closing bracket, ':', '-' or '|', and blanks */
+static size_t skip_level_suffix(const uint8_t *p, size_t i, size_t size) {
+    if (i < size && (p[i] == ']' || p[i] == ')' || p[i] == '>')) {
+        i++;
+    }
+    if (i < size && p[i] == ':') {
+        i++;
+    }
+    i = skip_blanks(p, i, size);
+    if (i < size && (p[i] == '-' || p[i] == '|') && (i + 1 == size || is_blank(p[i + 1]))) {
+        i = skip_blanks(p, i + 1, size);
+    }
+    return i;
+}
+
+static void parse_text(const strider_log_format_t *format, const strider_kernel_table_t *k,
+                       const uint8_t *p, size_t size, log_record_t *r) {
+    const bool bracket = size > 0 && p[0] == '[';
+    size_t i = bracket;
+    size_t n = k->parse_timestamp((const char *) p + i, size - i, format->timestamp_format,
+                                  format->year, &r->timestamp);
+
+    if (n > 0) {
+        i += n;
+        if (bracket && i < size && p[i] == ']') {
+            i++;
+        }
+    } else {
+        i = 0;
+    }
+    i = skip_blanks(p, i, size);
+
+    /* The word right after the stamp, if it is a level name */
+    size_t word = i;
+    if (word < size && (p[word] == '[' || p[word] == '(' || p[word] == '<')) {
+        word++;
+    }
+    size_t end = word;
+    while (end < size && end - word <= STRIDER_LEVEL_MAX_NAME_LENGTH && is_letter(p[end])) {
+        end++;
+    }
+    if (end > word && (end == size || !is_letter(p[end]))) {
+        r->level = strider_find_level(&format->levels, (const char *) p + word, end - word);
+        if (r->level >= 0) {
+            i = skip_level_suffix(p, end, size);
+            r->message = strider_buffer_view_create(p + i, size - i);
+            return;
+        }
+    }
+
+    r->level = k->find_level(&format->levels, (const char *) p + i, size - i);
+    r->message = strider_buffer_view_create(p + i, size - i);
+}
+
+/* ========================================================================
+ * Structured Records
+ * ======================================================================== */
+
+typedef enum { KEY_OTHER, KEY_TIMESTAMP, KEY_LEVEL, KEY_MESSAGE } log_key_t;
+
+static inline bool key_is(strider_buffer_view_t key, const char *name) {
+    const size_t length = strlen(name);
+    return key.size == length && memcmp(key.data, name, length) == 0;
+}
+
+static log_key_t classify_key(strider_buffer_view_t key) {
+    if (key_is(key, "ts") || key_is(key, "time") || key_is(key, "timestamp") ||
+        key_is(key, "@timestamp")) {
+        return KEY_TIMESTAMP;
+    }
+    if (key_is(key, "level") || key_is(key, "lvl") || key_is(key, "severity")) {
+        return KEY_LEVEL;
+    }
+    if (key_is(key, "msg") || key_is(key, "message")) {
+        return KEY_MESSAGE;
+    }
+    return KEY_OTHER;
+}
+
+static void parse_fields(const strider_log_format_t *format, const strider_kernel_table_t *k,
+                         const uint8_t *p, size_t size, log_record_t *r) {
+    const strider_tokenizer_t *tok = &format->tokenizer;
+    strider_buffer_view_t fields[STRIDER_LOG_MAX_FIELDS];
+    const size_t count =
+        k->tokenize(tok, strider_buffer_view_create(p, size), fields, STRIDER_LOG_MAX_FIELDS);
+
+    for (size_t f = 0; f + 1 < count; f += 2) {
+        const strider_buffer_view_t value = strider_field_unquote(tok, fields[f + 1]);
+
+        switch (classify_key(strider_field_unquote(tok, fields[f]))) {
+            case KEY_TIMESTAMP:
+                k->parse_timestamp((const char *) value.data, value.size,
+                                   format->timestamp_format, format->year, &r->timestamp);
+                break;
+            case KEY_LEVEL:
+                r->level = strider_find_level(&format->levels, (const char *) value.data,
+                                              value.size);
+                break;
+            case KEY_MESSAGE:
+                r->message = value;
+                break;
+            case KEY_OTHER:
+                break;
+        }
+    }
+}
+
+/* ========================================================================
+ * Batch Parsing
+ * ======================================================================== */
+
+static void store_record(const strider_log_format_t *format, const strider_kernel_table_t *k,
+                         const char *data, size_t start, size_t end,
+                         const strider_log_columns_t *columns, size_t index) {
+    const uint8_t *p = (const uint8_t *) data + start;
+    log_record_t r = {STRIDER_TIMESTAMP_INVALID, STRIDER_LOG_NO_LEVEL,
+                      strider_buffer_view_create(p, 0)};
+
+    if (columns->offsets) {
+        columns->offsets[index] = start;
+    }
+    if (!columns->timestamps && !columns->levels && !columns->messages) {
+        return;
+    }
+
+    if (format->layout == STRIDER_LOG_TEXT) {
+        parse_text(format, k, p, end - start, &r);
+    } else {
+        parse_fields(format, k, p, end - start, &r);
+    }
+
+    if (columns->timestamps) {
+        columns->timestamps[index] = r.timestamp;
+    }
+    if (columns->levels) {
+        columns->levels[index] = (int8_t) r.level;
+    }
+    if (columns->messages) {
+        columns->messages[index] = r.message;
+    }
+}
+
+size_t strider_parse_logs(const strider_log_format_t *format, const char *data, size_t size,
+                          const strider_log_columns_t *columns, size_t max_records,
+                          size_t *consumed) {
+    const strider_kernel_table_t *k = strider_get_kernels();
+    size_t positions[LINE_BATCH];
+    size_t records = 0;
+    size_t start = 0;
+
+    while (records < max_records && start < size) {
+        const size_t batch =
+            max_records - records < LINE_BATCH ? max_records - records : LINE_BATCH;
+        size_t window = LINE_WINDOW;
+        size_t found;
+
+        /* Grow the window until it holds a newline or reaches the end */
+        for (;;) {
+            if (window > size - start) {
+                window = size - start;
+            }
+            found = k->find_newline_positions(data + start, window, positions, batch);
+            if (found > 0 || start + window == size) {
+                break;
+            }
+            window *= 2;
+        }
+
+        if (found == 0) {
+            /* Text after the last newline */
+            store_record(format, k, data, start, size, columns, records++);
+            start = size;
+            break;
+        }
+        if (found > batch) {
+            found = batch;
+        }
+        const size_t base = start;
+        for (size_t i = 0; i < found; i++) {
+            const size_t end = base + positions[i];
+            store_record(format, k, data, start, end, columns, records++);
+            start = strider_next_line_start(data, size, end);
+        }
+    }
+
+    if (consumed) {
+        *consumed = start;
+    }
+    return records;
+}
+
+size_t strider_parse_logs_arena(const strider_log_format_t *format, const char *data, size_t size,
+                                strider_arena_t *arena, strider_log_columns_t *columns) {
+    /* Every newline ends a record, and the text after the last one is one more */
+    const size_t records = strider_get_kernels()->count_newlines(data, size) + 1;
+
+    if (!arena) {
+        arena = strider_thread_arena();
+    }
+    columns->offsets = (size_t *) strider_arena_alloc_array(arena, records, sizeof(size_t));
+    columns->timestamps = (int64_t *) strider_arena_alloc_array(arena, records, sizeof(int64_t));
+    columns->levels = (int8_t *) strider_arena_alloc_array(arena, records, sizeof(int8_t));
+    columns->messages = (strider_buffer_view_t *) strider_arena_alloc_array(
+        arena, records, sizeof(strider_buffer_view_t));
+    if (!columns->offsets || !columns->timestamps || !columns->levels || !columns->messages) {
+        return STRIDER_NOT_FOUND;
+    }
+
+    return strider_parse_logs(format, data, size, columns, records, NULL);
+}
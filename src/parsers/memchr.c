@@ -0,0 +1,100 @@
+/**
+ * @file memchr.c
+ * @brief Implementation of length-bounded byte search
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/ascii.h"
+#include "internal/dispatch.h"
+#include "strider/parsers/memchr.h"
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+size_t strider_memchr(strider_buffer_view_t view, int ch) {
+    unsigned char target = (unsigned char) ch;
+
+    for (size_t i = 0; i < view.size; i++) {
+        if (view.data[i] == target) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+size_t strider_memrchr(strider_buffer_view_t view, int ch) {
+    unsigned char target = (unsigned char) ch;
+
+    for (size_t i = view.size; i > 0; i--) {
+        if (view.data[i - 1] == target) {
+            return i - 1;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+size_t strider_memchr_nocase(strider_buffer_view_t view, int ch) {
+    const uint8_t target = strider_ascii_tolower((uint8_t) ch);
+
+    for (size_t i = 0; i < view.size; i++) {
+        if (strider_ascii_tolower(view.data[i]) == target) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+size_t strider_memchr_batch(const strider_buffer_view_t *views, size_t count, int ch,
+                            size_t *results) {
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = strider_memchr(views[i], ch);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+size_t strider_memchr_spans(const char *base, const strider_field_span_t *spans, size_t count,
+                            int ch, size_t *results) {
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        results[i] = strider_memchr(
+            strider_buffer_view_create(base + spans[i].start, spans[i].length), ch);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see memchr_simd.c)
+ * ======================================================================== */
+
+size_t strider_memchr_simd(strider_buffer_view_t view, int ch) {
+    return strider_get_kernels()->memchr(view, ch);
+}
+
+size_t strider_memrchr_simd(strider_buffer_view_t view, int ch) {
+    return strider_get_kernels()->memrchr(view, ch);
+}
+
+size_t strider_memchr_nocase_simd(strider_buffer_view_t view, int ch) {
+    return strider_get_kernels()->memchr_nocase(view, ch);
+}
+
+size_t strider_memchr_batch_simd(const strider_buffer_view_t *views, size_t count, int ch,
+                                 size_t *results) {
+    return strider_get_kernels()->memchr_batch(views, count, ch, results);
+}
+
+size_t strider_memchr_spans_simd(const char *base, const strider_field_span_t *spans,
+                                 size_t count, int ch, size_t *results) {
+    return strider_get_kernels()->memchr_spans(base, spans, count, ch, results);
+}
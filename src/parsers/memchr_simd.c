@@ -0,0 +1,172 @@
+/**
+ * @file memchr_simd.c
+ * @brief SIMD length-bounded byte search kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ * All loads are unaligned and stay inside the view.
+ */
+
+#include "internal/ascii.h"
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/stats.h"
+#include "strider/parsers/memchr.h"
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "memchr_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * Forward Search
+ * ======================================================================== */
+
+/**
+ * @brief Forward search with the broadcast needle already built
+ *
+ * With fold set, bytes are folded to ASCII lower case before they are
+ * compared, and target (and needle) must be lower case.
+ */
+static inline size_t find_forward(const uint8_t *ptr, size_t size, uint8_t target,
+                                  strider_vecn_t needle, bool fold) {
+    size_t i = 0;
+
+    /* 64 bytes per iteration */
+    for (; i + 64 <= size; i += 64) {
+        strider_block64_t block = strider_block64_load(ptr + i);
+        if (fold) {
+            block = strider_block64_ascii_tolower(block);
+        }
+        uint64_t mask = strider_block64_eq(block, needle);
+        if (mask != 0) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, i + 64, 0);
+            return i + (size_t) strider_ctz64(mask);
+        }
+    }
+
+    /* Remaining whole vectors */
+    for (; i + STRIDER_VECN_SIZE <= size; i += STRIDER_VECN_SIZE) {
+        strider_vecn_t v = strider_vecn_load_unaligned(ptr + i);
+        if (fold) {
+            v = strider_vecn_ascii_tolower(v);
+        }
+        uint32_t mask = strider_vecn_eq_mask(v, needle);
+        if (mask != 0) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, i + STRIDER_VECN_SIZE, 0);
+            return i + (size_t) strider_ctz32(mask);
+        }
+    }
+
+    /* Handle remaining bytes with scalar */
+    const size_t vector_bytes = i;
+    for (; i < size; i++) {
+        if ((fold ? strider_ascii_tolower(ptr[i]) : ptr[i]) == target) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, vector_bytes, i + 1 - vector_bytes);
+            return i;
+        }
+    }
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, vector_bytes, size - vector_bytes);
+    return STRIDER_NOT_FOUND;
+}
+
+size_t STRIDER_KERNEL(memchr)(strider_buffer_view_t view, int ch) {
+    const uint8_t target = (uint8_t) ch;
+    return find_forward(view.data, view.size, target, strider_vecn_set1(target), false);
+}
+
+size_t STRIDER_KERNEL(memchr_nocase)(strider_buffer_view_t view, int ch) {
+    const uint8_t target = strider_ascii_tolower((uint8_t) ch);
+
+    /* Only letters need folding; other bytes match only themselves */
+    const bool fold = (uint8_t) (target - 'a') <= 'z' - 'a';
+    return find_forward(view.data, view.size, target, strider_vecn_set1(target), fold);
+}
+
+/* ========================================================================
+ * Batch Search
+ * ======================================================================== */
+
+/* Inputs this far ahead are prefetched while one is searched */
+#define BATCH_PREFETCH_DISTANCE 8
+
+size_t STRIDER_KERNEL(memchr_batch)(const strider_buffer_view_t *views, size_t count, int ch,
+                                    size_t *results) {
+    const uint8_t target = (uint8_t) ch;
+    const strider_vecn_t needle = strider_vecn_set1(target);
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (i + BATCH_PREFETCH_DISTANCE < count) {
+            strider_prefetch(views[i + BATCH_PREFETCH_DISTANCE].data);
+        }
+        results[i] = find_forward(views[i].data, views[i].size, target, needle, false);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+size_t STRIDER_KERNEL(memchr_spans)(const char *base, const strider_field_span_t *spans,
+                                    size_t count, int ch, size_t *results) {
+    const uint8_t *data = (const uint8_t *) base;
+    const uint8_t target = (uint8_t) ch;
+    const strider_vecn_t needle = strider_vecn_set1(target);
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (i + BATCH_PREFETCH_DISTANCE < count) {
+            strider_prefetch(data + spans[i + BATCH_PREFETCH_DISTANCE].start);
+        }
+        results[i] = find_forward(data + spans[i].start, spans[i].length, target, needle, false);
+        found += results[i] != STRIDER_NOT_FOUND;
+    }
+    return found;
+}
+
+/* ========================================================================
+ * Reverse Search
+ * ======================================================================== */
+
+size_t STRIDER_KERNEL(memrchr)(strider_buffer_view_t view, int ch) {
+    const uint8_t *ptr = view.data;
+    const uint8_t target = (uint8_t) ch;
+    const strider_vecn_t needle = strider_vecn_set1(target);
+    size_t end = view.size; /* Bytes [0, end) remain to be searched */
+
+    /* 64 bytes per iteration, walking backward */
+    for (; end >= 64; end -= 64) {
+        uint64_t mask = strider_block64_eq(strider_block64_load(ptr + end - 64), needle);
+        if (mask != 0) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, view.size - end + 64, 0);
+            return end - 1 - (size_t) strider_clz64(mask);
+        }
+    }
+
+    /* Remaining whole vectors */
+    for (; end >= STRIDER_VECN_SIZE; end -= STRIDER_VECN_SIZE) {
+        uint32_t mask =
+            strider_vecn_eq_mask(strider_vecn_load_unaligned(ptr + end - STRIDER_VECN_SIZE), needle);
+        if (mask != 0) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, view.size - end + STRIDER_VECN_SIZE, 0);
+            /* Highest set bit of a STRIDER_VECN_SIZE-bit mask */
+            return end - 1 - (size_t) (strider_clz32(mask) - (32 - STRIDER_VECN_SIZE));
+        }
+    }
+
+    /* Handle remaining bytes with scalar */
+    const size_t vector_bytes = view.size - end;
+    while (end > 0) {
+        end--;
+        if (ptr[end] == target) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, vector_bytes,
+                                 view.size - end - vector_bytes);
+            return end;
+        }
+    }
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MEMCHR, vector_bytes, view.size - vector_bytes);
+    return STRIDER_NOT_FOUND;
+}
@@ -0,0 +1,399 @@
+/**
+ * @file multi_pattern.c
+ * @brief Implementation of multi-literal matching
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Builds both the Teddy tables and the Aho-Corasick DFA; the kernels in
+ * multi_pattern_simd.c pick the engine at search time.
+ */
+
+#include "internal/dispatch.h"
+#include "internal/multi_pattern.h"
+#include "internal/stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* ========================================================================
+ * Teddy Construction
+ * ======================================================================== */
+
+typedef struct {
+    uint32_t id;
+    uint32_t prefix; /* First teddy_width bytes, big-endian */
+} teddy_entry_t;
+
+static int compare_teddy_entries(const void *a, const void *b) {
+    const teddy_entry_t *x = (const teddy_entry_t *) a;
+    const teddy_entry_t *y = (const teddy_entry_t *) b;
+
+    if (x->prefix != y->prefix) {
+        return x->prefix < y->prefix ? -1 : 1;
+    }
+    return x->id < y->id ? -1 : (x->id > y->id);
+}
+
+static int compare_ids(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *) a;
+    uint32_t y = *(const uint32_t *) b;
+    return x < y ? -1 : (x > y);
+}
+
+/**
+ * @brief Assign patterns to buckets and fill the nibble tables
+ *
+ * Patterns are sorted by prefix and split into contiguous runs, so
+ * patterns sharing leading bytes share a bucket and the tables stay
+ * selective.
+ */
+static int build_teddy(strider_multi_pattern_t *mp, size_t min_length) {
+    teddy_entry_t entries[STRIDER_TEDDY_MAX_PATTERNS];
+    const size_t count = mp->count;
+
+    mp->teddy_width = min_length < STRIDER_TEDDY_MAX_WIDTH ? min_length : STRIDER_TEDDY_MAX_WIDTH;
+    mp->bucket_ids = (uint32_t *) malloc(count * sizeof(uint32_t));
+    if (!mp->bucket_ids) {
+        return -1;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t *p = strider_mp_pattern(mp, (uint32_t) i);
+        uint32_t prefix = 0;
+
+        for (size_t j = 0; j < mp->teddy_width; j++) {
+            prefix = (prefix << 8) | p[j];
+        }
+        entries[i].id = (uint32_t) i;
+        entries[i].prefix = prefix;
+    }
+    qsort(entries, count, sizeof(entries[0]), compare_teddy_entries);
+
+    for (size_t b = 0, k = 0; b < STRIDER_TEDDY_BUCKETS; b++) {
+        size_t end = (b + 1) * count / STRIDER_TEDDY_BUCKETS;
+
+        mp->bucket_start[b] = (uint32_t) k;
+        for (; k < end; k++) {
+            const uint8_t *p = strider_mp_pattern(mp, entries[k].id);
+
+            mp->bucket_ids[k] = entries[k].id;
+            for (size_t j = 0; j < mp->teddy_width; j++) {
+                mp->teddy_lo[j][p[j] & 0x0F] |= (uint8_t) (1u << b);
+                mp->teddy_hi[j][p[j] >> 4] |= (uint8_t) (1u << b);
+            }
+        }
+        /* Sorted ids within a bucket keep verification in pattern order */
+        qsort(mp->bucket_ids + mp->bucket_start[b], k - mp->bucket_start[b], sizeof(uint32_t),
+              compare_ids);
+    }
+    mp->bucket_start[STRIDER_TEDDY_BUCKETS] = (uint32_t) count;
+    mp->use_teddy = true;
+
+    return 0;
+}
+
+/* ========================================================================
+ * Aho-Corasick Construction
+ * ======================================================================== */
+
+/**
+ * @brief Build the byte-class compressed DFA
+ *
+ * Bytes that occur in no pattern share class 0, so the transition table
+ * is num_states x num_classes instead of num_states x 256. States are
+ * renumbered in breadth-first order so the shallow states most scans
+ * spend their time in are packed at the front of the table.
+ */
+static int build_dfa(strider_multi_pattern_t *mp, size_t total_length) {
+    const size_t max_states = total_length + 1;
+    size_t classes = 1;
+    size_t states = 1;
+    uint32_t *trie = NULL;     /* Goto function, then full DFA (original numbering) */
+    uint32_t *fail = NULL;     /* Failure link per state */
+    uint32_t *order = NULL;    /* States in breadth-first order */
+    uint32_t *rank = NULL;     /* Original state -> breadth-first number */
+    uint32_t *terminal = NULL; /* Pattern ids ending at each state, chained ... */
+    uint32_t *next_id = NULL;  /* ... through next_id (UINT32_MAX terminated) */
+    uint32_t *out_count = NULL;
+    int result = -1;
+
+    for (size_t i = 0; i < mp->count; i++) {
+        const uint8_t *p = strider_mp_pattern(mp, (uint32_t) i);
+        for (size_t j = 0; j < mp->lengths[i]; j++) {
+            if (mp->byte_class[p[j]] == 0) {
+                mp->byte_class[p[j]] = (uint16_t) classes++;
+            }
+        }
+    }
+    mp->num_classes = classes;
+
+    /* Premultiplied state numbers must leave room for the output flag */
+    if (max_states > (STRIDER_DFA_OUTPUT_FLAG - 1) / classes) {
+        return -1;
+    }
+
+    trie = (uint32_t *) calloc(max_states * classes, sizeof(uint32_t));
+    fail = (uint32_t *) calloc(max_states, sizeof(uint32_t));
+    order = (uint32_t *) malloc(max_states * sizeof(uint32_t));
+    rank = (uint32_t *) malloc(max_states * sizeof(uint32_t));
+    terminal = (uint32_t *) malloc(max_states * sizeof(uint32_t));
+    next_id = (uint32_t *) malloc(mp->count * sizeof(uint32_t));
+    out_count = (uint32_t *) calloc(max_states, sizeof(uint32_t));
+    if (!trie || !fail || !order || !rank || !terminal || !next_id || !out_count) {
+        goto cleanup;
+    }
+    memset(terminal, 0xFF, max_states * sizeof(uint32_t));
+
+    /* Trie of all patterns; child 0 means "no edge" (root is never a child) */
+    for (size_t i = mp->count; i > 0; i--) {
+        const uint32_t id = (uint32_t) (i - 1);
+        const uint8_t *p = strider_mp_pattern(mp, id);
+        uint32_t state = 0;
+
+        for (size_t j = 0; j < mp->lengths[id]; j++) {
+            uint32_t *edge = &trie[state * classes + mp->byte_class[p[j]]];
+            if (*edge == 0) {
+                *edge = (uint32_t) states++;
+            }
+            state = *edge;
+        }
+        /* Prepending in descending id order leaves each chain ascending */
+        next_id[id] = terminal[state];
+        terminal[state] = id;
+    }
+
+    /* Breadth-first: failure links, missing edges and output counts */
+    size_t head = 0, tail = 0;
+    order[tail++] = 0;
+    while (head < tail) {
+        const uint32_t s = order[head++];
+
+        for (uint32_t id = terminal[s]; id != UINT32_MAX; id = next_id[id]) {
+            out_count[s]++;
+        }
+        if (s != 0) {
+            out_count[s] += out_count[fail[s]];
+        }
+
+        for (size_t c = 0; c < classes; c++) {
+            uint32_t *edge = &trie[s * classes + c];
+
+            if (*edge != 0) {
+                fail[*edge] = (s == 0) ? 0 : trie[fail[s] * classes + c];
+                order[tail++] = *edge;
+            } else if (s != 0) {
+                *edge = trie[fail[s] * classes + c];
+            }
+        }
+    }
+    for (size_t r = 0; r < states; r++) {
+        rank[order[r]] = (uint32_t) r;
+    }
+
+    /* Outputs in breadth-first order: own ids merged with the failure state's */
+    mp->num_states = states;
+    mp->output_start = (uint32_t *) malloc((states + 1) * sizeof(uint32_t));
+    mp->transitions = (uint32_t *) malloc(states * classes * sizeof(uint32_t));
+    if (!mp->output_start || !mp->transitions) {
+        goto cleanup;
+    }
+
+    mp->output_start[0] = 0;
+    for (size_t r = 0; r < states; r++) {
+        mp->output_start[r + 1] = mp->output_start[r] + out_count[order[r]];
+    }
+    mp->output_ids = (uint32_t *) malloc((mp->output_start[states] + 1) * sizeof(uint32_t));
+    if (!mp->output_ids) {
+        goto cleanup;
+    }
+
+    for (size_t r = 0; r < states; r++) {
+        const uint32_t s = order[r];
+        uint32_t *out = mp->output_ids + mp->output_start[r];
+        uint32_t id = terminal[s];
+        const uint32_t *inherited = NULL, *inherited_end = NULL;
+
+        if (s != 0) {
+            inherited = mp->output_ids + mp->output_start[rank[fail[s]]];
+            inherited_end = mp->output_ids + mp->output_start[rank[fail[s]] + 1];
+        }
+        while (id != UINT32_MAX || inherited != inherited_end) {
+            if (inherited == inherited_end || (id != UINT32_MAX && id < *inherited)) {
+                *out++ = id;
+                id = next_id[id];
+            } else {
+                *out++ = *inherited++;
+            }
+        }
+
+        for (size_t c = 0; c < classes; c++) {
+            const uint32_t target = rank[trie[s * classes + c]];
+            uint32_t value = target * (uint32_t) classes;
+
+            if (out_count[trie[s * classes + c]] > 0) {
+                value |= STRIDER_DFA_OUTPUT_FLAG;
+            }
+            mp->transitions[r * classes + c] = value;
+        }
+    }
+    result = 0;
+
+cleanup:
+    free(trie);
+    free(fail);
+    free(order);
+    free(rank);
+    free(terminal);
+    free(next_id);
+    free(out_count);
+    return result;
+}
+
+/* ========================================================================
+ * Construction / Destruction
+ * ======================================================================== */
+
+strider_multi_pattern_t *strider_multi_pattern_create(const strider_buffer_view_t *patterns,
+                                                      size_t count) {
+    strider_multi_pattern_t *mp;
+    size_t total_length = 0;
+    size_t min_length = SIZE_MAX;
+
+    if (!patterns || count == 0 || count >= UINT32_MAX) {
+        return NULL;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (!patterns[i].data || patterns[i].size == 0 ||
+            patterns[i].size > SIZE_MAX - total_length) {
+            return NULL;
+        }
+        total_length += patterns[i].size;
+        min_length = patterns[i].size < min_length ? patterns[i].size : min_length;
+    }
+
+    mp = (strider_multi_pattern_t *) calloc(1, sizeof(*mp));
+    if (!mp) {
+        return NULL;
+    }
+    mp->count = count;
+    mp->storage = (uint8_t *) malloc(total_length);
+    mp->offsets = (size_t *) malloc(count * sizeof(size_t));
+    mp->lengths = (size_t *) malloc(count * sizeof(size_t));
+    if (!mp->storage || !mp->offsets || !mp->lengths) {
+        strider_multi_pattern_destroy(mp);
+        return NULL;
+    }
+
+    for (size_t i = 0, offset = 0; i < count; i++) {
+        memcpy(mp->storage + offset, patterns[i].data, patterns[i].size);
+        mp->offsets[i] = offset;
+        mp->lengths[i] = patterns[i].size;
+        mp->max_length = patterns[i].size > mp->max_length ? patterns[i].size : mp->max_length;
+        offset += patterns[i].size;
+    }
+
+    if ((count <= STRIDER_TEDDY_MAX_PATTERNS && build_teddy(mp, min_length) != 0) ||
+        build_dfa(mp, total_length) != 0) {
+        strider_multi_pattern_destroy(mp);
+        return NULL;
+    }
+
+    return mp;
+}
+
+void strider_multi_pattern_destroy(strider_multi_pattern_t *mp) {
+    if (!mp) {
+        return;
+    }
+    free(mp->storage);
+    free(mp->offsets);
+    free(mp->lengths);
+    free(mp->bucket_ids);
+    free(mp->transitions);
+    free(mp->output_start);
+    free(mp->output_ids);
+    free(mp);
+}
+
+size_t strider_multi_pattern_count(const strider_multi_pattern_t *mp) {
+    return mp ? mp->count : 0;
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+size_t strider_multi_pattern_find(const strider_multi_pattern_t *mp,
+                                  strider_buffer_view_t haystack, strider_match_t *matches,
+                                  size_t max_matches) {
+    size_t count = 0;
+
+    for (size_t i = 0; i < haystack.size && count < max_matches; i++) {
+        for (uint32_t id = 0; id < mp->count && count < max_matches; id++) {
+            size_t length = mp->lengths[id];
+
+            if (length <= haystack.size - i &&
+                memcmp(haystack.data + i, strider_mp_pattern(mp, id), length) == 0) {
+                matches[count].pattern_id = id;
+                matches[count].offset = i;
+                count++;
+            }
+        }
+    }
+
+    return count;
+}
+
+/* ========================================================================
+ * Aho-Corasick Scan
+ * ======================================================================== */
+
+size_t strider_multi_pattern_find_dfa(const strider_multi_pattern_t *mp,
+                                      strider_buffer_view_t haystack, strider_match_t *matches,
+                                      size_t max_matches) {
+    const uint32_t *transitions = mp->transitions;
+    const uint16_t *byte_class = mp->byte_class;
+    const uint8_t *ptr = haystack.data;
+    uint32_t state = 0; /* Premultiplied by num_classes */
+    size_t count = 0;
+
+    if (max_matches == 0) {
+        STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, 0, 0);
+        return 0;
+    }
+
+    for (size_t i = 0; i < haystack.size; i++) {
+        uint32_t next = transitions[state + byte_class[ptr[i]]];
+
+        state = next & ~STRIDER_DFA_OUTPUT_FLAG;
+        if (next & STRIDER_DFA_OUTPUT_FLAG) {
+            size_t s = state / mp->num_classes;
+
+            for (uint32_t k = mp->output_start[s]; k < mp->output_start[s + 1]; k++) {
+                uint32_t id = mp->output_ids[k];
+                strider_match_list_add(matches, &count, max_matches, i + 1 - mp->lengths[id], id);
+            }
+        }
+
+        /* Matches still to come start at >= i + 2 - max_length */
+        if (count == max_matches && i + 2 > mp->max_length &&
+            i + 2 - mp->max_length > matches[count - 1].offset) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, 0, i + 1);
+            return count;
+        }
+    }
+
+    /* Counts for the scalar backend and for the SIMD kernels' fallback */
+    STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, 0, haystack.size);
+    return count;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see multi_pattern_simd.c)
+ * ======================================================================== */
+
+size_t strider_multi_pattern_find_simd(const strider_multi_pattern_t *mp,
+                                       strider_buffer_view_t haystack, strider_match_t *matches,
+                                       size_t max_matches) {
+    return strider_get_kernels()->multi_pattern_find(mp, haystack, matches, max_matches);
+}
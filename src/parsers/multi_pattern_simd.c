@@ -0,0 +1,147 @@
+/**
+ * @file multi_pattern_simd.c
+ * @brief Teddy multi-literal prefilter kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * For every offset i, byte j of the pattern prefix is looked up in the
+ * low/high nibble tables of position j; AND-ing the results over the
+ * prefix leaves one bit per bucket that may match at i. Candidate
+ * buckets are verified pattern by pattern with memcmp. Without a native
+ * byte shuffle (SSE2) or for sets above STRIDER_TEDDY_MAX_PATTERNS the
+ * kernel scans with the Aho-Corasick DFA instead.
+ */
+
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/multi_pattern.h"
+#include "internal/stats.h"
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "multi_pattern_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+
+/* Bits of a strider_vecn_eq_mask() result that correspond to lanes */
+#    define VECN_LANE_MASK ((uint32_t) ((1ULL << STRIDER_VECN_SIZE) - 1))
+
+/**
+ * @brief Verify the patterns of every bucket flagged at one offset
+ */
+static inline void verify_buckets(const strider_multi_pattern_t *mp,
+                                  strider_buffer_view_t haystack, size_t offset, uint32_t buckets,
+                                  strider_match_t *matches, size_t *count, size_t max_matches) {
+    const size_t remaining = haystack.size - offset;
+
+    while (buckets != 0) {
+        const int b = strider_ctz32(buckets);
+
+        for (uint32_t k = mp->bucket_start[b]; k < mp->bucket_start[b + 1]; k++) {
+            const uint32_t id = mp->bucket_ids[k];
+            const size_t length = mp->lengths[id];
+
+            if (length <= remaining &&
+                memcmp(haystack.data + offset, strider_mp_pattern(mp, id), length) == 0) {
+                strider_match_list_add(matches, count, max_matches, offset, id);
+            }
+        }
+        buckets &= buckets - 1;
+    }
+}
+
+/* Candidate buckets at one offset (scalar form of the vector lookup) */
+static inline uint32_t teddy_scalar(const strider_multi_pattern_t *mp, const uint8_t *ptr) {
+    uint32_t buckets = 0xFF;
+
+    for (size_t j = 0; j < mp->teddy_width; j++) {
+        buckets &= mp->teddy_lo[j][ptr[j] & 0x0F] & mp->teddy_hi[j][ptr[j] >> 4];
+    }
+    return buckets;
+}
+
+static size_t teddy_find(const strider_multi_pattern_t *mp, strider_buffer_view_t haystack,
+                         strider_match_t *matches, size_t max_matches) {
+    const uint8_t *ptr = haystack.data;
+    const size_t size = haystack.size;
+    const size_t width = mp->teddy_width;
+    const strider_vecn_t low_nibble = strider_vecn_set1(0x0F);
+    strider_vecn_t lo[STRIDER_TEDDY_MAX_WIDTH];
+    strider_vecn_t hi[STRIDER_TEDDY_MAX_WIDTH];
+    uint8_t buckets[STRIDER_VECN_SIZE];
+    size_t count = 0;
+    size_t i = 0;
+
+    if (max_matches == 0 || size < width) {
+        STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, 0, 0);
+        return 0;
+    }
+    for (size_t j = 0; j < width; j++) {
+        lo[j] = strider_vecn_load_table16(mp->teddy_lo[j]);
+        hi[j] = strider_vecn_load_table16(mp->teddy_hi[j]);
+    }
+
+    /* One vector of candidate offsets per iteration; prefix loads stay in bounds */
+    for (; i + width - 1 + STRIDER_VECN_SIZE <= size; i += STRIDER_VECN_SIZE) {
+        strider_vecn_t candidates = strider_vecn_set1(0xFF);
+
+        for (size_t j = 0; j < width; j++) {
+            strider_vecn_t v = strider_vecn_load_unaligned(ptr + i + j);
+            strider_vecn_t r = strider_vecn_and(
+                strider_vecn_lookup16(lo[j], strider_vecn_and(v, low_nibble)),
+                strider_vecn_lookup16(hi[j], strider_vecn_high_nibble(v)));
+            candidates = strider_vecn_and(candidates, r);
+        }
+
+        uint32_t mask = ~strider_vecn_eq_mask(candidates, strider_vecn_zero()) & VECN_LANE_MASK;
+        if (mask == 0) {
+            continue;
+        }
+
+        strider_vecn_store_unaligned(buckets, candidates);
+        while (mask != 0) {
+            const int pos = strider_ctz32(mask);
+
+            /* Output full and every later match sorts after the last one kept */
+            if (count == max_matches && i + (size_t) pos > matches[count - 1].offset) {
+                STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, i + width - 1 + STRIDER_VECN_SIZE,
+                                     0);
+                return count;
+            }
+            verify_buckets(mp, haystack, i + (size_t) pos, buckets[pos], matches, &count,
+                           max_matches);
+            mask &= mask - 1;
+        }
+    }
+
+    /* Handle remaining offsets with scalar */
+    const size_t vector_bytes = i > 0 ? i + width - 1 : 0; /* Covered by the vector loads */
+    for (; i + width <= size; i++) {
+        if (count == max_matches && i > matches[count - 1].offset) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, vector_bytes,
+                                 i + width - 1 - vector_bytes);
+            return count;
+        }
+        verify_buckets(mp, haystack, i, teddy_scalar(mp, ptr + i), matches, &count, max_matches);
+    }
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_MULTI_PATTERN, vector_bytes, size - vector_bytes);
+    return count;
+}
+
+#endif /* STRIDER_VECN_HAS_SHUFFLE */
+
+size_t STRIDER_KERNEL(multi_pattern_find)(const strider_multi_pattern_t *mp,
+                                          strider_buffer_view_t haystack,
+                                          strider_match_t *matches, size_t max_matches) {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    if (mp->use_teddy) {
+        return teddy_find(mp, haystack, matches, max_matches);
+    }
+#endif
+    return strider_multi_pattern_find_dfa(mp, haystack, matches, max_matches);
+}
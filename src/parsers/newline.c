@@ -6,8 +6,9 @@
  * Copyright 2025 Strider Development Team
  */
 
+#include "internal/dispatch.h"
+#include "internal/varint.h"
 #include "strider/parsers/newline.h"
-#include "strider/simd/vector.h"
 #include <stdint.h>
 
 /* ========================================================================
@@ -60,132 +61,189 @@ size_t strider_find_newline_positions(const char *data, size_t size, size_t *pos
     return count;
 }
 
-/* ========================================================================
- * SIMD Implementation
- * ======================================================================== */
+/* Offsets of a buffer scanned at base must fit in 32 bits */
+static bool positions32_fit(size_t size, uint32_t base) {
+    return (uint64_t) base + size <= ((uint64_t) 1 << 32);
+}
 
-size_t strider_count_newlines_simd(const char *data, size_t size) {
+size_t strider_find_newline_positions32(const char *data, size_t size, uint32_t base,
+                                        uint32_t *positions, size_t max_positions) {
     const uint8_t *ptr = (const uint8_t *) data;
     size_t count = 0;
 
-#if defined(STRIDER_HAS_AVX2)
-    const size_t VECTOR_SIZE = 32;
-#else
-    const size_t VECTOR_SIZE = 16;
-#endif
-
-    /* Handle unaligned prefix with scalar */
-    uintptr_t addr = (uintptr_t) ptr;
-    size_t prefix_len = (VECTOR_SIZE - (addr & (VECTOR_SIZE - 1))) & (VECTOR_SIZE - 1);
+    if (!positions32_fit(size, base)) {
+        return STRIDER_NOT_FOUND;
+    }
 
-    if (prefix_len > 0 && prefix_len < size) {
-        count += strider_count_newlines((const char *) ptr, prefix_len);
+    for (size_t i = 0; i < size; i++) {
+        if (ptr[i] == '\n' || ptr[i] == '\r') {
+            if (count < max_positions) {
+                positions[count] = base + (uint32_t) i;
+            }
+            count++;
 
-        /* Check if we split a \r\n pair across the boundary */
-        if (ptr[prefix_len - 1] == '\r' && ptr[prefix_len] == '\n') {
-            count--;
+            if (ptr[i] == '\r' && i + 1 < size && ptr[i + 1] == '\n') {
+                i++; /* \r\n is reported at the \r */
+            }
         }
-
-        ptr += prefix_len;
-        size -= prefix_len;
     }
 
-    /* Process aligned chunks with SIMD */
-#if defined(STRIDER_HAS_AVX2)
-    strider_vec256_t lf_vec = strider_vec256_set1('\n');
-    strider_vec256_t cr_vec = strider_vec256_set1('\r');
-
-    while (size >= 32) {
-        strider_vec256_t data_vec = strider_vec256_load_aligned(ptr);
-
-        /* Find all \n characters */
-        strider_vec256_t lf_cmp = strider_vec256_cmpeq(data_vec, lf_vec);
-        uint32_t lf_mask = strider_vec256_movemask(lf_cmp);
-
-        /* Find all \r characters */
-        strider_vec256_t cr_cmp = strider_vec256_cmpeq(data_vec, cr_vec);
-        uint32_t cr_mask = strider_vec256_movemask(cr_cmp);
-
-        /* Count \n occurrences */
-        count += strider_popcount32(lf_mask);
-
-        /* For \r, need to check if followed by \n */
-        if (cr_mask != 0) {
-            /* Simple approach: check each \r */
-            for (int i = 0; i < 32; i++) {
-                if (cr_mask & (1U << i)) {
-                    /* Check if this \r is followed by \n */
-                    if (i + 1 < 32) {
-                        /* Next char is in same vector */
-                        if (lf_mask & (1U << (i + 1))) {
-                            /* \r\n pair - already counted the \n, skip this \r */
-                            continue;
-                        }
-                    } else {
-                        /* \r is at end of vector, check next byte */
-                        if (size > 32) {
-                            if (ptr[32] == '\n') {
-                                continue; /* Will be counted when we process next vector */
-                            }
-                        }
-                    }
-                    count++;
-                }
+    return count;
+}
+
+size_t strider_pack_newline_positions(const char *data, size_t size, uint8_t *out,
+                                      size_t capacity, size_t *out_size, size_t *consumed) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    size_t count = 0;
+    size_t written = 0;
+    size_t next = 0; /* Previous newline position + 1 */
+    size_t covered = size;
+
+    for (size_t i = 0; i < size; i++) {
+        if (ptr[i] == '\n' || ptr[i] == '\r') {
+            const uint64_t gap = i - next;
+
+            if (strider_varint_length(gap) > capacity - written) {
+                covered = i;
+                break;
+            }
+            written += strider_varint_encode(out + written, gap);
+            next = i + 1;
+            count++;
+
+            if (ptr[i] == '\r' && i + 1 < size && ptr[i + 1] == '\n') {
+                i++;
             }
         }
+    }
 
-        ptr += 32;
-        size -= 32;
+    if (out_size) {
+        *out_size = written;
     }
-#else
-    /* SSE2/NEON path */
-    strider_vec128_t lf_vec = strider_vec128_set1('\n');
-    strider_vec128_t cr_vec = strider_vec128_set1('\r');
-
-    while (size >= 16) {
-        strider_vec128_t data_vec = strider_vec128_load_aligned(ptr);
-
-        /* Find all \n characters */
-        strider_vec128_t lf_cmp = strider_vec128_cmpeq(data_vec, lf_vec);
-        uint32_t lf_mask = strider_vec128_movemask(lf_cmp);
-
-        /* Find all \r characters */
-        strider_vec128_t cr_cmp = strider_vec128_cmpeq(data_vec, cr_vec);
-        uint32_t cr_mask = strider_vec128_movemask(cr_cmp);
-
-        /* Count \n occurrences */
-        count += strider_popcount32(lf_mask);
-
-        /* For \r, need to check if followed by \n */
-        if (cr_mask != 0) {
-            for (int i = 0; i < 16; i++) {
-                if (cr_mask & (1U << i)) {
-                    /* Check if this \r is followed by \n */
-                    if (i + 1 < 16) {
-                        if (lf_mask & (1U << (i + 1))) {
-                            continue; /* \r\n pair */
-                        }
-                    } else {
-                        if (size > 16) {
-                            if (ptr[16] == '\n') {
-                                continue;
-                            }
-                        }
-                    }
-                    count++;
-                }
-            }
+    if (consumed) {
+        *consumed = covered;
+    }
+    return count;
+}
+
+size_t strider_unpack_newline_positions(const uint8_t *packed, size_t packed_size, size_t base,
+                                        size_t *positions, size_t max_positions) {
+    const uint8_t *p = packed;
+    const uint8_t *end = packed + packed_size;
+    size_t next = base;
+    size_t count = 0;
+
+    while (count < max_positions && p < end) {
+        uint64_t gap;
+        if (!(p = strider_varint_decode(p, end, &gap))) {
+            break;
         }
+        positions[count++] = next + (size_t) gap;
+        next += (size_t) gap + 1;
+    }
+
+    return count;
+}
 
-        ptr += 16;
-        size -= 16;
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see newline_simd.c)
+ * ======================================================================== */
+
+size_t strider_count_newlines_simd(const char *data, size_t size) {
+    return strider_get_kernels()->count_newlines(data, size);
+}
+
+size_t strider_find_newline_positions_simd(const char *data, size_t size, size_t *positions,
+                                           size_t max_positions) {
+    return strider_get_kernels()->find_newline_positions(data, size, positions, max_positions);
+}
+
+size_t *strider_find_newline_positions_arena(const char *data, size_t size,
+                                             strider_arena_t *arena, size_t *count) {
+    const strider_kernel_table_t *k = strider_get_kernels();
+    size_t *positions;
+
+    if (!arena) {
+        arena = strider_thread_arena();
     }
-#endif
+    *count = k->count_newlines(data, size);
+    positions = (size_t *) strider_arena_alloc_array(arena, *count, sizeof(size_t));
+    if (positions && *count > 0) {
+        k->find_newline_positions(data, size, positions, *count);
+    }
+    return positions;
+}
+
+size_t strider_find_newline_positions32_simd(const char *data, size_t size, uint32_t base,
+                                             uint32_t *positions, size_t max_positions) {
+    if (!positions32_fit(size, base)) {
+        return STRIDER_NOT_FOUND;
+    }
+    return strider_get_kernels()->find_newline_positions32(data, size, base, positions,
+                                                           max_positions);
+}
+
+size_t strider_pack_newline_positions_simd(const char *data, size_t size, uint8_t *out,
+                                           size_t capacity, size_t *out_size, size_t *consumed) {
+    return strider_get_kernels()->pack_newline_positions(data, size, out, capacity, out_size,
+                                                         consumed);
+}
+
+/* ========================================================================
+ * Streaming Interface
+ * ======================================================================== */
+
+void strider_newline_stream_init(strider_newline_stream_t *stream) {
+    stream->offset = 0;
+    stream->newlines = 0;
+    stream->pending_cr = false;
+}
+
+/**
+ * @brief Consume the half of a \r\n pair left over from the previous chunk
+ *
+ * @return Number of leading bytes to skip (0 or 1)
+ */
+static size_t stream_begin_chunk(strider_newline_stream_t *stream, const char *data, size_t size) {
+    size_t skip = (stream->pending_cr && size > 0 && data[0] == '\n') ? 1 : 0;
 
-    /* Handle remaining bytes with scalar */
     if (size > 0) {
-        count += strider_count_newlines((const char *) ptr, size);
+        stream->pending_cr = data[size - 1] == '\r';
     }
+    return skip;
+}
+
+size_t strider_newline_stream_feed(strider_newline_stream_t *stream, const char *data,
+                                   size_t size) {
+    const size_t skip = stream_begin_chunk(stream, data, size);
+    const size_t count = strider_count_newlines_simd(data + skip, size - skip);
 
+    stream->offset += size;
+    stream->newlines += count;
     return count;
 }
+
+size_t strider_newline_stream_feed_positions(strider_newline_stream_t *stream, const char *data,
+                                             size_t size, size_t *positions,
+                                             size_t max_positions) {
+    const size_t skip = stream_begin_chunk(stream, data, size);
+    const size_t base = stream->offset + skip;
+    const size_t count =
+        strider_find_newline_positions_simd(data + skip, size - skip, positions, max_positions);
+    const size_t stored = count < max_positions ? count : max_positions;
+
+    for (size_t i = 0; i < stored; i++) {
+        positions[i] += base;
+    }
+
+    stream->offset += size;
+    stream->newlines += count;
+    return count;
+}
+
+size_t strider_newline_stream_finish(strider_newline_stream_t *stream) {
+    const size_t total = stream->newlines;
+
+    strider_newline_stream_init(stream);
+    return total;
+}
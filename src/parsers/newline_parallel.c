@@ -0,0 +1,137 @@
+/**
+ * @file newline_parallel.c
+ * @brief Multi-threaded newline counting and position finding
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Segments are independent: the only cross-segment dependency, a \r\n
+ * pair split by a seam, is resolved by each segment looking at the byte
+ * before its start. The per-byte work is done by the dispatched SIMD
+ * kernels. Per-segment scratch comes from the caller's thread arena, so
+ * repeated calls do not allocate.
+ */
+
+#include "strider/parsers/newline.h"
+#include "strider/utils/arena.h"
+
+typedef struct {
+    const char *data;
+    size_t size;
+    size_t num_segments;
+    size_t *counts;  /* Newlines per segment */
+    size_t *offsets; /* Output index of each segment's first position */
+    size_t *positions;
+    size_t max_positions;
+} parallel_job_t;
+
+/**
+ * @brief Byte range of a segment, minus a leading \n completing a \r\n pair
+ */
+static void segment_range(const parallel_job_t *job, size_t index, size_t *begin, size_t *end) {
+    size_t start = index * STRIDER_PARALLEL_SEGMENT_SIZE;
+    size_t stop = start + STRIDER_PARALLEL_SEGMENT_SIZE;
+
+    if (stop > job->size) {
+        stop = job->size;
+    }
+    if (start > 0 && start < stop && job->data[start] == '\n' && job->data[start - 1] == '\r') {
+        start++;
+    }
+    *begin = start;
+    *end = stop;
+}
+
+static void count_task(void *arg, size_t index) {
+    parallel_job_t *job = (parallel_job_t *) arg;
+    size_t begin, end;
+
+    segment_range(job, index, &begin, &end);
+    job->counts[index] = strider_count_newlines_simd(job->data + begin, end - begin);
+}
+
+static void positions_task(void *arg, size_t index) {
+    parallel_job_t *job = (parallel_job_t *) arg;
+    const size_t offset = job->offsets[index];
+    size_t begin, end;
+
+    if (offset >= job->max_positions || job->counts[index] == 0) {
+        return;
+    }
+    segment_range(job, index, &begin, &end);
+
+    /* The kernel may scribble past its count up to its capacity, so cap
+     * the capacity at this segment's slice */
+    size_t *out = job->positions + offset;
+    size_t room = job->max_positions - offset;
+    size_t stored = job->counts[index] < room ? job->counts[index] : room;
+
+    strider_find_newline_positions_simd(job->data + begin, end - begin, out, stored);
+    for (size_t i = 0; i < stored; i++) {
+        out[i] += begin;
+    }
+}
+
+static size_t num_segments(size_t size) {
+    return (size + STRIDER_PARALLEL_SEGMENT_SIZE - 1) / STRIDER_PARALLEL_SEGMENT_SIZE;
+}
+
+size_t strider_count_newlines_parallel(const char *data, size_t size,
+                                       const strider_executor_t *executor) {
+    parallel_job_t job = {data, size, num_segments(size), NULL, NULL, NULL, 0};
+    strider_arena_t *arena = strider_thread_arena();
+    size_t total = 0;
+
+    if (!executor || job.num_segments <= 1 || !arena) {
+        return strider_count_newlines_simd(data, size);
+    }
+
+    const strider_arena_mark_t mark = strider_arena_mark(arena);
+    job.counts = (size_t *) strider_arena_alloc_array(arena, job.num_segments, sizeof(size_t));
+    if (!job.counts) {
+        return strider_count_newlines_simd(data, size);
+    }
+
+    executor->run(executor->context, count_task, &job, job.num_segments);
+    for (size_t i = 0; i < job.num_segments; i++) {
+        total += job.counts[i];
+    }
+
+    strider_arena_rewind(arena, mark);
+    return total;
+}
+
+size_t strider_find_newline_positions_parallel(const char *data, size_t size, size_t *positions,
+                                               size_t max_positions,
+                                               const strider_executor_t *executor) {
+    parallel_job_t job = {data, size, num_segments(size), NULL, NULL, positions, max_positions};
+    strider_arena_t *arena = strider_thread_arena();
+    size_t total = 0;
+
+    if (!executor || job.num_segments <= 1 || !arena) {
+        return strider_find_newline_positions_simd(data, size, positions, max_positions);
+    }
+
+    const strider_arena_mark_t mark = strider_arena_mark(arena);
+    job.counts = (size_t *) strider_arena_alloc_array(arena, job.num_segments, sizeof(size_t));
+    job.offsets = (size_t *) strider_arena_alloc_array(arena, job.num_segments, sizeof(size_t));
+    if (!job.counts || !job.offsets) {
+        strider_arena_rewind(arena, mark);
+        return strider_find_newline_positions_simd(data, size, positions, max_positions);
+    }
+
+    /* Pass 1: counts; prefix sum gives each segment its output slice */
+    executor->run(executor->context, count_task, &job, job.num_segments);
+    for (size_t i = 0; i < job.num_segments; i++) {
+        job.offsets[i] = total;
+        total += job.counts[i];
+    }
+
+    /* Pass 2: segments write their positions in place */
+    if (max_positions > 0) {
+        executor->run(executor->context, positions_task, &job, job.num_segments);
+    }
+
+    strider_arena_rewind(arena, mark);
+    return total;
+}
@@ -0,0 +1,715 @@
+/**
+ * @file newline_simd.c
+ * @brief SIMD newline counting and position kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ */
+
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/page.h"
+#include "internal/stats.h"
+#include "internal/varint.h"
+#include "strider/parsers/newline.h"
+#include "strider/simd/vector.h"
+#include <stdint.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "newline_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * SIMD Implementation
+ * ======================================================================== */
+
+/* ========================================================================
+ * Block Classification
+ * ======================================================================== */
+
+/* Alignment of the 64-byte blocks fed to classify_block_64() */
+#if defined(STRIDER_HAS_AVX512BW)
+#    define BLOCK_ALIGN 64
+#else
+#    define BLOCK_ALIGN STRIDER_VECN_SIZE
+#endif
+
+/**
+ * @brief Build \n and \r bitmasks for 64 bytes aligned to BLOCK_ALIGN
+ */
+static inline void classify_block_64(const uint8_t *ptr, uint64_t *lf_mask, uint64_t *cr_mask) {
+#if defined(STRIDER_HAS_AVX512BW)
+    strider_vec512_t data = strider_vec512_load_aligned(ptr);
+
+    *lf_mask = strider_vec512_cmpeq_mask(data, strider_vec512_set1('\n'));
+    *cr_mask = strider_vec512_cmpeq_mask(data, strider_vec512_set1('\r'));
+#elif defined(STRIDER_HAS_AVX2)
+    const strider_vec256_t lf_vec = strider_vec256_set1('\n');
+    const strider_vec256_t cr_vec = strider_vec256_set1('\r');
+    strider_vec256_t lo = strider_vec256_load_aligned(ptr);
+    strider_vec256_t hi = strider_vec256_load_aligned(ptr + 32);
+
+    *lf_mask = (uint64_t) strider_vec256_movemask(strider_vec256_cmpeq(lo, lf_vec)) |
+               ((uint64_t) strider_vec256_movemask(strider_vec256_cmpeq(hi, lf_vec)) << 32);
+    *cr_mask = (uint64_t) strider_vec256_movemask(strider_vec256_cmpeq(lo, cr_vec)) |
+               ((uint64_t) strider_vec256_movemask(strider_vec256_cmpeq(hi, cr_vec)) << 32);
+#elif defined(STRIDER_ARCH_ARM64)
+    /* NEON has no movemask: reduce all four compares of each mask at once */
+    const strider_vec128_t lf_vec = strider_vec128_set1('\n');
+    const strider_vec128_t cr_vec = strider_vec128_set1('\r');
+    strider_vec128_t d0 = strider_vec128_load_aligned(ptr);
+    strider_vec128_t d1 = strider_vec128_load_aligned(ptr + 16);
+    strider_vec128_t d2 = strider_vec128_load_aligned(ptr + 32);
+    strider_vec128_t d3 = strider_vec128_load_aligned(ptr + 48);
+
+    *lf_mask = strider_vec128_movemask64(
+        strider_vec128_cmpeq(d0, lf_vec), strider_vec128_cmpeq(d1, lf_vec),
+        strider_vec128_cmpeq(d2, lf_vec), strider_vec128_cmpeq(d3, lf_vec));
+    *cr_mask = strider_vec128_movemask64(
+        strider_vec128_cmpeq(d0, cr_vec), strider_vec128_cmpeq(d1, cr_vec),
+        strider_vec128_cmpeq(d2, cr_vec), strider_vec128_cmpeq(d3, cr_vec));
+#else
+    const strider_vec128_t lf_vec = strider_vec128_set1('\n');
+    const strider_vec128_t cr_vec = strider_vec128_set1('\r');
+    uint64_t lf = 0;
+    uint64_t cr = 0;
+
+    for (int i = 0; i < 4; i++) {
+        strider_vec128_t data = strider_vec128_load_aligned(ptr + 16 * i);
+        lf |= (uint64_t) strider_vec128_movemask(strider_vec128_cmpeq(data, lf_vec)) << (16 * i);
+        cr |= (uint64_t) strider_vec128_movemask(strider_vec128_cmpeq(data, cr_vec)) << (16 * i);
+    }
+
+    *lf_mask = lf;
+    *cr_mask = cr;
+#endif
+}
+
+/**
+ * @brief Newline bitmask of a partial block, carrying \r state in/out
+ *
+ * Bit i is set if ptr[i] ends a line (\r, or \n not after \r). On
+ * AVX-512BW one masked load covers the block without touching bytes
+ * past len; elsewhere it is a scalar loop.
+ *
+ * @param len Bytes in the block (0-63)
+ * @param prev_cr In: byte before ptr is \r. Out: last byte is \r.
+ */
+static inline uint64_t partial_mask(const uint8_t *ptr, size_t len, uint64_t *prev_cr) {
+#if defined(STRIDER_HAS_AVX512BW)
+    strider_vec512_t data = strider_vec512_load_masked(ptr, strider_mask64_low(len));
+    uint64_t lf = strider_vec512_cmpeq_mask(data, strider_vec512_set1('\n'));
+    uint64_t cr = strider_vec512_cmpeq_mask(data, strider_vec512_set1('\r'));
+    uint64_t mask = cr | (lf & ~((cr << 1) | *prev_cr));
+
+    if (len > 0) {
+        *prev_cr = (cr >> (len - 1)) & 1;
+    }
+    return mask;
+#else
+    uint64_t cr = *prev_cr;
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (ptr[i] == '\r' || (ptr[i] == '\n' && !cr)) {
+            mask |= (uint64_t) 1 << i;
+        }
+        cr = (ptr[i] == '\r');
+    }
+
+    *prev_cr = cr;
+    return mask;
+#endif
+}
+
+/* Bytes of partial blocks that partial_mask() examines in scalar code */
+#if defined(STRIDER_HAS_AVX512BW)
+#    define PARTIAL_SCALAR_BYTES(len) ((void) (len), (size_t) 0)
+#else
+#    define PARTIAL_SCALAR_BYTES(len) (len)
+#endif
+
+/* Bytes before the first BLOCK_ALIGN boundary (at most size) */
+static inline size_t block_prefix(const uint8_t *ptr, size_t size) {
+    size_t prefix = (BLOCK_ALIGN - ((uintptr_t) ptr & (BLOCK_ALIGN - 1))) & (BLOCK_ALIGN - 1);
+    return prefix < size ? prefix : size;
+}
+
+#if !defined(STRIDER_HAS_AVX512BW)
+
+/* ========================================================================
+ * Unrolled Accumulator Loop
+ * ======================================================================== */
+
+/* Unrolled loop processes 4 vectors per iteration. Each byte lane of an
+ * accumulator grows by at most 1 per iteration, so lanes are flushed
+ * to the scalar count every 255 iterations before they can wrap. */
+#define COUNT_UNROLL 4
+#define COUNT_FLUSH_INTERVAL 255
+
+#if defined(STRIDER_HAS_AVX2)
+#    define COUNT_VECTOR_SIZE 32
+#else
+#    define COUNT_VECTOR_SIZE 16
+#endif
+
+#define COUNT_BLOCK_SIZE (COUNT_UNROLL * COUNT_VECTOR_SIZE)
+
+/* 0xFF for every byte that ends a line: \n, or \r not followed by \n.
+ * Reads one byte past the vector (ptr[COUNT_VECTOR_SIZE]). */
+#if defined(STRIDER_HAS_AVX2)
+static inline strider_vec256_t line_end_mask(const uint8_t *ptr, strider_vec256_t lf_vec,
+                                             strider_vec256_t cr_vec) {
+    strider_vec256_t data = strider_vec256_load_aligned(ptr);
+    strider_vec256_t next = strider_vec256_load_unaligned(ptr + 1);
+    strider_vec256_t lf = strider_vec256_cmpeq(data, lf_vec);
+    strider_vec256_t cr = strider_vec256_cmpeq(data, cr_vec);
+    strider_vec256_t next_lf = strider_vec256_cmpeq(next, lf_vec);
+    return strider_vec256_or(lf, strider_vec256_andnot(cr, next_lf));
+}
+#else
+static inline strider_vec128_t line_end_mask(const uint8_t *ptr, strider_vec128_t lf_vec,
+                                             strider_vec128_t cr_vec) {
+    strider_vec128_t data = strider_vec128_load_aligned(ptr);
+    strider_vec128_t next = strider_vec128_load_unaligned(ptr + 1);
+    strider_vec128_t lf = strider_vec128_cmpeq(data, lf_vec);
+    strider_vec128_t cr = strider_vec128_cmpeq(data, cr_vec);
+    strider_vec128_t next_lf = strider_vec128_cmpeq(next, lf_vec);
+    return strider_vec128_or(lf, strider_vec128_andnot(cr, next_lf));
+}
+#endif
+
+/**
+ * @brief Count line ends in blocks * COUNT_BLOCK_SIZE aligned bytes
+ *
+ * Counts a \r\n pair at its \n. ptr[blocks * COUNT_BLOCK_SIZE] must be
+ * readable; a \r in the last byte is counted unless that byte is \n.
+ */
+static size_t count_newlines_unrolled(const uint8_t *ptr, size_t blocks) {
+    size_t count = 0;
+
+#if defined(STRIDER_HAS_AVX2)
+    const strider_vec256_t lf_vec = strider_vec256_set1('\n');
+    const strider_vec256_t cr_vec = strider_vec256_set1('\r');
+
+    while (blocks > 0) {
+        size_t n = blocks < COUNT_FLUSH_INTERVAL ? blocks : COUNT_FLUSH_INTERVAL;
+        strider_vec256_t acc0 = strider_vec256_zero();
+        strider_vec256_t acc1 = strider_vec256_zero();
+        strider_vec256_t acc2 = strider_vec256_zero();
+        strider_vec256_t acc3 = strider_vec256_zero();
+
+        for (size_t i = 0; i < n; i++) {
+            acc0 = strider_vec256_sub_u8(acc0, line_end_mask(ptr + 0, lf_vec, cr_vec));
+            acc1 = strider_vec256_sub_u8(acc1, line_end_mask(ptr + 32, lf_vec, cr_vec));
+            acc2 = strider_vec256_sub_u8(acc2, line_end_mask(ptr + 64, lf_vec, cr_vec));
+            acc3 = strider_vec256_sub_u8(acc3, line_end_mask(ptr + 96, lf_vec, cr_vec));
+            ptr += COUNT_BLOCK_SIZE;
+        }
+
+        count += (size_t) (strider_vec256_sum_u8(acc0) + strider_vec256_sum_u8(acc1) +
+                           strider_vec256_sum_u8(acc2) + strider_vec256_sum_u8(acc3));
+        blocks -= n;
+    }
+#else
+    const strider_vec128_t lf_vec = strider_vec128_set1('\n');
+    const strider_vec128_t cr_vec = strider_vec128_set1('\r');
+
+    while (blocks > 0) {
+        size_t n = blocks < COUNT_FLUSH_INTERVAL ? blocks : COUNT_FLUSH_INTERVAL;
+        strider_vec128_t acc0 = strider_vec128_zero();
+        strider_vec128_t acc1 = strider_vec128_zero();
+        strider_vec128_t acc2 = strider_vec128_zero();
+        strider_vec128_t acc3 = strider_vec128_zero();
+
+        for (size_t i = 0; i < n; i++) {
+            acc0 = strider_vec128_sub_u8(acc0, line_end_mask(ptr + 0, lf_vec, cr_vec));
+            acc1 = strider_vec128_sub_u8(acc1, line_end_mask(ptr + 16, lf_vec, cr_vec));
+            acc2 = strider_vec128_sub_u8(acc2, line_end_mask(ptr + 32, lf_vec, cr_vec));
+            acc3 = strider_vec128_sub_u8(acc3, line_end_mask(ptr + 48, lf_vec, cr_vec));
+            ptr += COUNT_BLOCK_SIZE;
+        }
+
+        count += (size_t) (strider_vec128_sum_u8(acc0) + strider_vec128_sum_u8(acc1) +
+                           strider_vec128_sum_u8(acc2) + strider_vec128_sum_u8(acc3));
+        blocks -= n;
+    }
+#endif
+
+    return count;
+}
+
+/* ========================================================================
+ * Head, Tail and Short Inputs
+ * ======================================================================== */
+
+/**
+ * @brief \n and \r bitmasks of COUNT_VECTOR_SIZE unaligned bytes
+ *
+ * The bytes need only lie in the pages of the input (internal/page.h).
+ */
+static inline void classify_vector(const uint8_t *ptr, uint32_t *lf_mask, uint32_t *cr_mask) {
+#if defined(STRIDER_HAS_AVX2)
+    strider_vec256_t data = strider_vec256_load_in_page(ptr);
+
+    *lf_mask = strider_vec256_movemask(strider_vec256_cmpeq(data, strider_vec256_set1('\n')));
+    *cr_mask = strider_vec256_movemask(strider_vec256_cmpeq(data, strider_vec256_set1('\r')));
+#else
+    strider_vec128_t data = strider_vec128_load_in_page(ptr);
+
+    *lf_mask = strider_vec128_movemask(strider_vec128_cmpeq(data, strider_vec128_set1('\n')));
+    *cr_mask = strider_vec128_movemask(strider_vec128_cmpeq(data, strider_vec128_set1('\r')));
+#endif
+}
+
+/**
+ * @brief Count line ends in lanes [skip, skip + length) of one vector
+ *
+ * Covers an unaligned head, a tail or a short input with one load
+ * instead of a scalar loop. The tail vector overlaps bytes counted
+ * before; their \r still masks a \n in lane skip only through prev_cr.
+ *
+ * @param prev_cr The byte before lane skip is a \r counted already
+ */
+static inline size_t count_window(const uint8_t *window, size_t skip, size_t length,
+                                  uint32_t prev_cr) {
+    const uint32_t first = (uint32_t) 1 << skip;
+    uint32_t lf_mask, cr_mask;
+
+    classify_vector(window, &lf_mask, &cr_mask);
+
+    const uint32_t after_cr = ((cr_mask << 1) & ~first) | (prev_cr ? first : 0);
+    uint32_t ends = (cr_mask | (lf_mask & ~after_cr)) >> skip;
+
+    if (length < 32) {
+        ends &= ((uint32_t) 1 << length) - 1;
+    }
+    return (size_t) strider_popcount32(ends);
+}
+
+/* Inputs shorter than a vector: one load that stays in the pages of the
+ * input, reaching before or past it depending on where the page ends */
+static size_t count_newlines_short(const uint8_t *ptr, size_t size) {
+    if (size == 0) {
+        return 0;
+    }
+    if (strider_load_in_page(ptr, COUNT_VECTOR_SIZE)) {
+        return count_window(ptr, 0, size, 0);
+    }
+    return count_window(ptr + size - COUNT_VECTOR_SIZE, COUNT_VECTOR_SIZE - size, size, 0);
+}
+
+/* ========================================================================
+ * Newline Counting Kernel
+ * ======================================================================== */
+
+/* A \r counts unless followed by \n; a \n always counts. Carrying the
+ * "previous byte was \r" bit across blocks turns this into
+ *   popcount(cr) + popcount(lf & ~(cr << 1 | carry))
+ * which is branch-free regardless of the line-ending style. The two
+ * masks are disjoint, so a single popcount of their OR is used. */
+size_t STRIDER_KERNEL(count_newlines)(const char *data, size_t size) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    size_t count = 0;
+    uint32_t prev_cr = 0; /* 1 if the byte before ptr is \r */
+
+    const size_t VECTOR_SIZE = COUNT_VECTOR_SIZE;
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_COUNT_NEWLINES, size, 0);
+    if (size < VECTOR_SIZE) {
+        return count_newlines_short(ptr, size);
+    }
+
+    /* Unaligned head: one unaligned vector, counting the bytes before
+     * the first aligned one */
+    uintptr_t addr = (uintptr_t) ptr;
+    size_t prefix_len = (VECTOR_SIZE - (addr & (VECTOR_SIZE - 1))) & (VECTOR_SIZE - 1);
+
+    if (prefix_len > 0) {
+        count = count_window(ptr, 0, prefix_len, 0);
+        prev_cr = (ptr[prefix_len - 1] == '\r');
+
+        ptr += prefix_len;
+        size -= prefix_len;
+    }
+
+    /* Bulk of the buffer: unrolled accumulator loop. It counts \r\n at
+     * the \n, so undo a \r already counted by the prefix and leave no
+     * carry behind (a trailing \r\n is counted by whoever sees the \n). */
+    if (size > COUNT_BLOCK_SIZE) {
+        size_t blocks = (size - 1) / COUNT_BLOCK_SIZE;
+
+        if (prev_cr && ptr[0] == '\n') {
+            count--;
+        }
+        count += count_newlines_unrolled(ptr, blocks);
+        prev_cr = 0;
+
+        ptr += blocks * COUNT_BLOCK_SIZE;
+        size -= blocks * COUNT_BLOCK_SIZE;
+    }
+
+    /* Remaining aligned vectors */
+#if defined(STRIDER_HAS_AVX2)
+    strider_vec256_t lf_vec = strider_vec256_set1('\n');
+    strider_vec256_t cr_vec = strider_vec256_set1('\r');
+
+    while (size >= 32) {
+        strider_vec256_t data_vec = strider_vec256_load_aligned(ptr);
+
+        uint32_t lf_mask = strider_vec256_movemask(strider_vec256_cmpeq(data_vec, lf_vec));
+        uint32_t cr_mask = strider_vec256_movemask(strider_vec256_cmpeq(data_vec, cr_vec));
+
+        /* \n directly after \r belongs to that \r (bits are disjoint) */
+        count += strider_popcount32(cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr)));
+        prev_cr = cr_mask >> 31;
+
+        ptr += 32;
+        size -= 32;
+    }
+#elif defined(STRIDER_ARCH_ARM64)
+    /* NEON: nibble masks (4 bits per byte), so the \r carry shifts by 4
+     * and every line end adds 4 to the popcount */
+    strider_vec128_t lf_vec = strider_vec128_set1('\n');
+    strider_vec128_t cr_vec = strider_vec128_set1('\r');
+    uint64_t prev_cr_nibble = prev_cr ? 0xF : 0;
+
+    while (size >= 16) {
+        strider_vec128_t data_vec = strider_vec128_load_aligned(ptr);
+
+        uint64_t lf_mask = strider_vec128_nibble_mask(strider_vec128_cmpeq(data_vec, lf_vec));
+        uint64_t cr_mask = strider_vec128_nibble_mask(strider_vec128_cmpeq(data_vec, cr_vec));
+
+        count += (size_t) strider_popcount64(cr_mask |
+                                             (lf_mask & ~((cr_mask << 4) | prev_cr_nibble))) >>
+                 2;
+        prev_cr_nibble = cr_mask >> 60;
+
+        ptr += 16;
+        size -= 16;
+    }
+    prev_cr = prev_cr_nibble != 0;
+#else
+    /* SSE2 path */
+    strider_vec128_t lf_vec = strider_vec128_set1('\n');
+    strider_vec128_t cr_vec = strider_vec128_set1('\r');
+
+    while (size >= 16) {
+        strider_vec128_t data_vec = strider_vec128_load_aligned(ptr);
+
+        uint32_t lf_mask = strider_vec128_movemask(strider_vec128_cmpeq(data_vec, lf_vec));
+        uint32_t cr_mask = strider_vec128_movemask(strider_vec128_cmpeq(data_vec, cr_vec));
+
+        /* \n directly after \r belongs to that \r (bits are disjoint) */
+        count += strider_popcount32(cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr)));
+        prev_cr = cr_mask >> 15;
+
+        ptr += 16;
+        size -= 16;
+    }
+#endif
+
+    /* Tail: the last vector of the input, of which only the top size
+     * lanes have not been counted yet */
+    if (size > 0) {
+        count += count_window(ptr + size - VECTOR_SIZE, VECTOR_SIZE - size, size, prev_cr);
+    }
+
+    return count;
+}
+
+#else /* STRIDER_HAS_AVX512BW */
+
+/* ========================================================================
+ * Newline Counting Kernel (AVX-512BW)
+ * ======================================================================== */
+
+/* Mask compares give the line-end bits of 64 bytes directly, so the
+ * count is popcount(cr | lf & ~(cr << 1 | carry)) per block and the
+ * unaligned head and the tail are single masked loads. */
+size_t STRIDER_KERNEL(count_newlines)(const char *data, size_t size) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    const size_t prefix = block_prefix(ptr, size);
+    uint64_t prev_cr = 0;
+    size_t count;
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_COUNT_NEWLINES, size, 0);
+    count = (size_t) strider_popcount64(partial_mask(ptr, prefix, &prev_cr));
+    ptr += prefix;
+    size -= prefix;
+
+    while (size >= 64) {
+        uint64_t lf_mask, cr_mask;
+        classify_block_64(ptr, &lf_mask, &cr_mask);
+
+        count += (size_t) strider_popcount64(cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr)));
+        prev_cr = cr_mask >> 63;
+
+        ptr += 64;
+        size -= 64;
+    }
+
+    return count + (size_t) strider_popcount64(partial_mask(ptr, size, &prev_cr));
+}
+
+#endif /* STRIDER_HAS_AVX512BW */
+
+/* ========================================================================
+ * Newline Position Kernel
+ * ======================================================================== */
+
+/**
+ * @brief Convert a 64-bit newline mask into offsets
+ *
+ * When the output has room for a whole block, writes four offsets per
+ * step without checking each bit (simdjson-style flattening); the extra
+ * writes stay below max_positions and are overwritten by later blocks.
+ *
+ * @return Updated total count
+ */
+static inline size_t flatten_mask(uint64_t mask, size_t base, size_t *positions,
+                                  size_t max_positions, size_t count) {
+    if (mask == 0) {
+        return count;
+    }
+
+    size_t pop = (size_t) strider_popcount64(mask);
+
+    if (count <= max_positions && max_positions - count >= 64) {
+        size_t *out = positions + count;
+        for (size_t i = 0; i < pop; i += 4) {
+            out[i + 0] = base + (size_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 1] = base + (size_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 2] = base + (size_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 3] = base + (size_t) strider_ctz64(mask);
+            mask &= mask - 1;
+        }
+        return count + pop;
+    }
+
+    /* Near the end of the output: store exactly what fits */
+    for (size_t n = count; mask != 0 && n < max_positions; n++) {
+        positions[n] = base + (size_t) strider_ctz64(mask);
+        mask &= mask - 1;
+    }
+    return count + pop;
+}
+
+size_t STRIDER_KERNEL(find_newline_positions)(const char *data, size_t size, size_t *positions,
+                                              size_t max_positions) {
+    const uint8_t *start = (const uint8_t *) data;
+    const uint8_t *ptr = start;
+    size_t count = 0;
+    uint64_t prev_cr = 0; /* 1 if the byte before ptr is \r */
+
+    /* Unaligned head */
+    const size_t prefix = block_prefix(ptr, size);
+    count = flatten_mask(partial_mask(ptr, prefix, &prev_cr), 0, positions, max_positions, count);
+    ptr += prefix;
+    size -= prefix;
+
+    /* Main loop: 64 bytes per iteration, \n after \r is masked out */
+    while (size >= 64) {
+        uint64_t lf_mask, cr_mask;
+        classify_block_64(ptr, &lf_mask, &cr_mask);
+
+        uint64_t mask = cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr));
+        prev_cr = cr_mask >> 63;
+
+        count = flatten_mask(mask, (size_t) (ptr - start), positions, max_positions, count);
+
+        ptr += 64;
+        size -= 64;
+    }
+
+    /* Tail */
+    count = flatten_mask(partial_mask(ptr, size, &prev_cr), (size_t) (ptr - start), positions,
+                         max_positions, count);
+
+    const size_t scalar_bytes = PARTIAL_SCALAR_BYTES(prefix + size);
+    STRIDER_STATS_RECORD(STRIDER_STATS_FIND_NEWLINE_POSITIONS,
+                         (size_t) (ptr - start) + size - scalar_bytes, scalar_bytes);
+    return count;
+}
+
+/* ========================================================================
+ * Compact Position Kernels
+ * ======================================================================== */
+
+/**
+ * @brief flatten_mask() for 32-bit output
+ */
+static inline size_t flatten_mask32(uint64_t mask, uint32_t base, uint32_t *positions,
+                                    size_t max_positions, size_t count) {
+    if (mask == 0) {
+        return count;
+    }
+
+    size_t pop = (size_t) strider_popcount64(mask);
+
+    if (count <= max_positions && max_positions - count >= 64) {
+        uint32_t *out = positions + count;
+        for (size_t i = 0; i < pop; i += 4) {
+            out[i + 0] = base + (uint32_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 1] = base + (uint32_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 2] = base + (uint32_t) strider_ctz64(mask);
+            mask &= mask - 1;
+            out[i + 3] = base + (uint32_t) strider_ctz64(mask);
+            mask &= mask - 1;
+        }
+        return count + pop;
+    }
+
+    for (size_t n = count; mask != 0 && n < max_positions; n++) {
+        positions[n] = base + (uint32_t) strider_ctz64(mask);
+        mask &= mask - 1;
+    }
+    return count + pop;
+}
+
+/* The caller (strider_find_newline_positions32_simd) checked base + size <= 2^32 */
+size_t STRIDER_KERNEL(find_newline_positions32)(const char *data, size_t size, uint32_t base,
+                                                uint32_t *positions, size_t max_positions) {
+    const uint8_t *start = (const uint8_t *) data;
+    const uint8_t *ptr = start;
+    size_t count = 0;
+    uint64_t prev_cr = 0;
+
+    const size_t prefix = block_prefix(ptr, size);
+    count = flatten_mask32(partial_mask(ptr, prefix, &prev_cr), base, positions, max_positions,
+                           count);
+    ptr += prefix;
+    size -= prefix;
+
+    while (size >= 64) {
+        uint64_t lf_mask, cr_mask;
+        classify_block_64(ptr, &lf_mask, &cr_mask);
+
+        uint64_t mask = cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr));
+        prev_cr = cr_mask >> 63;
+
+        count = flatten_mask32(mask, base + (uint32_t) (ptr - start), positions, max_positions,
+                               count);
+        ptr += 64;
+        size -= 64;
+    }
+
+    count = flatten_mask32(partial_mask(ptr, size, &prev_cr), base + (uint32_t) (ptr - start),
+                           positions, max_positions, count);
+
+    const size_t scalar_bytes = PARTIAL_SCALAR_BYTES(prefix + size);
+    STRIDER_STATS_RECORD(STRIDER_STATS_FIND_NEWLINE_POSITIONS,
+                         (size_t) (ptr - start) + size - scalar_bytes, scalar_bytes);
+    return count;
+}
+
+typedef struct {
+    uint8_t *out;
+    size_t capacity;
+    size_t written;
+    size_t next; /* Previous newline position + 1 */
+    size_t count;
+} pack_state_t;
+
+/* A block's first gap may be long; the other (at most 63) are under 64 */
+#define PACK_BLOCK_BOUND (STRIDER_VARINT_MAX_BYTES + 63)
+
+/**
+ * @brief Append the varint gaps of one block's newline mask
+ *
+ * @return Offset of the first newline that did not fit, or
+ *         STRIDER_NOT_FOUND if all did
+ */
+static inline size_t pack_mask(pack_state_t *state, uint64_t mask, size_t base) {
+    if (state->capacity - state->written >= PACK_BLOCK_BOUND) {
+        uint8_t *out = state->out + state->written;
+        size_t next = state->next;
+
+        state->count += (size_t) strider_popcount64(mask);
+        while (mask != 0) {
+            const size_t position = base + (size_t) strider_ctz64(mask);
+            const uint64_t gap = position - next;
+
+            if (gap < 0x80) {
+                *out++ = (uint8_t) gap;
+            } else {
+                out += strider_varint_encode(out, gap);
+            }
+            next = position + 1;
+            mask &= mask - 1;
+        }
+        state->written = (size_t) (out - state->out);
+        state->next = next;
+        return STRIDER_NOT_FOUND;
+    }
+
+    /* Near the end of the output: check every gap */
+    while (mask != 0) {
+        const size_t position = base + (size_t) strider_ctz64(mask);
+        const uint64_t gap = position - state->next;
+
+        if (strider_varint_length(gap) > state->capacity - state->written) {
+            return position;
+        }
+        state->written += strider_varint_encode(state->out + state->written, gap);
+        state->next = position + 1;
+        state->count++;
+        mask &= mask - 1;
+    }
+    return STRIDER_NOT_FOUND;
+}
+
+size_t STRIDER_KERNEL(pack_newline_positions)(const char *data, size_t size, uint8_t *out,
+                                              size_t capacity, size_t *out_size,
+                                              size_t *consumed) {
+    const uint8_t *start = (const uint8_t *) data;
+    const uint8_t *ptr = start;
+    const size_t total = size;
+    pack_state_t state = {out, capacity, 0, 0, 0};
+    size_t stop = STRIDER_NOT_FOUND;
+    uint64_t prev_cr = 0;
+
+    const size_t prefix = block_prefix(ptr, size);
+    stop = pack_mask(&state, partial_mask(ptr, prefix, &prev_cr), 0);
+    ptr += prefix;
+    size -= prefix;
+
+    while (stop == STRIDER_NOT_FOUND && size >= 64) {
+        uint64_t lf_mask, cr_mask;
+        classify_block_64(ptr, &lf_mask, &cr_mask);
+
+        uint64_t mask = cr_mask | (lf_mask & ~((cr_mask << 1) | prev_cr));
+        prev_cr = cr_mask >> 63;
+
+        stop = pack_mask(&state, mask, (size_t) (ptr - start));
+        ptr += 64;
+        size -= 64;
+    }
+
+    /* An early stop leaves the tail unexamined */
+    if (stop == STRIDER_NOT_FOUND) {
+        stop = pack_mask(&state, partial_mask(ptr, size, &prev_cr), (size_t) (ptr - start));
+    } else {
+        size = 0;
+    }
+
+    const size_t scalar_bytes = PARTIAL_SCALAR_BYTES(prefix + size);
+    STRIDER_STATS_RECORD(STRIDER_STATS_PACK_NEWLINE_POSITIONS,
+                         (size_t) (ptr - start) + size - scalar_bytes, scalar_bytes);
+
+    if (out_size) {
+        *out_size = state.written;
+    }
+    if (consumed) {
+        *consumed = stop == STRIDER_NOT_FOUND ? total : stop;
+    }
+    return state.count;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file strchr_simd.c
+ * @brief SIMD single character search kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * All loads are aligned vectors. An aligned vector never crosses a page,
+ * so reading the whole vector around str, and past the terminating NUL,
+ * cannot fault (see internal/page.h); the lanes before str are shifted
+ * out of the first mask. Short strings thus cost one vector, with no
+ * scalar prologue or epilogue.
+ */
+
+#include "internal/dispatch.h"
+#include "internal/page.h"
+#include "internal/stats.h"
+#include "strider/parsers/strchr.h"
+#include "strider/simd/vector.h"
+#include <stdint.h>
+#include <string.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "strchr_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * SIMD Implementation Helpers
+ * ======================================================================== */
+
+/**
+ * @brief Record a search that examined [str, end) with vector loads
+ */
+static inline void record_search(const char *str, const uint8_t *end) {
+    STRIDER_STATS_RECORD(STRIDER_STATS_STRCHR, (size_t) (end - (const uint8_t *) str), 0);
+}
+
+#if defined(STRIDER_HAS_AVX512BW)
+#    define STRCHR_VECTOR_SIZE 64
+#    define HIT_SHIFT 0 /* log2 of the mask bits per byte */
+#elif defined(STRIDER_HAS_AVX2)
+#    define STRCHR_VECTOR_SIZE 32
+#    define HIT_SHIFT 0
+#elif defined(STRIDER_ARCH_ARM64)
+#    define STRCHR_VECTOR_SIZE 16
+#    define HIT_SHIFT 2 /* NEON nibble masks */
+#else
+#    define STRCHR_VECTOR_SIZE 16
+#    define HIT_SHIFT 0
+#endif
+
+#if defined(STRIDER_HAS_AVX512BW)
+typedef strider_vec512_t hit_vec_t;
+#    define HIT_SET1(b) strider_vec512_set1(b)
+#elif defined(STRIDER_HAS_AVX2)
+typedef strider_vec256_t hit_vec_t;
+#    define HIT_SET1(b) strider_vec256_set1(b)
+#else
+typedef strider_vec128_t hit_vec_t;
+#    define HIT_SET1(b) strider_vec128_set1(b)
+#endif
+
+/**
+ * @brief Bitmask of the target and NUL bytes of an aligned vector
+ *
+ * Byte i owns bits [i << HIT_SHIFT, (i + 1) << HIT_SHIFT).
+ */
+static inline uint64_t vector_hits(const uint8_t *ptr, hit_vec_t target_vec, hit_vec_t zero_vec) {
+#if defined(STRIDER_HAS_AVX512BW)
+    strider_vec512_t data = strider_vec512_load_in_page(ptr);
+    return strider_vec512_cmpeq_mask(data, target_vec) | strider_vec512_cmpeq_mask(data, zero_vec);
+#elif defined(STRIDER_HAS_AVX2)
+    strider_vec256_t data = strider_vec256_load_in_page(ptr);
+    return strider_vec256_movemask(strider_vec256_or(strider_vec256_cmpeq(data, target_vec),
+                                                     strider_vec256_cmpeq(data, zero_vec)));
+#elif defined(STRIDER_ARCH_ARM64)
+    strider_vec128_t data = strider_vec128_load_in_page(ptr);
+    return strider_vec128_nibble_mask(strider_vec128_or(strider_vec128_cmpeq(data, target_vec),
+                                                        strider_vec128_cmpeq(data, zero_vec)));
+#else
+    strider_vec128_t data = strider_vec128_load_in_page(ptr);
+    return strider_vec128_movemask(strider_vec128_or(strider_vec128_cmpeq(data, target_vec),
+                                                     strider_vec128_cmpeq(data, zero_vec)));
+#endif
+}
+
+/* ========================================================================
+ * SIMD Implementation
+ * ======================================================================== */
+
+/**
+ * @brief Search with the broadcast vectors already built
+ *
+ * The first target or NUL byte decides: the target was found, or the
+ * string ended (which is the match when searching for NUL).
+ */
+static inline const char *find_char(const char *str, unsigned char target, hit_vec_t target_vec,
+                                    hit_vec_t zero_vec) {
+    const size_t offset = (uintptr_t) str & (STRCHR_VECTOR_SIZE - 1);
+    const uint8_t *ptr = (const uint8_t *) str - offset;
+
+    /* Head: the aligned vector holding str, lanes before str dropped */
+    uint64_t hits = vector_hits(ptr, target_vec, zero_vec) >> (offset << HIT_SHIFT);
+    if (hits != 0) {
+        const uint8_t *found = (const uint8_t *) str + (strider_ctz64(hits) >> HIT_SHIFT);
+        record_search(str, ptr + STRCHR_VECTOR_SIZE);
+        return *found == target ? (const char *) found : NULL;
+    }
+
+    for (;;) {
+        ptr += STRCHR_VECTOR_SIZE;
+        hits = vector_hits(ptr, target_vec, zero_vec);
+        if (hits != 0) {
+            const uint8_t *found = ptr + (strider_ctz64(hits) >> HIT_SHIFT);
+            record_search(str, ptr + STRCHR_VECTOR_SIZE);
+            return *found == target ? (const char *) found : NULL;
+        }
+    }
+}
+
+const char *STRIDER_KERNEL(strchr)(const char *str, int ch) {
+    const unsigned char target = (unsigned char) ch;
+    return find_char(str, target, HIT_SET1(target), HIT_SET1(0));
+}
+
+/* ========================================================================
+ * Batch Search
+ * ======================================================================== */
+
+/* Strings this far ahead are prefetched while one is searched */
+#define BATCH_PREFETCH_DISTANCE 8
+
+size_t STRIDER_KERNEL(strchr_batch)(const char *const *strs, size_t count, int ch,
+                                    const char **results) {
+    const unsigned char target = (unsigned char) ch;
+    const hit_vec_t target_vec = HIT_SET1(target);
+    const hit_vec_t zero_vec = HIT_SET1(0);
+    size_t found = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        if (i + BATCH_PREFETCH_DISTANCE < count) {
+            strider_prefetch(strs[i + BATCH_PREFETCH_DISTANCE]);
+        }
+        results[i] = find_char(strs[i], target, target_vec, zero_vec);
+        found += results[i] != NULL;
+    }
+    return found;
+}
@@ -0,0 +1,97 @@
+/**
+ * @file strstr.c
+ * @brief Implementation of length-bounded substring search
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/ascii.h"
+#include "internal/dispatch.h"
+#include "strider/parsers/strstr.h"
+#include <string.h>
+
+/* ========================================================================
+ * Needle Construction
+ * ======================================================================== */
+
+int strider_needle_init(strider_needle_t *needle, strider_buffer_view_t view) {
+    if (!needle || (!view.data && view.size > 0)) {
+        return -1;
+    }
+
+    needle->data = view.data;
+    needle->size = view.size;
+    needle->first = view.size > 0 ? view.data[0] : 0;
+    needle->last = view.size > 0 ? view.data[view.size - 1] : 0;
+
+    return 0;
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+size_t strider_strstr(strider_buffer_view_t haystack, strider_buffer_view_t needle) {
+    if (needle.size == 0) {
+        return 0;
+    }
+    if (needle.size > haystack.size) {
+        return STRIDER_NOT_FOUND;
+    }
+
+    for (size_t i = 0; i <= haystack.size - needle.size; i++) {
+        if (memcmp(haystack.data + i, needle.data, needle.size) == 0) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+size_t strider_strstr_nocase(strider_buffer_view_t haystack, strider_buffer_view_t needle) {
+    if (needle.size == 0) {
+        return 0;
+    }
+    if (needle.size > haystack.size) {
+        return STRIDER_NOT_FOUND;
+    }
+
+    for (size_t i = 0; i <= haystack.size - needle.size; i++) {
+        if (strider_ascii_equal_nocase(haystack.data + i, needle.data, needle.size)) {
+            return i;
+        }
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see strstr_simd.c)
+ * ======================================================================== */
+
+size_t strider_strstr_simd(strider_buffer_view_t haystack, strider_buffer_view_t needle) {
+    strider_needle_t compiled;
+
+    if (strider_needle_init(&compiled, needle) != 0) {
+        return STRIDER_NOT_FOUND;
+    }
+    return strider_needle_find(haystack, &compiled);
+}
+
+size_t strider_needle_find(strider_buffer_view_t haystack, const strider_needle_t *needle) {
+    return strider_get_kernels()->needle_find(haystack, needle);
+}
+
+size_t strider_strstr_nocase_simd(strider_buffer_view_t haystack, strider_buffer_view_t needle) {
+    strider_needle_t compiled;
+
+    if (strider_needle_init(&compiled, needle) != 0) {
+        return STRIDER_NOT_FOUND;
+    }
+    return strider_needle_find_nocase(haystack, &compiled);
+}
+
+size_t strider_needle_find_nocase(strider_buffer_view_t haystack, const strider_needle_t *needle) {
+    return strider_get_kernels()->needle_find_nocase(haystack, needle);
+}
@@ -0,0 +1,137 @@
+/**
+ * @file strstr_simd.c
+ * @brief SIMD substring search kernels (first/last-byte filter)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * For a needle of length k, bit i of the candidate mask is set when
+ * haystack[i] == needle[0] and haystack[i + k - 1] == needle[k - 1].
+ * Matching both ends rejects almost every false candidate of a plain
+ * first-byte filter, so the verify step stays off the hot path. All
+ * loads are unaligned and stay inside the haystack. Case-insensitive
+ * searches fold each loaded vector to lower case first (range check
+ * for A-Z, OR 0x20), which costs three instructions per vector.
+ */
+
+#include "internal/ascii.h"
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/stats.h"
+#include "strider/parsers/strstr.h"
+#include <string.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "strstr_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* Check the needle's inner bytes at a candidate whose ends already match */
+static inline bool verify_candidate(const uint8_t *candidate, const strider_needle_t *needle,
+                                    bool fold) {
+    if (needle->size <= 2) {
+        return true;
+    }
+    if (fold) {
+        return strider_ascii_equal_nocase(candidate + 1, needle->data + 1, needle->size - 2);
+    }
+    return memcmp(candidate + 1, needle->data + 1, needle->size - 2) == 0;
+}
+
+static inline uint8_t fold_byte(uint8_t c, bool fold) {
+    return fold ? strider_ascii_tolower(c) : c;
+}
+
+/* Vector at ptr, folded to ASCII lower case if fold is set */
+static inline strider_vecn_t load_vector(const uint8_t *ptr, bool fold) {
+    strider_vecn_t v = strider_vecn_load_unaligned(ptr);
+    return fold ? strider_vecn_ascii_tolower(v) : v;
+}
+
+static inline strider_block64_t load_block(const uint8_t *ptr, bool fold) {
+    strider_block64_t block = strider_block64_load(ptr);
+    return fold ? strider_block64_ascii_tolower(block) : block;
+}
+
+/**
+ * @brief First/last-byte filter search
+ *
+ * With fold set, the haystack is folded per vector and compared with
+ * the folded needle ends; candidates are verified case-insensitively.
+ */
+static inline size_t find_needle(strider_buffer_view_t haystack, const strider_needle_t *needle,
+                                 bool fold) {
+    const uint8_t *ptr = haystack.data;
+    const size_t size = haystack.size;
+    const size_t k = needle->size;
+
+    if (k == 0 || k > size) {
+        STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, 0, 0);
+        return k == 0 ? 0 : STRIDER_NOT_FOUND;
+    }
+    if (k == 1) { /* Counted by memchr */
+        return fold ? STRIDER_KERNEL(memchr_nocase)(haystack, needle->first)
+                    : STRIDER_KERNEL(memchr)(haystack, needle->first);
+    }
+
+    const uint8_t first_byte = fold_byte(needle->first, fold);
+    const uint8_t last_byte = fold_byte(needle->last, fold);
+    const strider_vecn_t first = strider_vecn_set1(first_byte);
+    const strider_vecn_t last = strider_vecn_set1(last_byte);
+    const size_t last_offset = k - 1;
+    const size_t candidates = size - last_offset; /* Valid start offsets */
+    size_t i = 0;
+
+    /* 64 candidate offsets per iteration */
+    for (; i + 64 <= candidates; i += 64) {
+        uint64_t mask = strider_block64_eq(load_block(ptr + i, fold), first) &
+                        strider_block64_eq(load_block(ptr + i + last_offset, fold), last);
+        while (mask != 0) {
+            size_t pos = i + (size_t) strider_ctz64(mask);
+            if (verify_candidate(ptr + pos, needle, fold)) {
+                STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, i + 64 + last_offset, 0);
+                return pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    /* Remaining whole vectors */
+    for (; i + STRIDER_VECN_SIZE <= candidates; i += STRIDER_VECN_SIZE) {
+        uint32_t mask = strider_vecn_eq_mask(load_vector(ptr + i, fold), first) &
+                        strider_vecn_eq_mask(load_vector(ptr + i + last_offset, fold), last);
+        while (mask != 0) {
+            size_t pos = i + (size_t) strider_ctz32(mask);
+            if (verify_candidate(ptr + pos, needle, fold)) {
+                STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, i + STRIDER_VECN_SIZE + last_offset, 0);
+                return pos;
+            }
+            mask &= mask - 1;
+        }
+    }
+
+    /* Handle remaining offsets with scalar */
+    const size_t vector_bytes = i > 0 ? i + last_offset : 0; /* Covered by the vector loads */
+    for (; i < candidates; i++) {
+        if (fold_byte(ptr[i], fold) == first_byte &&
+            fold_byte(ptr[i + last_offset], fold) == last_byte &&
+            verify_candidate(ptr + i, needle, fold)) {
+            STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, vector_bytes, i + k - vector_bytes);
+            return i;
+        }
+    }
+
+    STRIDER_STATS_RECORD(STRIDER_STATS_STRSTR, vector_bytes, size - vector_bytes);
+    return STRIDER_NOT_FOUND;
+}
+
+size_t STRIDER_KERNEL(needle_find)(strider_buffer_view_t haystack, const strider_needle_t *needle) {
+    return find_needle(haystack, needle, false);
+}
+
+size_t STRIDER_KERNEL(needle_find_nocase)(strider_buffer_view_t haystack,
+                                          const strider_needle_t *needle) {
+    return find_needle(haystack, needle, true);
+}
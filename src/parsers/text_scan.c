@@ -0,0 +1,107 @@
+/**
+ * @file text_scan.c
+ * @brief Implementation of the single-pass text scan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/dispatch.h"
+#include "internal/text_scan.h"
+#include "strider/parsers/text_scan.h"
+#include <stdint.h>
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+static inline bool is_continuation(uint8_t byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+size_t strider_validate_utf8(const char *data, size_t size) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    size_t i = 0;
+
+    while (i < size) {
+        const uint8_t lead = ptr[i];
+        uint8_t min = 0x80, max = 0xBF; /* Range of the second byte */
+        size_t length;
+
+        if (lead < 0x80) {
+            i++;
+            continue;
+        }
+        if (lead >= 0xC2 && lead <= 0xDF) {
+            length = 2;
+        } else if (lead >= 0xE0 && lead <= 0xEF) {
+            length = 3;
+            if (lead == 0xE0) {
+                min = 0xA0; /* Overlong */
+            } else if (lead == 0xED) {
+                max = 0x9F; /* Surrogates */
+            }
+        } else if (lead >= 0xF0 && lead <= 0xF4) {
+            length = 4;
+            if (lead == 0xF0) {
+                min = 0x90; /* Overlong */
+            } else if (lead == 0xF4) {
+                max = 0x8F; /* Above U+10FFFF */
+            }
+        } else {
+            return i; /* Continuation byte, C0/C1 or F5-FF */
+        }
+
+        if (size - i < length || ptr[i + 1] < min || ptr[i + 1] > max) {
+            return i;
+        }
+        for (size_t k = 2; k < length; k++) {
+            if (!is_continuation(ptr[i + k])) {
+                return i;
+            }
+        }
+        i += length;
+    }
+
+    return STRIDER_NOT_FOUND;
+}
+
+int strider_scan_text(const char *data, size_t size, size_t long_line_limit,
+                      strider_text_stats_t *stats) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    size_t line_start = 0;
+
+    if (!stats || (!data && size > 0)) {
+        return -1;
+    }
+    strider_text_stats_init(stats);
+    stats->utf8_error = strider_validate_utf8(data, size);
+
+    for (size_t i = 0; i < size; i++) {
+        if (ptr[i] == '\n' && i > 0 && ptr[i - 1] == '\r') {
+            line_start = i + 1; /* Second byte of \r\n, the \r ended the line */
+        } else if (ptr[i] == '\n' || ptr[i] == '\r') {
+            stats->newlines++;
+            strider_text_stats_add_line(stats, line_start, i - line_start, long_line_limit);
+            line_start = i + 1;
+        }
+    }
+    if (line_start < size) {
+        strider_text_stats_add_line(stats, line_start, size - line_start, long_line_limit);
+    }
+
+    return 0;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see text_scan_simd.c)
+ * ======================================================================== */
+
+int strider_scan_text_simd(const char *data, size_t size, size_t long_line_limit,
+                           strider_text_stats_t *stats) {
+    if (!stats || (!data && size > 0)) {
+        return -1;
+    }
+    strider_get_kernels()->scan_text(data, size, long_line_limit, stats);
+    return 0;
+}
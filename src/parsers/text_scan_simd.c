@@ -0,0 +1,325 @@
+/**
+ * @file text_scan_simd.c
+ * @brief SIMD single-pass text scan kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * Each 64-byte block is loaded once and feeds both consumers:
+ *
+ *   1. Newlines: \n and \r bit masks give the line terminators (a \n
+ *      right after \r belongs to the \r), which are walked bit by bit
+ *      for the line lengths.
+ *   2. UTF-8 (Keiser and Lemire): a block with no byte >= 0x80 is only
+ *      checked for a sequence left open by the previous block. Other
+ *      blocks classify every byte together with the one before it
+ *      through three nibble lookups; the resulting error bits must
+ *      agree with where the 3rd and 4th bytes of a sequence are due.
+ *
+ * The vector check only says whether a block holds an error; the exact
+ * offset is then found by strider_validate_utf8() from the start of
+ * the sequence open at the block start, so error reporting stays
+ * identical to the scalar reference. The tail shorter than a block is
+ * copied into a zero-padded block; NUL bytes are valid ASCII and end
+ * any truncated sequence with an error, as the reference does.
+ *
+ * Without a native byte shuffle (SSE2) the nibble lookups are emulated
+ * byte by byte and cost more than the scalar validator, so only the
+ * ASCII test stays vectorized: non-ASCII blocks are handed to
+ * strider_validate_utf8(), which resumes at the last character
+ * boundary it reached.
+ */
+
+#include "internal/block64.h"
+#include "internal/dispatch.h"
+#include "internal/text_scan.h"
+#include "strider/parsers/text_scan.h"
+#include <string.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "text_scan_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * UTF-8 Classification
+ * ======================================================================== */
+
+/* True if no byte of the block is >= 0x80 */
+static inline bool block_is_ascii(const strider_block64_t *block) {
+    strider_vecn_t any = block->v[0];
+
+    for (int i = 1; i < STRIDER_BLOCK64_VECTORS; i++) {
+        any = strider_vecn_or(any, block->v[i]);
+    }
+    return strider_vecn_movemask(any) == 0;
+}
+
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+
+/* Error classes of a byte pair (first byte, second byte) */
+#define TOO_SHORT (1 << 0)      /* Lead followed by a lead or ASCII */
+#define TOO_LONG (1 << 1)       /* ASCII followed by a continuation */
+#define OVERLONG_3 (1 << 2)     /* E0 80..9F */
+#define TOO_LARGE (1 << 3)      /* F4 90..BF, F5..FF */
+#define SURROGATE (1 << 4)      /* ED A0..BF */
+#define OVERLONG_2 (1 << 5)     /* C0..C1 */
+#define TOO_LARGE_1000 (1 << 6) /* F5..FF 80..8F */
+#define OVERLONG_4 (1 << 6)     /* F0 80..8F */
+#define TWO_CONTS (1 << 7)      /* Continuation followed by a continuation */
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+/* By high nibble of the first byte */
+static const uint8_t first_high_table[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+    TOO_SHORT | OVERLONG_2,
+    TOO_SHORT,
+    TOO_SHORT | OVERLONG_3 | SURROGATE,
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,
+};
+
+/* By low nibble of the first byte */
+static const uint8_t first_low_table[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+    CARRY | OVERLONG_2,
+    CARRY,
+    CARRY,
+    CARRY | TOO_LARGE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+};
+
+/* By high nibble of the second byte */
+static const uint8_t second_high_table[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+};
+
+/* Largest byte allowed in each of the last three lanes of a vector that
+ * ends a complete sequence (last lane: no lead, then no 3-byte lead...) */
+static const uint8_t incomplete_limits[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+
+/**
+ * @brief Validator state carried from one block to the next
+ */
+typedef struct {
+    strider_vecn_t first_high;
+    strider_vecn_t first_low;
+    strider_vecn_t second_high;
+    strider_vecn_t limits;
+    strider_vecn_t prev;       /* Last vector checked */
+    strider_vecn_t incomplete; /* Non-zero if prev ends inside a sequence */
+} utf8_checker_t;
+
+static inline void utf8_checker_init(utf8_checker_t *c) {
+    c->first_high = strider_vecn_load_table16(first_high_table);
+    c->first_low = strider_vecn_load_table16(first_low_table);
+    c->second_high = strider_vecn_load_table16(second_high_table);
+    c->limits = strider_vecn_load_unaligned(incomplete_limits + 32 - STRIDER_VECN_SIZE);
+    c->prev = strider_vecn_zero();
+    c->incomplete = strider_vecn_zero();
+}
+
+/* Non-zero bytes where input (preceded by prev) is not valid UTF-8 */
+static inline strider_vecn_t utf8_vector_errors(const utf8_checker_t *c, strider_vecn_t input,
+                                                strider_vecn_t prev) {
+    const strider_vecn_t low_nibble = strider_vecn_set1(0x0F);
+    const strider_vecn_t prev1 = strider_vecn_prev(prev, input, 1);
+    const strider_vecn_t special = strider_vecn_and(
+        strider_vecn_and(strider_vecn_lookup16(c->first_high, strider_vecn_high_nibble(prev1)),
+                         strider_vecn_lookup16(c->first_low, strider_vecn_and(prev1, low_nibble))),
+        strider_vecn_lookup16(c->second_high, strider_vecn_high_nibble(input)));
+
+    /* 0x80 where the byte must be the 3rd or 4th of a sequence, which
+     * is exactly where special may (and must) say TWO_CONTS */
+    const strider_vecn_t third = strider_vecn_subs_u8(strider_vecn_prev(prev, input, 2),
+                                                      strider_vecn_set1(0xE0 - 0x80));
+    const strider_vecn_t fourth = strider_vecn_subs_u8(strider_vecn_prev(prev, input, 3),
+                                                       strider_vecn_set1(0xF0 - 0x80));
+    const strider_vecn_t must_continue =
+        strider_vecn_and(strider_vecn_or(third, fourth), strider_vecn_set1(0x80));
+
+    return strider_vecn_xor(must_continue, special);
+}
+
+/* True if the block holds an error (or closes none left open before it) */
+static inline bool utf8_vector_check_block(utf8_checker_t *c, const strider_block64_t *block) {
+    strider_vecn_t errors;
+
+    if (block_is_ascii(block)) {
+        /* ASCII: only a sequence left open by the previous block can fail */
+        errors = c->incomplete;
+        c->incomplete = strider_vecn_zero();
+    } else {
+        errors = strider_vecn_zero();
+        for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+            errors = strider_vecn_or(errors, utf8_vector_errors(c, block->v[i], c->prev));
+            c->prev = block->v[i];
+        }
+        c->incomplete = strider_vecn_subs_u8(c->prev, c->limits);
+    }
+    c->prev = block->v[STRIDER_BLOCK64_VECTORS - 1];
+    return !strider_vecn_is_zero(errors);
+}
+
+/* Offset of the first error, given that the blocks before the one at
+ * start held none: rescan from the character holding the byte before
+ * start, which may be a sequence the block fails to complete */
+static size_t locate_utf8_error(const uint8_t *ptr, size_t size, size_t start) {
+    if (start > 0) {
+        start--;
+        for (int back = 0; back < 3 && start > 0 && (ptr[start] & 0xC0) == 0x80; back++) {
+            start--;
+        }
+    }
+    const size_t offset = strider_validate_utf8((const char *) ptr + start, size - start);
+    return offset == STRIDER_NOT_FOUND ? STRIDER_NOT_FOUND : start + offset;
+}
+
+#else
+
+/**
+ * @brief Validator state of the scalar fallback
+ */
+typedef struct {
+    size_t validated; /* Input before this offset is valid, ending on a character boundary */
+} utf8_checker_t;
+
+static inline void utf8_checker_init(utf8_checker_t *c) {
+    c->validated = 0;
+}
+
+#endif
+
+/* Offset of the first error if the block at start holds one, else STRIDER_NOT_FOUND */
+static inline size_t utf8_check_block(utf8_checker_t *c, const strider_block64_t *block,
+                                      const uint8_t *ptr, size_t size, size_t start) {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    return utf8_vector_check_block(c, block) ? locate_utf8_error(ptr, size, start)
+                                             : STRIDER_NOT_FOUND;
+#else
+    const size_t end = size - start < 64 ? size : start + 64;
+
+    if (c->validated >= end) {
+        return STRIDER_NOT_FOUND; /* Covered by the sequence that ended the last run */
+    }
+    if (block_is_ascii(block)) {
+        c->validated = end;
+        return STRIDER_NOT_FOUND;
+    }
+
+    /* Up to 3 bytes past the block complete a character starting in it */
+    const size_t limit = size - end < 3 ? size : end + 3;
+    const size_t offset =
+        strider_validate_utf8((const char *) ptr + c->validated, limit - c->validated);
+
+    if (offset == STRIDER_NOT_FOUND) {
+        c->validated = limit;
+    } else if (c->validated + offset >= end) {
+        c->validated += offset; /* The character there starts in the next block */
+    } else {
+        return c->validated + offset;
+    }
+    return STRIDER_NOT_FOUND;
+#endif
+}
+
+/* Offset of an error at the end of the input (a sequence left open), else STRIDER_NOT_FOUND */
+static inline size_t utf8_check_end(const utf8_checker_t *c, const uint8_t *ptr, size_t size,
+                                    size_t last_block) {
+#if defined(STRIDER_VECN_HAS_SHUFFLE)
+    return strider_vecn_is_zero(c->incomplete) ? STRIDER_NOT_FOUND
+                                               : locate_utf8_error(ptr, size, last_block);
+#else
+    (void) c;
+    (void) ptr;
+    (void) size;
+    (void) last_block;
+    return STRIDER_NOT_FOUND; /* The last run was validated up to the end of the input */
+#endif
+}
+
+/* ========================================================================
+ * Scan
+ * ======================================================================== */
+
+void STRIDER_KERNEL(scan_text)(const char *data, size_t size, size_t long_line_limit,
+                               strider_text_stats_t *stats) {
+    const uint8_t *ptr = (const uint8_t *) data;
+    const strider_vecn_t lf = strider_vecn_set1('\n');
+    const strider_vecn_t cr = strider_vecn_set1('\r');
+    uint8_t tail[64];
+    utf8_checker_t utf8;
+    bool validating = true;
+    uint64_t prev_cr = 0; /* 1 if the previous block ended in \r */
+    size_t line_start = 0;
+    size_t i = 0;
+
+    strider_text_stats_init(stats);
+    utf8_checker_init(&utf8);
+
+    for (; i < size; i += 64) {
+        const uint8_t *block_ptr = ptr + i;
+
+        if (size - i < 64) {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, ptr + i, size - i);
+            block_ptr = tail;
+        }
+        const strider_block64_t block = strider_block64_load(block_ptr);
+
+        /* Terminators: every \r, and every \n not completing a \r\n */
+        const uint64_t lf_bits = strider_block64_eq(block, lf);
+        const uint64_t cr_bits = strider_block64_eq(block, cr);
+        const uint64_t crlf = lf_bits & ((cr_bits << 1) | prev_cr);
+        const uint64_t ends = cr_bits | (lf_bits & ~crlf);
+        uint64_t events = ends | crlf;
+
+        prev_cr = cr_bits >> 63;
+        stats->newlines += (size_t) strider_popcount64(ends);
+        while (events != 0) {
+            const int bit = strider_ctz64(events);
+            const size_t pos = i + (size_t) bit;
+
+            if ((ends >> bit) & 1) {
+                strider_text_stats_add_line(stats, line_start, pos - line_start,
+                                            long_line_limit);
+            }
+            line_start = pos + 1;
+            events &= events - 1;
+        }
+
+        if (validating) {
+            stats->utf8_error = utf8_check_block(&utf8, &block, ptr, size, i);
+            validating = stats->utf8_error == STRIDER_NOT_FOUND;
+        }
+    }
+
+    /* Input ending inside a sequence (a padded tail already caught it) */
+    if (validating && size > 0) {
+        stats->utf8_error = utf8_check_end(&utf8, ptr, size, i - 64);
+    }
+    if (line_start < size) {
+        strider_text_stats_add_line(stats, line_start, size - line_start, long_line_limit);
+    }
+}
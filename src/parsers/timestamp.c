@@ -0,0 +1,133 @@
+/**
+ * @file timestamp.c
+ * @brief Implementation of timestamp extraction
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "internal/timestamp.h"
+#include "strider/parsers/timestamp.h"
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+/* Two decimal digits at p, or -1 */
+static int parse_2digits(const uint8_t *p) {
+    if (!strider_is_digit(p[0]) || !strider_is_digit(p[1])) {
+        return -1;
+    }
+    return (p[0] - '0') * 10 + (p[1] - '0');
+}
+
+/* "HH:MM:SS" at p */
+static bool parse_clock(const uint8_t *p, strider_civil_time_t *t) {
+    const int hour = parse_2digits(p);
+    const int minute = parse_2digits(p + 3);
+    const int second = parse_2digits(p + 6);
+
+    if (hour < 0 || minute < 0 || second < 0 || p[2] != ':' || p[5] != ':') {
+        return false;
+    }
+    t->hour = (unsigned) hour;
+    t->minute = (unsigned) minute;
+    t->second = (unsigned) second;
+    return true;
+}
+
+static size_t parse_iso8601(const uint8_t *p, size_t size, int64_t *ns) {
+    strider_civil_time_t t;
+
+    if (size < STRIDER_ISO8601_FIXED_LENGTH) {
+        return 0;
+    }
+
+    const int century = parse_2digits(p);
+    const int year = parse_2digits(p + 2);
+    const int month = parse_2digits(p + 5);
+    const int day = parse_2digits(p + 8);
+    if (century < 0 || year < 0 || month < 0 || day < 0 || p[4] != '-' || p[7] != '-' ||
+        (p[10] != 'T' && p[10] != 't' && p[10] != ' ') || !parse_clock(p + 11, &t)) {
+        return 0;
+    }
+    t.year = century * 100 + year;
+    t.month = (unsigned) month;
+    t.day = (unsigned) day;
+
+    return strider_timestamp_finish(p, p + STRIDER_ISO8601_FIXED_LENGTH, p + size, &t, true, ns);
+}
+
+static size_t parse_syslog(const uint8_t *p, size_t size, int year, int64_t *ns) {
+    strider_civil_time_t t;
+
+    if (size < STRIDER_SYSLOG_FIXED_LENGTH) {
+        return 0;
+    }
+
+    /* Days below 10 are space-padded (RFC 3164), but accept "01" too */
+    const unsigned month = strider_syslog_month(p);
+    if (month == 0 || p[3] != ' ' || (p[4] != ' ' && !strider_is_digit(p[4])) ||
+        !strider_is_digit(p[5]) || p[6] != ' ' || !parse_clock(p + 7, &t)) {
+        return 0;
+    }
+    t.year = year;
+    t.month = month;
+    t.day = (p[4] == ' ' ? 0 : (unsigned) (p[4] - '0') * 10) + (unsigned) (p[5] - '0');
+
+    return strider_timestamp_finish(p, p + STRIDER_SYSLOG_FIXED_LENGTH, p + size, &t, false, ns);
+}
+
+size_t strider_parse_timestamp(const char *data, size_t size, strider_timestamp_format_t format,
+                               int year, int64_t *ns) {
+    const uint8_t *p = (const uint8_t *) data;
+
+    switch (format) {
+        case STRIDER_TIMESTAMP_ISO8601:
+            return parse_iso8601(p, size, ns);
+        case STRIDER_TIMESTAMP_SYSLOG:
+            return parse_syslog(p, size, year, ns);
+        case STRIDER_TIMESTAMP_EPOCH:
+            return strider_timestamp_parse_epoch(p, size, ns);
+    }
+    return 0;
+}
+
+size_t strider_parse_timestamps(const char *data, size_t size, const size_t *positions,
+                                size_t count, strider_timestamp_format_t format, int year,
+                                int64_t *timestamps) {
+    size_t start = 0;
+    size_t valid = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        int64_t ns;
+
+        if (strider_parse_timestamp(data + start, positions[i] - start, format, year, &ns) > 0) {
+            timestamps[i] = ns;
+            valid++;
+        } else {
+            timestamps[i] = STRIDER_TIMESTAMP_INVALID;
+        }
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+
+    return valid;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see timestamp_simd.c)
+ * ======================================================================== */
+
+size_t strider_parse_timestamp_simd(const char *data, size_t size,
+                                    strider_timestamp_format_t format, int year, int64_t *ns) {
+    return strider_get_kernels()->parse_timestamp(data, size, format, year, ns);
+}
+
+size_t strider_parse_timestamps_simd(const char *data, size_t size, const size_t *positions,
+                                     size_t count, strider_timestamp_format_t format, int year,
+                                     int64_t *timestamps) {
+    return strider_get_kernels()->parse_timestamps(data, size, positions, count, format, year,
+                                                   timestamps);
+}
@@ -0,0 +1,199 @@
+/**
+ * @file timestamp_simd.c
+ * @brief SIMD timestamp parsing kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * The fixed part of a stamp is checked and converted 16 bytes at a time:
+ *
+ *   1. digits = (v - '0') <= 9, per byte
+ *   2. Replace every digit by '0' and compare the result with a template
+ *      such as "0000-00-00T00:00": one compare checks every digit and
+ *      separator position at once
+ *   3. Zero the non-digits and multiply-add adjacent bytes with weights
+ *      (10, 1), giving two-digit fields in 16-bit lanes. A field that
+ *      straddles a lane pair (e.g. "-MM-") gets weights (0, 10) and
+ *      (1, 0) and is the sum of two lanes.
+ *
+ * The calendar arithmetic, fraction and zone are shared with the scalar
+ * reference (internal/timestamp.h).
+ */
+
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "internal/timestamp.h"
+#include "strider/simd/vector.h"
+#include <stdint.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "timestamp_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * Templates
+ * ======================================================================== */
+
+/* Lane i of a 16-bit lane vector (see strider_vec128_maddubs()) */
+#define LANE(lanes, i) ((unsigned) (lanes)[i])
+
+/* ISO 8601, bytes 0-15: "YYYY-MM-DDTHH:MM"; the date/time separator
+ * (byte 10) has three spellings and is checked on its own */
+static const uint8_t ISO_TEMPLATE[16] = {'0', '0', '0', '0', '-', '0', '0', '-',
+                                         '0', '0', 'T', '0', '0', ':', '0', '0'};
+#define ISO_TEMPLATE_MASK 0xFBFFu
+static const uint8_t ISO_WEIGHTS[16] = {10, 1, 10, 1, 0, 10, 1, 0, 10, 1, 0, 10, 1, 0, 10, 1};
+
+/* ISO 8601, bytes 3-18: only ":SS" (lanes 13-15) is new */
+static const uint8_t ISO_TAIL_TEMPLATE[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, ':', '0', '0'};
+#define ISO_TAIL_TEMPLATE_MASK 0xE000u
+static const uint8_t ISO_TAIL_WEIGHTS[16] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 1};
+
+/* Syslog, bytes 0-15: "Mmm dd HH:MM:SS"; the month name, the optional
+ * space padding of the day (byte 4) and byte 15 are checked separately */
+static const uint8_t SYSLOG_TEMPLATE[16] = {0,   0,   0,   ' ', 0,   '0', ' ', '0',
+                                            '0', ':', '0', '0', ':', '0', '0', 0};
+#define SYSLOG_TEMPLATE_MASK 0x7FE8u
+static const uint8_t SYSLOG_WEIGHTS[16] = {0, 0, 0, 0, 10, 1, 0, 10, 1, 0, 10, 1, 0, 10, 1, 0};
+
+/**
+ * @brief Check 16 bytes against a template and convert their digits
+ *
+ * @param ptr 16 readable bytes
+ * @param layout Template ('0' for digit positions)
+ * @param mask Template positions to check (bit i = byte i)
+ * @param weights Multiply-add weights
+ * @param lanes Output: 16-bit lanes of the multiply-add
+ * @return true if every checked byte matches the template
+ */
+static inline bool match_template(const uint8_t *ptr, const uint8_t *layout, uint32_t mask,
+                                  const uint8_t *weights, uint16_t lanes[8]) {
+    const strider_vec128_t zero_char = strider_vec128_set1('0');
+    strider_vec128_t data = strider_vec128_load_unaligned(ptr);
+    strider_vec128_t values = strider_vec128_sub_u8(data, zero_char);
+    strider_vec128_t digits =
+        strider_vec128_cmpeq(strider_vec128_min_u8(values, strider_vec128_set1(9)), values);
+
+    /* Digits become '0', everything else stays as is */
+    strider_vec128_t shape = strider_vec128_or(strider_vec128_and(digits, zero_char),
+                                               strider_vec128_andnot(data, digits));
+    uint32_t matched =
+        strider_vec128_movemask(strider_vec128_cmpeq(shape, strider_vec128_load_unaligned(layout)));
+    if ((matched & mask) != mask) {
+        return false;
+    }
+
+    strider_vec128_t fields = strider_vec128_maddubs(strider_vec128_and(values, digits),
+                                                     strider_vec128_load_unaligned(weights));
+    strider_vec128_store_unaligned(lanes, fields);
+    return true;
+}
+
+/* ========================================================================
+ * Format Parsers
+ * ======================================================================== */
+
+static size_t parse_iso8601(const uint8_t *p, size_t size, int64_t *ns) {
+    uint16_t head[8];
+    uint16_t tail[8];
+    strider_civil_time_t t;
+
+    /* Both loads stay inside the fixed part */
+    if (size < STRIDER_ISO8601_FIXED_LENGTH || (p[10] != 'T' && p[10] != 't' && p[10] != ' ') ||
+        !match_template(p, ISO_TEMPLATE, ISO_TEMPLATE_MASK, ISO_WEIGHTS, head) ||
+        !match_template(p + 3, ISO_TAIL_TEMPLATE, ISO_TAIL_TEMPLATE_MASK, ISO_TAIL_WEIGHTS,
+                        tail)) {
+        return 0;
+    }
+
+    t.year = LANE(head, 0) * 100 + LANE(head, 1);
+    t.month = LANE(head, 2) + LANE(head, 3);
+    t.day = LANE(head, 4);
+    t.hour = LANE(head, 5) + LANE(head, 6);
+    t.minute = LANE(head, 7);
+    t.second = LANE(tail, 7);
+
+    return strider_timestamp_finish(p, p + STRIDER_ISO8601_FIXED_LENGTH, p + size, &t, true, ns);
+}
+
+/**
+ * @param readable Bytes readable at p (>= size); the load covers one
+ *                 byte more than the fixed part
+ */
+static size_t parse_syslog(const uint8_t *p, size_t size, size_t readable, int year,
+                           int64_t *ns) {
+    uint16_t lanes[8];
+    strider_civil_time_t t;
+
+    if (size < STRIDER_SYSLOG_FIXED_LENGTH) {
+        return 0;
+    }
+    if (readable < 16) {
+        return strider_parse_timestamp((const char *) p, size, STRIDER_TIMESTAMP_SYSLOG, year, ns);
+    }
+
+    /* A space-padded day has a zero tens digit after masking */
+    const unsigned month = strider_syslog_month(p);
+    if (month == 0 || (p[4] != ' ' && !strider_is_digit(p[4])) ||
+        !match_template(p, SYSLOG_TEMPLATE, SYSLOG_TEMPLATE_MASK, SYSLOG_WEIGHTS, lanes)) {
+        return 0;
+    }
+
+    t.year = year;
+    t.month = month;
+    t.day = LANE(lanes, 2);
+    t.hour = LANE(lanes, 3) + LANE(lanes, 4);
+    t.minute = LANE(lanes, 5);
+    t.second = LANE(lanes, 6) + LANE(lanes, 7);
+
+    return strider_timestamp_finish(p, p + STRIDER_SYSLOG_FIXED_LENGTH, p + size, &t, false, ns);
+}
+
+static inline size_t parse_one(const uint8_t *p, size_t size, size_t readable,
+                               strider_timestamp_format_t format, int year, int64_t *ns) {
+    switch (format) {
+        case STRIDER_TIMESTAMP_ISO8601:
+            return parse_iso8601(p, size, ns);
+        case STRIDER_TIMESTAMP_SYSLOG:
+            return parse_syslog(p, size, readable, year, ns);
+        case STRIDER_TIMESTAMP_EPOCH:
+            return strider_timestamp_parse_epoch(p, size, ns);
+    }
+    return 0;
+}
+
+/* ========================================================================
+ * Kernels
+ * ======================================================================== */
+
+size_t STRIDER_KERNEL(parse_timestamp)(const char *data, size_t size,
+                                       strider_timestamp_format_t format, int year, int64_t *ns) {
+    return parse_one((const uint8_t *) data, size, size, format, year, ns);
+}
+
+/* Loads may run past the end of a line (never past the buffer); the
+ * templates only accept bytes inside the fixed part of the stamp */
+size_t STRIDER_KERNEL(parse_timestamps)(const char *data, size_t size, const size_t *positions,
+                                        size_t count, strider_timestamp_format_t format, int year,
+                                        int64_t *timestamps) {
+    const uint8_t *base = (const uint8_t *) data;
+    size_t start = 0;
+    size_t valid = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        int64_t ns;
+
+        if (parse_one(base + start, positions[i] - start, size - start, format, year, &ns) > 0) {
+            timestamps[i] = ns;
+            valid++;
+        } else {
+            timestamps[i] = STRIDER_TIMESTAMP_INVALID;
+        }
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+
+    return valid;
+}
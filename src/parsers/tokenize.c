@@ -0,0 +1,175 @@
+/**
+ * @file tokenize.c
+ * @brief Implementation of field tokenization
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "internal/tokenize.h"
+#include "strider/parsers/tokenize.h"
+
+/* ========================================================================
+ * Tokenizer Settings
+ * ======================================================================== */
+
+int strider_tokenizer_init(strider_tokenizer_t *tok, const char *separators, size_t count,
+                           int quote, int escape, bool merge_separators) {
+    if (!tok || !separators || count == 0 || quote < -1 || quote > 255 || escape < -1 ||
+        escape > 255 || (quote >= 0 && quote == escape)) {
+        return -1;
+    }
+    if (strider_byteset_init(&tok->separators, separators, count) != 0) {
+        return -1;
+    }
+    if ((quote >= 0 && strider_byteset_contains(&tok->separators, (uint8_t) quote)) ||
+        (escape >= 0 && strider_byteset_contains(&tok->separators, (uint8_t) escape))) {
+        return -1;
+    }
+
+    tok->quote = quote >= 0 ? (uint8_t) quote : 0;
+    tok->escape = escape >= 0 ? (uint8_t) escape : 0;
+    tok->has_quote = quote >= 0;
+    tok->has_escape = escape >= 0;
+    tok->merge_separators = merge_separators;
+    return 0;
+}
+
+int strider_tokenizer_init_format(strider_tokenizer_t *tok, strider_tokenize_format_t format) {
+    switch (format) {
+        case STRIDER_TOKENIZE_WHITESPACE:
+            return strider_tokenizer_init(tok, " \t", 2, '"', '\\', true);
+        case STRIDER_TOKENIZE_CSV:
+            return strider_tokenizer_init(tok, ",", 1, '"', -1, false);
+        case STRIDER_TOKENIZE_LOGFMT:
+            return strider_tokenizer_init(tok, " \t=", 3, '"', '\\', true);
+        case STRIDER_TOKENIZE_JSON:
+            return strider_tokenizer_init(tok, " \t{}[],:", 9, '"', '\\', true);
+    }
+    return -1;
+}
+
+strider_buffer_view_t strider_field_unquote(const strider_tokenizer_t *tok,
+                                            strider_buffer_view_t field) {
+    if (tok->has_quote && field.size >= 2 && field.data[0] == tok->quote &&
+        field.data[field.size - 1] == tok->quote) {
+        return strider_buffer_view_create(field.data + 1, field.size - 2);
+    }
+    return field;
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation
+ * ======================================================================== */
+
+/**
+ * @brief Split one line
+ *
+ * @return false if the fields did not fit (the last one written then
+ *         extends to the end of the line)
+ */
+static bool tokenize_line(const strider_tokenizer_t *tok, const uint8_t *p, size_t size,
+                          strider_field_writer_t *w) {
+    bool quoted = false;
+    bool escaped = false;
+    bool open = !tok->merge_separators;
+    size_t start = 0;
+
+    if (size == 0) {
+        return true;
+    }
+    if (w->capacity == 0) {
+        return false;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        const uint8_t c = p[i];
+        bool separator = false;
+
+        if (escaped) {
+            escaped = false;
+        } else if (tok->has_escape && c == tok->escape) {
+            escaped = true;
+        } else if (tok->has_quote && c == tok->quote) {
+            quoted = !quoted;
+        } else {
+            separator = !quoted && strider_byteset_contains(&tok->separators, c);
+        }
+
+        if (tok->merge_separators) {
+            if (separator && open) {
+                strider_field_emit(w, start, i - start);
+                open = false;
+            } else if (!separator && !open) {
+                if (w->count == w->capacity) {
+                    strider_field_extend(w, size);
+                    return false;
+                }
+                start = i;
+                open = true;
+            }
+        } else if (separator) {
+            if (w->count + 1 == w->capacity) {
+                strider_field_emit(w, start, size - start);
+                return false;
+            }
+            strider_field_emit(w, start, i - start);
+            start = i + 1;
+        }
+    }
+
+    if (open) {
+        strider_field_emit(w, start, size - start);
+    }
+    return true;
+}
+
+size_t strider_tokenize(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                        strider_buffer_view_t *fields, size_t max_fields) {
+    strider_field_writer_t w = {NULL, fields, line.data, max_fields, 0};
+
+    tokenize_line(tok, line.data, line.size, &w);
+    return w.count;
+}
+
+size_t strider_tokenize_lines(const strider_tokenizer_t *tok, const char *data, size_t size,
+                              const size_t *positions, size_t count, strider_field_span_t *spans,
+                              size_t max_spans, size_t *field_index) {
+    const uint8_t *base = (const uint8_t *) data;
+    size_t start = 0;
+    size_t written = 0;
+    size_t i = 0;
+
+    field_index[0] = 0;
+    for (; i < count; i++) {
+        strider_field_writer_t w = {spans + written, NULL, NULL, max_spans - written, 0};
+
+        if (!tokenize_line(tok, base + start, positions[i] - start, &w)) {
+            break;
+        }
+        written += w.count;
+        field_index[i + 1] = written;
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+
+    return i;
+}
+
+/* ========================================================================
+ * SIMD Implementation (runtime dispatched, see tokenize_simd.c)
+ * ======================================================================== */
+
+size_t strider_tokenize_simd(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                             strider_buffer_view_t *fields, size_t max_fields) {
+    return strider_get_kernels()->tokenize(tok, line, fields, max_fields);
+}
+
+size_t strider_tokenize_lines_simd(const strider_tokenizer_t *tok, const char *data, size_t size,
+                                   const size_t *positions, size_t count,
+                                   strider_field_span_t *spans, size_t max_spans,
+                                   size_t *field_index) {
+    return strider_get_kernels()->tokenize_lines(tok, data, size, positions, count, spans,
+                                                 max_spans, field_index);
+}
@@ -0,0 +1,211 @@
+/**
+ * @file tokenize_simd.c
+ * @brief SIMD field tokenization kernels
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compiled once per ISA (see STRIDER_KERNEL_ISAS in CMakeLists.txt);
+ * the active variant is selected at runtime by src/dispatch.c.
+ *
+ * Each line is scanned in 64-byte blocks, in two stages:
+ *
+ *   1. Structural masks: separators (nibble lookup, see
+ *      internal/byteset.h), escape and quote characters. Escaped bytes
+ *      are found with the odd/even run trick, and the prefix XOR of the
+ *      unescaped quotes masks out quoted separators. Escape and quote
+ *      state carry into the next block.
+ *   2. Spans: every remaining separator bit ends a field. With merged
+ *      separators, fields start and end where the separator mask
+ *      changes, i.e. at the set bits of tokens ^ (tokens << 1).
+ */
+
+#include "internal/byteset.h"
+#include "internal/dispatch.h"
+#include "internal/lines.h"
+#include "internal/tokenize.h"
+#include <string.h>
+
+#if !defined(STRIDER_KERNEL_ISA)
+#    error "tokenize_simd.c must be compiled with STRIDER_KERNEL_ISA defined"
+#endif
+
+/* ========================================================================
+ * Stage 1: Structural Masks
+ * ======================================================================== */
+
+/**
+ * @brief Tokenizer expanded into registers for one call
+ */
+typedef struct {
+    strider_byteset_matcher_t separators;
+    strider_vecn_t quote;
+    strider_vecn_t escape;
+    const strider_tokenizer_t *tok;
+} tokenizer_matcher_t;
+
+/**
+ * @brief Scan state carried from one block of a line to the next
+ */
+typedef struct {
+    uint64_t escaped;  /**< 1 if the next block starts with an escaped byte */
+    uint64_t quoted;   /**< All ones if the next block starts inside quotes */
+    uint64_t in_token; /**< 1 if the last byte was not a separator */
+} scan_state_t;
+
+/* Unquoted, unescaped separators of the 64 bytes at ptr */
+static inline uint64_t separator_mask(const tokenizer_matcher_t *m, const uint8_t *ptr,
+                                      scan_state_t *state) {
+    strider_block64_t block = strider_block64_load(ptr);
+    uint64_t separators = 0;
+    uint64_t escaped = 0;
+
+    for (int i = 0; i < STRIDER_BLOCK64_VECTORS; i++) {
+        separators |= (uint64_t) strider_byteset_match_vector(block.v[i], &m->separators)
+                      << (i * STRIDER_VECN_SIZE);
+    }
+    if (m->tok->has_escape) {
+        escaped = strider_escaped_mask64(strider_block64_eq(block, m->escape), &state->escaped);
+    }
+    if (m->tok->has_quote) {
+        const uint64_t quotes = strider_block64_eq(block, m->quote) & ~escaped;
+        const uint64_t quoted = strider_prefix_xor64(quotes) ^ state->quoted;
+
+        state->quoted = (uint64_t) -(int64_t) (quoted >> 63);
+        separators &= ~quoted;
+    }
+    return separators & ~escaped;
+}
+
+/* ========================================================================
+ * Stage 2: Field Spans
+ * ======================================================================== */
+
+/**
+ * @brief Split one line
+ *
+ * @param readable Bytes readable at p (>= size); blocks closer than 64
+ *                 bytes to the end of the buffer are copied
+ * @return false if the fields did not fit (the last one written then
+ *         extends to the end of the line)
+ */
+static inline bool tokenize_line(const tokenizer_matcher_t *m, const uint8_t *p, size_t size,
+                                 size_t readable, strider_field_writer_t *w) {
+    const bool merge = m->tok->merge_separators;
+    scan_state_t state = {0, 0, 0};
+    bool open = !merge;
+    size_t start = 0;
+
+    if (size == 0) {
+        return true;
+    }
+    if (w->capacity == 0) {
+        return false;
+    }
+
+    for (size_t base = 0; base < size; base += 64) {
+        const uint8_t *block = p + base;
+        uint8_t copy[64];
+
+        if (readable - base < 64) {
+            memset(copy, 0, sizeof(copy));
+            memcpy(copy, block, size - base);
+            block = copy;
+        }
+
+        const uint64_t valid = strider_mask64_low(size - base);
+        uint64_t separators = separator_mask(m, block, &state) & valid;
+
+        if (merge) {
+            const uint64_t tokens = ~separators & valid;
+            uint64_t edges = (tokens ^ ((tokens << 1) | state.in_token)) & valid;
+
+            state.in_token = tokens >> 63;
+            while (edges) {
+                const size_t pos = base + (size_t) strider_ctz64(edges);
+                edges &= edges - 1;
+                if (open) {
+                    strider_field_emit(w, start, pos - start);
+                    open = false;
+                } else {
+                    if (w->count == w->capacity) {
+                        strider_field_extend(w, size);
+                        return false;
+                    }
+                    start = pos;
+                    open = true;
+                }
+            }
+        } else {
+            while (separators) {
+                const size_t pos = base + (size_t) strider_ctz64(separators);
+                separators &= separators - 1;
+                if (w->count + 1 == w->capacity) {
+                    strider_field_emit(w, start, size - start);
+                    return false;
+                }
+                strider_field_emit(w, start, pos - start);
+                start = pos + 1;
+            }
+        }
+    }
+
+    if (open) {
+        strider_field_emit(w, start, size - start);
+    }
+    return true;
+}
+
+/* ========================================================================
+ * Kernels
+ * ======================================================================== */
+
+/* Returns false if the separators cannot be matched with vectors on this ISA */
+static bool matcher_init(tokenizer_matcher_t *m, const strider_tokenizer_t *tok) {
+    m->quote = strider_vecn_set1(tok->quote);
+    m->escape = strider_vecn_set1(tok->escape);
+    m->tok = tok;
+    return strider_byteset_matcher_init(&m->separators, &tok->separators);
+}
+
+size_t STRIDER_KERNEL(tokenize)(const strider_tokenizer_t *tok, strider_buffer_view_t line,
+                                strider_buffer_view_t *fields, size_t max_fields) {
+    strider_field_writer_t w = {NULL, fields, line.data, max_fields, 0};
+    tokenizer_matcher_t matcher;
+
+    if (!matcher_init(&matcher, tok)) {
+        return strider_tokenize(tok, line, fields, max_fields);
+    }
+    tokenize_line(&matcher, line.data, line.size, line.size, &w);
+    return w.count;
+}
+
+size_t STRIDER_KERNEL(tokenize_lines)(const strider_tokenizer_t *tok, const char *data,
+                                      size_t size, const size_t *positions, size_t count,
+                                      strider_field_span_t *spans, size_t max_spans,
+                                      size_t *field_index) {
+    const uint8_t *base = (const uint8_t *) data;
+    tokenizer_matcher_t matcher;
+    size_t start = 0;
+    size_t written = 0;
+    size_t i = 0;
+
+    if (!matcher_init(&matcher, tok)) {
+        return strider_tokenize_lines(tok, data, size, positions, count, spans, max_spans,
+                                      field_index);
+    }
+
+    field_index[0] = 0;
+    for (; i < count; i++) {
+        strider_field_writer_t w = {spans + written, NULL, NULL, max_spans - written, 0};
+
+        if (!tokenize_line(&matcher, base + start, positions[i] - start, size - start, &w)) {
+            break;
+        }
+        written += w.count;
+        field_index[i + 1] = written;
+        start = strider_next_line_start(data, size, positions[i]);
+    }
+
+    return i;
+}
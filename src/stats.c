@@ -0,0 +1,270 @@
+/**
+ * @file stats.c
+ * @brief Per-kernel statistics implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Every thread that records gets a counter block of its own, registered
+ * in a global list. Only the owning thread writes a block (relaxed
+ * load + store, no read-modify-write), readers sum all blocks. A block
+ * released by an exiting thread keeps its counts and is handed to the
+ * next new thread, so the list is bounded by the peak thread count.
+ * Resetting records a baseline instead of clearing blocks other threads
+ * are writing.
+ */
+
+#include "internal/format.h"
+#include "internal/stats.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(STRIDER_ENABLE_STATS)
+#    if defined(_WIN32)
+#        include <windows.h>
+#    else
+#        include <pthread.h>
+#    endif
+#    if !defined(__STDC_NO_ATOMICS__)
+#        include <stdatomic.h>
+#    endif
+#endif
+
+static const char *const kernel_names[STRIDER_STATS_KERNEL_COUNT] = {
+    "count_newlines", "find_newline_positions", "pack_newline_positions", "strchr",
+    "memchr",         "byteset",                "strstr",                 "multi_pattern",
+};
+
+/* ========================================================================
+ * Counter Blocks
+ * ======================================================================== */
+
+#if defined(STRIDER_ENABLE_STATS)
+
+#    if !defined(__STDC_NO_ATOMICS__)
+typedef atomic_uint_least64_t counter_t;
+#        define COUNTER_LOAD(c) ((uint64_t) atomic_load_explicit(&(c), memory_order_relaxed))
+#        define COUNTER_STORE(c, v) atomic_store_explicit(&(c), (v), memory_order_relaxed)
+#    else
+typedef volatile uint64_t counter_t;
+#        define COUNTER_LOAD(c) ((uint64_t) (c))
+#        define COUNTER_STORE(c, v) ((c) = (v))
+#    endif
+
+enum { COUNTER_CALLS, COUNTER_SIMD, COUNTER_SCALAR, COUNTER_KINDS };
+
+typedef struct stats_block {
+    struct stats_block *next;
+    bool in_use; /* Owned by a live thread (guarded by the registry lock) */
+    counter_t counters[STRIDER_STATS_KERNEL_COUNT][COUNTER_KINDS];
+} stats_block_t;
+
+/* Registry, guarded by the lock below; blocks are never freed */
+static stats_block_t *all_blocks;
+static uint64_t baseline[STRIDER_STATS_KERNEL_COUNT][COUNTER_KINDS];
+
+#    if defined(_WIN32)
+static SRWLOCK registry_lock = SRWLOCK_INIT;
+#        define REGISTRY_LOCK() AcquireSRWLockExclusive(&registry_lock)
+#        define REGISTRY_UNLOCK() ReleaseSRWLockExclusive(&registry_lock)
+#    else
+static pthread_mutex_t registry_lock = PTHREAD_MUTEX_INITIALIZER;
+#        define REGISTRY_LOCK() pthread_mutex_lock(&registry_lock)
+#        define REGISTRY_UNLOCK() pthread_mutex_unlock(&registry_lock)
+#    endif
+
+/* A released block, or a new one added to the registry */
+static stats_block_t *block_acquire(void) {
+    stats_block_t *block;
+
+    REGISTRY_LOCK();
+    for (block = all_blocks; block; block = block->next) {
+        if (!block->in_use) {
+            break;
+        }
+    }
+    if (!block) {
+        block = (stats_block_t *) calloc(1, sizeof(*block));
+        if (block) {
+            block->next = all_blocks;
+            all_blocks = block;
+        }
+    }
+    if (block) {
+        block->in_use = true;
+    }
+    REGISTRY_UNLOCK();
+    return block;
+}
+
+static void block_release(void *ptr) {
+    REGISTRY_LOCK();
+    ((stats_block_t *) ptr)->in_use = false;
+    REGISTRY_UNLOCK();
+}
+
+/* Counters summed over all blocks; the caller holds the registry lock */
+static void sum_blocks(uint64_t totals[STRIDER_STATS_KERNEL_COUNT][COUNTER_KINDS]) {
+    memset(totals, 0, sizeof(uint64_t) * STRIDER_STATS_KERNEL_COUNT * COUNTER_KINDS);
+    for (stats_block_t *block = all_blocks; block; block = block->next) {
+        for (int k = 0; k < STRIDER_STATS_KERNEL_COUNT; k++) {
+            for (int c = 0; c < COUNTER_KINDS; c++) {
+                totals[k][c] += COUNTER_LOAD(block->counters[k][c]);
+            }
+        }
+    }
+}
+
+/* ========================================================================
+ * Thread-Local Block
+ * ======================================================================== */
+
+#    if defined(_WIN32)
+
+static DWORD thread_block_slot = FLS_OUT_OF_INDEXES;
+static INIT_ONCE thread_block_once = INIT_ONCE_STATIC_INIT;
+
+static void WINAPI thread_block_release(void *ptr) {
+    if (ptr) {
+        block_release(ptr);
+    }
+}
+
+static BOOL CALLBACK thread_block_init(PINIT_ONCE once, void *param, void **context) {
+    (void) once;
+    (void) param;
+    (void) context;
+    thread_block_slot = FlsAlloc(thread_block_release);
+    return TRUE;
+}
+
+static stats_block_t *thread_block(void) {
+    stats_block_t *block;
+
+    InitOnceExecuteOnce(&thread_block_once, thread_block_init, NULL, NULL);
+    if (thread_block_slot == FLS_OUT_OF_INDEXES) {
+        return NULL;
+    }
+    block = (stats_block_t *) FlsGetValue(thread_block_slot);
+    if (!block) {
+        block = block_acquire();
+        if (block && !FlsSetValue(thread_block_slot, block)) {
+            block_release(block);
+            block = NULL;
+        }
+    }
+    return block;
+}
+
+#    else
+
+static pthread_key_t thread_block_key;
+static pthread_once_t thread_block_once = PTHREAD_ONCE_INIT;
+static bool thread_block_ready;
+
+static void thread_block_init(void) {
+    thread_block_ready = pthread_key_create(&thread_block_key, block_release) == 0;
+}
+
+static stats_block_t *thread_block(void) {
+    stats_block_t *block;
+
+    pthread_once(&thread_block_once, thread_block_init);
+    if (!thread_block_ready) {
+        return NULL;
+    }
+    block = (stats_block_t *) pthread_getspecific(thread_block_key);
+    if (!block) {
+        block = block_acquire();
+        if (block && pthread_setspecific(thread_block_key, block) != 0) {
+            block_release(block);
+            block = NULL;
+        }
+    }
+    return block;
+}
+
+#    endif
+
+void strider_stats_record(strider_stats_kernel_t kernel, size_t simd_bytes, size_t scalar_bytes) {
+    stats_block_t *block = thread_block();
+
+    if (!block) {
+        return;
+    }
+    counter_t *counters = block->counters[kernel];
+    COUNTER_STORE(counters[COUNTER_CALLS], COUNTER_LOAD(counters[COUNTER_CALLS]) + 1);
+    COUNTER_STORE(counters[COUNTER_SIMD], COUNTER_LOAD(counters[COUNTER_SIMD]) + simd_bytes);
+    COUNTER_STORE(counters[COUNTER_SCALAR], COUNTER_LOAD(counters[COUNTER_SCALAR]) + scalar_bytes);
+}
+
+#endif /* STRIDER_ENABLE_STATS */
+
+/* ========================================================================
+ * Public API
+ * ======================================================================== */
+
+void strider_get_stats(strider_stats_t *stats) {
+    if (!stats) {
+        return;
+    }
+    memset(stats, 0, sizeof(*stats));
+    stats->backend = strider_get_backend();
+
+#if defined(STRIDER_ENABLE_STATS)
+    uint64_t totals[STRIDER_STATS_KERNEL_COUNT][COUNTER_KINDS];
+
+    stats->enabled = true;
+    REGISTRY_LOCK();
+    sum_blocks(totals);
+    for (int k = 0; k < STRIDER_STATS_KERNEL_COUNT; k++) {
+        strider_kernel_stats_t *out = &stats->kernels[k];
+
+        out->calls = totals[k][COUNTER_CALLS] - baseline[k][COUNTER_CALLS];
+        out->simd_bytes = totals[k][COUNTER_SIMD] - baseline[k][COUNTER_SIMD];
+        out->scalar_bytes = totals[k][COUNTER_SCALAR] - baseline[k][COUNTER_SCALAR];
+        out->bytes = out->simd_bytes + out->scalar_bytes;
+    }
+    REGISTRY_UNLOCK();
+#endif
+}
+
+void strider_reset_stats(void) {
+#if defined(STRIDER_ENABLE_STATS)
+    REGISTRY_LOCK();
+    sum_blocks(baseline);
+    REGISTRY_UNLOCK();
+#endif
+}
+
+const char *strider_stats_kernel_name(strider_stats_kernel_t kernel) {
+    if ((int) kernel < 0 || kernel >= STRIDER_STATS_KERNEL_COUNT) {
+        return NULL;
+    }
+    return kernel_names[kernel];
+}
+
+int strider_describe_stats(const strider_stats_t *stats, char *buffer, size_t buffer_size) {
+    if (!stats || !buffer || buffer_size == 0) {
+        return -1;
+    }
+
+    int written = strider_appendf(buffer, buffer_size, 0, "Backend: %s%s\n",
+                                  strider_backend_name(stats->backend),
+                                  stats->enabled ? "" : " (statistics disabled)");
+
+    for (int k = 0; k < STRIDER_STATS_KERNEL_COUNT; k++) {
+        const strider_kernel_stats_t *kernel = &stats->kernels[k];
+
+        if (kernel->calls == 0) {
+            continue;
+        }
+        written = strider_appendf(buffer, buffer_size, written,
+                                  "%s: %llu calls, %llu bytes (%llu simd, %llu scalar)\n",
+                                  kernel_names[k], (unsigned long long) kernel->calls,
+                                  (unsigned long long) kernel->bytes,
+                                  (unsigned long long) kernel->simd_bytes,
+                                  (unsigned long long) kernel->scalar_bytes);
+    }
+    return written;
+}
@@ -0,0 +1,306 @@
+/**
+ * @file arena.c
+ * @brief Bump allocator implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Blocks form a singly linked list in allocation order. After a reset
+ * (or rewind) allocation walks the list again, skipping blocks too
+ * small for a request, and only appends a new block at the tail.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* MAP_ANONYMOUS, MADV_HUGEPAGE */
+#endif
+
+#include "strider/utils/arena.h"
+#include "strider/utils/memory.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <pthread.h>
+#    include <sys/mman.h>
+#endif
+
+/* Block headers are padded so data starts on a cache line */
+#define BLOCK_HEADER_SIZE 64
+
+/* Huge page size assumed when rounding mapped blocks */
+#define HUGE_PAGE_SIZE ((size_t) 2 << 20)
+
+struct strider_arena_block {
+    strider_arena_block_t *next;
+    size_t size;   /* Usable bytes after the header */
+    size_t mapped; /* Length of the mapping, 0 if from the heap */
+};
+
+static inline uint8_t *block_data(strider_arena_block_t *block) {
+    return (uint8_t *) block + BLOCK_HEADER_SIZE;
+}
+
+/* ========================================================================
+ * Blocks
+ * ======================================================================== */
+
+static strider_arena_block_t *block_create(size_t size, unsigned flags) {
+    strider_arena_block_t *block = NULL;
+    size_t mapped = 0;
+
+    if (size > SIZE_MAX - BLOCK_HEADER_SIZE - HUGE_PAGE_SIZE) {
+        return NULL;
+    }
+    size += BLOCK_HEADER_SIZE;
+
+#if defined(MADV_HUGEPAGE) && defined(MAP_ANONYMOUS)
+    if (flags & STRIDER_ARENA_HUGE_PAGES) {
+        const size_t length = (size + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        void *ptr = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (ptr != MAP_FAILED) {
+            (void) madvise(ptr, length, MADV_HUGEPAGE);
+            block = (strider_arena_block_t *) ptr;
+            mapped = length;
+            size = length;
+        }
+    }
+#else
+    (void) flags;
+#endif
+
+    if (!block) {
+        block = (strider_arena_block_t *) strider_aligned_alloc(BLOCK_HEADER_SIZE, size);
+        if (!block) {
+            return NULL;
+        }
+    }
+    block->next = NULL;
+    block->size = size - BLOCK_HEADER_SIZE;
+    block->mapped = mapped;
+    return block;
+}
+
+static void block_destroy(strider_arena_block_t *block) {
+#if defined(MADV_HUGEPAGE) && defined(MAP_ANONYMOUS)
+    if (block->mapped) {
+        munmap(block, block->mapped);
+        return;
+    }
+#endif
+    strider_aligned_free(block);
+}
+
+/* Offset of an aligned allocation of size bytes in block, or SIZE_MAX */
+static inline size_t block_fit(strider_arena_block_t *block, size_t offset, size_t size,
+                               size_t alignment) {
+    const uintptr_t base = (uintptr_t) block_data(block);
+    const size_t start =
+        (size_t) (((base + offset + alignment - 1) & ~(uintptr_t) (alignment - 1)) - base);
+
+    if (start > block->size || size > block->size - start) {
+        return SIZE_MAX;
+    }
+    return start;
+}
+
+/* ========================================================================
+ * Arena
+ * ======================================================================== */
+
+int strider_arena_init(strider_arena_t *arena, size_t block_size, unsigned flags) {
+    if (!arena || (flags & ~STRIDER_ARENA_HUGE_PAGES)) {
+        return -1;
+    }
+    arena->first = NULL;
+    arena->current = NULL;
+    arena->offset = 0;
+    arena->block_size = block_size ? block_size : STRIDER_ARENA_DEFAULT_BLOCK_SIZE;
+    arena->flags = flags;
+    return 0;
+}
+
+void strider_arena_destroy(strider_arena_t *arena) {
+    if (!arena) {
+        return;
+    }
+    while (arena->first) {
+        strider_arena_block_t *next = arena->first->next;
+        block_destroy(arena->first);
+        arena->first = next;
+    }
+    arena->current = NULL;
+    arena->offset = 0;
+}
+
+void *strider_arena_alloc(strider_arena_t *arena, size_t size, size_t alignment) {
+    if (!arena || alignment == 0 || (alignment & (alignment - 1)) ||
+        alignment > STRIDER_ARENA_MAX_ALIGNMENT) {
+        return NULL;
+    }
+
+    /* Reuse the blocks after the current one before growing */
+    if (!arena->current) {
+        arena->current = arena->first;
+        arena->offset = 0;
+    }
+    for (strider_arena_block_t *block = arena->current; block; block = block->next) {
+        const size_t start = block_fit(block, block == arena->current ? arena->offset : 0, size,
+                                       alignment);
+        if (start != SIZE_MAX) {
+            arena->current = block;
+            arena->offset = start + size;
+            return block_data(block) + start;
+        }
+    }
+
+    if (size > SIZE_MAX - alignment) {
+        return NULL;
+    }
+    const size_t need = size + alignment - 1;
+    strider_arena_block_t *block =
+        block_create(need > arena->block_size ? need : arena->block_size, arena->flags);
+    if (!block) {
+        return NULL;
+    }
+
+    if (!arena->first) {
+        arena->first = block;
+    } else {
+        strider_arena_block_t *tail = arena->current;
+        while (tail->next) {
+            tail = tail->next;
+        }
+        tail->next = block;
+    }
+
+    const size_t start = block_fit(block, 0, size, alignment);
+    arena->current = block;
+    arena->offset = start + size;
+    return block_data(block) + start;
+}
+
+void *strider_arena_alloc_array(strider_arena_t *arena, size_t count, size_t size) {
+    if (size != 0 && count > SIZE_MAX / size) {
+        return NULL;
+    }
+    return strider_arena_alloc(arena, count * size, sizeof(max_align_t));
+}
+
+void strider_arena_reset(strider_arena_t *arena) {
+    if (!arena) {
+        return;
+    }
+    arena->current = arena->first;
+    arena->offset = 0;
+}
+
+strider_arena_mark_t strider_arena_mark(const strider_arena_t *arena) {
+    strider_arena_mark_t mark = {arena->current, arena->offset};
+    return mark;
+}
+
+void strider_arena_rewind(strider_arena_t *arena, strider_arena_mark_t mark) {
+    if (!mark.block) {
+        strider_arena_reset(arena);
+        return;
+    }
+    arena->current = mark.block;
+    arena->offset = mark.offset;
+}
+
+size_t strider_arena_capacity(const strider_arena_t *arena) {
+    size_t total = 0;
+
+    for (const strider_arena_block_t *block = arena->first; block; block = block->next) {
+        total += block->size;
+    }
+    return total;
+}
+
+/* ========================================================================
+ * Thread-Local Arena
+ * ======================================================================== */
+
+static strider_arena_t *thread_arena_create(void) {
+    strider_arena_t *arena = (strider_arena_t *) malloc(sizeof(*arena));
+
+    if (arena) {
+        strider_arena_init(arena, 0, 0);
+    }
+    return arena;
+}
+
+static void thread_arena_free(void *ptr) {
+    strider_arena_destroy((strider_arena_t *) ptr);
+    free(ptr);
+}
+
+#if defined(_WIN32)
+
+static DWORD thread_arena_slot = FLS_OUT_OF_INDEXES;
+static INIT_ONCE thread_arena_once = INIT_ONCE_STATIC_INIT;
+
+static void WINAPI thread_arena_release(void *ptr) {
+    if (ptr) {
+        thread_arena_free(ptr);
+    }
+}
+
+static BOOL CALLBACK thread_arena_init(PINIT_ONCE once, void *param, void **context) {
+    (void) once;
+    (void) param;
+    (void) context;
+    thread_arena_slot = FlsAlloc(thread_arena_release);
+    return TRUE;
+}
+
+strider_arena_t *strider_thread_arena(void) {
+    strider_arena_t *arena;
+
+    InitOnceExecuteOnce(&thread_arena_once, thread_arena_init, NULL, NULL);
+    if (thread_arena_slot == FLS_OUT_OF_INDEXES) {
+        return NULL;
+    }
+    arena = (strider_arena_t *) FlsGetValue(thread_arena_slot);
+    if (!arena) {
+        arena = thread_arena_create();
+        if (arena && !FlsSetValue(thread_arena_slot, arena)) {
+            thread_arena_free(arena);
+            arena = NULL;
+        }
+    }
+    return arena;
+}
+
+#else
+
+static pthread_key_t thread_arena_key;
+static pthread_once_t thread_arena_once = PTHREAD_ONCE_INIT;
+static bool thread_arena_ready;
+
+static void thread_arena_init(void) {
+    thread_arena_ready = pthread_key_create(&thread_arena_key, thread_arena_free) == 0;
+}
+
+strider_arena_t *strider_thread_arena(void) {
+    strider_arena_t *arena;
+
+    pthread_once(&thread_arena_once, thread_arena_init);
+    if (!thread_arena_ready) {
+        return NULL;
+    }
+    arena = (strider_arena_t *) pthread_getspecific(thread_arena_key);
+    if (!arena) {
+        arena = thread_arena_create();
+        if (arena && pthread_setspecific(thread_arena_key, arena) != 0) {
+            thread_arena_free(arena);
+            arena = NULL;
+        }
+    }
+    return arena;
+}
+
+#endif
@@ -0,0 +1,234 @@
+/**
+ * @file thread_pool.c
+ * @brief Built-in thread pool implementation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Workers sleep on a condition variable until a batch is posted, then
+ * claim task indices under the pool lock. Tasks are expected to be
+ * coarse (a segment of a large buffer), so a lock per claim is cheap
+ * next to the work itself.
+ */
+
+#include "strider/utils/thread_pool.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+typedef SRWLOCK pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+typedef HANDLE pool_thread_t;
+#    define pool_mutex_init(m) (InitializeSRWLock(m), 0)
+#    define pool_mutex_destroy(m) ((void) (m))
+#    define pool_mutex_lock(m) AcquireSRWLockExclusive(m)
+#    define pool_mutex_unlock(m) ReleaseSRWLockExclusive(m)
+#    define pool_cond_init(c) (InitializeConditionVariable(c), 0)
+#    define pool_cond_destroy(c) ((void) (c))
+#    define pool_cond_wait(c, m) SleepConditionVariableSRW((c), (m), INFINITE, 0)
+#    define pool_cond_broadcast(c) WakeAllConditionVariable(c)
+#    define pool_cond_signal(c) WakeConditionVariable(c)
+#else
+#    include <pthread.h>
+#    include <unistd.h>
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+typedef pthread_t pool_thread_t;
+#    define pool_mutex_init(m) pthread_mutex_init((m), NULL)
+#    define pool_mutex_destroy(m) pthread_mutex_destroy(m)
+#    define pool_mutex_lock(m) pthread_mutex_lock(m)
+#    define pool_mutex_unlock(m) pthread_mutex_unlock(m)
+#    define pool_cond_init(c) pthread_cond_init((c), NULL)
+#    define pool_cond_destroy(c) pthread_cond_destroy(c)
+#    define pool_cond_wait(c, m) pthread_cond_wait((c), (m))
+#    define pool_cond_broadcast(c) pthread_cond_broadcast(c)
+#    define pool_cond_signal(c) pthread_cond_signal(c)
+#endif
+
+struct strider_thread_pool {
+    pool_mutex_t lock;      /* Guards everything below */
+    pool_mutex_t run_lock;  /* Serializes batches from different callers */
+    pool_cond_t work_ready; /* A batch was posted, or shutdown */
+    pool_cond_t work_done;  /* The last task of a batch finished */
+    pool_thread_t *threads;
+    size_t num_threads;
+    bool shutdown;
+
+    /* Current batch */
+    strider_task_fn task;
+    void *arg;
+    size_t count;
+    size_t next; /* Next unclaimed index */
+    size_t done; /* Finished tasks */
+};
+
+/* ========================================================================
+ * Task Execution
+ * ======================================================================== */
+
+/**
+ * @brief Run tasks of the current batch until none are left to claim
+ *
+ * Called and returns with pool->lock held.
+ */
+static void drain_tasks(strider_thread_pool_t *pool) {
+    while (pool->next < pool->count) {
+        const size_t index = pool->next++;
+        const strider_task_fn task = pool->task;
+        void *arg = pool->arg;
+
+        pool_mutex_unlock(&pool->lock);
+        task(arg, index);
+        pool_mutex_lock(&pool->lock);
+
+        if (++pool->done == pool->count) {
+            pool_cond_signal(&pool->work_done);
+        }
+    }
+}
+
+#if defined(_WIN32)
+static DWORD WINAPI worker_main(LPVOID param) {
+#else
+static void *worker_main(void *param) {
+#endif
+    strider_thread_pool_t *pool = (strider_thread_pool_t *) param;
+
+    pool_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->shutdown && pool->next >= pool->count) {
+            pool_cond_wait(&pool->work_ready, &pool->lock);
+        }
+        if (pool->shutdown) {
+            break;
+        }
+        drain_tasks(pool);
+    }
+    pool_mutex_unlock(&pool->lock);
+
+    return 0;
+}
+
+static void pool_run(void *context, strider_task_fn task, void *arg, size_t count) {
+    strider_thread_pool_t *pool = (strider_thread_pool_t *) context;
+
+    if (count == 0) {
+        return;
+    }
+
+    pool_mutex_lock(&pool->run_lock);
+    pool_mutex_lock(&pool->lock);
+
+    pool->task = task;
+    pool->arg = arg;
+    pool->count = count;
+    pool->next = 0;
+    pool->done = 0;
+    pool_cond_broadcast(&pool->work_ready);
+
+    /* The submitting thread works too */
+    drain_tasks(pool);
+    while (pool->done < pool->count) {
+        pool_cond_wait(&pool->work_done, &pool->lock);
+    }
+
+    pool->task = NULL;
+    pool->count = 0;
+    pool->next = 0;
+
+    pool_mutex_unlock(&pool->lock);
+    pool_mutex_unlock(&pool->run_lock);
+}
+
+/* ========================================================================
+ * Pool Lifetime
+ * ======================================================================== */
+
+size_t strider_hardware_concurrency(void) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t) info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t) n : 1;
+#endif
+}
+
+static void stop_workers(strider_thread_pool_t *pool, size_t started) {
+    pool_mutex_lock(&pool->lock);
+    pool->shutdown = true;
+    pool_cond_broadcast(&pool->work_ready);
+    pool_mutex_unlock(&pool->lock);
+
+    for (size_t i = 0; i < started; i++) {
+#if defined(_WIN32)
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+#else
+        pthread_join(pool->threads[i], NULL);
+#endif
+    }
+}
+
+strider_thread_pool_t *strider_thread_pool_create(size_t threads) {
+    strider_thread_pool_t *pool = (strider_thread_pool_t *) calloc(1, sizeof(*pool));
+
+    if (!pool) {
+        return NULL;
+    }
+    if (threads == 0) {
+        threads = strider_hardware_concurrency();
+    }
+
+    pool->threads = (pool_thread_t *) calloc(threads, sizeof(pool_thread_t));
+    if (!pool->threads || pool_mutex_init(&pool->lock) != 0) {
+        free(pool->threads);
+        free(pool);
+        return NULL;
+    }
+    pool_mutex_init(&pool->run_lock);
+    pool_cond_init(&pool->work_ready);
+    pool_cond_init(&pool->work_done);
+
+    for (size_t i = 0; i < threads; i++) {
+#if defined(_WIN32)
+        pool->threads[i] = CreateThread(NULL, 0, worker_main, pool, 0, NULL);
+        bool started = pool->threads[i] != NULL;
+#else
+        bool started = pthread_create(&pool->threads[i], NULL, worker_main, pool) == 0;
+#endif
+        if (!started) {
+            pool->num_threads = i;
+            strider_thread_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    pool->num_threads = threads;
+
+    return pool;
+}
+
+void strider_thread_pool_destroy(strider_thread_pool_t *pool) {
+    if (!pool) {
+        return;
+    }
+
+    stop_workers(pool, pool->num_threads);
+    pool_cond_destroy(&pool->work_done);
+    pool_cond_destroy(&pool->work_ready);
+    pool_mutex_destroy(&pool->run_lock);
+    pool_mutex_destroy(&pool->lock);
+    free(pool->threads);
+    free(pool);
+}
+
+size_t strider_thread_pool_size(const strider_thread_pool_t *pool) {
+    return pool ? pool->num_threads : 0;
+}
+
+strider_executor_t strider_thread_pool_executor(strider_thread_pool_t *pool) {
+    strider_executor_t executor = {pool_run, pool};
+    return executor;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file test_arena.c
+ * @brief Unit tests for the bump allocator
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "strider/utils/arena.h"
+#include "strider/utils/memory.h"
+#include "strider/utils/thread_pool.h"
+#include "unity.h"
+#include <stdint.h>
+#include <string.h>
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* ========================================================================
+ * Allocation
+ * ======================================================================== */
+
+void test_arena_init_validates(void) {
+    strider_arena_t arena;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_arena_init(NULL, 0, 0));
+    TEST_ASSERT_EQUAL_INT(-1, strider_arena_init(&arena, 0, 0x80));
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 0, 0));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_ARENA_DEFAULT_BLOCK_SIZE, arena.block_size);
+    TEST_ASSERT_EQUAL_size_t(0, strider_arena_capacity(&arena));
+
+    TEST_ASSERT_NULL(strider_arena_alloc(&arena, 8, 0));
+    TEST_ASSERT_NULL(strider_arena_alloc(&arena, 8, 24));
+    TEST_ASSERT_NULL(strider_arena_alloc(&arena, 8, STRIDER_ARENA_MAX_ALIGNMENT * 2));
+    TEST_ASSERT_NULL(strider_arena_alloc_array(&arena, SIZE_MAX / 4, 8));
+    TEST_ASSERT_NULL(strider_arena_alloc(NULL, 8, 8));
+    strider_arena_destroy(&arena);
+    strider_arena_destroy(NULL);
+}
+
+void test_arena_alignment(void) {
+    strider_arena_t arena;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 4096, 0));
+    for (size_t alignment = 1; alignment <= STRIDER_ARENA_MAX_ALIGNMENT; alignment *= 2) {
+        /* An odd-sized allocation first, so the offset is unaligned */
+        TEST_ASSERT_NOT_NULL(strider_arena_alloc(&arena, 3, 1));
+        uint8_t *ptr = (uint8_t *) strider_arena_alloc(&arena, 100, alignment);
+        TEST_ASSERT_NOT_NULL(ptr);
+        TEST_ASSERT_TRUE(strider_is_aligned(ptr, alignment));
+        memset(ptr, 0x5A, 100);
+    }
+    strider_arena_destroy(&arena);
+}
+
+void test_arena_allocations_do_not_overlap(void) {
+    strider_arena_t arena;
+    uint8_t *ptrs[200];
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 1024, 0));
+    for (size_t i = 0; i < 200; i++) {
+        ptrs[i] = (uint8_t *) strider_arena_alloc(&arena, i + 1, 8);
+        TEST_ASSERT_NOT_NULL(ptrs[i]);
+        memset(ptrs[i], (int) i, i + 1);
+    }
+    for (size_t i = 0; i < 200; i++) {
+        for (size_t j = 0; j <= i; j++) {
+            TEST_ASSERT_EQUAL_UINT8((uint8_t) i, ptrs[i][j]);
+        }
+    }
+    TEST_ASSERT_TRUE(strider_arena_capacity(&arena) >= 200 * 201 / 2);
+    strider_arena_destroy(&arena);
+}
+
+void test_arena_large_allocation_gets_own_block(void) {
+    strider_arena_t arena;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 1024, 0));
+    uint8_t *big = (uint8_t *) strider_arena_alloc(&arena, 100000, 64);
+    TEST_ASSERT_NOT_NULL(big);
+    memset(big, 1, 100000);
+    TEST_ASSERT_TRUE(strider_arena_capacity(&arena) >= 100000);
+    strider_arena_destroy(&arena);
+    TEST_ASSERT_EQUAL_size_t(0, strider_arena_capacity(&arena));
+}
+
+/* ========================================================================
+ * Reset and Rewind
+ * ======================================================================== */
+
+/* Batches of the same shape stop growing the arena after the first */
+void test_arena_reset_reuses_blocks(void) {
+    strider_arena_t arena;
+    size_t capacity = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 4096, 0));
+    for (int batch = 0; batch < 10; batch++) {
+        for (size_t i = 0; i < 50; i++) {
+            TEST_ASSERT_NOT_NULL(strider_arena_alloc(&arena, 300 + i * 40, 16));
+        }
+        TEST_ASSERT_NOT_NULL(strider_arena_alloc(&arena, 50000, 64));
+        if (batch == 0) {
+            capacity = strider_arena_capacity(&arena);
+        }
+        TEST_ASSERT_EQUAL_size_t(capacity, strider_arena_capacity(&arena));
+        strider_arena_reset(&arena);
+    }
+    strider_arena_destroy(&arena);
+}
+
+void test_arena_reset_returns_same_memory(void) {
+    strider_arena_t arena;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 0, 0));
+    void *first = strider_arena_alloc(&arena, 64, 64);
+    TEST_ASSERT_NOT_NULL(strider_arena_alloc(&arena, 1000, 8));
+    strider_arena_reset(&arena);
+    TEST_ASSERT_EQUAL_PTR(first, strider_arena_alloc(&arena, 64, 64));
+    strider_arena_destroy(&arena);
+}
+
+void test_arena_mark_rewind(void) {
+    strider_arena_t arena;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 1024, 0));
+
+    /* A mark of an empty arena rewinds to the start */
+    const strider_arena_mark_t empty = strider_arena_mark(&arena);
+    uint8_t *start = (uint8_t *) strider_arena_alloc(&arena, 16, 16);
+    strider_arena_rewind(&arena, empty);
+    TEST_ASSERT_EQUAL_PTR(start, strider_arena_alloc(&arena, 16, 16));
+
+    /* Memory before the mark survives, memory after it is reused */
+    memset(start, 0x77, 16);
+    const strider_arena_mark_t mark = strider_arena_mark(&arena);
+    uint8_t *scratch = (uint8_t *) strider_arena_alloc(&arena, 16, 16);
+    TEST_ASSERT_NOT_NULL(strider_arena_alloc(&arena, 5000, 16)); /* spills to a new block */
+    strider_arena_rewind(&arena, mark);
+    TEST_ASSERT_EQUAL_PTR(scratch, strider_arena_alloc(&arena, 16, 16));
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL_UINT8(0x77, start[i]);
+    }
+    strider_arena_destroy(&arena);
+}
+
+void test_arena_huge_pages(void) {
+    strider_arena_t arena;
+
+    /* Huge pages are a hint; allocation works either way */
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 0, STRIDER_ARENA_HUGE_PAGES));
+    uint8_t *ptr = (uint8_t *) strider_arena_alloc(&arena, 3 << 20, 64);
+    TEST_ASSERT_NOT_NULL(ptr);
+    TEST_ASSERT_TRUE(strider_is_aligned(ptr, 64));
+    memset(ptr, 0xEE, 3 << 20);
+    strider_arena_reset(&arena);
+    TEST_ASSERT_EQUAL_PTR(ptr, strider_arena_alloc(&arena, 3 << 20, 64));
+    strider_arena_destroy(&arena);
+}
+
+/* ========================================================================
+ * Thread-Local Arena
+ * ======================================================================== */
+
+#define THREAD_TASKS 64
+
+static void record_thread_arena(void *arg, size_t index) {
+    strider_arena_t **arenas = (strider_arena_t **) arg;
+    arenas[index] = strider_thread_arena();
+
+    /* Allocations from the thread's own arena need no locking */
+    uint8_t *ptr = (uint8_t *) strider_arena_alloc(arenas[index], 256, 16);
+    if (ptr) {
+        memset(ptr, (int) index, 256);
+    }
+}
+
+void test_thread_arena(void) {
+    strider_arena_t *arenas[THREAD_TASKS];
+    strider_thread_pool_t *pool = strider_thread_pool_create(4);
+    TEST_ASSERT_NOT_NULL(pool);
+
+    strider_arena_t *mine = strider_thread_arena();
+    TEST_ASSERT_NOT_NULL(mine);
+    TEST_ASSERT_EQUAL_PTR(mine, strider_thread_arena());
+
+    const strider_executor_t executor = strider_thread_pool_executor(pool);
+    executor.run(executor.context, record_thread_arena, arenas, THREAD_TASKS);
+    for (size_t i = 0; i < THREAD_TASKS; i++) {
+        TEST_ASSERT_NOT_NULL(arenas[i]);
+    }
+    strider_thread_pool_destroy(pool);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_arena_init_validates);
+    RUN_TEST(test_arena_alignment);
+    RUN_TEST(test_arena_allocations_do_not_overlap);
+    RUN_TEST(test_arena_large_allocation_gets_own_block);
+    RUN_TEST(test_arena_reset_reuses_blocks);
+    RUN_TEST(test_arena_reset_returns_same_memory);
+    RUN_TEST(test_arena_mark_rewind);
+    RUN_TEST(test_arena_huge_pages);
+    RUN_TEST(test_thread_arena);
+
+    return UNITY_END();
+}
@@ -0,0 +1,226 @@
+/**
+ * @file test_byteset.c
+ * @brief Unit tests for multi-byte set search
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Tests set construction, the scalar reference search and the SIMD
+ * variants, including sets that need both nibble-table passes.
+ */
+
+#include "strider/parsers/byteset.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define LOG_DELIMITERS " \t=\",]"
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* ========================================================================
+ * Set Construction Tests
+ * ======================================================================== */
+
+/**
+ * Test: Membership matches the bytes the set was built from
+ */
+void test_byteset_membership(void) {
+    strider_byteset_t set;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_byteset_init(&set, LOG_DELIMITERS, strlen(LOG_DELIMITERS)));
+    TEST_ASSERT_EQUAL_UINT16(6, set.count);
+    TEST_ASSERT_EQUAL_UINT8(1, set.passes);
+
+    for (int b = 0; b < 256; b++) {
+        bool expected = memchr(LOG_DELIMITERS, b, strlen(LOG_DELIMITERS)) != NULL;
+        TEST_ASSERT_EQUAL_MESSAGE(expected, strider_byteset_contains(&set, (uint8_t) b),
+                                  "membership");
+    }
+}
+
+/**
+ * Test: Duplicates are ignored, invalid arguments rejected
+ */
+void test_byteset_init_edge_cases(void) {
+    strider_byteset_t set;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_byteset_init(&set, "aaaa", 4));
+    TEST_ASSERT_EQUAL_UINT16(1, set.count);
+
+    TEST_ASSERT_EQUAL_INT(0, strider_byteset_init(&set, NULL, 0));
+    TEST_ASSERT_EQUAL_UINT16(0, set.count);
+    TEST_ASSERT_EQUAL_UINT8(0, set.passes);
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_byteset_init(NULL, "a", 1));
+    TEST_ASSERT_EQUAL_INT(-1, strider_byteset_init(&set, NULL, 1));
+}
+
+/**
+ * Test: More than 8 distinct low-nibble groups need a second pass
+ */
+void test_byteset_two_passes(void) {
+    /* One byte per high nibble, each with a different low nibble */
+    char bytes[16];
+    strider_byteset_t set;
+
+    for (int i = 0; i < 16; i++) {
+        bytes[i] = (char) ((i << 4) | i);
+    }
+    TEST_ASSERT_EQUAL_INT(0, strider_byteset_init(&set, bytes, sizeof(bytes)));
+    TEST_ASSERT_EQUAL_UINT8(2, set.passes);
+}
+
+/* ========================================================================
+ * Search Tests
+ * ======================================================================== */
+
+/**
+ * Test: Find the first field delimiter in a log line
+ */
+void test_byteset_find_delimiters(void) {
+    strider_byteset_t set;
+    strider_buffer_view_t view = strider_buffer_view_from_cstr("level=info msg=\"ok\"");
+
+    strider_byteset_init(&set, LOG_DELIMITERS, strlen(LOG_DELIMITERS));
+
+    TEST_ASSERT_EQUAL_size_t(5, strider_find_byteset(view, &set));
+    TEST_ASSERT_EQUAL_size_t(5, strider_find_byteset_simd(view, &set));
+
+    view = strider_buffer_view_from_cstr("nodelimitershere");
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_byteset(view, &set));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_byteset_simd(view, &set));
+}
+
+/**
+ * Test: Skip leading whitespace
+ */
+void test_byteset_skip_whitespace(void) {
+    strider_byteset_t space;
+    strider_buffer_view_t view = strider_buffer_view_from_cstr(" \t \t  value");
+
+    strider_byteset_init(&space, " \t", 2);
+
+    TEST_ASSERT_EQUAL_size_t(6, strider_skip_byteset(view, &space));
+    TEST_ASSERT_EQUAL_size_t(6, strider_skip_byteset_simd(view, &space));
+
+    view = strider_buffer_view_from_cstr("       ");
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_skip_byteset(view, &space));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_skip_byteset_simd(view, &space));
+}
+
+/**
+ * Test: Empty view and empty set
+ */
+void test_byteset_empty(void) {
+    strider_byteset_t set;
+    strider_buffer_view_t empty = strider_buffer_view_create("", 0);
+    strider_buffer_view_t text = strider_buffer_view_from_cstr("abc");
+
+    strider_byteset_init(&set, "a", 1);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_byteset_simd(empty, &set));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_skip_byteset_simd(empty, &set));
+
+    strider_byteset_init(&set, NULL, 0);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_byteset_simd(text, &set));
+    TEST_ASSERT_EQUAL_size_t(0, strider_skip_byteset_simd(text, &set));
+}
+
+/**
+ * Test: SIMD matches scalar for small, large and high-byte sets
+ */
+void test_byteset_simd_vs_scalar(void) {
+    size_t size = 1000;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    char big_set[40];
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* 40 bytes spread over all high nibbles, incl. >= 0x80 */
+    for (int i = 0; i < 40; i++) {
+        big_set[i] = (char) (i * 37 + 11);
+    }
+
+    const struct {
+        const char *bytes;
+        size_t count;
+    } sets[] = {
+        {LOG_DELIMITERS, 6},
+        {"\x80\xff\x7f\x00", 4},
+        {big_set, sizeof(big_set)},
+    };
+
+    srand(2024);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) rand();
+    }
+
+    for (size_t s = 0; s < sizeof(sets) / sizeof(sets[0]); s++) {
+        strider_byteset_t set;
+        strider_byteset_init(&set, sets[s].bytes, sets[s].count);
+
+        for (size_t offset = 0; offset < 64; offset += 5) {
+            for (size_t len = 0; len + offset <= size; len += 23) {
+                strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                TEST_ASSERT_EQUAL_size_t(strider_find_byteset(view, &set),
+                                         strider_find_byteset_simd(view, &set));
+                TEST_ASSERT_EQUAL_size_t(strider_skip_byteset(view, &set),
+                                         strider_skip_byteset_simd(view, &set));
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Match far into a long run of member / non-member bytes
+ */
+void test_byteset_long_runs(void) {
+    size_t size = 777;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    strider_byteset_t set;
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    strider_byteset_init(&set, " \t", 2);
+
+    for (size_t pos = 0; pos < size; pos += 13) {
+        memset(buffer, 'x', size);
+        buffer[pos] = '\t';
+        strider_buffer_view_t view = strider_buffer_view_create(buffer, size);
+        TEST_ASSERT_EQUAL_size_t(pos, strider_find_byteset_simd(view, &set));
+
+        memset(buffer, ' ', size);
+        buffer[pos] = 'x';
+        TEST_ASSERT_EQUAL_size_t(pos, strider_skip_byteset_simd(view, &set));
+    }
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Set construction */
+    RUN_TEST(test_byteset_membership);
+    RUN_TEST(test_byteset_init_edge_cases);
+    RUN_TEST(test_byteset_two_passes);
+
+    /* Search */
+    RUN_TEST(test_byteset_find_delimiters);
+    RUN_TEST(test_byteset_skip_whitespace);
+    RUN_TEST(test_byteset_empty);
+    RUN_TEST(test_byteset_simd_vs_scalar);
+    RUN_TEST(test_byteset_long_runs);
+
+    return UNITY_END();
+}
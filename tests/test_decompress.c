@@ -0,0 +1,390 @@
+/**
+ * @file test_decompress.c
+ * @brief Unit tests for streaming decompression into scan windows
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * The compressed inputs are built here from stored (uncompressed)
+ * deflate blocks and raw zstd blocks, so the tests need neither zlib
+ * nor libzstd themselves; formats that were not built in are checked
+ * to fail with ENOTSUP instead.
+ */
+
+#include "strider/io/decompress.h"
+#include "strider/parsers/newline.h"
+#include "unity.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCRATCH_PATH "strider_test_decompress.tmp"
+
+/* Odd size, so windows are cut inside blocks, lines and \r\n pairs */
+#define WINDOW_SIZE 4099
+
+/* Largest stored block the encoders below write */
+#define BLOCK_SIZE 1000
+
+typedef struct {
+    uint8_t *data;
+    size_t size;
+} bytes_t;
+
+static void append(bytes_t *out, const void *data, size_t size) {
+    out->data = (uint8_t *) realloc(out->data, out->size + size);
+    TEST_ASSERT_NOT_NULL(out->data);
+    memcpy(out->data + out->size, data, size);
+    out->size += size;
+}
+
+static void append_le(bytes_t *out, uint32_t value, size_t size) {
+    uint8_t bytes[4] = {(uint8_t) value, (uint8_t) (value >> 8), (uint8_t) (value >> 16),
+                        (uint8_t) (value >> 24)};
+    append(out, bytes, size);
+}
+
+static uint32_t crc32_of(const char *data, size_t size) {
+    uint32_t crc = 0xffffffffu;
+    for (size_t i = 0; i < size; i++) {
+        crc ^= (uint8_t) data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xedb88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+/* One gzip member holding data in stored deflate blocks */
+static void append_gzip(bytes_t *out, const char *data, size_t size) {
+    static const uint8_t header[10] = {0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xff};
+    size_t offset = 0;
+
+    append(out, header, sizeof(header));
+    do {
+        const size_t block = size - offset < BLOCK_SIZE ? size - offset : BLOCK_SIZE;
+        const uint8_t final = offset + block == size;
+
+        append(out, &final, 1); /* BFINAL, BTYPE 00 (stored) */
+        append_le(out, (uint32_t) block, 2);
+        append_le(out, (uint32_t) ~block & 0xffff, 2);
+        append(out, data + offset, block);
+        offset += block;
+    } while (offset < size);
+    append_le(out, crc32_of(data, size), 4);
+    append_le(out, (uint32_t) size, 4);
+}
+
+/* One zstd frame holding data in raw blocks */
+static void append_zstd(bytes_t *out, const char *data, size_t size) {
+    static const uint8_t header[6] = {0x28, 0xb5, 0x2f, 0xfd, 0x00, 0x58}; /* 2 MB window */
+    size_t offset = 0;
+
+    append(out, header, sizeof(header));
+    do {
+        const size_t block = size - offset < BLOCK_SIZE ? size - offset : BLOCK_SIZE;
+        const uint32_t last = offset + block == size;
+
+        append_le(out, (uint32_t) (block << 3) | last, 3); /* Block_Type 0 (raw) */
+        append(out, data + offset, block);
+        offset += block;
+    } while (offset < size);
+}
+
+static void write_scratch(const void *data, size_t size) {
+    FILE *fp = fopen(SCRATCH_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_size_t(size, fwrite(data, 1, size, fp));
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+}
+
+static char *make_log(size_t size, unsigned seed) {
+    char *data = (char *) malloc(size ? size : 1);
+    TEST_ASSERT_NOT_NULL(data);
+
+    srand(seed);
+    for (size_t i = 0; i < size; i++) {
+        const int r = rand() % 40;
+        data[i] = r == 0 ? '\n' : r == 1 ? '\r' : (char) ('a' + r % 26);
+    }
+    return data;
+}
+
+static strider_decompressor_t *open_scratch(strider_compression_t format) {
+    const strider_decompress_options_t options = {WINDOW_SIZE, format};
+    return strider_decompress_open(SCRATCH_PATH, &options);
+}
+
+/* Decompress the scratch file and compare it with data */
+static void assert_decompresses(strider_compression_t format, strider_compression_t detected,
+                                const char *data, size_t size) {
+    strider_decompressor_t *input = open_scratch(format);
+    strider_newline_stream_t stream;
+    strider_buffer_view_t window;
+    size_t *expected = (size_t *) malloc((size + 1) * sizeof(size_t));
+    size_t *positions = (size_t *) malloc((size + 1) * sizeof(size_t));
+    size_t offset = 0;
+    size_t found = 0;
+    int result;
+
+    TEST_ASSERT_NOT_NULL(input);
+    TEST_ASSERT_EQUAL_INT(detected, strider_decompress_format(input));
+
+    strider_newline_stream_init(&stream);
+    while ((result = strider_decompress_next(input, &window)) > 0) {
+        TEST_ASSERT_TRUE(window.size > 0 && offset + window.size <= size);
+        TEST_ASSERT_EQUAL_MEMORY(data + offset, window.data, window.size);
+        if (offset + window.size < size) {
+            TEST_ASSERT_EQUAL_size_t(WINDOW_SIZE, window.size); /* Only the last is short */
+        }
+        found += strider_newline_stream_feed_positions(&stream, (const char *) window.data,
+                                                       window.size, positions + found,
+                                                       size + 1 - found);
+        offset += window.size;
+    }
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_size_t(size, offset);
+    TEST_ASSERT_EQUAL_INT(0, strider_decompress_next(input, &window));
+
+    /* Lines crossing windows come out as one scan of the whole stream */
+    const size_t count = strider_find_newline_positions(data, size, expected, size + 1);
+    TEST_ASSERT_EQUAL_size_t(count, found);
+    TEST_ASSERT_EQUAL_size_t(count, strider_newline_stream_finish(&stream));
+    if (count > 0) {
+        TEST_ASSERT_EQUAL_MEMORY(expected, positions, count * sizeof(size_t));
+    }
+
+    strider_decompress_close(input);
+    free(expected);
+    free(positions);
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    remove(SCRATCH_PATH);
+}
+
+/* ========================================================================
+ * Tests
+ * ======================================================================== */
+
+/**
+ * Test: Plain input is passed through, with and without detection
+ */
+void test_decompress_plain(void) {
+    static const size_t sizes[] = {0, 1, WINDOW_SIZE - 1, WINDOW_SIZE, 5 * WINDOW_SIZE + 3};
+
+    TEST_ASSERT_TRUE(strider_decompress_supported(STRIDER_COMPRESSION_AUTO));
+    TEST_ASSERT_TRUE(strider_decompress_supported(STRIDER_COMPRESSION_NONE));
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        char *data = make_log(sizes[s], (unsigned) s);
+        write_scratch(data, sizes[s]);
+
+        assert_decompresses(STRIDER_COMPRESSION_AUTO, STRIDER_COMPRESSION_NONE, data, sizes[s]);
+        assert_decompresses(STRIDER_COMPRESSION_NONE, STRIDER_COMPRESSION_NONE, data, sizes[s]);
+        free(data);
+    }
+}
+
+/**
+ * Test: gzip, one member and several concatenated
+ */
+void test_decompress_gzip(void) {
+    const size_t size = 9 * WINDOW_SIZE + 123;
+    char *data = make_log(size, 3);
+    bytes_t gzip = {NULL, 0};
+
+    append_gzip(&gzip, data, size);
+    write_scratch(gzip.data, gzip.size);
+
+    if (!strider_decompress_supported(STRIDER_COMPRESSION_GZIP)) {
+        TEST_ASSERT_NULL(open_scratch(STRIDER_COMPRESSION_AUTO));
+        TEST_ASSERT_EQUAL_INT(ENOTSUP, errno);
+        free(gzip.data);
+        free(data);
+        TEST_IGNORE_MESSAGE("gzip support not built in");
+    }
+
+    assert_decompresses(STRIDER_COMPRESSION_AUTO, STRIDER_COMPRESSION_GZIP, data, size);
+    assert_decompresses(STRIDER_COMPRESSION_GZIP, STRIDER_COMPRESSION_GZIP, data, size);
+
+    /* Members split at a line, mid-line and inside a \r\n are seamless */
+    free(gzip.data);
+    gzip.data = NULL;
+    gzip.size = 0;
+    append_gzip(&gzip, data, 1);
+    append_gzip(&gzip, data + 1, 2 * WINDOW_SIZE);
+    append_gzip(&gzip, data + 1 + 2 * WINDOW_SIZE, 0);
+    append_gzip(&gzip, data + 1 + 2 * WINDOW_SIZE, size - 1 - 2 * WINDOW_SIZE);
+    write_scratch(gzip.data, gzip.size);
+    assert_decompresses(STRIDER_COMPRESSION_AUTO, STRIDER_COMPRESSION_GZIP, data, size);
+
+    free(gzip.data);
+    free(data);
+}
+
+/**
+ * Test: Truncated and corrupt gzip input fails instead of ending early
+ */
+void test_decompress_gzip_errors(void) {
+    const size_t size = 3 * WINDOW_SIZE;
+    char *data = make_log(size, 5);
+    bytes_t gzip = {NULL, 0};
+    strider_buffer_view_t window;
+    int result;
+
+    if (!strider_decompress_supported(STRIDER_COMPRESSION_GZIP)) {
+        free(data);
+        TEST_IGNORE_MESSAGE("gzip support not built in");
+    }
+    append_gzip(&gzip, data, size);
+
+    /* Truncated inside the data, then inside the trailer */
+    const size_t cuts[] = {gzip.size / 2, gzip.size - 3};
+    for (size_t c = 0; c < sizeof(cuts) / sizeof(cuts[0]); c++) {
+        write_scratch(gzip.data, cuts[c]);
+        strider_decompressor_t *input = open_scratch(STRIDER_COMPRESSION_AUTO);
+        TEST_ASSERT_NOT_NULL(input);
+        while ((result = strider_decompress_next(input, &window)) > 0) {
+        }
+        TEST_ASSERT_EQUAL_INT(-1, result);
+        TEST_ASSERT_EQUAL_INT(EIO, errno);
+        strider_decompress_close(input);
+    }
+
+    /* Wrong CRC */
+    gzip.data[gzip.size - 8] ^= 1;
+    write_scratch(gzip.data, gzip.size);
+    strider_decompressor_t *input = open_scratch(STRIDER_COMPRESSION_GZIP);
+    TEST_ASSERT_NOT_NULL(input);
+    while ((result = strider_decompress_next(input, &window)) > 0) {
+    }
+    TEST_ASSERT_EQUAL_INT(-1, result);
+    strider_decompress_close(input);
+
+    free(gzip.data);
+    free(data);
+}
+
+/**
+ * Test: Zero padding after the last gzip member ends the stream cleanly
+ */
+void test_decompress_gzip_padding(void) {
+    const size_t size = 2 * WINDOW_SIZE + 7;
+    const size_t paddings[] = {1, 3 * WINDOW_SIZE + 5}; /* The long one spans reader chunks */
+    char *data = make_log(size, 9);
+    uint8_t *zeros = (uint8_t *) calloc(paddings[1], 1);
+    strider_buffer_view_t window;
+    int result;
+
+    if (!strider_decompress_supported(STRIDER_COMPRESSION_GZIP)) {
+        free(zeros);
+        free(data);
+        TEST_IGNORE_MESSAGE("gzip support not built in");
+    }
+    TEST_ASSERT_NOT_NULL(zeros);
+
+    for (size_t p = 0; p < sizeof(paddings) / sizeof(paddings[0]); p++) {
+        bytes_t gzip = {NULL, 0};
+
+        append_gzip(&gzip, data, size);
+        append(&gzip, zeros, paddings[p]);
+        write_scratch(gzip.data, gzip.size);
+        assert_decompresses(STRIDER_COMPRESSION_AUTO, STRIDER_COMPRESSION_GZIP, data, size);
+
+        /* Anything but zeros after the padding is still corrupt */
+        append(&gzip, "x", 1);
+        write_scratch(gzip.data, gzip.size);
+        strider_decompressor_t *input = open_scratch(STRIDER_COMPRESSION_GZIP);
+        TEST_ASSERT_NOT_NULL(input);
+        while ((result = strider_decompress_next(input, &window)) > 0) {
+        }
+        TEST_ASSERT_EQUAL_INT(-1, result);
+        TEST_ASSERT_EQUAL_INT(EIO, errno);
+        strider_decompress_close(input);
+        free(gzip.data);
+    }
+
+    /* Zeros before any member are not padding */
+    write_scratch(zeros, 10);
+    strider_decompressor_t *input = open_scratch(STRIDER_COMPRESSION_GZIP);
+    TEST_ASSERT_NOT_NULL(input);
+    TEST_ASSERT_EQUAL_INT(-1, strider_decompress_next(input, &window));
+    strider_decompress_close(input);
+
+    free(zeros);
+    free(data);
+}
+
+/**
+ * Test: zstd, several frames
+ */
+void test_decompress_zstd(void) {
+    const size_t size = 7 * WINDOW_SIZE + 45;
+    char *data = make_log(size, 9);
+    bytes_t zstd = {NULL, 0};
+
+    append_zstd(&zstd, data, 3 * WINDOW_SIZE + 1);
+    append_zstd(&zstd, data + 3 * WINDOW_SIZE + 1, size - 3 * WINDOW_SIZE - 1);
+    write_scratch(zstd.data, zstd.size);
+
+    if (!strider_decompress_supported(STRIDER_COMPRESSION_ZSTD)) {
+        TEST_ASSERT_NULL(open_scratch(STRIDER_COMPRESSION_AUTO));
+        TEST_ASSERT_EQUAL_INT(ENOTSUP, errno);
+        TEST_ASSERT_NULL(open_scratch(STRIDER_COMPRESSION_ZSTD));
+        free(zstd.data);
+        free(data);
+        TEST_IGNORE_MESSAGE("zstd support not built in");
+    }
+
+    assert_decompresses(STRIDER_COMPRESSION_AUTO, STRIDER_COMPRESSION_ZSTD, data, size);
+
+    /* Truncated */
+    strider_buffer_view_t window;
+    int result;
+    write_scratch(zstd.data, zstd.size - 10);
+    strider_decompressor_t *input = open_scratch(STRIDER_COMPRESSION_ZSTD);
+    TEST_ASSERT_NOT_NULL(input);
+    while ((result = strider_decompress_next(input, &window)) > 0) {
+    }
+    TEST_ASSERT_EQUAL_INT(-1, result);
+    strider_decompress_close(input);
+
+    free(zstd.data);
+    free(data);
+}
+
+/**
+ * Test: Invalid arguments and missing files
+ */
+void test_decompress_invalid_arguments(void) {
+    const strider_decompress_options_t bad_format = {0, (strider_compression_t) 42};
+    strider_buffer_view_t window;
+
+    TEST_ASSERT_NULL(strider_decompress_open(NULL, NULL));
+    TEST_ASSERT_NULL(strider_decompress_open("does/not/exist.gz", NULL));
+    write_scratch("x", 1);
+    TEST_ASSERT_NULL(strider_decompress_open(SCRATCH_PATH, &bad_format));
+    TEST_ASSERT_FALSE(strider_decompress_supported((strider_compression_t) 42));
+    TEST_ASSERT_EQUAL_INT(-1, strider_decompress_next(NULL, &window));
+    strider_decompress_close(NULL);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_decompress_plain);
+    RUN_TEST(test_decompress_gzip);
+    RUN_TEST(test_decompress_gzip_errors);
+    RUN_TEST(test_decompress_gzip_padding);
+    RUN_TEST(test_decompress_zstd);
+    RUN_TEST(test_decompress_invalid_arguments);
+
+    return UNITY_END();
+}
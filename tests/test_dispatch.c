@@ -0,0 +1,1057 @@
+/**
+ * @file test_dispatch.c
+ * @brief Unit tests for runtime kernel backend dispatch
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Verifies backend selection and that every backend supported on the
+ * running CPU produces the same results as the scalar reference.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* MAP_ANONYMOUS */
+#endif
+
+#include "strider/dispatch.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/level.h"
+#include "strider/parsers/logs.h"
+#include "strider/parsers/memchr.h"
+#include "strider/parsers/multi_pattern.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/strchr.h"
+#include "strider/parsers/strstr.h"
+#include "strider/parsers/text_scan.h"
+#include "strider/parsers/timestamp.h"
+#include "strider/parsers/tokenize.h"
+#include "strider/utils/thread_pool.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#    include <windows.h>
+#else
+#    include <sys/mman.h>
+#    include <unistd.h>
+#endif
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Restore automatic selection after each test */
+    strider_set_backend(STRIDER_BACKEND_AUTO);
+}
+
+/* ========================================================================
+ * Backend Selection Tests
+ * ======================================================================== */
+
+/**
+ * Test: Active backend is resolved and supported
+ */
+void test_dispatch_active_backend_supported(void) {
+    strider_backend_t backend = strider_get_backend();
+
+    TEST_ASSERT_NOT_EQUAL(STRIDER_BACKEND_AUTO, backend);
+    TEST_ASSERT_TRUE(strider_backend_is_supported(backend));
+}
+
+/**
+ * Test: Scalar backend is always available
+ */
+void test_dispatch_scalar_always_supported(void) {
+    TEST_ASSERT_TRUE(strider_backend_is_supported(STRIDER_BACKEND_SCALAR));
+    TEST_ASSERT_EQUAL_INT(0, strider_set_backend(STRIDER_BACKEND_SCALAR));
+    TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_SCALAR, strider_get_backend());
+}
+
+/**
+ * Test: Automatic selection matches CPU features
+ */
+void test_dispatch_auto_prefers_widest(void) {
+    strider_cpu_features_t features = strider_get_cpu_features();
+    strider_backend_t backend = strider_get_backend();
+
+#if defined(__x86_64__) || defined(_M_X64)
+    if (strider_backend_is_supported(STRIDER_BACKEND_AVX512BW)) {
+        TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_AVX512BW, backend);
+    } else if (strider_backend_is_supported(STRIDER_BACKEND_AVX2)) {
+        TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_AVX2, backend);
+    } else {
+        TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_SSE2, backend);
+    }
+    TEST_ASSERT_TRUE(features.has_sse2);
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    TEST_ASSERT_TRUE(features.has_neon);
+    TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_NEON, backend);
+#else
+    (void) features;
+    TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_SCALAR, backend);
+#endif
+}
+
+/**
+ * Test: Pinning an unsupported backend fails and keeps the current one
+ */
+void test_dispatch_set_unsupported_backend(void) {
+    strider_backend_t before = strider_get_backend();
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_set_backend((strider_backend_t) -1));
+    TEST_ASSERT_EQUAL_INT(-1, strider_set_backend(STRIDER_BACKEND_COUNT));
+#if defined(__x86_64__) || defined(_M_X64)
+    TEST_ASSERT_EQUAL_INT(-1, strider_set_backend(STRIDER_BACKEND_NEON));
+#else
+    TEST_ASSERT_EQUAL_INT(-1, strider_set_backend(STRIDER_BACKEND_AVX2));
+#endif
+    TEST_ASSERT_EQUAL_INT(before, strider_get_backend());
+}
+
+/**
+ * Test: Backend names round-trip through the parser
+ */
+void test_dispatch_backend_names(void) {
+    strider_backend_t backend;
+
+    for (int i = STRIDER_BACKEND_AUTO; i < STRIDER_BACKEND_COUNT; i++) {
+        const char *name = strider_backend_name((strider_backend_t) i);
+        TEST_ASSERT_EQUAL_INT(0, strider_backend_from_name(name, &backend));
+        TEST_ASSERT_EQUAL_INT(i, backend);
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, strider_backend_from_name("AVX2", &backend));
+    TEST_ASSERT_EQUAL_INT(STRIDER_BACKEND_AVX2, backend);
+    TEST_ASSERT_EQUAL_INT(-1, strider_backend_from_name("avx", &backend));
+    TEST_ASSERT_EQUAL_INT(-1, strider_backend_from_name("avx2x", &backend));
+    TEST_ASSERT_EQUAL_INT(-1, strider_backend_from_name(NULL, &backend));
+    TEST_ASSERT_EQUAL_STRING("unknown", strider_backend_name(STRIDER_BACKEND_COUNT));
+}
+
+typedef struct {
+    const char *buffer;
+    size_t size;
+    size_t expected;
+    size_t errors[8];
+} switch_work_t;
+
+/* Task 0 keeps switching backends while the others run kernels */
+static void switch_task(void *arg, size_t index) {
+    switch_work_t *work = (switch_work_t *) arg;
+
+    for (int round = 0; round < 200; round++) {
+        if (index == 0) {
+            strider_set_backend((strider_backend_t) (STRIDER_BACKEND_SCALAR +
+                                                     round % (STRIDER_BACKEND_COUNT - 1)));
+        } else if (strider_count_newlines_simd(work->buffer, work->size) != work->expected) {
+            work->errors[index]++;
+        }
+    }
+}
+
+/**
+ * Test: Switching backends while other threads run kernels is safe
+ */
+void test_dispatch_concurrent_backend_switch(void) {
+    static char buffer[8192];
+    switch_work_t work = {buffer, sizeof(buffer), 0, {0}};
+
+    for (size_t i = 0; i < sizeof(buffer); i++) {
+        buffer[i] = (i % 37 == 0) ? '\n' : 'x';
+    }
+    work.expected = strider_count_newlines(buffer, sizeof(buffer));
+
+    strider_thread_pool_t *pool = strider_thread_pool_create(4);
+    TEST_ASSERT_NOT_NULL(pool);
+    strider_executor_t executor = strider_thread_pool_executor(pool);
+    executor.run(executor.context, switch_task, &work, 8);
+    strider_thread_pool_destroy(pool);
+
+    for (size_t i = 0; i < 8; i++) {
+        TEST_ASSERT_EQUAL_size_t(0, work.errors[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, strider_set_backend(STRIDER_BACKEND_AUTO));
+}
+
+/* ========================================================================
+ * Cross-Backend Equivalence Tests
+ * ======================================================================== */
+
+/**
+ * Test: Every supported backend counts newlines like the scalar reference
+ */
+void test_dispatch_newlines_all_backends(void) {
+    size_t size = 4096;
+    char *buffer = (char *) malloc(size + 64);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(1234);
+    for (size_t i = 0; i < size + 64; i++) {
+        int r = rand() % 8;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : (char) ('a' + r);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 7) {
+            for (size_t len = 0; len < size; len += 131) {
+                size_t expected = strider_count_newlines(buffer + offset, len);
+                size_t actual = strider_count_newlines_simd(buffer + offset, len);
+                TEST_ASSERT_EQUAL_size_t_MESSAGE(expected, actual, strider_backend_name(b));
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend finds newline positions like the scalar reference
+ */
+void test_dispatch_newline_positions_all_backends(void) {
+    size_t size = 4096;
+    char *buffer = (char *) malloc(size + 64);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size * sizeof(size_t));
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(5678);
+    for (size_t i = 0; i < size + 64; i++) {
+        int r = rand() % 8;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : (char) ('a' + r);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 9) {
+            for (size_t len = 0; len < size; len += 257) {
+                size_t n = strider_find_newline_positions(buffer + offset, len, expected, size);
+                size_t m = strider_find_newline_positions_simd(buffer + offset, len, actual, size);
+                TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+                if (n == 0) {
+                    continue;
+                }
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual, n * sizeof(size_t),
+                                                 strider_backend_name(b));
+            }
+        }
+    }
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: Every supported backend emits 32-bit and packed positions like the scalar reference
+ */
+void test_dispatch_compact_positions_all_backends(void) {
+    size_t size = 4096;
+    char *buffer = (char *) malloc(size + 64);
+    uint32_t *expected32 = (uint32_t *) malloc(size * sizeof(uint32_t));
+    uint32_t *actual32 = (uint32_t *) malloc(size * sizeof(uint32_t));
+    uint8_t *expected_packed = (uint8_t *) malloc(size);
+    uint8_t *actual_packed = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected32);
+    TEST_ASSERT_NOT_NULL(actual32);
+    TEST_ASSERT_NOT_NULL(expected_packed);
+    TEST_ASSERT_NOT_NULL(actual_packed);
+
+    srand(6789);
+    for (size_t i = 0; i < size + 64; i++) {
+        int r = rand() % 40;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : (char) ('a' + r % 26);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 9) {
+            for (size_t len = 0; len < size; len += 257) {
+                const char *data = buffer + offset;
+                size_t n = strider_find_newline_positions32(data, len, 100, expected32, size);
+                size_t m = strider_find_newline_positions32_simd(data, len, 100, actual32, size);
+                TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+                if (n > 0) {
+                    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected32, actual32, n * sizeof(uint32_t),
+                                                     strider_backend_name(b));
+                }
+
+                /* A small capacity also exercises the stop point */
+                for (size_t capacity = 16; capacity <= size; capacity *= 16) {
+                    size_t expected_size, actual_size, expected_consumed, actual_consumed;
+                    n = strider_pack_newline_positions(data, len, expected_packed, capacity,
+                                                       &expected_size, &expected_consumed);
+                    m = strider_pack_newline_positions_simd(data, len, actual_packed, capacity,
+                                                            &actual_size, &actual_consumed);
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(expected_consumed, actual_consumed,
+                                                     strider_backend_name(b));
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(expected_size, actual_size,
+                                                     strider_backend_name(b));
+                    if (expected_size > 0) {
+                        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected_packed, actual_packed,
+                                                         expected_size, strider_backend_name(b));
+                    }
+                }
+            }
+        }
+    }
+
+    free(buffer);
+    free(expected32);
+    free(actual32);
+    free(expected_packed);
+    free(actual_packed);
+}
+
+/**
+ * Test: Every supported backend finds characters like the scalar reference
+ */
+void test_dispatch_strchr_all_backends(void) {
+    /* 32-byte aligned, multiple of 32: aligned over-reads stay in bounds */
+    size_t size = 320;
+    char *buffer = (char *) strider_aligned_alloc(32, size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t i = 0; i < size - 1; i++) {
+        buffer[i] = (char) ('a' + (i % 23));
+    }
+    buffer[size - 1] = '\0';
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset++) {
+            const char *str = buffer + offset;
+            const int targets[] = {'a', 'k', 'w', 'z', '\0'};
+
+            for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+                TEST_ASSERT_EQUAL_PTR_MESSAGE(strider_strchr(str, targets[t]),
+                                              strider_strchr_simd(str, targets[t]),
+                                              strider_backend_name(b));
+            }
+        }
+    }
+
+    strider_aligned_free(buffer);
+}
+
+/* ========================================================================
+ * Page Boundary Tests
+ * ======================================================================== */
+
+/* One readable page between two inaccessible ones, so any read outside
+ * the page faults */
+static char *guarded_page(size_t *page_size) {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    DWORD old;
+
+    GetSystemInfo(&info);
+    *page_size = info.dwPageSize;
+    char *base = (char *) VirtualAlloc(NULL, 3 * *page_size, MEM_RESERVE | MEM_COMMIT,
+                                       PAGE_READWRITE);
+    if (!base || !VirtualProtect(base, *page_size, PAGE_NOACCESS, &old) ||
+        !VirtualProtect(base + 2 * *page_size, *page_size, PAGE_NOACCESS, &old)) {
+        return NULL;
+    }
+#else
+    *page_size = (size_t) sysconf(_SC_PAGESIZE);
+    char *base = (char *) mmap(NULL, 3 * *page_size, PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED || mprotect(base, *page_size, PROT_NONE) != 0 ||
+        mprotect(base + 2 * *page_size, *page_size, PROT_NONE) != 0) {
+        return NULL;
+    }
+#endif
+    return base + *page_size;
+}
+
+static void free_guarded_page(char *page, size_t page_size) {
+#if defined(_WIN32)
+    (void) page_size;
+    VirtualFree(page - page_size, 0, MEM_RELEASE);
+#else
+    munmap(page - page_size, 3 * page_size);
+#endif
+}
+
+/**
+ * Test: Short inputs at either end of a page are handled without
+ * touching the neighbouring pages
+ */
+void test_dispatch_page_boundaries_all_backends(void) {
+    size_t page_size;
+    char *page = guarded_page(&page_size);
+    TEST_ASSERT_NOT_NULL(page);
+
+    srand(99);
+    for (size_t i = 0; i < page_size; i++) {
+        int r = rand() % 6;
+        page[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : (char) ('a' + r);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t len = 0; len <= 300; len++) {
+            const char *head = page;
+            const char *tail = page + page_size - len;
+
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_count_newlines(head, len),
+                                             strider_count_newlines_simd(head, len),
+                                             strider_backend_name(b));
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_count_newlines(tail, len),
+                                             strider_count_newlines_simd(tail, len),
+                                             strider_backend_name(b));
+        }
+
+        /* Strings ending in the last byte of the page */
+        for (size_t len = 1; len <= 300; len++) {
+            char *str = page + page_size - len;
+            const int targets[] = {'\n', 'c', 'z', '\0'};
+            char saved = page[page_size - 1];
+
+            page[page_size - 1] = '\0';
+            for (size_t t = 0; t < sizeof(targets) / sizeof(targets[0]); t++) {
+                TEST_ASSERT_EQUAL_PTR_MESSAGE(strider_strchr(str, targets[t]),
+                                              strider_strchr_simd(str, targets[t]),
+                                              strider_backend_name(b));
+            }
+            page[page_size - 1] = saved;
+        }
+    }
+
+    free_guarded_page(page, page_size);
+}
+
+/**
+ * Test: Every supported backend searches bounded buffers like the scalar reference
+ */
+void test_dispatch_memchr_all_backends(void) {
+    size_t size = 700;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(91);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) ('a' + rand() % 26);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 3) {
+            for (size_t len = 0; len + offset <= size; len += 37) {
+                strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                for (int ch = 'a'; ch <= 'z'; ch += 5) {
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_memchr(view, ch),
+                                                     strider_memchr_simd(view, ch),
+                                                     strider_backend_name(b));
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_memrchr(view, ch),
+                                                     strider_memrchr_simd(view, ch),
+                                                     strider_backend_name(b));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend searches batches like the scalar reference
+ */
+void test_dispatch_batch_search_all_backends(void) {
+#define BATCH_COUNT 300
+    char *buffer = (char *) strider_aligned_alloc(64, BATCH_COUNT * 91 + 64);
+    strider_buffer_view_t views[BATCH_COUNT];
+    strider_field_span_t spans[BATCH_COUNT];
+    const char *strs[BATCH_COUNT];
+    size_t expected[BATCH_COUNT], results[BATCH_COUNT];
+    const char *expected_ptrs[BATCH_COUNT], *result_ptrs[BATCH_COUNT];
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* Strings of 0-90 bytes at every alignment, back to back */
+    srand(31);
+    size_t offset = 0;
+    for (size_t i = 0; i < BATCH_COUNT; i++) {
+        size_t len = (size_t) (rand() % 91);
+        for (size_t j = 0; j < len; j++) {
+            buffer[offset + j] = (char) ('a' + rand() % 20);
+        }
+        buffer[offset + len] = '\0';
+        views[i] = strider_buffer_view_create(buffer + offset, len);
+        spans[i].start = (uint32_t) offset;
+        spans[i].length = (uint32_t) len;
+        strs[i] = buffer + offset;
+        offset += len + 1;
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (int ch = 'a'; ch <= 'z'; ch += 6) {
+            size_t found = strider_memchr_batch(views, BATCH_COUNT, ch, expected);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(
+                found, strider_memchr_batch_simd(views, BATCH_COUNT, ch, results),
+                strider_backend_name(b));
+            TEST_ASSERT_EQUAL_size_t_ARRAY_MESSAGE(expected, results, BATCH_COUNT,
+                                                   strider_backend_name(b));
+
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(
+                found, strider_memchr_spans_simd(buffer, spans, BATCH_COUNT, ch, results),
+                strider_backend_name(b));
+            TEST_ASSERT_EQUAL_size_t_ARRAY_MESSAGE(expected, results, BATCH_COUNT,
+                                                   strider_backend_name(b));
+
+            found = strider_strchr_batch(strs, BATCH_COUNT, ch, expected_ptrs);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(
+                found, strider_strchr_batch_simd(strs, BATCH_COUNT, ch, result_ptrs),
+                strider_backend_name(b));
+            TEST_ASSERT_EQUAL_PTR_ARRAY_MESSAGE(expected_ptrs, result_ptrs, BATCH_COUNT,
+                                                strider_backend_name(b));
+        }
+    }
+
+    strider_aligned_free(buffer);
+#undef BATCH_COUNT
+}
+
+/**
+ * Test: Every supported backend searches byte sets like the scalar reference
+ */
+void test_dispatch_byteset_all_backends(void) {
+    size_t size = 600;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    char wide[24];
+    strider_byteset_t sets[2];
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* The wide set exceeds the SSE2 compare path and needs two passes */
+    for (int i = 0; i < 24; i++) {
+        wide[i] = (char) (i * 45 + 3);
+    }
+    strider_byteset_init(&sets[0], " \t=\",]", 6);
+    strider_byteset_init(&sets[1], wide, sizeof(wide));
+
+    srand(77);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) rand();
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t s = 0; s < 2; s++) {
+            for (size_t offset = 0; offset < 64; offset += 7) {
+                for (size_t len = 0; len + offset <= size; len += 41) {
+                    strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_find_byteset(view, &sets[s]),
+                                                     strider_find_byteset_simd(view, &sets[s]),
+                                                     strider_backend_name(b));
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_skip_byteset(view, &sets[s]),
+                                                     strider_skip_byteset_simd(view, &sets[s]),
+                                                     strider_backend_name(b));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend finds substrings like the scalar reference
+ */
+void test_dispatch_strstr_all_backends(void) {
+    size_t size = 600;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(303);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) ('a' + rand() % 4);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t k = 1; k <= 6; k++) {
+            strider_buffer_view_t needle = strider_buffer_view_create(buffer + 400 + k, k);
+
+            for (size_t offset = 0; offset < 64; offset += 11) {
+                for (size_t len = 0; len + offset <= size; len += 53) {
+                    strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_strstr(view, needle),
+                                                     strider_strstr_simd(view, needle),
+                                                     strider_backend_name(b));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend searches ignoring case like the scalar reference
+ */
+void test_dispatch_nocase_search_all_backends(void) {
+    size_t size = 600;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* Letters in both cases next to the non-letters that differ by 0x20 */
+    srand(2718);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) "xyXY@`[{"[rand() % 8];
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 7) {
+            for (size_t len = 0; len + offset <= size; len += 41) {
+                strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+
+                for (const char *ch = "xY@`[{z"; *ch; ch++) {
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_memchr_nocase(view, *ch),
+                                                     strider_memchr_nocase_simd(view, *ch),
+                                                     strider_backend_name(b));
+                }
+                for (size_t k = 2; k <= 5; k++) {
+                    strider_buffer_view_t needle = strider_buffer_view_create(buffer + 500 + k, k);
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(strider_strstr_nocase(view, needle),
+                                                     strider_strstr_nocase_simd(view, needle),
+                                                     strider_backend_name(b));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend scans text like the scalar reference
+ */
+void test_dispatch_text_scan_all_backends(void) {
+    static const char *const pieces[] = {"ab", "\n", "\r\n", "\r", "\xc3\xa9", "\xe2\x82\xac",
+                                         "\xf0\x9f\x98\x80"};
+    size_t size = 600;
+    char *buffer = (char *) malloc(size + 4);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(626);
+    for (size_t n = 0; n < size;) {
+        const char *piece = pieces[rand() % 7];
+        memcpy(buffer + n, piece, strlen(piece));
+        n += strlen(piece);
+    }
+    buffer[500] = (char) 0xA9; /* Stray continuation, unless it lands on one */
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t offset = 0; offset < 64; offset += 13) {
+            for (size_t len = 0; len + offset <= size; len += 37) {
+                strider_text_stats_t expected;
+                strider_text_stats_t actual;
+
+                strider_scan_text(buffer + offset, len, 16, &expected);
+                TEST_ASSERT_EQUAL_INT(0, strider_scan_text_simd(buffer + offset, len, 16, &actual));
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(&expected, &actual, sizeof(expected),
+                                                 strider_backend_name(b));
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Every supported backend matches pattern sets like the scalar reference
+ */
+void test_dispatch_multi_pattern_all_backends(void) {
+    /* Small set (Teddy where available) and large set (Aho-Corasick) */
+    const size_t set_sizes[] = {8, 100};
+    size_t size = 500;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    strider_match_t *expected = (strider_match_t *) malloc(size * 8 * sizeof(strider_match_t));
+    strider_match_t *actual = (strider_match_t *) malloc(size * 8 * sizeof(strider_match_t));
+    strider_buffer_view_t views[100];
+    strider_multi_pattern_t *sets[2];
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(606);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) ('a' + rand() % 5);
+    }
+    for (size_t s = 0; s < 2; s++) {
+        for (size_t i = 0; i < set_sizes[s]; i++) {
+            size_t length = 2 + (size_t) rand() % 6;
+            views[i] = strider_buffer_view_create(buffer + (size_t) rand() % (size - length),
+                                                  length);
+        }
+        sets[s] = strider_multi_pattern_create(views, set_sizes[s]);
+        TEST_ASSERT_NOT_NULL(sets[s]);
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t s = 0; s < 2; s++) {
+            for (size_t len = 0; len <= size; len += 97) {
+                strider_buffer_view_t view = strider_buffer_view_create(buffer, len);
+                size_t n = strider_multi_pattern_find(sets[s], view, expected, size * 8);
+                size_t m = strider_multi_pattern_find_simd(sets[s], view, actual, size * 8);
+                TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+                for (size_t i = 0; i < n; i++) {
+                    TEST_ASSERT_EQUAL_UINT32_MESSAGE(expected[i].pattern_id, actual[i].pattern_id,
+                                                     strider_backend_name(b));
+                    TEST_ASSERT_EQUAL_size_t_MESSAGE(expected[i].offset, actual[i].offset,
+                                                     strider_backend_name(b));
+                }
+            }
+        }
+    }
+
+    strider_multi_pattern_destroy(sets[0]);
+    strider_multi_pattern_destroy(sets[1]);
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: Every supported backend parses line timestamps like the scalar reference
+ */
+void test_dispatch_timestamps_all_backends(void) {
+    static const char *const stamps[] = {"2025-12-31T23:59:59.123Z", "2025-02-29 10:00:00",
+                                         "Dec 31 23:59:59", "Jan  9 08:07:06", "1767225599.5",
+                                         "2025-12-31T23:59:59+01:00", "2025-12-31T2:59:59"};
+    static const strider_timestamp_format_t formats[] = {
+        STRIDER_TIMESTAMP_ISO8601, STRIDER_TIMESTAMP_SYSLOG, STRIDER_TIMESTAMP_EPOCH};
+    const size_t lines = 400;
+    char *text = (char *) malloc(lines * 48);
+    size_t *positions = (size_t *) malloc(lines * sizeof(size_t));
+    int64_t *expected = (int64_t *) malloc(lines * sizeof(int64_t));
+    int64_t *actual = (int64_t *) malloc(lines * sizeof(int64_t));
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    /* Random stamps, some cut short, with message text and mixed endings */
+    srand(1606);
+    for (size_t i = 0; i < lines; i++) {
+        const char *stamp = stamps[(size_t) rand() % 7];
+        size_t length = strlen(stamp);
+        if (rand() % 4 == 0) {
+            length = (size_t) rand() % (length + 1);
+        }
+        memcpy(text + size, stamp, length);
+        size += length;
+        size += (size_t) sprintf(text + size, " msg%d", rand() % 100);
+        text[size++] = '\n';
+        if (rand() % 3 == 0) {
+            text[size - 1] = '\r';
+            text[size++] = '\n';
+        }
+    }
+    const size_t count = strider_find_newline_positions(text, size, positions, lines);
+    TEST_ASSERT_EQUAL_size_t(lines, count);
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t f = 0; f < 3; f++) {
+            size_t n = strider_parse_timestamps(text, size, positions, count, formats[f], 2025,
+                                                expected);
+            size_t m = strider_parse_timestamps_simd(text, size, positions, count, formats[f],
+                                                     2025, actual);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+            TEST_ASSERT_EQUAL_INT64_ARRAY_MESSAGE(expected, actual, count,
+                                                  strider_backend_name(b));
+        }
+    }
+
+    free(text);
+    free(positions);
+    free(expected);
+    free(actual);
+}
+
+void test_dispatch_levels_all_backends(void) {
+    static const char *const words[] = {"[ERROR]", "warn", "WARNING", "INFO:", "infos",
+                                        "debug", "msg", "12:00:00", "FATAL", "ok"};
+    const size_t lines = 500;
+    char *text = (char *) malloc(lines * 80);
+    size_t *positions = (size_t *) malloc(lines * sizeof(size_t));
+    uint64_t expected[(500 + 63) / 64];
+    uint64_t actual[(500 + 63) / 64];
+    strider_level_set_t set;
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init_default(&set));
+
+    /* Random words, some lines longer than the window, mixed endings */
+    srand(1707);
+    for (size_t i = 0; i < lines; i++) {
+        const int n = rand() % 10;
+        for (int w = 0; w < n; w++) {
+            size += (size_t) sprintf(text + size, "%s ", words[rand() % 10]);
+        }
+        text[size++] = '\n';
+        if (rand() % 3 == 0) {
+            text[size - 1] = '\r';
+            text[size++] = '\n';
+        }
+    }
+    const size_t count = strider_find_newline_positions(text, size, positions, lines);
+    TEST_ASSERT_EQUAL_size_t(lines, count);
+
+    const uint32_t levels = STRIDER_LEVEL_BIT(STRIDER_LEVEL_ERROR) |
+                            STRIDER_LEVEL_BIT(STRIDER_LEVEL_WARN) |
+                            STRIDER_LEVEL_BIT(STRIDER_LEVEL_FATAL);
+    size_t n = strider_filter_levels(text, size, positions, count, &set, levels, expected);
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        size_t m = strider_filter_levels_simd(text, size, positions, count, &set, levels, actual);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+        TEST_ASSERT_EQUAL_HEX64_ARRAY_MESSAGE(expected, actual, (count + 63) / 64,
+                                              strider_backend_name(b));
+    }
+
+    free(text);
+    free(positions);
+}
+
+void test_dispatch_tokenize_all_backends(void) {
+    static const char alphabet[] = "ab ,=|;\"\\{}:x";
+    static const char many[] = " ,=|;{}:!#$%&()*+-./<>?@";
+    const size_t lines = 300;
+    char *text = (char *) malloc(lines * 150);
+    size_t *positions = (size_t *) malloc(lines * sizeof(size_t));
+    strider_field_span_t *expected = (strider_field_span_t *) malloc(lines * 150 * 8);
+    strider_field_span_t *actual = (strider_field_span_t *) malloc(lines * 150 * 8);
+    size_t *expected_index = (size_t *) malloc((lines + 1) * sizeof(size_t));
+    size_t *actual_index = (size_t *) malloc((lines + 1) * sizeof(size_t));
+    strider_tokenizer_t toks[3];
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+    TEST_ASSERT_NOT_NULL(expected_index);
+    TEST_ASSERT_NOT_NULL(actual_index);
+
+    /* More than 16 separators takes the fallback on SSE2 */
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init_format(&toks[0], STRIDER_TOKENIZE_LOGFMT));
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init_format(&toks[1], STRIDER_TOKENIZE_CSV));
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&toks[2], many, sizeof(many) - 1, '"', '\\',
+                                                    true));
+
+    srand(1808);
+    for (size_t i = 0; i < lines; i++) {
+        const size_t length = (size_t) rand() % 150;
+        for (size_t j = 0; j < length; j++) {
+            text[size++] = alphabet[rand() % (int) (sizeof(alphabet) - 1)];
+        }
+        text[size++] = '\n';
+    }
+    const size_t count = strider_find_newline_positions(text, size, positions, lines);
+    TEST_ASSERT_EQUAL_size_t(lines, count);
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+        for (size_t t = 0; t < 3; t++) {
+            size_t n = strider_tokenize_lines(&toks[t], text, size, positions, count, expected,
+                                              lines * 150, expected_index);
+            size_t m = strider_tokenize_lines_simd(&toks[t], text, size, positions, count, actual,
+                                                   lines * 150, actual_index);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(count, n, strider_backend_name(b));
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, strider_backend_name(b));
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected_index, actual_index,
+                                             (count + 1) * sizeof(size_t),
+                                             strider_backend_name(b));
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, actual,
+                                             expected_index[count] * sizeof(strider_field_span_t),
+                                             strider_backend_name(b));
+        }
+    }
+
+    free(text);
+    free(positions);
+    free(expected);
+    free(actual);
+    free(expected_index);
+    free(actual_index);
+}
+
+void test_dispatch_logs_all_backends(void) {
+    static const char *const parts[] = {"2025-12-31T23:59:59Z ", "[2025-12-31 23:59:59.5] ",
+                                        "ERROR ", "[warn]: ", "info - ", "level=debug ",
+                                        "ts=1767225599 ", "msg=\"a b\" ", "{\"msg\": \"x\"} ",
+                                        "text "};
+    const size_t lines = 400;
+    char *text = (char *) malloc(lines * 200);
+    size_t offsets[2][400];
+    int64_t timestamps[2][400];
+    int8_t levels[2][400];
+    strider_buffer_view_t messages[2][400];
+    strider_log_format_t formats[3];
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&formats[0], STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&formats[1], STRIDER_LOG_LOGFMT,
+                                                     STRIDER_TIMESTAMP_EPOCH, 0));
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&formats[2], STRIDER_LOG_JSON,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+
+    /* Random parts, mixed endings, the last line unterminated */
+    srand(1909);
+    for (size_t i = 0; i < lines; i++) {
+        const int n = rand() % 8;
+        for (int w = 0; w < n; w++) {
+            size += (size_t) sprintf(text + size, "%s", parts[rand() % 10]);
+        }
+        if (i + 1 < lines) {
+            text[size++] = '\n';
+            if (rand() % 3 == 0) {
+                text[size - 1] = '\r';
+                text[size++] = '\n';
+            }
+        }
+    }
+
+    for (size_t f = 0; f < 3; f++) {
+        for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+            const int out = b != STRIDER_BACKEND_SCALAR;
+            const strider_log_columns_t columns = {offsets[out], timestamps[out], levels[out],
+                                                   messages[out]};
+            size_t consumed = 0;
+
+            if (!strider_backend_is_supported((strider_backend_t) b)) {
+                continue;
+            }
+            TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+
+            size_t n = strider_parse_logs(&formats[f], text, size, &columns, lines, &consumed);
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(lines, n, strider_backend_name(b));
+            TEST_ASSERT_EQUAL_size_t_MESSAGE(size, consumed, strider_backend_name(b));
+            if (out) {
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(offsets[0], offsets[1], sizeof(offsets[0]),
+                                                 strider_backend_name(b));
+                TEST_ASSERT_EQUAL_INT64_ARRAY_MESSAGE(timestamps[0], timestamps[1], lines,
+                                                      strider_backend_name(b));
+                TEST_ASSERT_EQUAL_INT8_ARRAY_MESSAGE(levels[0], levels[1], lines,
+                                                     strider_backend_name(b));
+                TEST_ASSERT_EQUAL_MEMORY_MESSAGE(messages[0], messages[1], sizeof(messages[0]),
+                                                 strider_backend_name(b));
+            }
+        }
+    }
+
+    free(text);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Backend selection */
+    RUN_TEST(test_dispatch_active_backend_supported);
+    RUN_TEST(test_dispatch_scalar_always_supported);
+    RUN_TEST(test_dispatch_auto_prefers_widest);
+    RUN_TEST(test_dispatch_set_unsupported_backend);
+    RUN_TEST(test_dispatch_backend_names);
+    RUN_TEST(test_dispatch_concurrent_backend_switch);
+
+    /* Cross-backend equivalence */
+    RUN_TEST(test_dispatch_newlines_all_backends);
+    RUN_TEST(test_dispatch_newline_positions_all_backends);
+    RUN_TEST(test_dispatch_compact_positions_all_backends);
+    RUN_TEST(test_dispatch_strchr_all_backends);
+    RUN_TEST(test_dispatch_page_boundaries_all_backends);
+    RUN_TEST(test_dispatch_memchr_all_backends);
+    RUN_TEST(test_dispatch_batch_search_all_backends);
+    RUN_TEST(test_dispatch_byteset_all_backends);
+    RUN_TEST(test_dispatch_strstr_all_backends);
+    RUN_TEST(test_dispatch_nocase_search_all_backends);
+    RUN_TEST(test_dispatch_text_scan_all_backends);
+    RUN_TEST(test_dispatch_multi_pattern_all_backends);
+    RUN_TEST(test_dispatch_timestamps_all_backends);
+    RUN_TEST(test_dispatch_levels_all_backends);
+    RUN_TEST(test_dispatch_tokenize_all_backends);
+    RUN_TEST(test_dispatch_logs_all_backends);
+
+    return UNITY_END();
+}
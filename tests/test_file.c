@@ -0,0 +1,162 @@
+/**
+ * @file test_file.c
+ * @brief Unit tests for memory-mapped file input
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Writes scratch files into the test working directory, maps them and
+ * checks the view contents and the buffered fallback.
+ */
+
+#include "strider/io/file.h"
+#include "strider/parsers/newline.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__linux__)
+#    include <unistd.h>
+#endif
+
+#define SCRATCH_PATH "strider_test_file.tmp"
+
+static void write_scratch(const void *data, size_t size) {
+    FILE *fp = fopen(SCRATCH_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_size_t(size, fwrite(data, 1, size, fp));
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    remove(SCRATCH_PATH);
+}
+
+/* ========================================================================
+ * Mapping Tests
+ * ======================================================================== */
+
+/**
+ * Test: Mapped view holds the file contents
+ */
+void test_file_map_contents(void) {
+    const char text[] = "first\nsecond\r\nthird\n";
+    strider_file_t file;
+
+    write_scratch(text, sizeof(text) - 1);
+
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&file, SCRATCH_PATH, STRIDER_FILE_DEFAULT));
+    TEST_ASSERT_TRUE(file.mapped);
+
+    strider_buffer_view_t view = strider_file_view(&file);
+    TEST_ASSERT_EQUAL_size_t(sizeof(text) - 1, view.size);
+    TEST_ASSERT_EQUAL_MEMORY(text, view.data, view.size);
+    TEST_ASSERT_EQUAL_size_t(3, strider_count_newlines_simd((const char *) view.data, view.size));
+
+    strider_file_close(&file);
+    TEST_ASSERT_NULL(file.data);
+    TEST_ASSERT_EQUAL_size_t(0, file.size);
+}
+
+/**
+ * Test: Every hint combination maps a multi-page file
+ */
+void test_file_map_all_hints(void) {
+    size_t size = 3 * 4096 + 17;
+    char *data = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(data);
+
+    for (size_t i = 0; i < size; i++) {
+        data[i] = (i % 80 == 79) ? '\n' : 'x';
+    }
+    write_scratch(data, size);
+
+    for (unsigned flags = 0; flags < 16; flags++) {
+        strider_file_t file;
+
+        TEST_ASSERT_EQUAL_INT(0, strider_file_open(&file, SCRATCH_PATH, flags));
+        TEST_ASSERT_EQUAL_size_t(size, file.size);
+        TEST_ASSERT_EQUAL_MEMORY(data, file.data, size);
+        strider_file_close(&file);
+    }
+
+    free(data);
+}
+
+/**
+ * Test: Empty file gives an empty view
+ */
+void test_file_empty(void) {
+    strider_file_t file;
+
+    write_scratch("", 0);
+
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&file, SCRATCH_PATH, STRIDER_FILE_DEFAULT));
+    TEST_ASSERT_EQUAL_size_t(0, file.size);
+    TEST_ASSERT_TRUE(strider_buffer_view_is_empty(strider_file_view(&file)));
+    strider_file_close(&file);
+}
+
+/**
+ * Test: Missing file and invalid arguments fail cleanly
+ */
+void test_file_open_errors(void) {
+    strider_file_t file;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_file_open(&file, "does/not/exist.log", 0));
+    TEST_ASSERT_NULL(file.data);
+    TEST_ASSERT_EQUAL_INT(-1, strider_file_open(&file, NULL, 0));
+    TEST_ASSERT_EQUAL_INT(-1, strider_file_open(NULL, SCRATCH_PATH, 0));
+
+    /* Closing a zeroed or already closed file is harmless */
+    strider_file_close(&file);
+    strider_file_close(NULL);
+}
+
+/**
+ * Test: Pipes are read into a buffer instead of mapped
+ */
+void test_file_pipe_fallback(void) {
+#if defined(__linux__)
+    const char text[] = "from\na\npipe\n";
+    char path[64];
+    int fds[2];
+    strider_file_t file;
+
+    TEST_ASSERT_EQUAL_INT(0, pipe(fds));
+    TEST_ASSERT_EQUAL_INT((int) sizeof(text) - 1, (int) write(fds[1], text, sizeof(text) - 1));
+    close(fds[1]);
+
+    snprintf(path, sizeof(path), "/dev/fd/%d", fds[0]);
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&file, path, STRIDER_FILE_DEFAULT));
+    TEST_ASSERT_FALSE(file.mapped);
+    TEST_ASSERT_EQUAL_size_t(sizeof(text) - 1, file.size);
+    TEST_ASSERT_EQUAL_MEMORY(text, file.data, file.size);
+
+    strider_file_close(&file);
+    close(fds[0]);
+#else
+    TEST_IGNORE_MESSAGE("/dev/fd not available");
+#endif
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_file_map_contents);
+    RUN_TEST(test_file_map_all_hints);
+    RUN_TEST(test_file_empty);
+    RUN_TEST(test_file_open_errors);
+    RUN_TEST(test_file_pipe_fallback);
+
+    return UNITY_END();
+}
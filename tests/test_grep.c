@@ -0,0 +1,306 @@
+/**
+ * @file test_grep.c
+ * @brief Unit tests for the parallel line search engine
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Compares the reported lines, in order, with a line-by-line reference
+ * search, on inputs with lines and \r\n pairs crossing chunk seams,
+ * chunks with more matches than they record at once, and several
+ * batches of chunks.
+ */
+
+#include "strider/io/grep.h"
+#include "strider/utils/thread_pool.h"
+#include "unity.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CHUNK STRIDER_GREP_CHUNK_SIZE
+#define SCRATCH_PATH "strider_test_grep.tmp"
+
+static strider_thread_pool_t *pool;
+static strider_executor_t executor;
+
+void setUp(void) {
+    pool = strider_thread_pool_create(3);
+    TEST_ASSERT_NOT_NULL(pool);
+    executor = strider_thread_pool_executor(pool);
+}
+
+void tearDown(void) {
+    strider_thread_pool_destroy(pool);
+    remove(SCRATCH_PATH);
+}
+
+/* ========================================================================
+ * Reference
+ * ======================================================================== */
+
+typedef struct {
+    size_t count;
+    size_t capacity;
+    strider_grep_line_t *lines;
+    size_t stop_after; /* Stop the search after this many lines (0: never) */
+} collected_t;
+
+static int collect_line(void *context, const strider_grep_line_t *line) {
+    collected_t *out = (collected_t *) context;
+
+    if (out->count == out->capacity) {
+        out->capacity = out->capacity ? 2 * out->capacity : 64;
+        out->lines = (strider_grep_line_t *) realloc(out->lines,
+                                                     out->capacity * sizeof(*out->lines));
+        TEST_ASSERT_NOT_NULL(out->lines);
+    }
+    out->lines[out->count++] = *line;
+    return out->stop_after != 0 && out->count == out->stop_after;
+}
+
+static bool line_contains(const char *line, size_t size, const char *pattern) {
+    const size_t length = strlen(pattern);
+
+    for (size_t i = 0; i + length <= size; i++) {
+        if (memcmp(line + i, pattern, length) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Line-by-line search for any of the patterns; lines end at \n, \r\n or \r */
+static void reference_grep(const char *data, size_t size, const char *const *patterns,
+                           size_t count, collected_t *out) {
+    size_t start = 0;
+    size_t number = 1;
+
+    while (start < size) {
+        size_t end = start;
+        while (end < size && data[end] != '\n' && data[end] != '\r') {
+            end++;
+        }
+        for (size_t p = 0; p < count; p++) {
+            if (line_contains(data + start, end - start, patterns[p])) {
+                strider_grep_line_t line = {strider_buffer_view_create(data + start, end - start),
+                                            start, number};
+                collect_line(out, &line);
+                break;
+            }
+        }
+        start = (end + 1 < size && data[end] == '\r' && data[end + 1] == '\n') ? end + 2 : end + 1;
+        number++;
+    }
+}
+
+/* Grep with and without the pool must both report the reference lines */
+static void assert_grep(const char *data, size_t size, const char *const *patterns,
+                        size_t count) {
+    strider_buffer_view_t views[8];
+    collected_t expected = {0, 0, NULL, 0};
+
+    for (size_t p = 0; p < count; p++) {
+        views[p] = strider_buffer_view_from_cstr(patterns[p]);
+    }
+    reference_grep(data, size, patterns, count, &expected);
+
+    strider_grep_t *grep = strider_grep_create(views, count, STRIDER_GREP_LINE_NUMBERS);
+    TEST_ASSERT_NOT_NULL(grep);
+
+    for (int parallel = 0; parallel < 2; parallel++) {
+        collected_t actual = {0, 0, NULL, 0};
+        size_t lines;
+
+        TEST_ASSERT_EQUAL_INT(0, strider_grep_buffer(grep, strider_buffer_view_create(data, size),
+                                                     parallel ? &executor : NULL, collect_line,
+                                                     &actual, &lines));
+        TEST_ASSERT_EQUAL_size_t(expected.count, lines);
+        TEST_ASSERT_EQUAL_size_t(expected.count, actual.count);
+        for (size_t i = 0; i < expected.count; i++) {
+            TEST_ASSERT_EQUAL_size_t(expected.lines[i].offset, actual.lines[i].offset);
+            TEST_ASSERT_EQUAL_size_t(expected.lines[i].text.size, actual.lines[i].text.size);
+            TEST_ASSERT_EQUAL_size_t(expected.lines[i].number, actual.lines[i].number);
+            TEST_ASSERT_EQUAL_PTR(expected.lines[i].text.data, actual.lines[i].text.data);
+        }
+        free(actual.lines);
+    }
+
+    strider_grep_destroy(grep);
+    free(expected.lines);
+}
+
+/* ========================================================================
+ * Tests
+ * ======================================================================== */
+
+/**
+ * Test: Lines of a small buffer, with every kind of line ending
+ */
+void test_grep_small_buffer(void) {
+    const char *text = "INFO ok\nERROR disk\r\nWARN ERROR twice\rno\n\nERROR";
+    const char *one[] = {"ERROR"};
+    const char *two[] = {"disk", "WARN"};
+
+    assert_grep(text, strlen(text), one, 1);
+    assert_grep(text, strlen(text), two, 2);
+
+    strider_buffer_view_t pattern = strider_buffer_view_from_cstr("error");
+    strider_grep_t *grep = strider_grep_create(&pattern, 1, STRIDER_GREP_IGNORE_CASE);
+    collected_t lines = {0, 0, NULL, 0};
+    size_t count;
+
+    TEST_ASSERT_NOT_NULL(grep);
+    TEST_ASSERT_EQUAL_INT(0, strider_grep_buffer(grep, strider_buffer_view_from_cstr(text), NULL,
+                                                 collect_line, &lines, &count));
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_size_t(8, lines.lines[0].offset);
+    TEST_ASSERT_EQUAL_size_t(10, lines.lines[0].text.size);
+    TEST_ASSERT_EQUAL_size_t(0, lines.lines[0].number); /* No line numbers asked for */
+    TEST_ASSERT_EQUAL_size_t(strlen(text) - 5, lines.lines[2].offset);
+
+    strider_grep_destroy(grep);
+    free(lines.lines);
+}
+
+/**
+ * Test: Invalid patterns and arguments
+ */
+void test_grep_invalid_arguments(void) {
+    strider_buffer_view_t patterns[2] = {strider_buffer_view_from_cstr("a"),
+                                         strider_buffer_view_from_cstr("b\nc")};
+    strider_buffer_view_t empty = strider_buffer_view_from_cstr("");
+    size_t lines = 7;
+
+    TEST_ASSERT_NULL(strider_grep_create(NULL, 1, 0));
+    TEST_ASSERT_NULL(strider_grep_create(patterns, 0, 0));
+    TEST_ASSERT_NULL(strider_grep_create(&empty, 1, 0));
+    TEST_ASSERT_NULL(strider_grep_create(patterns, 2, 0));
+    TEST_ASSERT_NULL(strider_grep_create(patterns, 2, STRIDER_GREP_IGNORE_CASE));
+
+    strider_grep_t *grep = strider_grep_create(patterns, 1, 0);
+    TEST_ASSERT_NOT_NULL(grep);
+    TEST_ASSERT_EQUAL_INT(-1, strider_grep_buffer(NULL, empty, NULL, NULL, NULL, &lines));
+    TEST_ASSERT_EQUAL_INT(-1, strider_grep_buffer(grep, strider_buffer_view_create(NULL, 4), NULL,
+                                                  NULL, NULL, &lines));
+    TEST_ASSERT_EQUAL_INT(0, strider_grep_buffer(grep, empty, NULL, NULL, NULL, &lines));
+    TEST_ASSERT_EQUAL_size_t(0, lines);
+    TEST_ASSERT_EQUAL_INT(-1, strider_grep_file(grep, "does/not/exist", NULL, NULL, NULL, &lines));
+    strider_grep_destroy(grep);
+}
+
+/**
+ * Test: Lines and \r\n pairs across chunk seams, lines spanning chunks
+ */
+void test_grep_chunk_seams(void) {
+    const size_t size = 6 * CHUNK;
+    char *buffer = (char *) malloc(size);
+    const char *patterns[] = {"needle"};
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(27);
+    for (size_t i = 0; i < size; i++) {
+        const int r = rand() % 60;
+        buffer[i] = r == 0 ? '\n' : r == 1 ? '\r' : 'k';
+    }
+    /* Line ending right at, before and after a seam */
+    memcpy(buffer + CHUNK - 7, "needle\r\n", 8);
+    memcpy(buffer + 2 * CHUNK - 6, "needle\r\n", 8);
+    memcpy(buffer + 3 * CHUNK - 3, "needle", 6);
+    /* A line over two whole chunks, matching at its end */
+    memset(buffer + 3 * CHUNK + 10, 'k', 2 * CHUNK + 100);
+    memcpy(buffer + 5 * CHUNK + 104, "needle", 6);
+    for (size_t i = 4000; i + 6 < size; i += 4099) {
+        memcpy(buffer + i, "needle", 6);
+    }
+    memcpy(buffer + size - 6, "needle", 6); /* Unterminated last line */
+
+    assert_grep(buffer, size, patterns, 1);
+    free(buffer);
+}
+
+/**
+ * Test: Every line matching, so chunks overflow their records, over several batches
+ */
+void test_grep_dense_matches(void) {
+    const size_t size = (STRIDER_GREP_BATCH_CHUNKS + 3) * CHUNK;
+    char *buffer = (char *) malloc(size);
+    const char *patterns[] = {"x", "yz"};
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = "axbyzc\n"[i % 7];
+    }
+    assert_grep(buffer, size, patterns, 2);
+    free(buffer);
+}
+
+/**
+ * Test: A non-zero return from the callback stops the search
+ */
+void test_grep_stop(void) {
+    const size_t size = 3 * CHUNK;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = "hit\n"[i % 4];
+    }
+    strider_buffer_view_t pattern = strider_buffer_view_from_cstr("hit");
+    strider_grep_t *grep = strider_grep_create(&pattern, 1, 0);
+    collected_t lines = {0, 0, NULL, 5000};
+    size_t count;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_grep_buffer(grep, strider_buffer_view_create(buffer, size),
+                                                 &executor, collect_line, &lines, &count));
+    TEST_ASSERT_EQUAL_size_t(5000, count);
+    TEST_ASSERT_EQUAL_size_t(4 * 4999, lines.lines[4999].offset);
+
+    /* Counting only */
+    TEST_ASSERT_EQUAL_INT(0, strider_grep_buffer(grep, strider_buffer_view_create(buffer, size),
+                                                 &executor, NULL, NULL, &count));
+    TEST_ASSERT_EQUAL_size_t(size / 4, count);
+
+    strider_grep_destroy(grep);
+    free(lines.lines);
+    free(buffer);
+}
+
+/**
+ * Test: Searching a mapped file
+ */
+void test_grep_file(void) {
+    const char text[] = "alpha\nbeta needle\ngamma\nneedle\n";
+    FILE *fp = fopen(SCRATCH_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_size_t(sizeof(text) - 1, fwrite(text, 1, sizeof(text) - 1, fp));
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+
+    strider_buffer_view_t pattern = strider_buffer_view_from_cstr("needle");
+    strider_grep_t *grep = strider_grep_create(&pattern, 1, STRIDER_GREP_LINE_NUMBERS);
+    collected_t lines = {0, 0, NULL, 0};
+    size_t count;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_grep_file(grep, SCRATCH_PATH, &executor, collect_line,
+                                               &lines, &count));
+    TEST_ASSERT_EQUAL_size_t(2, count);
+    TEST_ASSERT_EQUAL_size_t(2, lines.lines[0].number);
+    TEST_ASSERT_EQUAL_size_t(4, lines.lines[1].number);
+
+    strider_grep_destroy(grep);
+    free(lines.lines);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_grep_small_buffer);
+    RUN_TEST(test_grep_invalid_arguments);
+    RUN_TEST(test_grep_chunk_seams);
+    RUN_TEST(test_grep_dense_matches);
+    RUN_TEST(test_grep_stop);
+    RUN_TEST(test_grep_file);
+
+    return UNITY_END();
+}
@@ -0,0 +1,297 @@
+/**
+ * @file test_level.c
+ * @brief Unit tests for log level filtering
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "strider/parsers/level.h"
+#include "strider/parsers/newline.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define ERRORS_AND_WARNINGS                                                                        \
+    (STRIDER_LEVEL_BIT(STRIDER_LEVEL_ERROR) | STRIDER_LEVEL_BIT(STRIDER_LEVEL_WARN))
+
+static strider_level_set_t defaults;
+
+void setUp(void) {
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init_default(&defaults));
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* Level of str with a one-line batch through both implementations */
+static int level_of(const strider_level_set_t *set, const char *str) {
+    const size_t size = strlen(str);
+    const size_t position = size;
+    uint64_t scalar_bitmap = 0;
+    uint64_t simd_bitmap = 0;
+    const int level = strider_find_level(set, str, size);
+
+    TEST_ASSERT_EQUAL_INT_MESSAGE(level, strider_find_level_simd(set, str, size), str);
+
+    /* One level at a time: only the level of the line selects it */
+    for (unsigned id = 0; id < 32; id++) {
+        size_t n = strider_filter_levels(str, size, &position, 1, set, STRIDER_LEVEL_BIT(id),
+                                         &scalar_bitmap);
+        size_t m = strider_filter_levels_simd(str, size, &position, 1, set, STRIDER_LEVEL_BIT(id),
+                                              &simd_bitmap);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(level == (int) id, n, str);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, str);
+        TEST_ASSERT_EQUAL_UINT64_MESSAGE(scalar_bitmap, simd_bitmap, str);
+    }
+    return level;
+}
+
+/* ========================================================================
+ * Level Sets
+ * ======================================================================== */
+
+void test_level_set_add_validates(void) {
+    strider_level_set_t set;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_init(&set, 0, false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_init(&set, STRIDER_LEVEL_MAX_WINDOW + 1, false));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init(&set, 32, false));
+
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "NOTICE", STRIDER_LEVEL_CUSTOM));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "NOTICE", STRIDER_LEVEL_INFO));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "", STRIDER_LEVEL_INFO));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "TOOLONGNAME", STRIDER_LEVEL_INFO));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "E1", STRIDER_LEVEL_INFO));
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "OK", 32));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "OK", 31));
+    TEST_ASSERT_EQUAL_INT(2, set.count);
+
+    for (unsigned i = set.count; i < STRIDER_LEVEL_MAX_NAMES; i++) {
+        char name[3] = {'A', (char) ('A' + i), '\0'};
+        TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, name, 1));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, strider_level_set_add(&set, "ZZ", 1));
+}
+
+/* ========================================================================
+ * Level Detection
+ * ======================================================================== */
+
+void test_level_default_names(void) {
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "2025-12-31 ERROR disk full"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_INFO, level_of(&defaults, "INFO started"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_DEBUG, level_of(&defaults, "12:00:01 DEBUG x=1"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_TRACE, level_of(&defaults, "TRACE"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_WARN, level_of(&defaults, "WARN low memory"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_WARN, level_of(&defaults, "WARNING low memory"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_FATAL, level_of(&defaults, "FATAL"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_FATAL, level_of(&defaults, "CRITICAL: on fire"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, "2025-12-31 12:00:00 nothing to see"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, ""));
+}
+
+void test_level_case_insensitive(void) {
+    strider_level_set_t exact;
+
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "error: x"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "Error: x"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_WARN, level_of(&defaults, "wArNiNg"));
+
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init(&exact, 64, false));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&exact, "ERROR", STRIDER_LEVEL_ERROR));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&exact, "ERROR: x"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&exact, "error: x"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&exact, "Error: x"));
+}
+
+void test_level_word_boundaries(void) {
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "[ERROR] x"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "(ERROR) x"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_INFO, level_of(&defaults, "level=info msg=hi"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_WARN, level_of(&defaults, "<warn>"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, "INFORMATION only"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, "ERRORS: 0"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, "NOERROR"));
+
+    /* Digits and underscores separate words too */
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_DEBUG, level_of(&defaults, "1DEBUG2"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_DEBUG, level_of(&defaults, "_debug_"));
+}
+
+void test_level_first_name_wins(void) {
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_INFO, level_of(&defaults, "INFO retrying after ERROR"));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, "app ERROR info"));
+}
+
+void test_level_custom_names(void) {
+    strider_level_set_t set;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init(&set, 64, true));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "NOTICE", STRIDER_LEVEL_CUSTOM));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "E", 20));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "ALERT", 31));
+
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_CUSTOM, level_of(&set, "Dec 31 host notice: x"));
+    TEST_ASSERT_EQUAL_INT(20, level_of(&set, "12:00 E/ActivityManager: x"));
+    TEST_ASSERT_EQUAL_INT(31, level_of(&set, "ALERT"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&set, "ERROR"));
+
+    /* Names added to the defaults */
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&defaults, "NOTICE", STRIDER_LEVEL_CUSTOM));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_CUSTOM, level_of(&defaults, "[notice] x"));
+}
+
+void test_level_window(void) {
+    strider_level_set_t set;
+    char line[128];
+
+    /* ERROR at byte 59: the default 64-byte window sees it whole */
+    memset(line, '.', sizeof(line));
+    memcpy(line + 59, "ERROR", 5);
+    line[70] = '\0';
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_ERROR, level_of(&defaults, line));
+
+    /* At byte 60 it is cut to "ERRO" */
+    memset(line, '.', sizeof(line));
+    memcpy(line + 60, "ERROR", 5);
+    line[70] = '\0';
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, line));
+
+    /* A cut word can still spell a shorter name */
+    memset(line, '.', sizeof(line));
+    memcpy(line + 60, "INFOX", 5);
+    line[70] = '\0';
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_INFO, level_of(&defaults, line));
+
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_init(&set, 8, true));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&set, "INFO", STRIDER_LEVEL_INFO));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LEVEL_INFO, level_of(&set, "    INFO"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&set, "     INFO"));
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&set, "12:00:00 INFO"));
+
+    /* A word filling the whole window */
+    memset(line, 'a', 100);
+    line[100] = '\0';
+    TEST_ASSERT_EQUAL_INT(-1, level_of(&defaults, line));
+}
+
+/* ========================================================================
+ * Batch Filtering
+ * ======================================================================== */
+
+void test_filter_levels_batch(void) {
+    const char *text = "INFO a\n"
+                       "ERROR b\r\n"
+                       "DEBUG c\n"
+                       "\n"
+                       "[warn] d\r"
+                       "error";
+    const size_t size = strlen(text);
+    size_t positions[8];
+    uint64_t bitmap[1] = {~UINT64_C(0)};
+    size_t selection[8];
+
+    /* The last line has no newline of its own: end it at the buffer end */
+    size_t count = strider_find_newline_positions(text, size, positions, 8);
+    TEST_ASSERT_EQUAL_size_t(5, count);
+    positions[count++] = size;
+
+    TEST_ASSERT_EQUAL_size_t(
+        3, strider_filter_levels(text, size, positions, count, &defaults, ERRORS_AND_WARNINGS,
+                                 bitmap));
+    TEST_ASSERT_EQUAL_HEX64(0x32, bitmap[0]);
+    TEST_ASSERT_EQUAL_size_t(3, strider_selection_from_bitmap(bitmap, count, selection));
+    TEST_ASSERT_EQUAL_size_t(1, selection[0]);
+    TEST_ASSERT_EQUAL_size_t(4, selection[1]);
+    TEST_ASSERT_EQUAL_size_t(5, selection[2]);
+
+    bitmap[0] = ~UINT64_C(0);
+    TEST_ASSERT_EQUAL_size_t(
+        3, strider_filter_levels_simd(text, size, positions, count, &defaults,
+                                      ERRORS_AND_WARNINGS, bitmap));
+    TEST_ASSERT_EQUAL_HEX64(0x32, bitmap[0]);
+
+    TEST_ASSERT_EQUAL_size_t(0, strider_filter_levels(text, size, positions, count, &defaults,
+                                                      0, bitmap));
+    TEST_ASSERT_EQUAL_HEX64(0, bitmap[0]);
+}
+
+void test_selection_from_bitmap(void) {
+    const uint64_t bitmap[3] = {UINT64_C(0x8000000000000001), 0, UINT64_C(0xFF)};
+    size_t selection[8];
+
+    TEST_ASSERT_EQUAL_size_t(0, strider_selection_from_bitmap(bitmap, 0, selection));
+
+    /* Bits past count are ignored */
+    TEST_ASSERT_EQUAL_size_t(6, strider_selection_from_bitmap(bitmap, 132, selection));
+    TEST_ASSERT_EQUAL_size_t(0, selection[0]);
+    TEST_ASSERT_EQUAL_size_t(63, selection[1]);
+    TEST_ASSERT_EQUAL_size_t(128, selection[2]);
+    TEST_ASSERT_EQUAL_size_t(131, selection[5]);
+}
+
+void test_filter_levels_simd_matches_scalar(void) {
+    static const char *const words[] = {"ERROR", "error", "[WARN]", "WARNING", "warnings",
+                                        "info", "INFOS", "Debug", "x", "12:00:00",
+                                        "TRACE", "fatal:", "CRITICAL", "CRITICALS", "-"};
+    const size_t lines = 3000;
+    char *text = (char *) malloc(lines * 80);
+    size_t *positions = (size_t *) malloc(lines * sizeof(size_t));
+    uint64_t *expected = (uint64_t *) malloc((lines + 63) / 64 * sizeof(uint64_t));
+    uint64_t *actual = (uint64_t *) malloc((lines + 63) / 64 * sizeof(uint64_t));
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(17);
+    for (size_t i = 0; i < lines; i++) {
+        const size_t end = size + (size_t) (rand() % 76);
+        while (size < end) {
+            const char *word = words[rand() % 15];
+            const size_t length = strlen(word);
+            if (size + length > end) {
+                break;
+            }
+            memcpy(text + size, word, length);
+            size += length;
+            text[size++] = ' ';
+        }
+        text[size++] = '\n';
+    }
+    TEST_ASSERT_EQUAL_size_t(lines, strider_find_newline_positions(text, size, positions, lines));
+
+    for (uint32_t levels = 1; levels < 64; levels += 5) {
+        size_t n = strider_filter_levels(text, size, positions, lines, &defaults, levels,
+                                         expected);
+        size_t m = strider_filter_levels_simd(text, size, positions, lines, &defaults, levels,
+                                              actual);
+        TEST_ASSERT_EQUAL_size_t(n, m);
+        TEST_ASSERT_EQUAL_HEX64_ARRAY(expected, actual, (lines + 63) / 64);
+    }
+
+    free(text);
+    free(positions);
+    free(expected);
+    free(actual);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_level_set_add_validates);
+    RUN_TEST(test_level_default_names);
+    RUN_TEST(test_level_case_insensitive);
+    RUN_TEST(test_level_word_boundaries);
+    RUN_TEST(test_level_first_name_wins);
+    RUN_TEST(test_level_custom_names);
+    RUN_TEST(test_level_window);
+    RUN_TEST(test_filter_levels_batch);
+    RUN_TEST(test_selection_from_bitmap);
+    RUN_TEST(test_filter_levels_simd_matches_scalar);
+
+    return UNITY_END();
+}
@@ -0,0 +1,306 @@
+/**
+ * @file test_line_index.c
+ * @brief Unit tests for line index sidecar files
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Builds indexes over scratch files and checks every lookup against the
+ * scalar newline reference, including after appends and rewrites.
+ */
+
+#include "strider/io/file.h"
+#include "strider/io/line_index.h"
+#include "strider/parsers/newline.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SOURCE_PATH "strider_test_line_index.log"
+#define INDEX_PATH "strider_test_line_index.idx"
+
+static void write_source(const char *mode, const void *data, size_t size) {
+    FILE *fp = fopen(SOURCE_PATH, mode);
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_size_t(size, fwrite(data, 1, size, fp));
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+}
+
+/* Lines of varying length with mixed \n, \r\n and \r endings */
+static char *make_log(size_t lines, unsigned seed, size_t *size) {
+    char *text = (char *) malloc(lines * 300 + 1);
+    size_t n = 0;
+
+    TEST_ASSERT_NOT_NULL(text);
+    for (size_t i = 0; i < lines; i++) {
+        seed = seed * 1103515245u + 12345u;
+        const size_t length = (seed >> 16) % 280;
+        for (size_t j = 0; j < length; j++) {
+            text[n++] = (char) ('a' + (i + j) % 26);
+        }
+        switch ((seed >> 8) % 5) {
+        case 0:
+            text[n++] = '\r';
+            text[n++] = '\n';
+            break;
+        case 1:
+            text[n++] = '\r';
+            break;
+        default:
+            text[n++] = '\n';
+            break;
+        }
+    }
+    *size = n;
+    return text;
+}
+
+/* Every indexed position must match the scalar reference over the file */
+static void check_index_matches_source(void) {
+    strider_file_t source;
+    strider_line_index_t *index = strider_line_index_open(INDEX_PATH);
+
+    TEST_ASSERT_NOT_NULL(index);
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&source, SOURCE_PATH, 0));
+
+    const size_t expected = strider_count_newlines((const char *) source.data, source.size);
+    size_t *positions = (size_t *) malloc((expected + 1) * sizeof(size_t));
+    TEST_ASSERT_NOT_NULL(positions);
+    strider_find_newline_positions((const char *) source.data, source.size, positions, expected);
+
+    TEST_ASSERT_EQUAL_size_t(source.size, strider_line_index_source_size(index));
+    TEST_ASSERT_EQUAL_size_t(expected, strider_line_index_count(index));
+    for (size_t i = 0; i < expected; i++) {
+        TEST_ASSERT_EQUAL_size_t(positions[i], strider_line_index_position(index, i));
+    }
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_line_index_position(index, expected));
+
+    free(positions);
+    strider_file_close(&source);
+    strider_line_index_close(index);
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    remove(SOURCE_PATH);
+    remove(INDEX_PATH);
+}
+
+/* ========================================================================
+ * Build and Lookup Tests
+ * ======================================================================== */
+
+/**
+ * Test: Positions across many blocks match a full scan
+ */
+void test_line_index_build_positions(void) {
+    size_t size;
+    char *text = make_log(2000, 1, &size);
+
+    write_source("wb", text, size);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+    free(text);
+}
+
+/**
+ * Test: Line views strip endings and include the unterminated last line
+ */
+void test_line_index_lines(void) {
+    const char text[] = "alpha\r\n\nbeta\rgamma\r\n\r\ndelta";
+    strider_buffer_view_t line;
+    strider_file_t source;
+
+    write_source("wb", text, sizeof(text) - 1);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+
+    strider_line_index_t *index = strider_line_index_open(INDEX_PATH);
+    TEST_ASSERT_NOT_NULL(index);
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&source, SOURCE_PATH, 0));
+    strider_buffer_view_t view = strider_file_view(&source);
+
+    const char *expected[] = {"alpha", "", "beta", "gamma", "", "delta"};
+    TEST_ASSERT_EQUAL_size_t(5, strider_line_index_count(index));
+    for (size_t i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_INT(0, strider_line_index_line(index, view, i, &line));
+        TEST_ASSERT_EQUAL_size_t(strlen(expected[i]), line.size);
+        if (line.size > 0) {
+            TEST_ASSERT_EQUAL_MEMORY(expected[i], line.data, line.size);
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(-1, strider_line_index_line(index, view, 6, &line));
+
+    strider_file_close(&source);
+    strider_line_index_close(index);
+}
+
+/**
+ * Test: A source ending in a newline has no extra trailing line
+ */
+void test_line_index_terminated_source(void) {
+    const char text[] = "one\ntwo\n";
+    strider_buffer_view_t line;
+    strider_file_t source;
+
+    write_source("wb", text, sizeof(text) - 1);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+
+    strider_line_index_t *index = strider_line_index_open(INDEX_PATH);
+    TEST_ASSERT_NOT_NULL(index);
+    TEST_ASSERT_EQUAL_INT(0, strider_file_open(&source, SOURCE_PATH, 0));
+
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_line(index, strider_file_view(&source), 1, &line));
+    TEST_ASSERT_EQUAL_MEMORY("two", line.data, 3);
+    TEST_ASSERT_EQUAL_INT(-1,
+                          strider_line_index_line(index, strider_file_view(&source), 2, &line));
+
+    strider_file_close(&source);
+    strider_line_index_close(index);
+}
+
+/**
+ * Test: An empty source gives an empty index
+ */
+void test_line_index_empty_source(void) {
+    write_source("wb", "", 0);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+}
+
+/**
+ * Test: Missing and foreign files are rejected
+ */
+void test_line_index_invalid(void) {
+    TEST_ASSERT_NULL(strider_line_index_open(INDEX_PATH));
+    TEST_ASSERT_EQUAL_INT(-1, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+
+    /* A plain text file is not an index */
+    FILE *fp = fopen(INDEX_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    for (int i = 0; i < 1000; i++) {
+        fputs("not an index\n", fp);
+    }
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+    TEST_ASSERT_NULL(strider_line_index_open(INDEX_PATH));
+}
+
+/* ========================================================================
+ * Update Tests
+ * ======================================================================== */
+
+/**
+ * Test: Update creates a missing index
+ */
+void test_line_index_update_creates(void) {
+    size_t size;
+    char *text = make_log(300, 2, &size);
+
+    write_source("wb", text, size);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+    free(text);
+}
+
+/**
+ * Test: Repeated appends extend partial blocks in place
+ */
+void test_line_index_update_appends(void) {
+    size_t size;
+    char *text = make_log(1500, 3, &size);
+    size_t written = size / 3;
+
+    write_source("wb", text, written);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+
+    /* Uneven slices so block and \r\n boundaries fall everywhere */
+    for (size_t step = 1; written < size; step = step * 7 % 4093 + 1) {
+        const size_t n = size - written < step ? size - written : step;
+        write_source("ab", text + written, n);
+        written += n;
+        TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+        check_index_matches_source();
+    }
+    free(text);
+}
+
+/**
+ * Test: A \r\n pair split by an update is counted once
+ */
+void test_line_index_update_split_crlf(void) {
+    write_source("wb", "first\r", 6);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+    write_source("ab", "\nsecond\n", 8);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+
+    strider_line_index_t *index = strider_line_index_open(INDEX_PATH);
+    TEST_ASSERT_NOT_NULL(index);
+    TEST_ASSERT_EQUAL_size_t(2, strider_line_index_count(index));
+    TEST_ASSERT_EQUAL_size_t(5, strider_line_index_position(index, 0));
+    TEST_ASSERT_EQUAL_size_t(13, strider_line_index_position(index, 1));
+    strider_line_index_close(index);
+}
+
+/**
+ * Test: Appending past the reserved skip table rebuilds the index
+ */
+void test_line_index_update_grows(void) {
+    size_t size;
+    char *text = make_log(40000, 4, &size);
+
+    write_source("wb", text, 1000);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+    write_source("ab", text + 1000, size - 1000);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+    free(text);
+}
+
+/**
+ * Test: Rewritten or truncated sources are reindexed from scratch
+ */
+void test_line_index_update_rewritten(void) {
+    size_t size_a;
+    size_t size_b;
+    char *a = make_log(800, 5, &size_a);
+    char *b = make_log(800, 6, &size_b);
+
+    write_source("wb", a, size_a);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_build(INDEX_PATH, SOURCE_PATH));
+
+    /* Different content that is longer than the indexed prefix */
+    const size_t size_c = size_a + 64 < size_b ? size_a + 64 : size_b;
+    write_source("wb", b, size_c);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+
+    /* Truncated (log rotation) */
+    write_source("wb", a, size_a / 4);
+    TEST_ASSERT_EQUAL_INT(0, strider_line_index_update(INDEX_PATH, SOURCE_PATH));
+    check_index_matches_source();
+
+    free(a);
+    free(b);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_line_index_build_positions);
+    RUN_TEST(test_line_index_lines);
+    RUN_TEST(test_line_index_terminated_source);
+    RUN_TEST(test_line_index_empty_source);
+    RUN_TEST(test_line_index_invalid);
+    RUN_TEST(test_line_index_update_creates);
+    RUN_TEST(test_line_index_update_appends);
+    RUN_TEST(test_line_index_update_split_crlf);
+    RUN_TEST(test_line_index_update_grows);
+    RUN_TEST(test_line_index_update_rewritten);
+
+    return UNITY_END();
+}
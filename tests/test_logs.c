@@ -0,0 +1,332 @@
+/**
+ * @file test_logs.c
+ * @brief Unit tests for batch log record parsing
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "strider/parsers/logs.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+/* 2025-12-31T23:59:59Z */
+#define NEW_YEARS_EVE INT64_C(1767225599000000000)
+
+#define MAX_RECORDS 16
+
+static size_t offsets[MAX_RECORDS];
+static int64_t timestamps[MAX_RECORDS];
+static int8_t levels[MAX_RECORDS];
+static strider_buffer_view_t messages[MAX_RECORDS];
+static const strider_log_columns_t columns = {offsets, timestamps, levels, messages};
+
+void setUp(void) {
+    memset(offsets, 0xAA, sizeof(offsets));
+    memset(timestamps, 0xAA, sizeof(timestamps));
+    memset(levels, 0xAA, sizeof(levels));
+    memset(messages, 0, sizeof(messages));
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* Parse a NUL-terminated buffer, checking that all of it is consumed */
+static size_t parse(const strider_log_format_t *format, const char *text) {
+    size_t consumed = 0;
+    const size_t n = strider_parse_logs(format, text, strlen(text), &columns, MAX_RECORDS,
+                                        &consumed);
+    TEST_ASSERT_EQUAL_size_t(strlen(text), consumed);
+    return n;
+}
+
+static void assert_message(const char *expected, strider_buffer_view_t message) {
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(strlen(expected), message.size, expected);
+    if (message.size > 0) {
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, message.data, message.size, expected);
+    }
+}
+
+/* ========================================================================
+ * Format Settings
+ * ======================================================================== */
+
+void test_log_format_init_validates(void) {
+    strider_log_format_t format;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_log_format_init(NULL, STRIDER_LOG_TEXT,
+                                                      STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_INT(-1, strider_log_format_init(&format, (strider_log_layout_t) 99,
+                                                      STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_INT(-1, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                      (strider_timestamp_format_t) 99, 0));
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_JSON,
+                                                     STRIDER_TIMESTAMP_EPOCH, 0));
+    TEST_ASSERT_EQUAL_INT(STRIDER_LOG_JSON, format.layout);
+    TEST_ASSERT_EQUAL_INT(STRIDER_TIMESTAMP_EPOCH, format.timestamp_format);
+}
+
+/* ========================================================================
+ * Text Records
+ * ======================================================================== */
+
+void test_parse_logs_text(void) {
+    strider_log_format_t format;
+    const char *text = "2025-12-31T23:59:59Z ERROR disk full\n"
+                       "[2025-12-31 23:59:59] [warn]: slow request\n"
+                       "2025-12-31T23:59:59Z INFO - started\r\n"
+                       "2025-12-31T23:59:59Z (Debug) | tick\n"
+                       "2025-12-31T23:59:59Z INFORMATION only\n"
+                       "no stamp, error somewhere";
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_size_t(6, parse(&format, text));
+
+    TEST_ASSERT_EQUAL_size_t(0, offsets[0]);
+    TEST_ASSERT_EQUAL_size_t(37, offsets[1]);
+    TEST_ASSERT_EQUAL_size_t(strchr(text + 37, '\n') + 1 - text, offsets[2]);
+
+    for (int i = 0; i < 5; i++) {
+        TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[i]);
+    }
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, timestamps[5]);
+
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_ERROR, levels[0]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_WARN, levels[1]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_INFO, levels[2]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_DEBUG, levels[3]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, levels[4]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_ERROR, levels[5]);
+
+    assert_message("disk full", messages[0]);
+    assert_message("slow request", messages[1]);
+    assert_message("started", messages[2]);
+    assert_message("tick", messages[3]);
+    assert_message("INFORMATION only", messages[4]);
+    assert_message("no stamp, error somewhere", messages[5]);
+
+    /* Messages are views into the input */
+    TEST_ASSERT_EQUAL_PTR(text + 27, messages[0].data);
+}
+
+void test_parse_logs_syslog(void) {
+    strider_log_format_t format;
+    const char *text = "Dec 31 23:59:59 host sshd[42]: error: auth failed\n"
+                       "Dec 31 23:59:59 host cron[7]: job done\n";
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_SYSLOG, 2025));
+    TEST_ASSERT_EQUAL_size_t(2, parse(&format, text));
+
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[0]);
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[1]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_ERROR, levels[0]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, levels[1]);
+    assert_message("host sshd[42]: error: auth failed", messages[0]);
+    assert_message("host cron[7]: job done", messages[1]);
+}
+
+void test_parse_logs_custom_levels(void) {
+    strider_log_format_t format;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_EPOCH, 0));
+    TEST_ASSERT_EQUAL_INT(0, strider_level_set_add(&format.levels, "NOTICE",
+                                                   STRIDER_LEVEL_CUSTOM));
+    TEST_ASSERT_EQUAL_size_t(1, parse(&format, "1767225599 NOTICE: rotated\n"));
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[0]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_CUSTOM, levels[0]);
+    assert_message("rotated", messages[0]);
+}
+
+void test_parse_logs_empty_lines(void) {
+    strider_log_format_t format;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_size_t(0, parse(&format, ""));
+    TEST_ASSERT_EQUAL_size_t(3, parse(&format, "\n\r\n\r"));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, timestamps[i]);
+        TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, levels[i]);
+        TEST_ASSERT_EQUAL_size_t(0, messages[i].size);
+    }
+    TEST_ASSERT_EQUAL_size_t(0, offsets[0]);
+    TEST_ASSERT_EQUAL_size_t(1, offsets[1]);
+    TEST_ASSERT_EQUAL_size_t(3, offsets[2]);
+}
+
+/* ========================================================================
+ * Structured Records
+ * ======================================================================== */
+
+void test_parse_logs_logfmt(void) {
+    strider_log_format_t format;
+    const char *text = "ts=2025-12-31T23:59:59Z level=error msg=\"disk full\" host=a\n"
+                       "host=b msg=plain lvl=WARN\n"
+                       "unrelated=1\n";
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_LOGFMT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_size_t(3, parse(&format, text));
+
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[0]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_ERROR, levels[0]);
+    assert_message("disk full", messages[0]);
+
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, timestamps[1]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_WARN, levels[1]);
+    assert_message("plain", messages[1]);
+
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, levels[2]);
+    TEST_ASSERT_EQUAL_size_t(0, messages[2].size);
+}
+
+void test_parse_logs_json(void) {
+    strider_log_format_t format;
+    const char *text =
+        "{\"@timestamp\": 1767225599.5, \"severity\": \"FATAL\", \"message\": \"a, b: c\"}\n"
+        "{\"time\":1767225599,\"msg\":\"quoted \\\"x\\\"\"}\n";
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_JSON,
+                                                     STRIDER_TIMESTAMP_EPOCH, 0));
+    TEST_ASSERT_EQUAL_size_t(2, parse(&format, text));
+
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE + 500000000, timestamps[0]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_FATAL, levels[0]);
+    assert_message("a, b: c", messages[0]);
+
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, timestamps[1]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, levels[1]);
+    assert_message("quoted \\\"x\\\"", messages[1]);
+}
+
+/* ========================================================================
+ * Batching
+ * ======================================================================== */
+
+void test_parse_logs_max_records_and_resume(void) {
+    strider_log_format_t format;
+    const char *text = "1 INFO a\r\n2 WARN b\n3 ERROR c";
+    const size_t size = strlen(text);
+    size_t consumed = 0;
+    size_t total = 0;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_EPOCH, 0));
+    TEST_ASSERT_EQUAL_size_t(0, strider_parse_logs(&format, text, size, &columns, 0, &consumed));
+    TEST_ASSERT_EQUAL_size_t(0, consumed);
+
+    /* One record per call, resuming where the last one stopped */
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_size_t(
+            1, strider_parse_logs(&format, text + total, size - total, &columns, 1, &consumed));
+        TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_INFO + i, levels[0]);
+        TEST_ASSERT_EQUAL_INT64((i + 1) * INT64_C(1000000000), timestamps[0]);
+        total += consumed;
+    }
+    TEST_ASSERT_EQUAL_size_t(size, total);
+    TEST_ASSERT_EQUAL_size_t(0, strider_parse_logs(&format, text + total, 0, &columns, 1,
+                                                   &consumed));
+}
+
+void test_parse_logs_optional_columns(void) {
+    strider_log_format_t format;
+    size_t only_offsets[MAX_RECORDS];
+    const strider_log_columns_t sparse = {only_offsets, NULL, NULL, NULL};
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_size_t(2, strider_parse_logs(&format, "a\nbc\n", 5, &sparse, MAX_RECORDS,
+                                                   NULL));
+    TEST_ASSERT_EQUAL_size_t(0, only_offsets[0]);
+    TEST_ASSERT_EQUAL_size_t(2, only_offsets[1]);
+}
+
+void test_parse_logs_arena(void) {
+    strider_log_format_t format;
+    strider_log_columns_t out;
+    strider_arena_t arena;
+    const char *text = "2025-12-31T23:59:59Z ERROR a\n2025-12-31T23:59:59Z INFO b\n";
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 4096, 0));
+
+    for (int batch = 0; batch < 3; batch++) {
+        TEST_ASSERT_EQUAL_size_t(2, strider_parse_logs_arena(&format, text, strlen(text), &arena,
+                                                             &out));
+        TEST_ASSERT_EQUAL_size_t(29, out.offsets[1]);
+        TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE, out.timestamps[1]);
+        TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_ERROR, out.levels[0]);
+        TEST_ASSERT_EQUAL_INT8(STRIDER_LEVEL_INFO, out.levels[1]);
+        assert_message("b", out.messages[1]);
+        TEST_ASSERT_EQUAL_size_t(4096, strider_arena_capacity(&arena));
+        strider_arena_reset(&arena);
+    }
+
+    TEST_ASSERT_EQUAL_size_t(2, strider_parse_logs_arena(&format, text, strlen(text), NULL, &out));
+    strider_arena_destroy(&arena);
+}
+
+/* Many records and lines longer than the internal window */
+void test_parse_logs_large_input(void) {
+    strider_log_format_t format;
+    const size_t count = 5000;
+    const size_t long_line = 100000;
+    const size_t size = count * 32 + long_line + 1;
+    char *text = malloc(size);
+    size_t *all_offsets = malloc((count + 1) * sizeof(size_t));
+    int8_t *all_levels = malloc(count + 1);
+    const strider_log_columns_t big = {all_offsets, NULL, all_levels, NULL};
+    size_t consumed = 0;
+
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(all_offsets);
+    TEST_ASSERT_NOT_NULL(all_levels);
+    for (size_t i = 0; i < count; i++) {
+        /* 31 bytes plus the newline */
+        memcpy(text + i * 32, i % 2 ? "2025-12-31T23:59:59Z WARN xxxxx\n"
+                                    : "2025-12-31T23:59:59Z INFO yyyyy\n",
+               32);
+    }
+    memset(text + count * 32, 'z', long_line);
+    text[size - 1] = '\n';
+
+    TEST_ASSERT_EQUAL_INT(0, strider_log_format_init(&format, STRIDER_LOG_TEXT,
+                                                     STRIDER_TIMESTAMP_ISO8601, 0));
+    TEST_ASSERT_EQUAL_size_t(count + 1, strider_parse_logs(&format, text, size, &big,
+                                                           count + 1, &consumed));
+    TEST_ASSERT_EQUAL_size_t(size, consumed);
+    for (size_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_size_t(i * 32, all_offsets[i]);
+        TEST_ASSERT_EQUAL_INT8(i % 2 ? STRIDER_LEVEL_WARN : STRIDER_LEVEL_INFO, all_levels[i]);
+    }
+    TEST_ASSERT_EQUAL_size_t(count * 32, all_offsets[count]);
+    TEST_ASSERT_EQUAL_INT8(STRIDER_LOG_NO_LEVEL, all_levels[count]);
+
+    free(all_levels);
+    free(all_offsets);
+    free(text);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_log_format_init_validates);
+    RUN_TEST(test_parse_logs_text);
+    RUN_TEST(test_parse_logs_syslog);
+    RUN_TEST(test_parse_logs_custom_levels);
+    RUN_TEST(test_parse_logs_empty_lines);
+    RUN_TEST(test_parse_logs_logfmt);
+    RUN_TEST(test_parse_logs_json);
+    RUN_TEST(test_parse_logs_max_records_and_resume);
+    RUN_TEST(test_parse_logs_optional_columns);
+    RUN_TEST(test_parse_logs_arena);
+    RUN_TEST(test_parse_logs_large_input);
+
+    return UNITY_END();
+}
@@ -0,0 +1,271 @@
+/**
+ * @file test_memchr.c
+ * @brief Unit tests for length-bounded byte search (memchr/memrchr)
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Tests scalar reference and SIMD implementations of forward and
+ * reverse byte search on buffer views.
+ */
+
+#include "strider/parsers/memchr.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation Tests
+ * ======================================================================== */
+
+/**
+ * Test: Find first and last occurrence
+ */
+void test_memchr_first_and_last(void) {
+    strider_buffer_view_t view = strider_buffer_view_from_cstr("a=1 b=2 c=3");
+
+    TEST_ASSERT_EQUAL_size_t(1, strider_memchr(view, '='));
+    TEST_ASSERT_EQUAL_size_t(9, strider_memrchr(view, '='));
+    TEST_ASSERT_EQUAL_size_t(0, strider_memchr(view, 'a'));
+    TEST_ASSERT_EQUAL_size_t(10, strider_memrchr(view, '3'));
+}
+
+/**
+ * Test: Byte not present
+ */
+void test_memchr_not_found(void) {
+    strider_buffer_view_t view = strider_buffer_view_from_cstr("hello world");
+
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr(view, 'X'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memrchr(view, 'X'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr_simd(view, 'X'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memrchr_simd(view, 'X'));
+}
+
+/**
+ * Test: Empty view never matches
+ */
+void test_memchr_empty_view(void) {
+    strider_buffer_view_t view = strider_buffer_view_create("", 0);
+
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr(view, '\0'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memrchr(view, '\0'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr_simd(view, '\0'));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memrchr_simd(view, '\0'));
+}
+
+/**
+ * Test: Embedded NULs do not terminate the search
+ */
+void test_memchr_embedded_nul(void) {
+    static const char data[] = "key\0value\0\nnext";
+    strider_buffer_view_t view = strider_buffer_view_create(data, sizeof(data) - 1);
+
+    TEST_ASSERT_EQUAL_size_t(10, strider_memchr(view, '\n'));
+    TEST_ASSERT_EQUAL_size_t(10, strider_memchr_simd(view, '\n'));
+    TEST_ASSERT_EQUAL_size_t(3, strider_memchr_simd(view, '\0'));
+    TEST_ASSERT_EQUAL_size_t(9, strider_memrchr_simd(view, '\0'));
+}
+
+/**
+ * Test: Match just past the view is not reported
+ */
+void test_memchr_respects_bounds(void) {
+    const char *data = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa\n";
+    size_t len = strlen(data);
+
+    for (size_t size = 0; size < len; size++) {
+        strider_buffer_view_t view = strider_buffer_view_create(data, size);
+        TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr_simd(view, '\n'));
+    }
+
+    /* Reverse search must not see a match before the view starts */
+    strider_buffer_view_t tail = strider_buffer_view_create(data + 1, len - 1);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memrchr_simd(tail, 'b'));
+}
+
+/* ========================================================================
+ * SIMD Implementation Tests
+ * ======================================================================== */
+
+/**
+ * Test: SIMD matches scalar for every offset, length and match position
+ *
+ * Buffers are allocated to their exact size so AddressSanitizer catches
+ * any read past the view.
+ */
+void test_memchr_simd_matches_scalar(void) {
+    for (size_t size = 0; size <= 200; size++) {
+        uint8_t *buffer = (uint8_t *) malloc(size ? size : 1);
+        TEST_ASSERT_NOT_NULL(buffer);
+        memset(buffer, 'x', size);
+
+        for (size_t pos = 0; pos <= size; pos++) {
+            if (pos < size) {
+                buffer[pos] = '\n';
+            }
+            strider_buffer_view_t view = strider_buffer_view_create(buffer, size);
+
+            TEST_ASSERT_EQUAL_size_t(strider_memchr(view, '\n'), strider_memchr_simd(view, '\n'));
+            TEST_ASSERT_EQUAL_size_t(strider_memrchr(view, '\n'),
+                                     strider_memrchr_simd(view, '\n'));
+
+            if (pos < size) {
+                buffer[pos] = 'x';
+            }
+        }
+
+        free(buffer);
+    }
+}
+
+/**
+ * Test: Reverse search returns the last of several matches
+ */
+void test_memrchr_simd_multiple_matches(void) {
+    size_t size = 1000;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (i % 80 == 79) ? '\n' : 'a';
+    }
+
+    for (size_t len = 0; len <= size; len++) {
+        strider_buffer_view_t view = strider_buffer_view_create(buffer, len);
+        size_t expected = (len >= 80) ? (len - (len % 80) - 1) : STRIDER_NOT_FOUND;
+
+        TEST_ASSERT_EQUAL_size_t(expected, strider_memrchr_simd(view, '\n'));
+        TEST_ASSERT_EQUAL_size_t(len >= 80 ? 79 : STRIDER_NOT_FOUND,
+                                 strider_memchr_simd(view, '\n'));
+    }
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Case-Insensitive Tests
+ * ======================================================================== */
+
+/**
+ * Test: Letters match in either case, other bytes only themselves
+ */
+void test_memchr_nocase(void) {
+    const char *data = "[id=7] {ID=8} Key=Value";
+    strider_buffer_view_t view = strider_buffer_view_from_cstr(data);
+
+    TEST_ASSERT_EQUAL_size_t(1, strider_memchr_nocase(view, 'I'));
+    TEST_ASSERT_EQUAL_size_t(1, strider_memchr_nocase_simd(view, 'I'));
+    TEST_ASSERT_EQUAL_size_t(14, strider_memchr_nocase_simd(view, 'k'));
+    TEST_ASSERT_EQUAL_size_t(18, strider_memchr_nocase_simd(view, 'v'));
+
+    /* '{' is '[' | 0x20 but not its other case */
+    TEST_ASSERT_EQUAL_size_t(7, strider_memchr_nocase_simd(view, '{'));
+    TEST_ASSERT_EQUAL_size_t(0, strider_memchr_nocase_simd(view, '['));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr_nocase_simd(view, 'q'));
+}
+
+/**
+ * Test: SIMD matches scalar on long mixed-case buffers
+ */
+void test_memchr_nocase_simd_matches_scalar(void) {
+    size_t size = 1000;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* Every byte from '@' to DEL, so the '@'/'`' and '['/'{' pairs occur */
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (char) (0x40 + (i * 7) % 64);
+    }
+
+    for (size_t start = 0; start < 70; start += 7) {
+        strider_buffer_view_t view = strider_buffer_view_create(buffer + start, size - start);
+        for (int ch = 0x40; ch < 0x80; ch++) {
+            TEST_ASSERT_EQUAL_size_t(strider_memchr_nocase(view, ch),
+                                     strider_memchr_nocase_simd(view, ch));
+        }
+    }
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Batch Search Tests
+ * ======================================================================== */
+
+/**
+ * Test: Batch search gives the per-view results and counts the hits
+ */
+void test_memchr_batch(void) {
+    const char *text = "key=value;path=/a/b;empty=;x=y=z";
+    const strider_buffer_view_t views[] = {
+        strider_buffer_view_create(text, 9),       /* key=value */
+        strider_buffer_view_create(text + 10, 9),  /* path=/a/b */
+        strider_buffer_view_create(text + 26, 0),  /* zero length */
+        strider_buffer_view_create(text + 20, 5),  /* empty */
+        strider_buffer_view_create(text + 27, 5),  /* x=y=z */
+    };
+    const size_t expected[] = {3, 4, STRIDER_NOT_FOUND, STRIDER_NOT_FOUND, 1};
+    size_t results[5];
+
+    TEST_ASSERT_EQUAL_size_t(3, strider_memchr_batch(views, 5, '=', results));
+    TEST_ASSERT_EQUAL_size_t_ARRAY(expected, results, 5);
+
+    memset(results, 0xAA, sizeof(results));
+    TEST_ASSERT_EQUAL_size_t(3, strider_memchr_batch_simd(views, 5, '=', results));
+    TEST_ASSERT_EQUAL_size_t_ARRAY(expected, results, 5);
+
+    TEST_ASSERT_EQUAL_size_t(0, strider_memchr_batch_simd(views, 0, '=', results));
+}
+
+/**
+ * Test: Span search takes offsets relative to one buffer
+ */
+void test_memchr_spans(void) {
+    const char *text = "GET /index.html?q=1 HTTP/1.1";
+    const strider_field_span_t spans[] = {{0, 3}, {4, 15}, {20, 8}};
+    const size_t expected[] = {STRIDER_NOT_FOUND, 11, STRIDER_NOT_FOUND};
+    size_t results[3];
+
+    TEST_ASSERT_EQUAL_size_t(1, strider_memchr_spans(text, spans, 3, '?', results));
+    TEST_ASSERT_EQUAL_size_t_ARRAY(expected, results, 3);
+    TEST_ASSERT_EQUAL_size_t(1, strider_memchr_spans_simd(text, spans, 3, '?', results));
+    TEST_ASSERT_EQUAL_size_t_ARRAY(expected, results, 3);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Scalar reference tests */
+    RUN_TEST(test_memchr_first_and_last);
+    RUN_TEST(test_memchr_not_found);
+    RUN_TEST(test_memchr_empty_view);
+    RUN_TEST(test_memchr_embedded_nul);
+    RUN_TEST(test_memchr_respects_bounds);
+
+    /* SIMD tests */
+    RUN_TEST(test_memchr_simd_matches_scalar);
+    RUN_TEST(test_memrchr_simd_multiple_matches);
+
+    /* Case-insensitive tests */
+    RUN_TEST(test_memchr_nocase);
+    RUN_TEST(test_memchr_nocase_simd_matches_scalar);
+
+    /* Batch tests */
+    RUN_TEST(test_memchr_batch);
+    RUN_TEST(test_memchr_spans);
+
+    return UNITY_END();
+}
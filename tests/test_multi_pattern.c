@@ -0,0 +1,243 @@
+/**
+ * @file test_multi_pattern.c
+ * @brief Unit tests for multi-literal matching
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Tests the scalar reference and the SIMD entry point with small sets
+ * (Teddy prefilter) and large sets (Aho-Corasick DFA), including
+ * overlapping matches and truncated output buffers.
+ */
+
+#include "strider/parsers/multi_pattern.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_MATCHES 4096
+
+static strider_match_t expected[MAX_MATCHES];
+static strider_match_t actual[MAX_MATCHES];
+
+static strider_multi_pattern_t *create_from_cstrs(const char *const *words, size_t count) {
+    strider_buffer_view_t views[16];
+
+    for (size_t i = 0; i < count; i++) {
+        views[i] = strider_buffer_view_from_cstr(words[i]);
+    }
+    return strider_multi_pattern_create(views, count);
+}
+
+/* Compare reference and SIMD results at several output capacities */
+static void assert_simd_matches_reference(const strider_multi_pattern_t *mp,
+                                          strider_buffer_view_t view) {
+    const size_t capacities[] = {0, 1, 2, 7, MAX_MATCHES};
+
+    for (size_t c = 0; c < sizeof(capacities) / sizeof(capacities[0]); c++) {
+        size_t n = strider_multi_pattern_find(mp, view, expected, capacities[c]);
+        size_t m = strider_multi_pattern_find_simd(mp, view, actual, capacities[c]);
+
+        TEST_ASSERT_EQUAL_size_t(n, m);
+        for (size_t i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_UINT32(expected[i].pattern_id, actual[i].pattern_id);
+            TEST_ASSERT_EQUAL_size_t(expected[i].offset, actual[i].offset);
+        }
+    }
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* ========================================================================
+ * Construction Tests
+ * ======================================================================== */
+
+/**
+ * Test: Invalid pattern sets are rejected
+ */
+void test_multi_pattern_create_invalid(void) {
+    strider_buffer_view_t views[2] = {
+        strider_buffer_view_from_cstr("ok"),
+        strider_buffer_view_create("", 0),
+    };
+
+    TEST_ASSERT_NULL(strider_multi_pattern_create(NULL, 1));
+    TEST_ASSERT_NULL(strider_multi_pattern_create(views, 0));
+    TEST_ASSERT_NULL(strider_multi_pattern_create(views, 2)); /* Empty pattern */
+
+    strider_multi_pattern_t *mp = strider_multi_pattern_create(views, 1);
+    TEST_ASSERT_NOT_NULL(mp);
+    TEST_ASSERT_EQUAL_size_t(1, strider_multi_pattern_count(mp));
+    strider_multi_pattern_destroy(mp);
+    strider_multi_pattern_destroy(NULL);
+}
+
+/* ========================================================================
+ * Matching Tests
+ * ======================================================================== */
+
+/**
+ * Test: Overlapping matches ordered by offset, then pattern id
+ */
+void test_multi_pattern_overlapping(void) {
+    const char *words[] = {"he", "she", "his", "hers"};
+    strider_multi_pattern_t *mp = create_from_cstrs(words, 4);
+    strider_buffer_view_t view = strider_buffer_view_from_cstr("ushers");
+    TEST_ASSERT_NOT_NULL(mp);
+
+    TEST_ASSERT_EQUAL_size_t(3, strider_multi_pattern_find(mp, view, expected, MAX_MATCHES));
+    TEST_ASSERT_EQUAL_size_t(3, strider_multi_pattern_find_simd(mp, view, actual, MAX_MATCHES));
+
+    TEST_ASSERT_EQUAL_UINT32(1, actual[0].pattern_id); /* she */
+    TEST_ASSERT_EQUAL_size_t(1, actual[0].offset);
+    TEST_ASSERT_EQUAL_UINT32(0, actual[1].pattern_id); /* he */
+    TEST_ASSERT_EQUAL_size_t(2, actual[1].offset);
+    TEST_ASSERT_EQUAL_UINT32(3, actual[2].pattern_id); /* hers */
+    TEST_ASSERT_EQUAL_size_t(2, actual[2].offset);
+
+    strider_multi_pattern_destroy(mp);
+}
+
+/**
+ * Test: Truncated output keeps the first matches in order
+ */
+void test_multi_pattern_truncated(void) {
+    const char *words[] = {"hers", "he", "she"};
+    strider_multi_pattern_t *mp = create_from_cstrs(words, 3);
+    strider_buffer_view_t view = strider_buffer_view_from_cstr("ushers");
+    TEST_ASSERT_NOT_NULL(mp);
+
+    TEST_ASSERT_EQUAL_size_t(2, strider_multi_pattern_find_simd(mp, view, actual, 2));
+    TEST_ASSERT_EQUAL_UINT32(2, actual[0].pattern_id); /* she @1 */
+    TEST_ASSERT_EQUAL_UINT32(0, actual[1].pattern_id); /* hers @2 sorts before he @2 */
+    TEST_ASSERT_EQUAL_size_t(2, actual[1].offset);
+
+    TEST_ASSERT_EQUAL_size_t(0, strider_multi_pattern_find_simd(mp, view, actual, 0));
+
+    strider_multi_pattern_destroy(mp);
+}
+
+/**
+ * Test: Duplicate and single-byte patterns
+ */
+void test_multi_pattern_duplicates(void) {
+    const char *words[] = {"ab", "a", "ab", "b"};
+    strider_multi_pattern_t *mp = create_from_cstrs(words, 4);
+    TEST_ASSERT_NOT_NULL(mp);
+
+    assert_simd_matches_reference(mp, strider_buffer_view_from_cstr("xxababbaxa"));
+
+    strider_multi_pattern_destroy(mp);
+}
+
+/**
+ * Test: Keywords in log lines (Teddy-sized set)
+ */
+void test_multi_pattern_log_keywords(void) {
+    const char *words[] = {"timeout", "OOM", "panic", "refused", "denied", "segfault"};
+    const char *text = "2025-01-01 INFO ok\n"
+                       "2025-01-01 ERROR connection refused after timeout\n"
+                       "2025-01-01 FATAL kernel panic: OOM killer\n";
+    strider_multi_pattern_t *mp = create_from_cstrs(words, 6);
+    strider_buffer_view_t view = strider_buffer_view_from_cstr(text);
+    TEST_ASSERT_NOT_NULL(mp);
+
+    size_t n = strider_multi_pattern_find_simd(mp, view, actual, MAX_MATCHES);
+    TEST_ASSERT_EQUAL_size_t(4, n);
+    TEST_ASSERT_EQUAL_UINT32(3, actual[0].pattern_id);
+    TEST_ASSERT_EQUAL_UINT32(0, actual[1].pattern_id);
+    TEST_ASSERT_EQUAL_UINT32(2, actual[2].pattern_id);
+    TEST_ASSERT_EQUAL_UINT32(1, actual[3].pattern_id);
+    TEST_ASSERT_EQUAL_MEMORY("OOM", text + actual[3].offset, 3);
+
+    assert_simd_matches_reference(mp, view);
+    strider_multi_pattern_destroy(mp);
+}
+
+/**
+ * Test: Random small and large sets against the reference
+ */
+void test_multi_pattern_random_sets(void) {
+    const size_t set_sizes[] = {1, 5, 16, 64, 65, 300};
+    size_t size = 3000;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    strider_buffer_view_t *views = (strider_buffer_view_t *) malloc(300 * sizeof(*views));
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(views);
+
+    /* Small alphabet so patterns occur often */
+    srand(8080);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) ('a' + rand() % 4);
+    }
+
+    for (size_t s = 0; s < sizeof(set_sizes) / sizeof(set_sizes[0]); s++) {
+        for (size_t i = 0; i < set_sizes[s]; i++) {
+            size_t length = 1 + (size_t) rand() % 8;
+            size_t start = (size_t) rand() % (size - length);
+            views[i] = strider_buffer_view_create(buffer + start, length);
+        }
+
+        strider_multi_pattern_t *mp = strider_multi_pattern_create(views, set_sizes[s]);
+        TEST_ASSERT_NOT_NULL(mp);
+
+        for (size_t offset = 0; offset < 50; offset += 17) {
+            for (size_t len = 0; len + offset <= 400; len += 61) {
+                assert_simd_matches_reference(mp,
+                                              strider_buffer_view_create(buffer + offset, len));
+            }
+        }
+        assert_simd_matches_reference(mp, strider_buffer_view_create(buffer, size));
+        strider_multi_pattern_destroy(mp);
+    }
+
+    free(buffer);
+    free(views);
+}
+
+/**
+ * Test: Patterns with bytes >= 0x80 and long patterns
+ */
+void test_multi_pattern_binary(void) {
+    uint8_t data[200];
+    strider_buffer_view_t views[3];
+
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t) (0x80 + (i * 7) % 128);
+    }
+    views[0] = strider_buffer_view_create(data + 10, 40);
+    views[1] = strider_buffer_view_create(data + 150, 3);
+    views[2] = strider_buffer_view_create(data + 199, 1);
+
+    strider_multi_pattern_t *mp = strider_multi_pattern_create(views, 3);
+    TEST_ASSERT_NOT_NULL(mp);
+    assert_simd_matches_reference(mp, strider_buffer_view_create(data, sizeof(data)));
+    strider_multi_pattern_destroy(mp);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Construction */
+    RUN_TEST(test_multi_pattern_create_invalid);
+
+    /* Matching */
+    RUN_TEST(test_multi_pattern_overlapping);
+    RUN_TEST(test_multi_pattern_truncated);
+    RUN_TEST(test_multi_pattern_duplicates);
+    RUN_TEST(test_multi_pattern_log_keywords);
+    RUN_TEST(test_multi_pattern_random_sets);
+    RUN_TEST(test_multi_pattern_binary);
+
+    return UNITY_END();
+}
@@ -217,6 +217,109 @@ void test_newlines_simd_matches_scalar(void) {
     }
 }
 
+/**
+ * Test: SIMD count handles \r\n split across every vector boundary
+ */
+void test_newlines_simd_crlf_boundary(void) {
+    char *buffer = (char *) strider_aligned_alloc(64, 256);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t split = 1; split < 255; split++) {
+        memset(buffer, 'a', 256);
+        buffer[split - 1] = '\r';
+        buffer[split] = '\n';
+        TEST_ASSERT_EQUAL_size_t(1, strider_count_newlines_simd(buffer, 256));
+
+        /* Lone \r followed by \r\n: two newlines */
+        if (split >= 2) {
+            buffer[split - 2] = '\r';
+            TEST_ASSERT_EQUAL_size_t(2, strider_count_newlines_simd(buffer, 256));
+        }
+    }
+
+    strider_aligned_free(buffer);
+}
+
+/**
+ * Test: SIMD positions match scalar on random mixed-ending data
+ */
+void test_newline_positions_simd_matches_scalar(void) {
+    size_t size = 8192;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size * sizeof(size_t));
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(42);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 10;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'x';
+    }
+
+    for (size_t offset = 0; offset < 64; offset += 5) {
+        size_t len = size - offset;
+        size_t scalar_count = strider_find_newline_positions(buffer + offset, len, expected, size);
+        size_t simd_count = strider_find_newline_positions_simd(buffer + offset, len, actual, size);
+
+        TEST_ASSERT_EQUAL_size_t(scalar_count, simd_count);
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, scalar_count * sizeof(size_t));
+    }
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: \r\n split across every block boundary is reported once
+ */
+void test_newline_positions_simd_crlf_boundary(void) {
+    char *buffer = (char *) strider_aligned_alloc(64, 256);
+    size_t positions[8];
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    for (size_t split = 1; split < 255; split++) {
+        memset(buffer, 'a', 256);
+        buffer[split - 1] = '\r';
+        buffer[split] = '\n';
+
+        size_t count = strider_find_newline_positions_simd(buffer, 256, positions, 8);
+
+        TEST_ASSERT_EQUAL_size_t(1, count);
+        TEST_ASSERT_EQUAL_size_t(split - 1, positions[0]);
+    }
+
+    strider_aligned_free(buffer);
+}
+
+/**
+ * Test: SIMD positions never write past max_positions
+ */
+void test_newline_positions_simd_limited(void) {
+    char buffer[300];
+    size_t positions[12];
+
+    memset(buffer, '\n', sizeof(buffer));
+
+    for (size_t max = 0; max <= 10; max++) {
+        for (size_t i = 0; i < 12; i++) {
+            positions[i] = (size_t) -1;
+        }
+
+        size_t count = strider_find_newline_positions_simd(buffer, sizeof(buffer), positions, max);
+
+        TEST_ASSERT_EQUAL_size_t(sizeof(buffer), count);
+        for (size_t i = 0; i < max; i++) {
+            TEST_ASSERT_EQUAL_size_t(i, positions[i]);
+        }
+        for (size_t i = max; i < 12; i++) {
+            TEST_ASSERT_EQUAL_size_t((size_t) -1, positions[i]);
+        }
+    }
+}
+
 /* ========================================================================
  * Large Buffer Tests
  * ======================================================================== */
@@ -251,6 +354,59 @@ void test_find_newlines_large_buffer(void) {
     free(buffer);
 }
 
+/**
+ * Test: Dense newlines across accumulator flush intervals
+ *
+ * Every byte is a line end, so each accumulator lane grows on every
+ * iteration; lanes must be flushed before they wrap at 256.
+ */
+void test_newlines_simd_dense_accumulator_flush(void) {
+    size_t size = 300 * 1024 + 17;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    memset(buffer, '\n', size);
+    TEST_ASSERT_EQUAL_size_t(size, strider_count_newlines_simd(buffer, size));
+    TEST_ASSERT_EQUAL_size_t(size - 1, strider_count_newlines_simd(buffer + 1, size - 1));
+
+    memset(buffer, '\r', size);
+    TEST_ASSERT_EQUAL_size_t(size, strider_count_newlines_simd(buffer, size));
+
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (i % 2) ? '\n' : '\r';
+    }
+    TEST_ASSERT_EQUAL_size_t(strider_count_newlines(buffer, size),
+                             strider_count_newlines_simd(buffer, size));
+    TEST_ASSERT_EQUAL_size_t(strider_count_newlines(buffer + 1, size - 1),
+                             strider_count_newlines_simd(buffer + 1, size - 1));
+
+    free(buffer);
+}
+
+/**
+ * Test: Random mixed endings at sizes around the unrolled block size
+ */
+void test_newlines_simd_unrolled_sizes(void) {
+    size_t max_size = 2048;
+    char *buffer = (char *) malloc(max_size + 64);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(7);
+    for (size_t i = 0; i < max_size + 64; i++) {
+        int r = rand() % 6;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'z';
+    }
+
+    for (size_t offset = 0; offset < 64; offset += 3) {
+        for (size_t len = 0; len <= max_size; len++) {
+            TEST_ASSERT_EQUAL_size_t(strider_count_newlines(buffer + offset, len),
+                                     strider_count_newlines_simd(buffer + offset, len));
+        }
+    }
+
+    free(buffer);
+}
+
 /**
  * Test: Match wc -l behavior (count newlines, not lines)
  */
@@ -268,6 +424,291 @@ void test_newlines_matches_wc(void) {
     TEST_ASSERT_EQUAL_size_t(2, strider_count_newlines("abc\ndef\n", 8));
 }
 
+/* ========================================================================
+ * Streaming Tests
+ * ======================================================================== */
+
+/**
+ * Test: \r\n split across chunks is counted once
+ */
+void test_newline_stream_split_crlf(void) {
+    strider_newline_stream_t stream;
+    size_t positions[4];
+
+    strider_newline_stream_init(&stream);
+    TEST_ASSERT_EQUAL_size_t(1, strider_newline_stream_feed(&stream, "abc\r", 4));
+    TEST_ASSERT_EQUAL_size_t(0, strider_newline_stream_feed(&stream, "\n", 1));
+    TEST_ASSERT_EQUAL_size_t(0, strider_newline_stream_feed(&stream, "", 0));
+    TEST_ASSERT_EQUAL_size_t(1, strider_newline_stream_feed(&stream, "\n", 1));
+    TEST_ASSERT_EQUAL_size_t(2, strider_newline_stream_finish(&stream));
+
+    /* Positions are global and the pair points to its \r */
+    strider_newline_stream_init(&stream);
+    TEST_ASSERT_EQUAL_size_t(1, strider_newline_stream_feed_positions(&stream, "ab\r", 3,
+                                                                      positions, 4));
+    TEST_ASSERT_EQUAL_size_t(2, positions[0]);
+    TEST_ASSERT_EQUAL_size_t(2, strider_newline_stream_feed_positions(&stream, "\nc\rd\n", 5,
+                                                                      positions, 4));
+    TEST_ASSERT_EQUAL_size_t(5, positions[0]);
+    TEST_ASSERT_EQUAL_size_t(7, positions[1]);
+    TEST_ASSERT_EQUAL_size_t(8, stream.offset);
+    TEST_ASSERT_EQUAL_size_t(3, strider_newline_stream_finish(&stream));
+    TEST_ASSERT_EQUAL_size_t(0, stream.offset);
+}
+
+/**
+ * Test: Random chunking gives the same results as one call
+ */
+void test_newline_stream_matches_single_call(void) {
+    size_t size = 5000;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size * sizeof(size_t));
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(1010);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 5;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'q';
+    }
+    size_t total = strider_find_newline_positions(buffer, size, expected, size);
+
+    for (size_t max_chunk = 1; max_chunk <= 300; max_chunk = max_chunk * 2 + 1) {
+        strider_newline_stream_t counter, finder;
+        size_t found = 0;
+
+        strider_newline_stream_init(&counter);
+        strider_newline_stream_init(&finder);
+        for (size_t pos = 0; pos < size;) {
+            size_t chunk = (size_t) rand() % (max_chunk + 1); /* 0-length chunks included */
+            chunk = chunk < size - pos ? chunk : size - pos;
+
+            strider_newline_stream_feed(&counter, buffer + pos, chunk);
+            found += strider_newline_stream_feed_positions(&finder, buffer + pos, chunk,
+                                                           actual + found, size - found);
+            pos += chunk;
+        }
+
+        TEST_ASSERT_EQUAL_size_t(total, found);
+        TEST_ASSERT_EQUAL_size_t(total, strider_newline_stream_finish(&counter));
+        TEST_ASSERT_EQUAL_size_t(total, strider_newline_stream_finish(&finder));
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, total * sizeof(size_t));
+    }
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/* ========================================================================
+ * Compact Position Output Tests
+ * ======================================================================== */
+
+/**
+ * Test: 32-bit positions equal base + the size_t positions
+ */
+void test_newline_positions32_match_positions(void) {
+    size_t size = 6000;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    uint32_t *scalar = (uint32_t *) malloc(size * sizeof(uint32_t));
+    uint32_t *simd = (uint32_t *) malloc(size * sizeof(uint32_t));
+    const uint32_t base = 0xF0000000u;
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(scalar);
+    TEST_ASSERT_NOT_NULL(simd);
+
+    srand(3131);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 6;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'z';
+    }
+
+    for (size_t offset = 0; offset < 64; offset += 7) {
+        size_t len = size - offset;
+        size_t n = strider_find_newline_positions(buffer + offset, len, expected, size);
+
+        TEST_ASSERT_EQUAL_size_t(
+            n, strider_find_newline_positions32(buffer + offset, len, base, scalar, size));
+        TEST_ASSERT_EQUAL_size_t(
+            n, strider_find_newline_positions32_simd(buffer + offset, len, base, simd, size));
+        for (size_t i = 0; i < n; i++) {
+            TEST_ASSERT_EQUAL_UINT32(base + (uint32_t) expected[i], scalar[i]);
+            TEST_ASSERT_EQUAL_UINT32(base + (uint32_t) expected[i], simd[i]);
+        }
+    }
+
+    free(buffer);
+    free(expected);
+    free(scalar);
+    free(simd);
+}
+
+/**
+ * Test: 32-bit positions are refused when base + size exceeds 2^32
+ */
+void test_newline_positions32_range(void) {
+    const char text[] = "a\nb\n";
+    uint32_t positions[4] = {7, 7, 7, 7};
+
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_newline_positions32(
+                                                    text, 4, UINT32_MAX - 2, positions, 4));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_find_newline_positions32_simd(
+                                                    text, 4, UINT32_MAX, positions, 4));
+    TEST_ASSERT_EQUAL_UINT32(7, positions[0]);
+
+    /* The last representable offset is accepted */
+    TEST_ASSERT_EQUAL_size_t(
+        2, strider_find_newline_positions32_simd(text, 4, UINT32_MAX - 3, positions, 4));
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, positions[1]);
+}
+
+/**
+ * Test: Packed gaps round-trip to the size_t positions and fit in size bytes
+ */
+void test_newline_pack_round_trip(void) {
+    size_t size = 20000;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size * sizeof(size_t));
+    uint8_t *scalar = (uint8_t *) malloc(size);
+    uint8_t *simd = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+    TEST_ASSERT_NOT_NULL(scalar);
+    TEST_ASSERT_NOT_NULL(simd);
+
+    /* Runs of short and long lines, so gaps take one or two bytes */
+    srand(4242);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % ((i / 2000) % 2 ? 3 : 20000);
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'p';
+    }
+
+    for (size_t offset = 0; offset < 64; offset += 13) {
+        size_t len = size - offset;
+        size_t n = strider_find_newline_positions(buffer + offset, len, expected, size);
+        size_t scalar_size, simd_size, scalar_consumed, simd_consumed;
+
+        TEST_ASSERT_EQUAL_size_t(n, strider_pack_newline_positions(buffer + offset, len, scalar,
+                                                                   len, &scalar_size,
+                                                                   &scalar_consumed));
+        TEST_ASSERT_EQUAL_size_t(n, strider_pack_newline_positions_simd(buffer + offset, len, simd,
+                                                                        len, &simd_size,
+                                                                        &simd_consumed));
+        TEST_ASSERT_EQUAL_size_t(len, scalar_consumed);
+        TEST_ASSERT_EQUAL_size_t(len, simd_consumed);
+        TEST_ASSERT_EQUAL_size_t(scalar_size, simd_size);
+        TEST_ASSERT_EQUAL_MEMORY(scalar, simd, scalar_size);
+
+        TEST_ASSERT_EQUAL_size_t(n, strider_unpack_newline_positions(simd, simd_size, 0, actual,
+                                                                     size));
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, n * sizeof(size_t));
+    }
+
+    free(buffer);
+    free(expected);
+    free(actual);
+    free(scalar);
+    free(simd);
+}
+
+/**
+ * Test: A full output buffer stops cleanly and the scan resumes at consumed
+ */
+void test_newline_pack_resume(void) {
+    size_t size = 3000;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size * sizeof(size_t));
+    uint8_t packed[37];
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    srand(777);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 300;
+        buffer[i] = (r < 20) ? '\n' : (r < 40) ? '\r' : 'k';
+    }
+    size_t n = strider_find_newline_positions(buffer, size, expected, size);
+
+    for (int simd = 0; simd < 2; simd++) {
+        size_t found = 0;
+
+        for (size_t pos = 0; pos < size;) {
+            size_t written, consumed;
+            size_t packed_count =
+                simd ? strider_pack_newline_positions_simd(buffer + pos, size - pos, packed,
+                                                           sizeof(packed), &written, &consumed)
+                     : strider_pack_newline_positions(buffer + pos, size - pos, packed,
+                                                      sizeof(packed), &written, &consumed);
+
+            TEST_ASSERT_TRUE(written <= sizeof(packed));
+            TEST_ASSERT_TRUE(consumed > 0);
+            TEST_ASSERT_EQUAL_size_t(packed_count, strider_unpack_newline_positions(
+                                                       packed, written, pos, actual + found,
+                                                       size - found));
+            found += packed_count;
+            pos += consumed;
+        }
+
+        TEST_ASSERT_EQUAL_size_t(n, found);
+        TEST_ASSERT_EQUAL_MEMORY(expected, actual, n * sizeof(size_t));
+    }
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: Arena output is sized to the newline count and matches the scalar positions
+ */
+void test_newline_positions_arena(void) {
+    strider_arena_t arena;
+    size_t size = 10000;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(size * sizeof(size_t));
+    size_t count = 0;
+    TEST_ASSERT_NOT_NULL(buffer);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_EQUAL_INT(0, strider_arena_init(&arena, 4096, 0));
+
+    srand(909);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 40;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'a';
+    }
+    size_t n = strider_find_newline_positions(buffer, size, expected, size);
+
+    size_t *positions = strider_find_newline_positions_arena(buffer, size, &arena, &count);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_EQUAL_size_t(n, count);
+    TEST_ASSERT_EQUAL_MEMORY(expected, positions, n * sizeof(size_t));
+
+    /* Same batch again after a reset: no new blocks */
+    const size_t capacity = strider_arena_capacity(&arena);
+    strider_arena_reset(&arena);
+    TEST_ASSERT_EQUAL_PTR(positions,
+                          strider_find_newline_positions_arena(buffer, size, &arena, &count));
+    TEST_ASSERT_EQUAL_size_t(capacity, strider_arena_capacity(&arena));
+
+    /* NULL takes the thread arena */
+    TEST_ASSERT_NOT_NULL(strider_find_newline_positions_arena(buffer, size, NULL, &count));
+    TEST_ASSERT_EQUAL_size_t(n, count);
+    TEST_ASSERT_NOT_NULL(strider_find_newline_positions_arena(buffer, 0, &arena, &count));
+    TEST_ASSERT_EQUAL_size_t(0, count);
+
+    strider_arena_destroy(&arena);
+    free(buffer);
+    free(expected);
+}
+
 /* ========================================================================
  * Test Runner
  * ======================================================================== */
@@ -292,10 +733,27 @@ int main(void) {
     RUN_TEST(test_newlines_simd_vectorized);
     RUN_TEST(test_newlines_simd_unaligned);
     RUN_TEST(test_newlines_simd_matches_scalar);
+    RUN_TEST(test_newlines_simd_crlf_boundary);
+    RUN_TEST(test_newline_positions_simd_matches_scalar);
+    RUN_TEST(test_newline_positions_simd_crlf_boundary);
+    RUN_TEST(test_newline_positions_simd_limited);
 
     /* Large buffer and compatibility tests */
     RUN_TEST(test_find_newlines_large_buffer);
+    RUN_TEST(test_newlines_simd_dense_accumulator_flush);
+    RUN_TEST(test_newlines_simd_unrolled_sizes);
     RUN_TEST(test_newlines_matches_wc);
 
+    /* Streaming */
+    RUN_TEST(test_newline_stream_split_crlf);
+    RUN_TEST(test_newline_stream_matches_single_call);
+
+    /* Compact position output */
+    RUN_TEST(test_newline_positions32_match_positions);
+    RUN_TEST(test_newline_positions32_range);
+    RUN_TEST(test_newline_pack_round_trip);
+    RUN_TEST(test_newline_pack_resume);
+    RUN_TEST(test_newline_positions_arena);
+
     return UNITY_END();
 }
@@ -0,0 +1,215 @@
+/**
+ * @file test_parallel.c
+ * @brief Unit tests for the thread pool and parallel newline scanners
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Checks that the pool runs every task exactly once, that custom
+ * executors are honoured, and that parallel results match the scalar
+ * reference, including \r\n pairs split by segment seams.
+ */
+
+#include "strider/parsers/newline.h"
+#include "strider/utils/thread_pool.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SEGMENT STRIDER_PARALLEL_SEGMENT_SIZE
+
+static strider_thread_pool_t *pool;
+
+void setUp(void) {
+    pool = strider_thread_pool_create(3);
+    TEST_ASSERT_NOT_NULL(pool);
+}
+
+void tearDown(void) {
+    strider_thread_pool_destroy(pool);
+}
+
+/* Buffer of several segments with random mixed line endings */
+static char *make_buffer(size_t size, unsigned seed) {
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(seed);
+    for (size_t i = 0; i < size; i++) {
+        int r = rand() % 40;
+        buffer[i] = (r == 0) ? '\n' : (r == 1) ? '\r' : 'k';
+    }
+    return buffer;
+}
+
+/* ========================================================================
+ * Thread Pool Tests
+ * ======================================================================== */
+
+static void increment_task(void *arg, size_t index) {
+    unsigned char *hits = (unsigned char *) arg;
+    hits[index]++;
+}
+
+/**
+ * Test: Every task runs exactly once, across repeated batches
+ */
+void test_thread_pool_runs_all_tasks(void) {
+    unsigned char hits[1000];
+    strider_executor_t executor = strider_thread_pool_executor(pool);
+
+    TEST_ASSERT_EQUAL_size_t(3, strider_thread_pool_size(pool));
+
+    for (size_t count = 0; count <= 1000; count += 111) {
+        memset(hits, 0, sizeof(hits));
+        executor.run(executor.context, increment_task, hits, count);
+        for (size_t i = 0; i < count; i++) {
+            TEST_ASSERT_EQUAL_UINT8(1, hits[i]);
+        }
+    }
+}
+
+/**
+ * Test: Default size uses every online CPU
+ */
+void test_thread_pool_default_size(void) {
+    strider_thread_pool_t *sized = strider_thread_pool_create(0);
+    TEST_ASSERT_NOT_NULL(sized);
+    TEST_ASSERT_EQUAL_size_t(strider_hardware_concurrency(), strider_thread_pool_size(sized));
+    strider_thread_pool_destroy(sized);
+    strider_thread_pool_destroy(NULL);
+}
+
+/* Executor that runs tasks in reverse order on the calling thread */
+static size_t reverse_batches;
+
+static void reverse_run(void *context, strider_task_fn task, void *arg, size_t count) {
+    (void) context;
+    reverse_batches++;
+    for (size_t i = count; i > 0; i--) {
+        task(arg, i - 1);
+    }
+}
+
+/**
+ * Test: A caller-provided executor is used
+ */
+void test_parallel_custom_executor(void) {
+    size_t size = 5 * SEGMENT + 123;
+    char *buffer = make_buffer(size, 11);
+    strider_executor_t executor = {reverse_run, NULL};
+
+    reverse_batches = 0;
+    TEST_ASSERT_EQUAL_size_t(strider_count_newlines(buffer, size),
+                             strider_count_newlines_parallel(buffer, size, &executor));
+    TEST_ASSERT_EQUAL_size_t(1, reverse_batches);
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Parallel Scanner Tests
+ * ======================================================================== */
+
+/**
+ * Test: \r\n pairs straddling every seam are counted once
+ */
+void test_parallel_crlf_at_seams(void) {
+    size_t size = 4 * SEGMENT + 10;
+    char *buffer = (char *) malloc(size);
+    size_t *expected = (size_t *) malloc(8 * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(8 * sizeof(size_t));
+    strider_executor_t executor = strider_thread_pool_executor(pool);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    memset(buffer, 'x', size);
+    for (size_t seam = SEGMENT; seam < size; seam += SEGMENT) {
+        buffer[seam - 1] = '\r';
+        buffer[seam] = '\n';
+    }
+
+    TEST_ASSERT_EQUAL_size_t(4, strider_count_newlines_parallel(buffer, size, &executor));
+    TEST_ASSERT_EQUAL_size_t(4, strider_find_newline_positions(buffer, size, expected, 8));
+    TEST_ASSERT_EQUAL_size_t(
+        4, strider_find_newline_positions_parallel(buffer, size, actual, 8, &executor));
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, 4 * sizeof(size_t));
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: Parallel count and positions match the reference
+ */
+void test_parallel_matches_reference(void) {
+    size_t size = 6 * SEGMENT + 4321;
+    char *buffer = make_buffer(size, 22);
+    size_t *expected = (size_t *) malloc(size / 8 * sizeof(size_t));
+    size_t *actual = (size_t *) malloc(size / 8 * sizeof(size_t));
+    strider_executor_t executor = strider_thread_pool_executor(pool);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    size_t n = strider_find_newline_positions(buffer, size, expected, size / 8);
+    TEST_ASSERT_TRUE(n < size / 8);
+
+    TEST_ASSERT_EQUAL_size_t(n, strider_count_newlines_parallel(buffer, size, &executor));
+    TEST_ASSERT_EQUAL_size_t(n, strider_count_newlines_parallel(buffer, size, NULL));
+    TEST_ASSERT_EQUAL_size_t(
+        n, strider_find_newline_positions_parallel(buffer, size, actual, size / 8, &executor));
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, n * sizeof(size_t));
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/**
+ * Test: Truncated output stores exactly the first max_positions
+ */
+void test_parallel_positions_limited(void) {
+    size_t size = 3 * SEGMENT + 99;
+    char *buffer = make_buffer(size, 33);
+    size_t total = strider_count_newlines(buffer, size);
+    size_t limit = total / 2 + 7; /* Ends in the middle of a segment */
+    size_t *expected = (size_t *) malloc(limit * sizeof(size_t));
+    size_t *actual = (size_t *) malloc((limit + 1) * sizeof(size_t));
+    strider_executor_t executor = strider_thread_pool_executor(pool);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+
+    actual[limit] = 0xABCD; /* Guard */
+    strider_find_newline_positions(buffer, size, expected, limit);
+    TEST_ASSERT_EQUAL_size_t(
+        total, strider_find_newline_positions_parallel(buffer, size, actual, limit, &executor));
+    TEST_ASSERT_EQUAL_MEMORY(expected, actual, limit * sizeof(size_t));
+    TEST_ASSERT_EQUAL_size_t(0xABCD, actual[limit]);
+
+    TEST_ASSERT_EQUAL_size_t(
+        total, strider_find_newline_positions_parallel(buffer, size, actual, 0, &executor));
+
+    free(buffer);
+    free(expected);
+    free(actual);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Thread pool */
+    RUN_TEST(test_thread_pool_runs_all_tasks);
+    RUN_TEST(test_thread_pool_default_size);
+    RUN_TEST(test_parallel_custom_executor);
+
+    /* Parallel scanners */
+    RUN_TEST(test_parallel_crlf_at_seams);
+    RUN_TEST(test_parallel_matches_reference);
+    RUN_TEST(test_parallel_positions_limited);
+
+    return UNITY_END();
+}
@@ -0,0 +1,317 @@
+/**
+ * @file test_reader.c
+ * @brief Unit tests for the asynchronous read-ahead reader
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Reads scratch files through every available backend and checks that
+ * the chunks concatenate to the file, for sizes around the buffer size
+ * and the ring length, and that they feed the newline stream like one
+ * scan of the whole file.
+ */
+
+#if !defined(_WIN32) && !defined(_GNU_SOURCE)
+#    define _GNU_SOURCE /* mkfifo */
+#endif
+
+#include "strider/io/reader.h"
+#include "strider/parsers/newline.h"
+#include "unity.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#    include <dirent.h>
+#    include <fcntl.h>
+#    include <pthread.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#define SCRATCH_PATH "strider_test_reader.tmp"
+#define FIFO_PATH "strider_test_reader.fifo"
+
+/* Odd size, so chunks are not page multiples */
+#define BUFFER_SIZE 5000
+
+static const strider_reader_backend_t backends[] = {STRIDER_READER_IO_URING,
+                                                    STRIDER_READER_THREAD};
+
+static void write_scratch(const char *data, size_t size) {
+    FILE *fp = fopen(SCRATCH_PATH, "wb");
+    TEST_ASSERT_NOT_NULL(fp);
+    TEST_ASSERT_EQUAL_size_t(size, fwrite(data, 1, size, fp));
+    TEST_ASSERT_EQUAL_INT(0, fclose(fp));
+}
+
+static char *make_data(size_t size, unsigned seed) {
+    char *data = (char *) malloc(size ? size : 1);
+    TEST_ASSERT_NOT_NULL(data);
+
+    srand(seed);
+    for (size_t i = 0; i < size; i++) {
+        const int r = rand() % 30;
+        data[i] = r == 0 ? '\n' : r == 1 ? '\r' : (char) ('a' + r);
+    }
+    return data;
+}
+
+/* Read a whole file through a reader and compare it with data */
+static void assert_reads(strider_reader_t *reader, const char *data, size_t size,
+                         size_t buffer_size) {
+    strider_newline_stream_t stream;
+    strider_buffer_view_t chunk;
+    size_t offset = 0;
+    int result;
+
+    strider_newline_stream_init(&stream);
+    while ((result = strider_reader_next(reader, &chunk)) > 0) {
+        TEST_ASSERT_TRUE(offset + chunk.size <= size);
+        TEST_ASSERT_EQUAL_MEMORY(data + offset, chunk.data, chunk.size);
+        if (offset + chunk.size < size) {
+            TEST_ASSERT_EQUAL_size_t(buffer_size, chunk.size); /* Only the last is short */
+        }
+        strider_newline_stream_feed(&stream, (const char *) chunk.data, chunk.size);
+        offset += chunk.size;
+    }
+    TEST_ASSERT_EQUAL_INT(0, result);
+    TEST_ASSERT_EQUAL_size_t(size, offset);
+    TEST_ASSERT_EQUAL_size_t(strider_count_newlines(data, size),
+                             strider_newline_stream_finish(&stream));
+
+    /* End of file is sticky */
+    TEST_ASSERT_EQUAL_INT(0, strider_reader_next(reader, &chunk));
+}
+
+/* Open with a backend; NULL (test skipped) where it is not available */
+static strider_reader_t *open_backend(strider_reader_backend_t backend, size_t buffers) {
+    const strider_reader_options_t options = {BUFFER_SIZE, buffers, backend};
+    strider_reader_t *reader = strider_reader_open(SCRATCH_PATH, &options);
+
+    if (!reader && backend == STRIDER_READER_IO_URING) {
+        return NULL; /* Not built in, or io_uring disabled (seccomp, sysctl) */
+    }
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_INT(backend, strider_reader_backend(reader));
+    return reader;
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    remove(SCRATCH_PATH);
+}
+
+/* ========================================================================
+ * Tests
+ * ======================================================================== */
+
+/**
+ * Test: Chunks concatenate to the file, sizes around buffer and ring length
+ */
+void test_reader_sizes(void) {
+    static const size_t sizes[] = {0,
+                                   1,
+                                   BUFFER_SIZE - 1,
+                                   BUFFER_SIZE,
+                                   BUFFER_SIZE + 1,
+                                   3 * BUFFER_SIZE,
+                                   3 * BUFFER_SIZE + 17,
+                                   40 * BUFFER_SIZE + 123};
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        char *data = make_data(sizes[s], (unsigned) s);
+        write_scratch(data, sizes[s]);
+
+        for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+            for (size_t buffers = 2; buffers <= 4; buffers++) {
+                strider_reader_t *reader = open_backend(backends[b], buffers);
+                if (reader) {
+                    assert_reads(reader, data, sizes[s], BUFFER_SIZE);
+                    strider_reader_close(reader);
+                }
+            }
+        }
+        free(data);
+    }
+}
+
+/**
+ * Test: Defaults, and closing before the end with reads in flight
+ */
+void test_reader_defaults_and_early_close(void) {
+    const size_t size = 5 * STRIDER_READER_BUFFER_SIZE + 99;
+    char *data = make_data(size, 7);
+    strider_buffer_view_t chunk;
+
+    write_scratch(data, size);
+
+    strider_reader_t *reader = strider_reader_open(SCRATCH_PATH, NULL);
+    TEST_ASSERT_NOT_NULL(reader);
+    assert_reads(reader, data, size, STRIDER_READER_BUFFER_SIZE);
+    strider_reader_close(reader);
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        reader = open_backend(backends[b], 3);
+        if (reader) {
+            TEST_ASSERT_EQUAL_INT(1, strider_reader_next(reader, &chunk));
+            TEST_ASSERT_EQUAL_MEMORY(data, chunk.data, BUFFER_SIZE);
+            strider_reader_close(reader);
+        }
+    }
+    free(data);
+}
+
+/**
+ * Test: Invalid arguments and missing files
+ */
+void test_reader_invalid_arguments(void) {
+    const strider_reader_options_t one_buffer = {BUFFER_SIZE, 1, STRIDER_READER_AUTO};
+    strider_buffer_view_t chunk;
+
+    TEST_ASSERT_NULL(strider_reader_open(NULL, NULL));
+    TEST_ASSERT_NULL(strider_reader_open("does/not/exist", NULL));
+    write_scratch("x", 1);
+    TEST_ASSERT_NULL(strider_reader_open(SCRATCH_PATH, &one_buffer));
+    TEST_ASSERT_EQUAL_INT(-1, strider_reader_next(NULL, &chunk));
+    strider_reader_close(NULL);
+}
+
+#if defined(__linux__)
+
+/* Descriptor of this process's io_uring instance, or -1 */
+static int find_ring_fd(void) {
+    DIR *dir = opendir("/proc/self/fd");
+    struct dirent *entry;
+    int found = -1;
+
+    while (dir && found < 0 && (entry = readdir(dir)) != NULL) {
+        char path[300];
+        char target[64];
+        ssize_t length;
+
+        snprintf(path, sizeof(path), "/proc/self/fd/%s", entry->d_name);
+        length = readlink(path, target, sizeof(target) - 1);
+        if (length > 0) {
+            target[length] = '\0';
+            if (strcmp(target, "anon_inode:[io_uring]") == 0) {
+                found = atoi(entry->d_name);
+            }
+        }
+    }
+    if (dir) {
+        closedir(dir);
+    }
+    return found;
+}
+
+/**
+ * Test: A failed resubmit is sticky instead of hanging the ring later
+ */
+void test_reader_uring_fill_failure(void) {
+    const size_t size = 10 * BUFFER_SIZE;
+    char *data = make_data(size, 13);
+    strider_buffer_view_t chunk;
+
+    write_scratch(data, size);
+    free(data);
+
+    strider_reader_t *reader = open_backend(STRIDER_READER_IO_URING, 2);
+    if (!reader) {
+        TEST_IGNORE_MESSAGE("io_uring not available");
+    }
+    TEST_ASSERT_EQUAL_INT(1, strider_reader_next(reader, &chunk));
+
+    /* Swap the ring for /dev/null, so handing the chunk back cannot refill it */
+    const int ring = find_ring_fd();
+    const int null_fd = open("/dev/null", O_RDONLY);
+    TEST_ASSERT_TRUE(ring >= 0 && null_fd >= 0);
+    TEST_ASSERT_EQUAL_INT(ring, dup2(null_fd, ring));
+    close(null_fd);
+
+    for (int call = 0; call < 6; call++) {
+        TEST_ASSERT_EQUAL_INT(-1, strider_reader_next(reader, &chunk));
+    }
+    strider_reader_close(reader);
+}
+
+#endif
+
+#if !defined(_WIN32)
+
+static void *fifo_writer(void *arg) {
+    const char *data = (const char *) arg;
+    FILE *fp = fopen(FIFO_PATH, "wb");
+
+    if (fp) {
+        fwrite(data, 1, 3 * BUFFER_SIZE + 5, fp);
+        fclose(fp);
+    }
+    return NULL;
+}
+
+/* Opens the FIFO (which blocks until a reader does) and writes nothing */
+static void *fifo_opener(void *arg) {
+    FILE *fp = fopen(FIFO_PATH, "wb");
+
+    (void) arg;
+    if (fp) {
+        fclose(fp);
+    }
+    return NULL;
+}
+
+/**
+ * Test: A pipe is read in order by the thread backend
+ */
+void test_reader_fifo(void) {
+    const size_t size = 3 * BUFFER_SIZE + 5;
+    const strider_reader_options_t options = {BUFFER_SIZE, 2, STRIDER_READER_AUTO};
+    const strider_reader_options_t uring = {BUFFER_SIZE, 2, STRIDER_READER_IO_URING};
+    char *data = make_data(size, 11);
+    pthread_t writer;
+
+    remove(FIFO_PATH);
+    if (mkfifo(FIFO_PATH, 0600) != 0) {
+        free(data);
+        TEST_IGNORE_MESSAGE("mkfifo not supported here");
+    }
+
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&writer, NULL, fifo_writer, data));
+    strider_reader_t *reader = strider_reader_open(FIFO_PATH, &options);
+    TEST_ASSERT_NOT_NULL(reader);
+    TEST_ASSERT_EQUAL_INT(STRIDER_READER_THREAD, strider_reader_backend(reader));
+    assert_reads(reader, data, size, BUFFER_SIZE);
+    strider_reader_close(reader);
+    pthread_join(writer, NULL);
+
+    /* io_uring reads at offsets, which a pipe does not have */
+    TEST_ASSERT_EQUAL_INT(0, pthread_create(&writer, NULL, fifo_opener, NULL));
+    TEST_ASSERT_NULL(strider_reader_open(FIFO_PATH, &uring));
+    pthread_join(writer, NULL);
+
+    remove(FIFO_PATH);
+    free(data);
+}
+
+#endif
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_reader_sizes);
+    RUN_TEST(test_reader_defaults_and_early_close);
+    RUN_TEST(test_reader_invalid_arguments);
+#if defined(__linux__)
+    RUN_TEST(test_reader_uring_fill_failure);
+#endif
+#if !defined(_WIN32)
+    RUN_TEST(test_reader_fifo);
+#endif
+
+    return UNITY_END();
+}
@@ -11,6 +11,8 @@
 
 #include "strider/config.h"
 #include "unity.h"
+#include <stdlib.h>
+#include <string.h>
 
 void setUp(void) {
     /* Run before each test */
@@ -146,6 +148,48 @@ void test_feature_detection_is_consistent(void) {
 #endif
 }
 
+/**
+ * Test: The pointer accessor returns the same cached features
+ * Expected: Stable non-NULL pointer, equal to the copy
+ */
+void test_cpu_features_pointer(void) {
+    const strider_cpu_features_t *features = strider_cpu_features();
+    strider_cpu_features_t copy = strider_get_cpu_features();
+
+    TEST_ASSERT_NOT_NULL(features);
+    TEST_ASSERT_EQUAL_PTR(features, strider_cpu_features());
+    TEST_ASSERT_EQUAL_MEMORY(features, &copy, sizeof(copy));
+}
+
+/**
+ * Test: Describing every feature into small buffers truncates safely
+ * Expected: Output is a NUL-terminated prefix of the full description,
+ *           and the return value is its length
+ */
+void test_describe_cpu_features_truncates(void) {
+    strider_cpu_features_t features;
+    char full[1024];
+
+    memset(&features, 1, sizeof(features));
+    strcpy(features.vendor, "GenuineIntel");
+    const int length = strider_describe_cpu_features(&features, full, sizeof(full));
+    TEST_ASSERT_EQUAL_INT((int) strlen(full), length);
+
+    for (size_t size = 1; size <= strlen(full) + 1; size++) {
+        char *buffer = (char *) malloc(size); /* Exact size, so ASan catches overruns */
+        TEST_ASSERT_NOT_NULL(buffer);
+        memset(buffer, 'x', size);
+        /* Characters written, so it is safe to use as an offset */
+        TEST_ASSERT_EQUAL_INT((int) (size - 1),
+                              strider_describe_cpu_features(&features, buffer, size));
+        TEST_ASSERT_EQUAL_size_t(size - 1, strlen(buffer));
+        if (size > 1) {
+            TEST_ASSERT_EQUAL_MEMORY(full, buffer, size - 1);
+        }
+        free(buffer);
+    }
+}
+
 int main(void) {
     UNITY_BEGIN();
 
@@ -156,6 +200,8 @@ int main(void) {
     RUN_TEST(test_cpu_has_neon);
     RUN_TEST(test_compile_time_simd_macros);
     RUN_TEST(test_feature_detection_is_consistent);
+    RUN_TEST(test_cpu_features_pointer);
+    RUN_TEST(test_describe_cpu_features_truncates);
 
     return UNITY_END();
 }
@@ -0,0 +1,325 @@
+/**
+ * @file test_stats.c
+ * @brief Unit tests for per-kernel statistics
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Counter checks run only in builds with STRIDER_ENABLE_STATS; other
+ * builds check that the API reports nothing.
+ */
+
+#include "strider/dispatch.h"
+#include "strider/parsers/byteset.h"
+#include "strider/parsers/memchr.h"
+#include "strider/parsers/multi_pattern.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/strchr.h"
+#include "strider/parsers/strstr.h"
+#include "strider/stats.h"
+#include "strider/utils/thread_pool.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define BUFFER_SIZE 4096
+
+static char buffer[BUFFER_SIZE + 64];
+
+void setUp(void) {
+    strider_reset_stats();
+}
+
+void tearDown(void) {
+    strider_set_backend(STRIDER_BACKEND_AUTO);
+}
+
+static strider_kernel_stats_t kernel_stats(strider_stats_kernel_t kernel) {
+    strider_stats_t stats;
+
+    strider_get_stats(&stats);
+    return stats.kernels[kernel];
+}
+
+/* Every byte is counted once; vector backends leave at most the
+ * unaligned head and the tail to scalar code */
+static void assert_split(strider_backend_t backend, strider_kernel_stats_t stats, size_t bytes) {
+    TEST_ASSERT_EQUAL_UINT64(bytes, stats.bytes);
+    TEST_ASSERT_EQUAL_UINT64(stats.bytes, stats.simd_bytes + stats.scalar_bytes);
+    if (backend == STRIDER_BACKEND_SCALAR) {
+        TEST_ASSERT_EQUAL_UINT64(0, stats.simd_bytes);
+    } else {
+        TEST_ASSERT_TRUE(stats.scalar_bytes <= 128);
+    }
+}
+
+/* ========================================================================
+ * API
+ * ======================================================================== */
+
+void test_stats_kernel_names(void) {
+    TEST_ASSERT_EQUAL_STRING("count_newlines",
+                             strider_stats_kernel_name(STRIDER_STATS_COUNT_NEWLINES));
+    TEST_ASSERT_EQUAL_STRING("byteset", strider_stats_kernel_name(STRIDER_STATS_BYTESET));
+    TEST_ASSERT_EQUAL_STRING("multi_pattern",
+                             strider_stats_kernel_name(STRIDER_STATS_MULTI_PATTERN));
+    TEST_ASSERT_NULL(strider_stats_kernel_name(STRIDER_STATS_KERNEL_COUNT));
+}
+
+/**
+ * Test: A description cut off by a small buffer returns what was written
+ */
+void test_stats_describe_truncates(void) {
+    strider_stats_t stats;
+    char full[1024];
+
+    memset(&stats, 0, sizeof(stats));
+    stats.backend = STRIDER_BACKEND_SCALAR;
+    stats.enabled = true;
+    for (int k = 0; k < STRIDER_STATS_KERNEL_COUNT; k++) {
+        stats.kernels[k].calls = 1;
+    }
+    const int length = strider_describe_stats(&stats, full, sizeof(full));
+    TEST_ASSERT_EQUAL_INT((int) strlen(full), length);
+
+    for (size_t size = 1; size <= strlen(full) + 1; size++) {
+        char *text = (char *) malloc(size); /* Exact size, so ASan catches overruns */
+        TEST_ASSERT_NOT_NULL(text);
+        memset(text, 'x', size);
+        TEST_ASSERT_EQUAL_INT((int) (size - 1), strider_describe_stats(&stats, text, size));
+        TEST_ASSERT_EQUAL_size_t(size - 1, strlen(text));
+        if (size > 1) {
+            TEST_ASSERT_EQUAL_MEMORY(full, text, size - 1);
+        }
+        free(text);
+    }
+}
+
+void test_stats_snapshot(void) {
+    strider_stats_t stats;
+    char text[1024];
+
+    memset(buffer, '\n', BUFFER_SIZE);
+    TEST_ASSERT_EQUAL_size_t(BUFFER_SIZE, strider_count_newlines_simd(buffer, BUFFER_SIZE));
+
+    strider_get_stats(&stats);
+    TEST_ASSERT_EQUAL_INT(strider_get_backend(), stats.backend);
+    TEST_ASSERT_TRUE(strider_describe_stats(&stats, text, sizeof(text)) > 0);
+    TEST_ASSERT_NOT_NULL(strstr(text, strider_backend_name(stats.backend)));
+    TEST_ASSERT_EQUAL_INT(-1, strider_describe_stats(NULL, text, sizeof(text)));
+
+    if (!stats.enabled) {
+        for (int k = 0; k < STRIDER_STATS_KERNEL_COUNT; k++) {
+            TEST_ASSERT_EQUAL_UINT64(0, stats.kernels[k].calls);
+            TEST_ASSERT_EQUAL_UINT64(0, stats.kernels[k].bytes);
+        }
+        TEST_ASSERT_NOT_NULL(strstr(text, "disabled"));
+        return;
+    }
+    TEST_ASSERT_EQUAL_UINT64(1, stats.kernels[STRIDER_STATS_COUNT_NEWLINES].calls);
+    TEST_ASSERT_EQUAL_UINT64(BUFFER_SIZE, stats.kernels[STRIDER_STATS_COUNT_NEWLINES].bytes);
+    TEST_ASSERT_NOT_NULL(strstr(text, "count_newlines: 1 calls"));
+
+    strider_reset_stats();
+    TEST_ASSERT_EQUAL_UINT64(0, kernel_stats(STRIDER_STATS_COUNT_NEWLINES).calls);
+}
+
+/* ========================================================================
+ * Byte Split per Backend
+ * ======================================================================== */
+
+static bool stats_enabled(void) {
+    strider_stats_t stats;
+
+    strider_get_stats(&stats);
+    return stats.enabled;
+}
+
+/* CRLF input must stay in the vector loops like LF input */
+void test_stats_newline_split(void) {
+    const char *unaligned = buffer + 1;
+
+    if (!stats_enabled()) {
+        TEST_IGNORE_MESSAGE("Built without STRIDER_ENABLE_STATS");
+    }
+    for (size_t i = 0; i + 1 < BUFFER_SIZE; i += 2) {
+        buffer[i] = '\r';
+        buffer[i + 1] = '\n';
+    }
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        const strider_backend_t backend = (strider_backend_t) b;
+        size_t positions[BUFFER_SIZE];
+        uint8_t packed[BUFFER_SIZE];
+        size_t packed_size;
+
+        if (strider_set_backend(backend) != 0) {
+            continue;
+        }
+
+        strider_reset_stats();
+        strider_count_newlines_simd(unaligned, BUFFER_SIZE - 1);
+        assert_split(backend, kernel_stats(STRIDER_STATS_COUNT_NEWLINES), BUFFER_SIZE - 1);
+
+        strider_find_newline_positions_simd(unaligned, BUFFER_SIZE - 1, positions, BUFFER_SIZE);
+        assert_split(backend, kernel_stats(STRIDER_STATS_FIND_NEWLINE_POSITIONS),
+                     BUFFER_SIZE - 1);
+
+        strider_pack_newline_positions_simd(unaligned, BUFFER_SIZE - 1, packed, sizeof(packed),
+                                            &packed_size, NULL);
+        assert_split(backend, kernel_stats(STRIDER_STATS_PACK_NEWLINE_POSITIONS),
+                     BUFFER_SIZE - 1);
+        TEST_ASSERT_EQUAL_UINT64(1, kernel_stats(STRIDER_STATS_PACK_NEWLINE_POSITIONS).calls);
+    }
+}
+
+/* Searches count the bytes up to the match (within a block) */
+void test_stats_search_split(void) {
+    if (!stats_enabled()) {
+        TEST_IGNORE_MESSAGE("Built without STRIDER_ENABLE_STATS");
+    }
+    memset(buffer, 'a', BUFFER_SIZE);
+    buffer[BUFFER_SIZE] = '\0';
+    buffer[1000] = 'x';
+
+    strider_byteset_t set;
+    strider_byteset_init(&set, "xyz", 3);
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        const strider_backend_t backend = (strider_backend_t) b;
+        const strider_buffer_view_t view = strider_buffer_view_create(buffer, BUFFER_SIZE);
+        strider_kernel_stats_t stats;
+
+        if (strider_set_backend(backend) != 0) {
+            continue;
+        }
+        strider_reset_stats();
+
+        TEST_ASSERT_EQUAL_size_t(1000, strider_memchr_simd(view, 'x'));
+        stats = kernel_stats(STRIDER_STATS_MEMCHR);
+        TEST_ASSERT_TRUE(stats.bytes >= 1001 && stats.bytes <= 1000 + 64);
+        TEST_ASSERT_EQUAL_UINT64(stats.bytes, stats.simd_bytes + stats.scalar_bytes);
+
+        TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_memchr_simd(view, 'q'));
+        assert_split(backend, kernel_stats(STRIDER_STATS_MEMCHR), stats.bytes + BUFFER_SIZE);
+
+        TEST_ASSERT_EQUAL_PTR(buffer + 1000, strider_strchr_simd(buffer, 'x'));
+        stats = kernel_stats(STRIDER_STATS_STRCHR);
+        TEST_ASSERT_EQUAL_UINT64(1, stats.calls);
+        TEST_ASSERT_TRUE(stats.bytes >= 1001 && stats.bytes <= 1000 + 64);
+
+        TEST_ASSERT_EQUAL_size_t(1000, strider_find_byteset_simd(view, &set));
+        stats = kernel_stats(STRIDER_STATS_BYTESET);
+        TEST_ASSERT_TRUE(stats.bytes >= 1001 && stats.bytes <= 1000 + 64);
+        if (backend == STRIDER_BACKEND_SCALAR) {
+            TEST_ASSERT_EQUAL_UINT64(0, stats.simd_bytes);
+        }
+    }
+}
+
+/**
+ * Test: Substring and multi-literal searches count under their own kernels
+ */
+void test_stats_substring_split(void) {
+    if (!stats_enabled()) {
+        TEST_IGNORE_MESSAGE("Built without STRIDER_ENABLE_STATS");
+    }
+    memset(buffer, 'a', BUFFER_SIZE);
+    buffer[1000] = 'x';
+    buffer[1001] = 'y';
+
+    const strider_buffer_view_t patterns[] = {strider_buffer_view_from_cstr("xy"),
+                                              strider_buffer_view_from_cstr("zz")};
+    strider_multi_pattern_t *mp = strider_multi_pattern_create(patterns, 2);
+    TEST_ASSERT_NOT_NULL(mp);
+
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        const strider_backend_t backend = (strider_backend_t) b;
+        const strider_buffer_view_t view = strider_buffer_view_create(buffer, BUFFER_SIZE);
+        strider_match_t matches[4];
+        strider_kernel_stats_t stats;
+
+        if (strider_set_backend(backend) != 0) {
+            continue;
+        }
+        strider_reset_stats();
+
+        TEST_ASSERT_EQUAL_size_t(1000, strider_strstr_simd(view, patterns[0]));
+        TEST_ASSERT_EQUAL_size_t(1000, strider_strstr_nocase_simd(view, patterns[0]));
+        stats = kernel_stats(STRIDER_STATS_STRSTR);
+        TEST_ASSERT_EQUAL_UINT64(2, stats.calls);
+        TEST_ASSERT_TRUE(stats.bytes >= 2 * 1002 && stats.bytes <= 2 * (1000 + 64 + 1));
+        TEST_ASSERT_EQUAL_UINT64(stats.bytes, stats.simd_bytes + stats.scalar_bytes);
+        TEST_ASSERT_EQUAL_UINT64(0, kernel_stats(STRIDER_STATS_MEMCHR).calls);
+
+        strider_reset_stats();
+        TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr_simd(view, patterns[1]));
+        assert_split(backend, kernel_stats(STRIDER_STATS_STRSTR), BUFFER_SIZE);
+
+        /* A one-byte needle is a memchr */
+        strider_reset_stats();
+        const strider_buffer_view_t one_byte = strider_buffer_view_from_cstr("y");
+        TEST_ASSERT_EQUAL_size_t(1001, strider_strstr_simd(view, one_byte));
+        TEST_ASSERT_EQUAL_UINT64(1, kernel_stats(STRIDER_STATS_MEMCHR).calls);
+        TEST_ASSERT_EQUAL_UINT64(0, kernel_stats(STRIDER_STATS_STRSTR).calls);
+
+        /* Teddy, or the DFA where there is no byte shuffle (SSE2) */
+        strider_reset_stats();
+        TEST_ASSERT_EQUAL_size_t(1, strider_multi_pattern_find_simd(mp, view, matches, 4));
+        stats = kernel_stats(STRIDER_STATS_MULTI_PATTERN);
+        TEST_ASSERT_EQUAL_UINT64(1, stats.calls);
+        TEST_ASSERT_EQUAL_UINT64(BUFFER_SIZE, stats.bytes);
+        TEST_ASSERT_EQUAL_UINT64(stats.bytes, stats.simd_bytes + stats.scalar_bytes);
+        if (backend == STRIDER_BACKEND_SCALAR) {
+            TEST_ASSERT_EQUAL_UINT64(0, stats.simd_bytes);
+        }
+    }
+    strider_multi_pattern_destroy(mp);
+}
+
+/* ========================================================================
+ * Threads
+ * ======================================================================== */
+
+#define THREAD_TASKS 64
+
+static void count_task(void *arg, size_t index) {
+    (void) arg;
+    (void) index;
+    strider_count_newlines_simd(buffer, BUFFER_SIZE);
+}
+
+/* Counts of all threads are included, also of threads that exited */
+void test_stats_threads(void) {
+    if (!stats_enabled()) {
+        TEST_IGNORE_MESSAGE("Built without STRIDER_ENABLE_STATS");
+    }
+    memset(buffer, '\n', BUFFER_SIZE);
+
+    for (int round = 0; round < 2; round++) {
+        strider_thread_pool_t *pool = strider_thread_pool_create(4);
+        TEST_ASSERT_NOT_NULL(pool);
+
+        const strider_executor_t executor = strider_thread_pool_executor(pool);
+        executor.run(executor.context, count_task, NULL, THREAD_TASKS);
+        strider_thread_pool_destroy(pool);
+    }
+
+    const strider_kernel_stats_t stats = kernel_stats(STRIDER_STATS_COUNT_NEWLINES);
+    TEST_ASSERT_EQUAL_UINT64(2 * THREAD_TASKS, stats.calls);
+    TEST_ASSERT_EQUAL_UINT64((uint64_t) 2 * THREAD_TASKS * BUFFER_SIZE, stats.bytes);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_stats_kernel_names);
+    RUN_TEST(test_stats_snapshot);
+    RUN_TEST(test_stats_describe_truncates);
+    RUN_TEST(test_stats_newline_split);
+    RUN_TEST(test_stats_search_split);
+    RUN_TEST(test_stats_substring_split);
+    RUN_TEST(test_stats_threads);
+
+    return UNITY_END();
+}
@@ -247,6 +247,28 @@ void test_strchr_long_string_not_found(void) {
     free(long_str);
 }
 
+/* ========================================================================
+ * Batch Search Tests
+ * ======================================================================== */
+
+/**
+ * Test: Batch search gives the per-string results and counts the hits
+ */
+void test_strchr_batch(void) {
+    const char *strs[] = {"text/html; charset=utf-8", "", "gzip, deflate", "a;b"};
+    const char *expected[] = {strs[0] + 9, NULL, NULL, strs[3] + 1};
+    const char *results[4];
+
+    TEST_ASSERT_EQUAL_size_t(2, strider_strchr_batch(strs, 4, ';', results));
+    TEST_ASSERT_EQUAL_PTR_ARRAY(expected, results, 4);
+    TEST_ASSERT_EQUAL_size_t(2, strider_strchr_batch_simd(strs, 4, ';', results));
+    TEST_ASSERT_EQUAL_PTR_ARRAY(expected, results, 4);
+
+    /* Searching for the terminator always succeeds */
+    TEST_ASSERT_EQUAL_size_t(4, strider_strchr_batch_simd(strs, 4, '\0', results));
+    TEST_ASSERT_EQUAL_PTR(strs[1], results[1]);
+}
+
 /* ========================================================================
  * Test Runner
  * ======================================================================== */
@@ -271,5 +293,8 @@ int main(void) {
     RUN_TEST(test_strchr_long_string);
     RUN_TEST(test_strchr_long_string_not_found);
 
+    /* Batch tests */
+    RUN_TEST(test_strchr_batch);
+
     return UNITY_END();
 }
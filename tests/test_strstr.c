@@ -0,0 +1,259 @@
+/**
+ * @file test_strstr.c
+ * @brief Unit tests for length-bounded substring search
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Tests the scalar reference, the precompiled needle handle and the
+ * SIMD first/last-byte filter, including candidates that fail the
+ * inner-byte verification.
+ */
+
+#include "strider/parsers/strstr.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+static strider_buffer_view_t cstr(const char *s) {
+    return strider_buffer_view_from_cstr(s);
+}
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* ========================================================================
+ * Scalar Reference Implementation Tests
+ * ======================================================================== */
+
+/**
+ * Test: Find tokens in a log line
+ */
+void test_strstr_log_tokens(void) {
+    strider_buffer_view_t line = cstr("2025-01-01 ERROR request_id=42 failed");
+
+    TEST_ASSERT_EQUAL_size_t(11, strider_strstr(line, cstr("ERROR")));
+    TEST_ASSERT_EQUAL_size_t(17, strider_strstr(line, cstr("request_id=")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr(line, cstr("WARN")));
+}
+
+/**
+ * Test: Empty and oversized needles
+ */
+void test_strstr_edge_cases(void) {
+    strider_buffer_view_t text = cstr("abc");
+
+    TEST_ASSERT_EQUAL_size_t(0, strider_strstr(text, cstr("")));
+    TEST_ASSERT_EQUAL_size_t(0, strider_strstr_simd(text, cstr("")));
+    TEST_ASSERT_EQUAL_size_t(0, strider_strstr(text, cstr("abc")));
+    TEST_ASSERT_EQUAL_size_t(0, strider_strstr_simd(text, cstr("abc")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr(text, cstr("abcd")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr_simd(text, cstr("abcd")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr_simd(cstr(""), cstr("a")));
+}
+
+/**
+ * Test: Invalid needle arguments are rejected
+ */
+void test_needle_init_invalid(void) {
+    strider_needle_t needle;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_needle_init(NULL, cstr("a")));
+    TEST_ASSERT_EQUAL_INT(-1, strider_needle_init(&needle, strider_buffer_view_create(NULL, 3)));
+    TEST_ASSERT_EQUAL_INT(0, strider_needle_init(&needle, strider_buffer_view_create(NULL, 0)));
+    TEST_ASSERT_EQUAL_size_t(0, needle.size);
+}
+
+/* ========================================================================
+ * SIMD Implementation Tests
+ * ======================================================================== */
+
+/**
+ * Test: Precompiled needle reused across many haystacks
+ */
+void test_needle_reuse(void) {
+    const char *lines[] = {
+        "INFO started",
+        "ERROR disk full",
+        "debug: no ERRORS here? ERROR yes",
+        "ERRO",
+        "",
+    };
+    const size_t expected[] = {STRIDER_NOT_FOUND, 0, 10, STRIDER_NOT_FOUND, STRIDER_NOT_FOUND};
+    strider_needle_t needle;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_needle_init(&needle, cstr("ERROR")));
+    TEST_ASSERT_EQUAL_UINT8('E', needle.first);
+    TEST_ASSERT_EQUAL_UINT8('R', needle.last);
+
+    for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        TEST_ASSERT_EQUAL_size_t(expected[i], strider_needle_find(cstr(lines[i]), &needle));
+    }
+}
+
+/**
+ * Test: Candidates whose ends match but inner bytes differ are rejected
+ */
+void test_strstr_false_candidates(void) {
+    size_t size = 300;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* "aXXb" repeated: every 'a' ... 'b' pair is a candidate for "aYYb" */
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = "aXXb"[i % 4];
+    }
+    memcpy(buffer + 250, "aYYb", 4);
+
+    strider_buffer_view_t view = strider_buffer_view_create(buffer, size);
+    TEST_ASSERT_EQUAL_size_t(250, strider_strstr_simd(view, cstr("aYYb")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr_simd(view, cstr("aZZb")));
+
+    free(buffer);
+}
+
+/**
+ * Test: SIMD matches scalar across needle lengths, offsets and sizes
+ */
+void test_strstr_simd_vs_scalar(void) {
+    size_t size = 800;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* Small alphabet so partial matches are frequent */
+    srand(4242);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) ('a' + rand() % 3);
+    }
+
+    for (size_t k = 1; k <= 9; k++) {
+        for (size_t start = 0; start + k <= size; start += 97) {
+            strider_buffer_view_t needle = strider_buffer_view_create(buffer + start, k);
+
+            for (size_t offset = 0; offset < 40; offset += 13) {
+                for (size_t len = 0; len + offset <= size; len += 29) {
+                    strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                    TEST_ASSERT_EQUAL_size_t(strider_strstr(view, needle),
+                                             strider_strstr_simd(view, needle));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/**
+ * Test: Match at the very end of the haystack
+ */
+void test_strstr_match_at_end(void) {
+    size_t size = 513;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    memset(buffer, '.', size);
+    memcpy(buffer + size - 11, "request_id=", 11);
+
+    strider_buffer_view_t view = strider_buffer_view_create(buffer, size);
+    TEST_ASSERT_EQUAL_size_t(size - 11, strider_strstr_simd(view, cstr("request_id=")));
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Case-Insensitive Tests
+ * ======================================================================== */
+
+/**
+ * Test: Any spelling of a level matches; the needle may be in any case
+ */
+void test_strstr_nocase_levels(void) {
+    const char *line = "2025-01-02T03:04:05Z [main] Error: disk full";
+    strider_needle_t needle;
+
+    TEST_ASSERT_EQUAL_size_t(28, strider_strstr_nocase(cstr(line), cstr("ERROR")));
+    TEST_ASSERT_EQUAL_size_t(28, strider_strstr_nocase_simd(cstr(line), cstr("error")));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_strstr_simd(cstr(line), cstr("ERROR")));
+
+    TEST_ASSERT_EQUAL_INT(0, strider_needle_init(&needle, cstr("eRrOr")));
+    TEST_ASSERT_EQUAL_size_t(28, strider_needle_find_nocase(cstr(line), &needle));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_needle_find(cstr(line), &needle));
+    TEST_ASSERT_EQUAL_size_t(0, strider_strstr_nocase_simd(cstr(line), cstr("")));
+}
+
+/**
+ * Test: Only letters fold; bytes that differ by 0x20 otherwise do not match
+ */
+void test_strstr_nocase_non_letters(void) {
+    /* '[' / '{', '@' / '`' and Latin-1 0xC9 / 0xE9 differ only in bit 5 */
+    const char *text = "{main} `id` caf\xe9 [MAIN] @ID@ CAF\xc9";
+
+    TEST_ASSERT_EQUAL_size_t(17, strider_strstr_nocase_simd(cstr(text), cstr("[main]")));
+    TEST_ASSERT_EQUAL_size_t(24, strider_strstr_nocase_simd(cstr(text), cstr("@id")));
+    TEST_ASSERT_EQUAL_size_t(12, strider_strstr_nocase_simd(cstr(text), cstr("CAF\xe9")));
+    TEST_ASSERT_EQUAL_size_t(29, strider_strstr_nocase_simd(cstr(text), cstr("caf\xc9")));
+    TEST_ASSERT_EQUAL_size_t(strider_strstr_nocase(cstr(text), cstr("{MAIN}")),
+                             strider_strstr_nocase_simd(cstr(text), cstr("{MAIN}")));
+}
+
+/**
+ * Test: SIMD matches scalar on mixed-case input across lengths and offsets
+ */
+void test_strstr_nocase_simd_vs_scalar(void) {
+    size_t size = 700;
+    uint8_t *buffer = (uint8_t *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    /* a, b and their upper case, plus '@' and '`' just outside A-Z / a-z */
+    srand(2525);
+    for (size_t i = 0; i < size; i++) {
+        buffer[i] = (uint8_t) "abAB@`"[rand() % 6];
+    }
+
+    for (size_t k = 1; k <= 7; k++) {
+        for (size_t start = 0; start + k <= size; start += 89) {
+            strider_buffer_view_t needle = strider_buffer_view_create(buffer + start, k);
+
+            for (size_t offset = 0; offset < 40; offset += 13) {
+                for (size_t len = 0; len + offset <= size; len += 31) {
+                    strider_buffer_view_t view = strider_buffer_view_create(buffer + offset, len);
+                    TEST_ASSERT_EQUAL_size_t(strider_strstr_nocase(view, needle),
+                                             strider_strstr_nocase_simd(view, needle));
+                }
+            }
+        }
+    }
+
+    free(buffer);
+}
+
+/* ========================================================================
+ * Test Runner
+ * ======================================================================== */
+
+int main(void) {
+    UNITY_BEGIN();
+
+    /* Scalar reference */
+    RUN_TEST(test_strstr_log_tokens);
+    RUN_TEST(test_strstr_edge_cases);
+    RUN_TEST(test_needle_init_invalid);
+
+    /* SIMD */
+    RUN_TEST(test_needle_reuse);
+    RUN_TEST(test_strstr_false_candidates);
+    RUN_TEST(test_strstr_simd_vs_scalar);
+    RUN_TEST(test_strstr_match_at_end);
+
+    /* Case-insensitive */
+    RUN_TEST(test_strstr_nocase_levels);
+    RUN_TEST(test_strstr_nocase_non_letters);
+    RUN_TEST(test_strstr_nocase_simd_vs_scalar);
+
+    return UNITY_END();
+}
@@ -0,0 +1,280 @@
+/**
+ * @file test_text_scan.c
+ * @brief Unit tests for the single-pass text scan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Tests UTF-8 validation against the RFC 3629 edge cases, the newline
+ * and line-length statistics, and that the SIMD scan agrees with the
+ * scalar reference where sequences and \r\n pairs cross 64-byte blocks,
+ * on every backend the CPU supports.
+ */
+
+#include "strider/dispatch.h"
+#include "strider/parsers/newline.h"
+#include "strider/parsers/text_scan.h"
+#include "unity.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    strider_set_backend(STRIDER_BACKEND_AUTO);
+}
+
+static size_t validate(const char *s) {
+    return strider_validate_utf8(s, strlen(s));
+}
+
+/* Same statistics from the reference and every supported backend, and the SIMD result */
+static strider_text_stats_t scan_both(const char *data, size_t size, size_t limit) {
+    strider_text_stats_t expected;
+    strider_text_stats_t actual;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_scan_text(data, size, limit, &expected));
+    for (int b = STRIDER_BACKEND_SCALAR; b < STRIDER_BACKEND_COUNT; b++) {
+        if (!strider_backend_is_supported((strider_backend_t) b)) {
+            continue;
+        }
+        TEST_ASSERT_EQUAL_INT(0, strider_set_backend((strider_backend_t) b));
+        TEST_ASSERT_EQUAL_INT(0, strider_scan_text_simd(data, size, limit, &actual));
+        TEST_ASSERT_EQUAL_size_t(expected.newlines, actual.newlines);
+        TEST_ASSERT_EQUAL_size_t(expected.lines, actual.lines);
+        TEST_ASSERT_EQUAL_size_t(expected.max_line_length, actual.max_line_length);
+        TEST_ASSERT_EQUAL_size_t(expected.long_lines, actual.long_lines);
+        TEST_ASSERT_EQUAL_size_t(expected.first_long_line, actual.first_long_line);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(expected.utf8_error, actual.utf8_error,
+                                         strider_backend_name((strider_backend_t) b));
+        TEST_ASSERT_EQUAL_MEMORY(expected.line_lengths, actual.line_lengths,
+                                 sizeof(expected.line_lengths));
+    }
+    return actual;
+}
+
+/* ========================================================================
+ * UTF-8 Validation Tests
+ * ======================================================================== */
+
+/**
+ * Test: Well-formed sequences of every length, including the range limits
+ */
+void test_validate_utf8_valid(void) {
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_validate_utf8(NULL, 0));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, validate("plain ASCII\n"));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, validate("caf\xc3\xa9 \xe2\x82\xac 1"));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, validate("\xc2\x80\xdf\xbf"));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, validate("\xe0\xa0\x80\xed\x9f\xbf\xef\xbf\xbf"));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, validate("\xf0\x90\x80\x80\xf4\x8f\xbf\xbf"));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, strider_validate_utf8("a\0b", 3));
+}
+
+/**
+ * Test: Offsets of overlong forms, surrogates, out-of-range and stray bytes
+ */
+void test_validate_utf8_invalid(void) {
+    TEST_ASSERT_EQUAL_size_t(2, validate("ab\xc0\xaf"));             /* Overlong 2-byte */
+    TEST_ASSERT_EQUAL_size_t(0, validate("\xc1\xbf"));               /* Overlong 2-byte */
+    TEST_ASSERT_EQUAL_size_t(1, validate("x\xe0\x9f\xbf"));          /* Overlong 3-byte */
+    TEST_ASSERT_EQUAL_size_t(0, validate("\xf0\x8f\xbf\xbf"));       /* Overlong 4-byte */
+    TEST_ASSERT_EQUAL_size_t(3, validate("abc\xed\xa0\x80"));        /* Surrogate */
+    TEST_ASSERT_EQUAL_size_t(0, validate("\xf4\x90\x80\x80"));       /* Above U+10FFFF */
+    TEST_ASSERT_EQUAL_size_t(2, validate("\xc3\xa9\xf5\x80\x80\x80")); /* F5 lead */
+    TEST_ASSERT_EQUAL_size_t(1, validate("a\x80"));                  /* Stray continuation */
+    TEST_ASSERT_EQUAL_size_t(2, validate("\xc3\xa9\xa9"));           /* Too many continuations */
+    TEST_ASSERT_EQUAL_size_t(0, validate("\xe2\x82z"));              /* Too short */
+    TEST_ASSERT_EQUAL_size_t(1, validate("a\xf0\x9f\x98"));          /* Truncated at the end */
+}
+
+/* ========================================================================
+ * Line Statistics Tests
+ * ======================================================================== */
+
+/**
+ * Test: Histogram buckets are powers of two, the last one open-ended
+ */
+void test_line_length_bucket(void) {
+    TEST_ASSERT_EQUAL_size_t(0, strider_line_length_bucket(0));
+    TEST_ASSERT_EQUAL_size_t(1, strider_line_length_bucket(1));
+    TEST_ASSERT_EQUAL_size_t(2, strider_line_length_bucket(2));
+    TEST_ASSERT_EQUAL_size_t(2, strider_line_length_bucket(3));
+    TEST_ASSERT_EQUAL_size_t(7, strider_line_length_bucket(100));
+    TEST_ASSERT_EQUAL_size_t(17, strider_line_length_bucket(65536));
+    TEST_ASSERT_EQUAL_size_t(STRIDER_LINE_LENGTH_BUCKETS - 1,
+                             strider_line_length_bucket(SIZE_MAX));
+}
+
+/**
+ * Test: Mixed line endings, empty lines and an unterminated final line
+ */
+void test_scan_text_lines(void) {
+    const char *text = "abc\r\n\nhello\rx\r\r\nlast";
+    strider_text_stats_t stats = scan_both(text, strlen(text), SIZE_MAX);
+
+    TEST_ASSERT_EQUAL_size_t(strider_count_newlines(text, strlen(text)), stats.newlines);
+    TEST_ASSERT_EQUAL_size_t(5, stats.newlines);
+    TEST_ASSERT_EQUAL_size_t(6, stats.lines);
+    TEST_ASSERT_EQUAL_size_t(5, stats.max_line_length);
+    TEST_ASSERT_EQUAL_size_t(0, stats.long_lines);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, stats.first_long_line);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, stats.utf8_error);
+
+    /* "", "" / "x" / "abc" / "last", "hello" */
+    TEST_ASSERT_EQUAL_size_t(2, stats.line_lengths[0]);
+    TEST_ASSERT_EQUAL_size_t(1, stats.line_lengths[1]);
+    TEST_ASSERT_EQUAL_size_t(1, stats.line_lengths[2]);
+    TEST_ASSERT_EQUAL_size_t(2, stats.line_lengths[3]);
+}
+
+/**
+ * Test: Empty input and a terminated final line add no extra line
+ */
+void test_scan_text_empty(void) {
+    strider_text_stats_t stats = scan_both(NULL, 0, 10);
+
+    TEST_ASSERT_EQUAL_size_t(0, stats.lines);
+    TEST_ASSERT_EQUAL_size_t(STRIDER_NOT_FOUND, stats.utf8_error);
+
+    stats = scan_both("a\n", 2, 10);
+    TEST_ASSERT_EQUAL_size_t(1, stats.lines);
+    TEST_ASSERT_EQUAL_size_t(1, stats.newlines);
+}
+
+/**
+ * Test: Lines over the limit are counted and the first one is located
+ */
+void test_scan_text_long_lines(void) {
+    const size_t limit = 64 * 1024;
+    const size_t size = 3 * limit;
+    char *buffer = (char *) malloc(size);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    memset(buffer, 'a', size);
+    buffer[100] = '\n';                 /* Line of 100 */
+    buffer[100 + limit + 1] = '\n';     /* Line of exactly limit: not long */
+    buffer[100 + 2 * limit + 3] = '\n'; /* Line of limit + 1 */
+
+    strider_text_stats_t stats = scan_both(buffer, size, limit);
+    TEST_ASSERT_EQUAL_size_t(4, stats.lines);
+    TEST_ASSERT_EQUAL_size_t(limit + 1, stats.max_line_length);
+    TEST_ASSERT_EQUAL_size_t(1, stats.long_lines);
+    TEST_ASSERT_EQUAL_size_t(100 + limit + 2, stats.first_long_line);
+    TEST_ASSERT_EQUAL_size_t(2, stats.line_lengths[strider_line_length_bucket(limit)]);
+
+    stats = scan_both(buffer, size, SIZE_MAX);
+    TEST_ASSERT_EQUAL_size_t(0, stats.long_lines);
+
+    free(buffer);
+}
+
+/**
+ * Test: Invalid arguments
+ */
+void test_scan_text_invalid_arguments(void) {
+    strider_text_stats_t stats;
+
+    TEST_ASSERT_EQUAL_INT(-1, strider_scan_text("a", 1, 10, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, strider_scan_text_simd("a", 1, 10, NULL));
+    TEST_ASSERT_EQUAL_INT(-1, strider_scan_text(NULL, 1, 10, &stats));
+    TEST_ASSERT_EQUAL_INT(-1, strider_scan_text_simd(NULL, 1, 10, &stats));
+}
+
+/* ========================================================================
+ * SIMD Block Boundary Tests
+ * ======================================================================== */
+
+/**
+ * Test: \r\n split across blocks counts once
+ */
+void test_scan_text_crlf_across_blocks(void) {
+    char buffer[192];
+
+    memset(buffer, 'a', sizeof(buffer));
+    for (size_t pos = 60; pos < 130; pos++) {
+        buffer[pos] = '\r';
+        buffer[pos + 1] = '\n';
+        strider_text_stats_t stats = scan_both(buffer, sizeof(buffer), SIZE_MAX);
+        TEST_ASSERT_EQUAL_size_t(1, stats.newlines);
+        TEST_ASSERT_EQUAL_size_t(2, stats.lines);
+        buffer[pos] = 'a';
+        buffer[pos + 1] = 'a';
+    }
+}
+
+/**
+ * Test: Sequences crossing a block, and errors just after one
+ */
+void test_scan_text_utf8_across_blocks(void) {
+    static const char *const sequences[] = {
+        "\xc3\xa9",         "\xe2\x82\xac",     "\xf0\x9f\x98\x80", /* Valid */
+        "\xc3",             "\xe2\x82",         "\xf0\x9f\x98",     /* Truncated */
+        "\xe0\x80\x80",     "\xed\xbf\xbf",     "\xf4\x90\x80\x80", /* Out of range */
+        "\xc3\xa9\xa9",     "\x80",             "\xff",             /* Stray bytes */
+    };
+    char buffer[256];
+
+    for (size_t s = 0; s < sizeof(sequences) / sizeof(sequences[0]); s++) {
+        const size_t length = strlen(sequences[s]);
+
+        for (size_t pos = 56; pos < 136; pos++) {
+            memset(buffer, 'a', sizeof(buffer));
+            memcpy(buffer + pos, sequences[s], length);
+
+            /* Error (if any) in the middle, and at the very end */
+            scan_both(buffer, sizeof(buffer), SIZE_MAX);
+            scan_both(buffer, pos + length, SIZE_MAX);
+        }
+    }
+}
+
+/**
+ * Test: Random valid and damaged multilingual text matches the reference
+ */
+void test_scan_text_random(void) {
+    static const char *const pieces[] = {
+        "a", "b ", "\n", "\r\n", "\r", "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\t",
+    };
+    const size_t size = 4096;
+    char *buffer = (char *) malloc(size + 8);
+    TEST_ASSERT_NOT_NULL(buffer);
+
+    srand(626);
+    for (int round = 0; round < 20; round++) {
+        size_t n = 0;
+
+        while (n < size) {
+            const char *piece = pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))];
+            memcpy(buffer + n, piece, strlen(piece));
+            n += strlen(piece);
+        }
+        if (round % 2 == 1) {
+            buffer[rand() % size] = (char) (0x80 + rand() % 0x80);
+        }
+        for (size_t len = 0; len + 8 <= size; len += 197) {
+            scan_both(buffer + round % 7, len, 40);
+        }
+    }
+
+    free(buffer);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_validate_utf8_valid);
+    RUN_TEST(test_validate_utf8_invalid);
+    RUN_TEST(test_line_length_bucket);
+    RUN_TEST(test_scan_text_lines);
+    RUN_TEST(test_scan_text_empty);
+    RUN_TEST(test_scan_text_long_lines);
+    RUN_TEST(test_scan_text_invalid_arguments);
+    RUN_TEST(test_scan_text_crlf_across_blocks);
+    RUN_TEST(test_scan_text_utf8_across_blocks);
+    RUN_TEST(test_scan_text_random);
+
+    return UNITY_END();
+}
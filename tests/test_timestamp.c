@@ -0,0 +1,326 @@
+/**
+ * @file test_timestamp.c
+ * @brief Unit tests for timestamp extraction
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ *
+ * Expected values were computed with Python's calendar.timegm().
+ */
+
+#include "strider/parsers/newline.h"
+#include "strider/parsers/timestamp.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define NS_PER_SEC INT64_C(1000000000)
+
+/* 2025-12-31T23:59:59Z */
+#define NEW_YEARS_EVE INT64_C(1767225599)
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/* Parse str with both implementations and check that they agree */
+static size_t parse(const char *str, strider_timestamp_format_t format, int year, int64_t *ns) {
+    const size_t size = strlen(str);
+    int64_t simd_ns = -1;
+    size_t length = strider_parse_timestamp(str, size, format, year, ns);
+    size_t simd_length = strider_parse_timestamp_simd(str, size, format, year, &simd_ns);
+
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(length, simd_length, str);
+    if (length > 0) {
+        TEST_ASSERT_EQUAL_INT64_MESSAGE(*ns, simd_ns, str);
+    }
+    return length;
+}
+
+static void assert_iso(const char *str, size_t length, int64_t expected) {
+    int64_t ns = 0;
+
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(length, parse(str, STRIDER_TIMESTAMP_ISO8601, 0, &ns), str);
+    TEST_ASSERT_EQUAL_INT64_MESSAGE(expected, ns, str);
+}
+
+static void assert_iso_invalid(const char *str) {
+    int64_t ns = 42;
+
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(0, parse(str, STRIDER_TIMESTAMP_ISO8601, 0, &ns), str);
+    TEST_ASSERT_EQUAL_INT64_MESSAGE(42, ns, str);
+}
+
+/* ========================================================================
+ * ISO 8601 Tests
+ * ======================================================================== */
+
+/**
+ * Test: Basic ISO 8601 stamps and date/time separators
+ */
+void test_iso8601_basic(void) {
+    assert_iso("2025-12-31T23:59:59Z", 20, NEW_YEARS_EVE * NS_PER_SEC);
+    assert_iso("2025-12-31T23:59:59 INFO started", 19, NEW_YEARS_EVE * NS_PER_SEC);
+    assert_iso("2025-12-31 23:59:59", 19, NEW_YEARS_EVE * NS_PER_SEC);
+    assert_iso("2025-12-31t23:59:59z", 20, NEW_YEARS_EVE * NS_PER_SEC);
+    assert_iso("1970-01-01T00:00:00Z", 20, 0);
+    assert_iso("2024-02-29T12:00:00Z", 20, INT64_C(1709208000) * NS_PER_SEC);
+}
+
+/**
+ * Test: Fractions of a second
+ */
+void test_iso8601_fraction(void) {
+    assert_iso("2025-12-31T23:59:59.123Z", 24, NEW_YEARS_EVE * NS_PER_SEC + 123000000);
+    assert_iso("2025-12-31T23:59:59,5", 21, NEW_YEARS_EVE * NS_PER_SEC + 500000000);
+    assert_iso("2025-12-31T23:59:59.123456789", 29, NEW_YEARS_EVE * NS_PER_SEC + 123456789);
+
+    /* Digits past nanoseconds are consumed and ignored */
+    assert_iso("2025-12-31T23:59:59.123456789999Z", 33,
+               NEW_YEARS_EVE * NS_PER_SEC + 123456789);
+
+    /* A dot without digits is not part of the stamp */
+    assert_iso("2025-12-31T23:59:59. done", 19, NEW_YEARS_EVE * NS_PER_SEC);
+
+    /* Before the epoch the fraction still counts forward */
+    assert_iso("1969-12-31T23:59:59.5Z", 22, -500000000);
+}
+
+/**
+ * Test: Zone offsets
+ */
+void test_iso8601_zones(void) {
+    assert_iso("2025-12-31T23:59:59+01:00", 25, (NEW_YEARS_EVE - 3600) * NS_PER_SEC);
+    assert_iso("2025-12-31T23:59:59.250-0530", 28,
+               (NEW_YEARS_EVE + 5 * 3600 + 30 * 60) * NS_PER_SEC + 250000000);
+    assert_iso("2025-12-31T23:59:59+02", 22, (NEW_YEARS_EVE - 7200) * NS_PER_SEC);
+    assert_iso("2025-12-31T23:59:59+02:x", 22, (NEW_YEARS_EVE - 7200) * NS_PER_SEC);
+
+    /* A sign that does not start a zone ends the stamp */
+    assert_iso("2025-12-31T23:59:59 -v", 19, NEW_YEARS_EVE * NS_PER_SEC);
+    assert_iso("2025-12-31T23:59:59+x", 19, NEW_YEARS_EVE * NS_PER_SEC);
+
+    assert_iso_invalid("2025-12-31T23:59:59+24:00");
+    assert_iso_invalid("2025-12-31T23:59:59+01:60");
+}
+
+/**
+ * Test: Malformed stamps and impossible dates are rejected
+ */
+void test_iso8601_invalid(void) {
+    assert_iso_invalid("");
+    assert_iso_invalid("2025-12-31T23:59:5");
+    assert_iso_invalid("2025-12-31X23:59:59");
+    assert_iso_invalid("2025/12/31T23:59:59");
+    assert_iso_invalid("2025-12-31T23-59-59");
+    assert_iso_invalid("2025-1a-31T23:59:59");
+    assert_iso_invalid(" 2025-12-31T23:59:59");
+    assert_iso_invalid("2025-13-01T00:00:00");
+    assert_iso_invalid("2025-00-01T00:00:00");
+    assert_iso_invalid("2025-04-31T00:00:00");
+    assert_iso_invalid("2025-02-29T00:00:00");
+    assert_iso_invalid("2100-02-29T00:00:00");
+    assert_iso_invalid("2025-12-00T00:00:00");
+    assert_iso_invalid("2025-12-31T24:00:00");
+    assert_iso_invalid("2025-12-31T23:60:00");
+    assert_iso_invalid("2025-12-31T23:59:61");
+}
+
+/**
+ * Test: Leap seconds and the int64 nanosecond range
+ */
+void test_iso8601_limits(void) {
+    assert_iso("2000-02-29T00:00:00Z", 20, INT64_C(951782400) * NS_PER_SEC);
+    assert_iso("2016-12-31T23:59:60Z", 20, INT64_C(1483228800) * NS_PER_SEC);
+    assert_iso("2262-01-01T00:00:00Z", 20, INT64_C(9214646400) * NS_PER_SEC);
+    assert_iso("1678-01-01T00:00:00Z", 20, INT64_C(-9214560000) * NS_PER_SEC);
+    assert_iso_invalid("2263-01-01T00:00:00Z");
+    assert_iso_invalid("1677-01-01T00:00:00Z");
+
+    /* Both ends of int64 nanoseconds, to the nanosecond */
+    assert_iso("2262-04-11T23:47:16.854775807Z", 30, INT64_MAX);
+    assert_iso("2262-04-12T00:47:16.854775807+01:00", 35, INT64_MAX);
+    assert_iso_invalid("2262-04-11T23:47:16.854775808Z");
+    assert_iso_invalid("2262-04-11T23:47:17Z");
+    assert_iso("1677-09-21T00:12:43.145224192Z", 30, INT64_MIN);
+    assert_iso("1677-09-21T00:12:44Z", 20, INT64_C(-9223372036) * NS_PER_SEC);
+    assert_iso_invalid("1677-09-21T00:12:43.145224191Z");
+    assert_iso_invalid("1677-09-21T00:12:42.999999999Z");
+    assert_iso_invalid("9999-12-31T23:59:59Z");
+}
+
+/* ========================================================================
+ * Syslog and Epoch Tests
+ * ======================================================================== */
+
+/**
+ * Test: RFC 3164 syslog stamps with a caller-supplied year
+ */
+void test_syslog(void) {
+    int64_t ns = 0;
+
+    TEST_ASSERT_EQUAL_size_t(15, parse("Dec 31 23:59:59 host sshd[1]: ok",
+                                       STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE * NS_PER_SEC, ns);
+
+    TEST_ASSERT_EQUAL_size_t(15, parse("Jan  1 00:00:00", STRIDER_TIMESTAMP_SYSLOG, 2026, &ns));
+    TEST_ASSERT_EQUAL_INT64((NEW_YEARS_EVE + 1) * NS_PER_SEC, ns);
+    TEST_ASSERT_EQUAL_size_t(15, parse("Jan 01 00:00:00", STRIDER_TIMESTAMP_SYSLOG, 2026, &ns));
+    TEST_ASSERT_EQUAL_INT64((NEW_YEARS_EVE + 1) * NS_PER_SEC, ns);
+
+    TEST_ASSERT_EQUAL_size_t(18, parse("Jan  1 00:00:00.25 x", STRIDER_TIMESTAMP_SYSLOG, 2026,
+                                       &ns));
+    TEST_ASSERT_EQUAL_INT64((NEW_YEARS_EVE + 1) * NS_PER_SEC + 250000000, ns);
+
+    /* The year decides whether Feb 29 exists */
+    TEST_ASSERT_EQUAL_size_t(15, parse("Feb 29 12:00:00", STRIDER_TIMESTAMP_SYSLOG, 2024, &ns));
+    TEST_ASSERT_EQUAL_INT64(INT64_C(1709208000) * NS_PER_SEC, ns);
+    TEST_ASSERT_EQUAL_size_t(0, parse("Feb 29 12:00:00", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+
+    TEST_ASSERT_EQUAL_size_t(0, parse("Dez 31 23:59:59", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("dec 31 23:59:59", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("Dec 3  23:59:59", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("Dec  0 23:59:59", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("Dec 31 23:59", STRIDER_TIMESTAMP_SYSLOG, 2025, &ns));
+}
+
+/**
+ * Test: Epoch seconds with optional fraction
+ */
+void test_epoch(void) {
+    int64_t ns = 0;
+
+    TEST_ASSERT_EQUAL_size_t(14, parse("1767225599.123 GET /", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE * NS_PER_SEC + 123000000, ns);
+    TEST_ASSERT_EQUAL_size_t(1, parse("0", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_INT64(0, ns);
+    TEST_ASSERT_EQUAL_size_t(10, parse("9223372036", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_INT64(INT64_C(9223372036) * NS_PER_SEC, ns);
+    TEST_ASSERT_EQUAL_size_t(20, parse("9223372036.854775807", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_INT64(INT64_MAX, ns);
+
+    TEST_ASSERT_EQUAL_size_t(0, parse("9223372036.854775808", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("9223372037", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("17672255991", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse(".5", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+    TEST_ASSERT_EQUAL_size_t(0, parse("", STRIDER_TIMESTAMP_EPOCH, 0, &ns));
+}
+
+/* ========================================================================
+ * Batch and Equivalence Tests
+ * ======================================================================== */
+
+/**
+ * Test: Batch parsing over newline positions, with mixed line endings
+ */
+void test_parse_timestamps_batch(void) {
+    const char text[] = "2025-12-31T23:59:59Z first\r\n"
+                        "no stamp here\n"
+                        "\n"
+                        "2025-12-31T23:59:59.5+01:00 third\r"
+                        "2025-12-31T23:59:5\n"
+                        "1970-01-01 00:00:00\n"
+                        "2025-12-31T23:59:59 unterminated";
+    const size_t size = sizeof(text) - 1;
+    size_t positions[16];
+    int64_t expected[16];
+    int64_t actual[16];
+
+    const size_t count = strider_find_newline_positions(text, size, positions, 16);
+    TEST_ASSERT_EQUAL_size_t(6, count);
+    TEST_ASSERT_EQUAL_size_t(3, strider_parse_timestamps(text, size, positions, count,
+                                                         STRIDER_TIMESTAMP_ISO8601, 0, expected));
+    TEST_ASSERT_EQUAL_size_t(3, strider_parse_timestamps_simd(
+                                    text, size, positions, count, STRIDER_TIMESTAMP_ISO8601, 0,
+                                    actual));
+
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE * NS_PER_SEC, expected[0]);
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, expected[1]);
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, expected[2]);
+    TEST_ASSERT_EQUAL_INT64((NEW_YEARS_EVE - 3600) * NS_PER_SEC + 500000000, expected[3]);
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, expected[4]);
+    TEST_ASSERT_EQUAL_INT64(0, expected[5]);
+    TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, count);
+}
+
+/**
+ * Test: A stamp cut off by the end of its line is rejected in batches
+ */
+void test_parse_timestamps_stamp_at_line_end(void) {
+    const char text[] = "Dec 31 23:59:5\n9 host\nDec 31 23:59:59\nJan  1 00:00:00";
+    const size_t size = sizeof(text) - 1;
+    size_t positions[4];
+    int64_t expected[4];
+    int64_t actual[4];
+
+    const size_t count = strider_find_newline_positions(text, size, positions, 4);
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    TEST_ASSERT_EQUAL_size_t(1, strider_parse_timestamps(text, size, positions, count,
+                                                         STRIDER_TIMESTAMP_SYSLOG, 2025, expected));
+    TEST_ASSERT_EQUAL_size_t(1, strider_parse_timestamps_simd(
+                                    text, size, positions, count, STRIDER_TIMESTAMP_SYSLOG, 2025,
+                                    actual));
+    TEST_ASSERT_EQUAL_INT64(STRIDER_TIMESTAMP_INVALID, expected[0]);
+    TEST_ASSERT_EQUAL_INT64(NEW_YEARS_EVE * NS_PER_SEC, expected[2]);
+    TEST_ASSERT_EQUAL_INT64_ARRAY(expected, actual, count);
+}
+
+/**
+ * Test: SIMD matches the reference on mutated stamps of every length
+ *
+ * Each input is copied into an exactly sized allocation so that reads
+ * past the end are caught by sanitizers.
+ */
+void test_parse_timestamp_simd_matches_scalar(void) {
+    static const char *const seeds[] = {"2025-12-31T23:59:59.123456+01:30 tail",
+                                        "Dec 31 23:59:59.5 host", "1767225599.123456 x"};
+    static const strider_timestamp_format_t formats[] = {
+        STRIDER_TIMESTAMP_ISO8601, STRIDER_TIMESTAMP_SYSLOG, STRIDER_TIMESTAMP_EPOCH};
+    static const char alphabet[] = "0123456789-:Tt .,+Zz\r\nxJD";
+    char text[64];
+
+    srand(1616);
+    for (size_t f = 0; f < 3; f++) {
+        const size_t seed_size = strlen(seeds[f]);
+        for (int round = 0; round < 2000; round++) {
+            memcpy(text, seeds[f], seed_size);
+            if (round > 0) {
+                text[rand() % (int) seed_size] = alphabet[rand() % (int) (sizeof(alphabet) - 1)];
+            }
+            for (size_t size = 0; size <= seed_size; size++) {
+                char *copy = (char *) malloc(size > 0 ? size : 1);
+                int64_t expected = 7;
+                int64_t actual = 7;
+                TEST_ASSERT_NOT_NULL(copy);
+                memcpy(copy, text, size);
+
+                size_t n = strider_parse_timestamp(copy, size, formats[f], 2025, &expected);
+                size_t m = strider_parse_timestamp_simd(copy, size, formats[f], 2025, &actual);
+                TEST_ASSERT_EQUAL_size_t(n, m);
+                TEST_ASSERT_EQUAL_INT64(expected, actual);
+                free(copy);
+            }
+        }
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_iso8601_basic);
+    RUN_TEST(test_iso8601_fraction);
+    RUN_TEST(test_iso8601_zones);
+    RUN_TEST(test_iso8601_invalid);
+    RUN_TEST(test_iso8601_limits);
+    RUN_TEST(test_syslog);
+    RUN_TEST(test_epoch);
+    RUN_TEST(test_parse_timestamps_batch);
+    RUN_TEST(test_parse_timestamps_stamp_at_line_end);
+    RUN_TEST(test_parse_timestamp_simd_matches_scalar);
+
+    return UNITY_END();
+}
@@ -0,0 +1,364 @@
+/**
+ * @file test_tokenize.c
+ * @brief Unit tests for field tokenization
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ * Copyright 2025 Strider Development Team
+ */
+
+#include "strider/parsers/newline.h"
+#include "strider/parsers/tokenize.h"
+#include "unity.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_FIELDS 64
+
+void setUp(void) {
+    /* Setup before each test */
+}
+
+void tearDown(void) {
+    /* Cleanup after each test */
+}
+
+/**
+ * @brief Tokenize str with both implementations and check the fields
+ *
+ * @param expected Fields joined with '|' (NULL for no fields)
+ */
+static void check_fields(const strider_tokenizer_t *tok, const char *str, size_t max_fields,
+                         const char *expected) {
+    strider_buffer_view_t fields[MAX_FIELDS];
+    strider_buffer_view_t simd_fields[MAX_FIELDS];
+    char joined[512] = "";
+    size_t length = 0;
+    const strider_buffer_view_t line = strider_buffer_view_from_cstr(str);
+
+    size_t n = strider_tokenize(tok, line, fields, max_fields);
+    size_t m = strider_tokenize_simd(tok, line, simd_fields, max_fields);
+    TEST_ASSERT_EQUAL_size_t_MESSAGE(n, m, str);
+
+    for (size_t i = 0; i < n; i++) {
+        /* Zero copy: every field points into the line */
+        TEST_ASSERT_TRUE(fields[i].data >= line.data);
+        TEST_ASSERT_TRUE(fields[i].data + fields[i].size <= line.data + line.size);
+        TEST_ASSERT_EQUAL_PTR_MESSAGE(fields[i].data, simd_fields[i].data, str);
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(fields[i].size, simd_fields[i].size, str);
+
+        if (i > 0) {
+            joined[length++] = '|';
+        }
+        memcpy(joined + length, fields[i].data, fields[i].size);
+        length += fields[i].size;
+    }
+    joined[length] = '\0';
+
+    if (expected == NULL) {
+        TEST_ASSERT_EQUAL_size_t_MESSAGE(0, n, str);
+    } else {
+        TEST_ASSERT_TRUE_MESSAGE(n > 0, str);
+        TEST_ASSERT_EQUAL_STRING_MESSAGE(expected, joined, str);
+    }
+}
+
+static strider_tokenizer_t format(strider_tokenize_format_t f) {
+    strider_tokenizer_t tok;
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init_format(&tok, f));
+    return tok;
+}
+
+/* ========================================================================
+ * Settings
+ * ======================================================================== */
+
+void test_tokenizer_init_validates(void) {
+    strider_tokenizer_t tok;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&tok, ",", 1, '"', '\\', false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, ",", 0, '"', '\\', false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, NULL, 1, '"', '\\', false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, ",\"", 2, '"', -1, false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, ",\\", 2, -1, '\\', false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, ",", 1, '"', '"', false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init(&tok, ",", 1, 256, -1, false));
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&tok, ",", 1, -1, -1, false));
+    TEST_ASSERT_EQUAL_INT(-1, strider_tokenizer_init_format(&tok, (strider_tokenize_format_t) 99));
+}
+
+/* ========================================================================
+ * Splitting
+ * ======================================================================== */
+
+void test_split_by_space(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_WHITESPACE);
+
+    check_fields(&tok, "field1 field2 field3", MAX_FIELDS, "field1|field2|field3");
+    check_fields(&tok, "  a \t b   c  ", MAX_FIELDS, "a|b|c");
+    check_fields(&tok, "single", MAX_FIELDS, "single");
+    check_fields(&tok, "   ", MAX_FIELDS, NULL);
+    check_fields(&tok, "", MAX_FIELDS, NULL);
+}
+
+void test_split_by_comma(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_CSV);
+
+    check_fields(&tok, "a,b,c", MAX_FIELDS, "a|b|c");
+    check_fields(&tok, "1, 2 ,3", MAX_FIELDS, "1| 2 |3");
+    check_fields(&tok, "\"x,y\",z", MAX_FIELDS, "\"x,y\"|z");
+    check_fields(&tok, "\"say \"\"hi, there\"\"\",z", MAX_FIELDS, "\"say \"\"hi, there\"\"\"|z");
+}
+
+void test_split_by_pipe(void) {
+    strider_tokenizer_t tok;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&tok, "|", 1, -1, -1, false));
+    check_fields(&tok, "field1|field2|field3", MAX_FIELDS, "field1|field2|field3");
+    check_fields(&tok, "\"a|b\"", MAX_FIELDS, "\"a|b\"");
+}
+
+void test_split_quoted_fields(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_WHITESPACE);
+
+    check_fields(&tok, "field1 \"field 2\" field3", MAX_FIELDS, "field1|\"field 2\"|field3");
+    check_fields(&tok, "msg=\"a b c\" x", MAX_FIELDS, "msg=\"a b c\"|x");
+
+    /* An unterminated quote runs to the end of the line */
+    check_fields(&tok, "a \"b c", MAX_FIELDS, "a|\"b c");
+}
+
+void test_split_escaped_quotes(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_WHITESPACE);
+
+    check_fields(&tok, "\"a \\\" b\" c", MAX_FIELDS, "\"a \\\" b\"|c");
+    check_fields(&tok, "\"a \\\\\" b", MAX_FIELDS, "\"a \\\\\"|b");
+    check_fields(&tok, "a\\ b c", MAX_FIELDS, "a\\ b|c");
+    check_fields(&tok, "\\\"a b", MAX_FIELDS, "\\\"a|b");
+}
+
+void test_split_empty_fields(void) {
+    strider_tokenizer_t tok;
+
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&tok, "|", 1, -1, -1, false));
+    check_fields(&tok, "field1||field3", MAX_FIELDS, "field1||field3");
+    check_fields(&tok, "|", MAX_FIELDS, "|");
+    check_fields(&tok, "a|", MAX_FIELDS, "a|");
+
+    strider_buffer_view_t fields[4];
+    TEST_ASSERT_EQUAL_size_t(
+        3, strider_tokenize_simd(&tok, strider_buffer_view_from_cstr("||"), fields, 4));
+    TEST_ASSERT_EQUAL_size_t(0, fields[1].size);
+}
+
+void test_split_max_fields(void) {
+    strider_tokenizer_t csv = format(STRIDER_TOKENIZE_CSV);
+    strider_tokenizer_t ws = format(STRIDER_TOKENIZE_WHITESPACE);
+
+    /* The last field takes the rest of the line */
+    check_fields(&csv, "a,b,c,d", 2, "a|b,c,d");
+    check_fields(&csv, "a,b", 2, "a|b");
+    check_fields(&csv, "a,b", 1, "a,b");
+    check_fields(&csv, "a,b", 0, NULL);
+    check_fields(&ws, "a b  c d ", 2, "a|b  c d ");
+    check_fields(&ws, "a b  ", 2, "a|b");
+}
+
+void test_tokenize_zero_copy(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_CSV);
+    const char *line = "one,\"two\",three";
+    strider_buffer_view_t fields[3];
+
+    TEST_ASSERT_EQUAL_size_t(
+        3, strider_tokenize_simd(&tok, strider_buffer_view_from_cstr(line), fields, 3));
+    TEST_ASSERT_EQUAL_PTR(line, fields[0].data);
+    TEST_ASSERT_EQUAL_PTR(line + 4, fields[1].data);
+    TEST_ASSERT_EQUAL_PTR(line + 10, fields[2].data);
+
+    strider_buffer_view_t unquoted = strider_field_unquote(&tok, fields[1]);
+    TEST_ASSERT_EQUAL_PTR(line + 5, unquoted.data);
+    TEST_ASSERT_EQUAL_size_t(3, unquoted.size);
+    unquoted = strider_field_unquote(&tok, fields[0]);
+    TEST_ASSERT_EQUAL_size_t(3, unquoted.size);
+}
+
+/* ========================================================================
+ * Record Formats
+ * ======================================================================== */
+
+void test_tokenize_logfmt(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_LOGFMT);
+
+    check_fields(&tok, "level=info msg=\"disk a=b full\" took=12ms", MAX_FIELDS,
+                 "level|info|msg|\"disk a=b full\"|took|12ms");
+    check_fields(&tok, "ts=2025-12-31T23:59:59Z err=\"\"", MAX_FIELDS,
+                 "ts|2025-12-31T23:59:59Z|err|\"\"");
+}
+
+void test_tokenize_json(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_JSON);
+
+    check_fields(&tok, "{\"level\":\"error\",\"msg\":\"a, b: {c}\",\"n\":42}", MAX_FIELDS,
+                 "\"level\"|\"error\"|\"msg\"|\"a, b: {c}\"|\"n\"|42");
+    check_fields(&tok, "{\"q\": \"say \\\"hi\\\"\", \"ok\": [true, null]}", MAX_FIELDS,
+                 "\"q\"|\"say \\\"hi\\\"\"|\"ok\"|true|null");
+    check_fields(&tok, "{}", MAX_FIELDS, NULL);
+}
+
+void test_tokenize_long_lines(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_WHITESPACE);
+    char line[300];
+    char expected[300];
+
+    /* A quoted field spanning several 64-byte blocks */
+    memset(line, 'x', sizeof(line));
+    line[0] = 'a';
+    line[1] = ' ';
+    line[2] = '"';
+    for (size_t i = 10; i < 250; i += 10) {
+        line[i] = ' ';
+    }
+    line[250] = '"';
+    line[251] = ' ';
+    line[252] = 'z';
+    line[253] = '\0';
+    memcpy(expected, line, 254);
+    expected[1] = '|';
+    expected[251] = '|';
+    check_fields(&tok, line, MAX_FIELDS, expected);
+
+    /* Runs of escapes crossing a block boundary: an even run leaves the
+     * quote unescaped, so the rest of the line is quoted */
+    memset(line, '\\', 71);
+    memcpy(line + 70, "\" b", 4);
+    check_fields(&tok, line, MAX_FIELDS, line);
+    memcpy(line + 71, "\" b", 4);
+    memcpy(expected, line, 75);
+    expected[72] = '|';
+    check_fields(&tok, line, MAX_FIELDS, expected);
+}
+
+/* ========================================================================
+ * Batch Tokenization
+ * ======================================================================== */
+
+void test_tokenize_lines_batch(void) {
+    strider_tokenizer_t tok = format(STRIDER_TOKENIZE_CSV);
+    const char *text = "a,b\r\n"
+                       "\n"
+                       "\"c,d\",e,f\n"
+                       "g";
+    const size_t size = strlen(text);
+    size_t positions[4];
+    strider_field_span_t spans[16];
+    size_t index[5];
+
+    size_t count = strider_find_newline_positions(text, size, positions, 4);
+    TEST_ASSERT_EQUAL_size_t(3, count);
+    positions[count++] = size;
+
+    for (int simd = 0; simd < 2; simd++) {
+        size_t lines = simd ? strider_tokenize_lines_simd(&tok, text, size, positions, count,
+                                                          spans, 16, index)
+                            : strider_tokenize_lines(&tok, text, size, positions, count, spans,
+                                                     16, index);
+        TEST_ASSERT_EQUAL_size_t(4, lines);
+        TEST_ASSERT_EQUAL_size_t(0, index[0]);
+        TEST_ASSERT_EQUAL_size_t(2, index[1]);
+        TEST_ASSERT_EQUAL_size_t(2, index[2]);
+        TEST_ASSERT_EQUAL_size_t(5, index[3]);
+        TEST_ASSERT_EQUAL_size_t(6, index[4]);
+
+        /* Spans are relative to their line */
+        TEST_ASSERT_EQUAL_UINT32(2, spans[1].start);
+        TEST_ASSERT_EQUAL_UINT32(0, spans[2].start);
+        TEST_ASSERT_EQUAL_UINT32(5, spans[2].length);
+        TEST_ASSERT_EQUAL_UINT32(8, spans[4].start);
+        TEST_ASSERT_EQUAL_UINT32(0, spans[5].start);
+        TEST_ASSERT_EQUAL_UINT32(1, spans[5].length);
+
+        /* Stops before the first line that does not fit */
+        lines = simd ? strider_tokenize_lines_simd(&tok, text, size, positions, count, spans, 4,
+                                                   index)
+                     : strider_tokenize_lines(&tok, text, size, positions, count, spans, 4, index);
+        TEST_ASSERT_EQUAL_size_t(2, lines);
+        TEST_ASSERT_EQUAL_size_t(2, index[2]);
+    }
+}
+
+void test_tokenize_simd_matches_scalar(void) {
+    static const char alphabet[] = "ab ,=\t\"\\{}:x";
+    strider_tokenizer_t toks[5];
+    const size_t lines = 2000;
+    char *text = (char *) malloc(lines * 200);
+    size_t *positions = (size_t *) malloc(lines * sizeof(size_t));
+    strider_field_span_t *expected = (strider_field_span_t *) malloc(lines * 200 * 8);
+    strider_field_span_t *actual = (strider_field_span_t *) malloc(lines * 200 * 8);
+    size_t *expected_index = (size_t *) malloc((lines + 1) * sizeof(size_t));
+    size_t *actual_index = (size_t *) malloc((lines + 1) * sizeof(size_t));
+    size_t size = 0;
+    TEST_ASSERT_NOT_NULL(text);
+    TEST_ASSERT_NOT_NULL(positions);
+    TEST_ASSERT_NOT_NULL(expected);
+    TEST_ASSERT_NOT_NULL(actual);
+    TEST_ASSERT_NOT_NULL(expected_index);
+    TEST_ASSERT_NOT_NULL(actual_index);
+
+    for (int f = 0; f < 4; f++) {
+        toks[f] = format((strider_tokenize_format_t) f);
+    }
+    TEST_ASSERT_EQUAL_INT(0, strider_tokenizer_init(&toks[4], ",=", 2, '"', '\\', false));
+
+    /* Random lines of 0-199 bytes, dense in quotes, escapes and separators */
+    srand(1818);
+    for (size_t i = 0; i < lines; i++) {
+        const size_t length = (size_t) rand() % 200;
+        for (size_t j = 0; j < length; j++) {
+            text[size++] = alphabet[rand() % (int) (sizeof(alphabet) - 1)];
+        }
+        text[size++] = '\n';
+    }
+    TEST_ASSERT_EQUAL_size_t(lines, strider_find_newline_positions(text, size, positions, lines));
+
+    for (int t = 0; t < 5; t++) {
+        for (size_t capacity = 0; capacity <= lines * 200; capacity = capacity * 3 + 1000) {
+            size_t n = strider_tokenize_lines(&toks[t], text, size, positions, lines, expected,
+                                              capacity, expected_index);
+            size_t m = strider_tokenize_lines_simd(&toks[t], text, size, positions, lines, actual,
+                                                   capacity, actual_index);
+            TEST_ASSERT_EQUAL_size_t(n, m);
+            TEST_ASSERT_EQUAL_MEMORY(expected_index, actual_index, (n + 1) * sizeof(size_t));
+            if (expected_index[n] > 0) {
+                TEST_ASSERT_EQUAL_MEMORY(expected, actual,
+                                         expected_index[n] * sizeof(strider_field_span_t));
+            }
+        }
+    }
+
+    free(text);
+    free(positions);
+    free(expected);
+    free(actual);
+    free(expected_index);
+    free(actual_index);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_tokenizer_init_validates);
+    RUN_TEST(test_split_by_space);
+    RUN_TEST(test_split_by_comma);
+    RUN_TEST(test_split_by_pipe);
+    RUN_TEST(test_split_quoted_fields);
+    RUN_TEST(test_split_escaped_quotes);
+    RUN_TEST(test_split_empty_fields);
+    RUN_TEST(test_split_max_fields);
+    RUN_TEST(test_tokenize_zero_copy);
+    RUN_TEST(test_tokenize_logfmt);
+    RUN_TEST(test_tokenize_json);
+    RUN_TEST(test_tokenize_long_lines);
+    RUN_TEST(test_tokenize_lines_batch);
+    RUN_TEST(test_tokenize_simd_matches_scalar);
+
+    return UNITY_END();
+}
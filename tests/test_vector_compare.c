@@ -16,8 +16,10 @@
 /* Test data buffers */
 #if defined(_MSC_VER)
 #    define ALIGN_32 __declspec(align(32))
+#    define ALIGN_64 __declspec(align(64))
 #else
 #    define ALIGN_32 __attribute__((aligned(32)))
+#    define ALIGN_64 __attribute__((aligned(64)))
 #endif
 
 static ALIGN_32 uint8_t test_data_a[32];
@@ -135,6 +137,101 @@ void test_vec128_movemask_pattern(void) {
     TEST_ASSERT_EQUAL_UINT32(expected, mask);
 }
 
+/**
+ * Test: Nibble mask gives 4 bits per matching byte
+ */
+void test_vec128_nibble_mask(void) {
+    memset(test_data_a, 'x', 16);
+    test_data_a[3] = '\n';
+    test_data_a[9] = '\n';
+    test_data_a[15] = '\n';
+
+    strider_vec128_t vec = strider_vec128_load_aligned(test_data_a);
+    strider_vec128_t cmp = strider_vec128_cmpeq(vec, strider_vec128_set1('\n'));
+    uint64_t mask = strider_vec128_nibble_mask(cmp);
+
+    TEST_ASSERT_EQUAL_HEX64(0xF00000F00000F000ULL, mask);
+    TEST_ASSERT_EQUAL_INT(3, strider_ctz64(mask) / 4);
+    TEST_ASSERT_EQUAL_INT(3, strider_popcount64(mask) / 4);
+    TEST_ASSERT_EQUAL_HEX64(0, strider_vec128_nibble_mask(strider_vec128_zero()));
+}
+
+/**
+ * Test: Four-vector movemask matches four single movemasks
+ */
+void test_vec128_movemask64(void) {
+    static ALIGN_32 uint8_t bytes[64];
+    strider_vec128_t v[4];
+    uint64_t expected = 0;
+
+    /* Only the sign bit of each byte matters */
+    for (int i = 0; i < 64; i++) {
+        bytes[i] = (uint8_t) ((i * 37 + 11) & 0xFF);
+        if (bytes[i] & 0x80) {
+            expected |= (uint64_t) 1 << i;
+        }
+    }
+    for (int i = 0; i < 4; i++) {
+        v[i] = strider_vec128_load_aligned(bytes + 16 * i);
+    }
+
+    TEST_ASSERT_EQUAL_HEX64(expected, strider_vec128_movemask64(v[0], v[1], v[2], v[3]));
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_HEX32((uint32_t) (expected >> (16 * i)) & 0xFFFF,
+                                strider_vec128_movemask(v[i]));
+    }
+}
+
+/**
+ * Test: Signed greater-than treats bytes >= 0x80 as negative
+ */
+void test_vec128_cmpgt_i8(void) {
+    static const uint8_t a[16] = {1, 0, 5, 0x7F, 0x80, 0xFF, 0x00, 0x80,
+                                  2, 2, 3, 0x10, 0x81, 0xFE, 0x7F, 0x01};
+    static const uint8_t b[16] = {0, 1, 5, 0x80, 0x7F, 0x00, 0xFF, 0x80,
+                                  1, 3, 3, 0x0F, 0x80, 0xFF, 0x7E, 0xFF};
+    /* a > b at 0, 3, 6, 8, 11, 12, 14, 15 */
+    const uint32_t expected = (1u << 0) | (1u << 3) | (1u << 6) | (1u << 8) | (1u << 11) |
+                              (1u << 12) | (1u << 14) | (1u << 15);
+
+    strider_vec128_t result =
+        strider_vec128_cmpgt_i8(strider_vec128_load_unaligned(a), strider_vec128_load_unaligned(b));
+    TEST_ASSERT_EQUAL_HEX32(expected, strider_vec128_movemask(result));
+}
+
+/**
+ * Test: Range check agrees with a scalar check for every byte and for
+ * empty, single-byte and full ranges
+ */
+void test_vec128_in_range(void) {
+    static const uint8_t ranges[][2] = {
+        {'A', 'Z'}, {'0', '9'}, {0x00, 0x1F}, {0x80, 0xFF}, {0x00, 0xFF}, {'x', 'x'}, {'b', 'a'},
+    };
+    uint8_t bytes[256];
+
+    for (int i = 0; i < 256; i++) {
+        bytes[i] = (uint8_t) i;
+    }
+
+    for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+        const uint8_t lo = ranges[r][0];
+        const uint8_t hi = ranges[r][1];
+
+        for (int i = 0; i < 256; i += 16) {
+            strider_vec128_t v = strider_vec128_load_unaligned(bytes + i);
+            uint32_t mask = strider_vec128_movemask(strider_vec128_in_range(v, lo, hi));
+            uint32_t expected = 0;
+
+            for (int j = 0; j < 16; j++) {
+                if (bytes[i + j] >= lo && bytes[i + j] <= hi) {
+                    expected |= 1u << j;
+                }
+            }
+            TEST_ASSERT_EQUAL_HEX32(expected, mask);
+        }
+    }
+}
+
 /* ========================================================================
  * 256-bit Comparison Tests (AVX2 only)
  * ======================================================================== */
@@ -183,8 +280,88 @@ void test_vec256_movemask_zeros(void) {
     TEST_ASSERT_EQUAL_UINT32(0, mask);
 }
 
+/**
+ * Test: 256-bit range check covers both 128-bit halves
+ */
+void test_vec256_in_range(void) {
+    for (int i = 0; i < 32; i++) {
+        test_data_a[i] = (uint8_t) ('A' - 8 + i * 3);
+    }
+
+    strider_vec256_t v = strider_vec256_load_aligned(test_data_a);
+    uint32_t mask = strider_vec256_movemask(strider_vec256_in_range(v, 'A', 'Z'));
+    uint32_t expected = 0;
+
+    for (int i = 0; i < 32; i++) {
+        if (test_data_a[i] >= 'A' && test_data_a[i] <= 'Z') {
+            expected |= 1u << i;
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX32(expected, mask);
+
+    /* No byte is 0x80, so every byte is greater than -128 */
+    strider_vec256_t above = strider_vec256_cmpgt_i8(v, strider_vec256_set1(0x80));
+    TEST_ASSERT_EQUAL_HEX32(0xFFFFFFFF, strider_vec256_movemask(above));
+}
+
 #endif /* STRIDER_HAS_AVX2 */
 
+/* ========================================================================
+ * 512-bit Mask Comparison Tests
+ * ======================================================================== */
+
+/**
+ * Test: Mask of n low bits
+ */
+void test_mask64_low(void) {
+    TEST_ASSERT_EQUAL_UINT64(0, strider_mask64_low(0));
+    TEST_ASSERT_EQUAL_UINT64(0x7F, strider_mask64_low(7));
+    TEST_ASSERT_EQUAL_UINT64(0x7FFFFFFFFFFFFFFFULL, strider_mask64_low(63));
+    TEST_ASSERT_EQUAL_UINT64(0xFFFFFFFFFFFFFFFFULL, strider_mask64_low(64));
+}
+
+#if defined(STRIDER_HAS_AVX512BW)
+
+static ALIGN_64 uint8_t test_data_64[64];
+
+/**
+ * Test: 512-bit compare gives one mask bit per matching byte
+ */
+void test_vec512_cmpeq_mask(void) {
+    memset(test_data_64, 'x', sizeof(test_data_64));
+    test_data_64[0] = '\n';
+    test_data_64[31] = '\n';
+    test_data_64[63] = '\n';
+
+    strider_vec512_t data = strider_vec512_load_aligned(test_data_64);
+    uint64_t mask = strider_vec512_cmpeq_mask(data, strider_vec512_set1('\n'));
+
+    TEST_ASSERT_EQUAL_UINT64((1ULL << 0) | (1ULL << 31) | (1ULL << 63), mask);
+    TEST_ASSERT_EQUAL_UINT64(0, strider_vec512_cmpeq_mask(data, strider_vec512_zero()));
+}
+
+/**
+ * Test: Masked load zeroes the lanes outside the mask
+ */
+void test_vec512_load_masked(void) {
+    uint8_t out[64];
+
+    for (int i = 0; i < 64; i++) {
+        test_data_64[i] = (uint8_t) (i + 1);
+    }
+
+    strider_vec512_t data = strider_vec512_load_masked(test_data_64, strider_mask64_low(10));
+    strider_vec512_store_unaligned(out, data);
+
+    for (int i = 0; i < 64; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i < 10 ? i + 1 : 0, out[i]);
+    }
+    TEST_ASSERT_EQUAL_UINT64(strider_mask64_low(64) & ~strider_mask64_low(10),
+                             strider_vec512_cmpeq_mask(data, strider_vec512_zero()));
+}
+
+#endif /* STRIDER_HAS_AVX512BW */
+
 /* ========================================================================
  * Utility Tests
  * ======================================================================== */
@@ -226,6 +403,17 @@ void test_popcount(void) {
  * ======================================================================== */
 
 int main(void) {
+#if defined(STRIDER_TEST_REQUIRES_AVX2)
+    if (!strider_get_cpu_features().has_avx2) {
+        return 77; /* Skipped: built with AVX2 flags but CPU lacks AVX2 */
+    }
+#endif
+#if defined(STRIDER_TEST_REQUIRES_AVX512BW)
+    if (!strider_get_cpu_features().has_avx512bw) {
+        return 77; /* Skipped: built with AVX-512 flags but CPU lacks AVX-512BW */
+    }
+#endif
+
     UNITY_BEGIN();
 
     /* 128-bit comparison tests */
@@ -235,12 +423,24 @@ int main(void) {
     RUN_TEST(test_vec128_find_newline);
     RUN_TEST(test_vec128_movemask_all_zeros);
     RUN_TEST(test_vec128_movemask_pattern);
+    RUN_TEST(test_vec128_nibble_mask);
+    RUN_TEST(test_vec128_movemask64);
+    RUN_TEST(test_vec128_cmpgt_i8);
+    RUN_TEST(test_vec128_in_range);
 
 /* 256-bit comparison tests (AVX2 only) */
 #if defined(STRIDER_HAS_AVX2)
     RUN_TEST(test_vec256_cmpeq_equal_vectors);
     RUN_TEST(test_vec256_find_byte);
     RUN_TEST(test_vec256_movemask_zeros);
+    RUN_TEST(test_vec256_in_range);
+#endif
+
+    /* 512-bit mask comparison tests (AVX-512BW only) */
+    RUN_TEST(test_mask64_low);
+#if defined(STRIDER_HAS_AVX512BW)
+    RUN_TEST(test_vec512_cmpeq_mask);
+    RUN_TEST(test_vec512_load_masked);
 #endif
 
     /* Utility tests */
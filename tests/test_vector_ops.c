@@ -134,6 +134,73 @@ void test_vec128_store_unaligned(void) {
     }
 }
 
+/* ========================================================================
+ * Shuffle / Table Lookup Tests
+ * ======================================================================== */
+
+/**
+ * Test: 16-entry table lookup
+ * Expected: Byte i = table[indices[i]]
+ */
+void test_vec128_shuffle(void) {
+    static const uint8_t indices[16] = {15, 0, 7, 7, 1, 14, 2, 13, 3, 12, 4, 11, 5, 10, 6, 9};
+    strider_vec128_t table = strider_vec128_load_aligned(test_data_aligned + 16);
+    strider_vec128_t result = strider_vec128_shuffle(table, strider_vec128_load_unaligned(indices));
+
+    strider_vec128_store_aligned(output_buffer, result);
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL_UINT8(16 + indices[i], output_buffer[i]);
+    }
+}
+
+/**
+ * Test: High nibble extraction
+ * Expected: Byte i = input[i] >> 4, including bytes >= 0x80
+ */
+void test_vec128_high_nibble(void) {
+    static const uint8_t input[16] = {0x00, 0x0F, 0x10, 0x2A, 0x7F, 0x80, 0x9C, 0xFF,
+                                      0x3D, 0x45, 0x5B, 0x61, 0xA0, 0xB7, 0xC8, 0xE3};
+    strider_vec128_t vec = strider_vec128_load_unaligned(input);
+
+    strider_vec128_store_aligned(output_buffer, strider_vec128_high_nibble(vec));
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL_UINT8(input[i] >> 4, output_buffer[i]);
+    }
+}
+
+/**
+ * Test: Bytes shifted in from the previous vector
+ * Expected: Byte i = concatenation (prev, cur)[16 + i - n]
+ */
+void test_vec128_prev(void) {
+    strider_vec128_t prev = strider_vec128_load_aligned(test_data_aligned);
+    strider_vec128_t cur = strider_vec128_load_aligned(test_data_aligned + 16);
+
+    for (int n = 1; n <= 3; n++) {
+        strider_vec128_store_aligned(output_buffer, strider_vec128_prev(prev, cur, n));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(test_data_aligned + 16 - n, output_buffer, 16);
+    }
+}
+
+/**
+ * Test: Saturating unsigned subtraction
+ * Expected: Byte i = max(a[i] - b[i], 0)
+ */
+void test_vec128_subs_u8(void) {
+    static const uint8_t a[16] = {0, 1, 2, 0x7F, 0x80, 0xC0, 0xE0, 0xFF,
+                                  5, 5, 5, 0x9F, 0xA0, 0xEF, 0xF0, 0xF4};
+    strider_vec128_t result =
+        strider_vec128_subs_u8(strider_vec128_load_unaligned(a), strider_vec128_set1(0x60));
+
+    strider_vec128_store_aligned(output_buffer, result);
+
+    for (int i = 0; i < 16; i++) {
+        TEST_ASSERT_EQUAL_UINT8(a[i] > 0x60 ? a[i] - 0x60 : 0, output_buffer[i]);
+    }
+}
+
 /* ========================================================================
  * 256-bit Vector Tests (if AVX2 available)
  * ======================================================================== */
@@ -187,6 +254,45 @@ void test_vec256_zero(void) {
     TEST_PASS_MESSAGE("AVX2 not available, test skipped");
 #    endif
 }
+
+/**
+ * Test: 256-bit previous-byte shift crosses the 128-bit lanes
+ */
+void test_vec256_prev(void) {
+    static ALIGN_32 uint8_t data[64];
+
+    for (int i = 0; i < 64; i++) {
+        data[i] = (uint8_t) (100 + i);
+    }
+    strider_vec256_t prev = strider_vec256_load_aligned(data);
+    strider_vec256_t cur = strider_vec256_load_aligned(data + 32);
+
+    for (int n = 1; n <= 3; n++) {
+        strider_vec256_store_aligned(output_buffer, strider_vec256_prev(prev, cur, n));
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(data + 32 - n, output_buffer, 32);
+    }
+}
+
+/**
+ * Test: 256-bit lookup with a broadcast 16-entry table
+ * Expected: Both halves index the same table
+ */
+void test_vec256_shuffle_broadcast(void) {
+    uint8_t indices[32];
+
+    for (int i = 0; i < 32; i++) {
+        indices[i] = (uint8_t) ((i * 7) & 0x0F);
+    }
+
+    strider_vec128_t table = strider_vec128_load_aligned(test_data_aligned + 16);
+    strider_vec256_t result = strider_vec256_shuffle(strider_vec256_broadcast128(table),
+                                                     strider_vec256_load_unaligned(indices));
+    strider_vec256_store_aligned(output_buffer, result);
+
+    for (int i = 0; i < 32; i++) {
+        TEST_ASSERT_EQUAL_UINT8(16 + indices[i], output_buffer[i]);
+    }
+}
 #endif
 
 /* ========================================================================
@@ -207,6 +313,12 @@ void test_is_aligned(void) {
 }
 
 int main(void) {
+#if defined(STRIDER_TEST_REQUIRES_AVX2)
+    if (!strider_get_cpu_features().has_avx2) {
+        return 77; /* Skipped: built with AVX2 flags but CPU lacks AVX2 */
+    }
+#endif
+
     UNITY_BEGIN();
 
     /* 128-bit vector tests (always available) */
@@ -216,12 +328,18 @@ int main(void) {
     RUN_TEST(test_vec128_zero);
     RUN_TEST(test_vec128_store_aligned);
     RUN_TEST(test_vec128_store_unaligned);
+    RUN_TEST(test_vec128_shuffle);
+    RUN_TEST(test_vec128_high_nibble);
+    RUN_TEST(test_vec128_prev);
+    RUN_TEST(test_vec128_subs_u8);
 
 /* 256-bit vector tests (AVX2) */
 #if defined(STRIDER_HAS_AVX2) || !defined(STRIDER_ARCH_X86_64)
     RUN_TEST(test_vec256_load_aligned);
     RUN_TEST(test_vec256_set1);
     RUN_TEST(test_vec256_zero);
+    RUN_TEST(test_vec256_prev);
+    RUN_TEST(test_vec256_shuffle_broadcast);
 #endif
 
     /* Alignment helpers */